@@ -26,6 +26,36 @@
       'msvs_settings': {
         'VCCLCompilerTool': { 'ExceptionHandling': 1 },
       }
+    },
+    {
+      'target_name': 'opt-in-features',
+      # The same engine with the opt-in port options turned on, which the
+      # end-to-end tests also run against (see microvium_port_test.h)
+      'defines': [ 'MVM_TEST_OPT_IN_FEATURES=1' ],
+      'sources': [
+        'native-vm-bindings/index.cc',
+        'native-vm-bindings/NativeVM.cc',
+        'native-vm-bindings/Value.cc',
+        'native-vm-bindings/misc.cc',
+        'native-vm-bindings/WeakRef.cc',
+        'native-vm-bindings/error_descriptions.cc',
+        'native-vm/microvium.c'
+      ],
+      'include_dirs': [
+        "<!@(node -p \"require('node-addon-api').include\")",
+        "native-vm-bindings"
+      ],
+      'dependencies': ["<!(node -p \"require('node-addon-api').gyp\")"],
+      'cflags!': [ '-fno-exceptions' ],
+      'cflags_cc!': [ '-fno-exceptions' ],
+      'xcode_settings': {
+        'GCC_ENABLE_CPP_EXCEPTIONS': 'YES',
+        'CLANG_CXX_LIBRARY': 'libc++',
+        'MACOSX_DEPLOYMENT_TARGET': '10.7'
+      },
+      'msvs_settings': {
+        'VCCLCompilerTool': { 'ExceptionHandling': 1 },
+      }
     }
   ]
 }
\ No newline at end of file
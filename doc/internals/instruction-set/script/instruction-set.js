@@ -42,6 +42,156 @@ exports.additionalBeginningSections = [{
       2. (Optional) Perform static analysis and produce {IL + static information}
       3. Emit bytecode from the {IL + optional static information}
   `
+}, {
+  title: 'Superinstructions',
+  content: `
+    A superinstruction is a single bytecode instruction that performs the work
+    of a common sequence of IL operations. They save dispatches in the
+    interpreter and sometimes bytecode space. The bytecode emitter selects
+    them with a peephole pass over adjacent operations in the same block, and
+    the bytecode decoder expands them back to the original IL operations, so
+    they are invisible at the IL level.
+
+    The candidates were chosen by running the end-to-end test scripts in the
+    TypeScript VM, which executes the IL directly, and counting each sequence
+    of operations executed one after another in the same block (a \`Call\` is
+    followed by the operation after it once the callee returns). The counts
+    come from \`scripts/count-il-sequences.ts\`. The scripts executed 287,560
+    IL operations in total, and the most frequent sequences were:
+
+    | Sequence                                         | Count |
+    | ------------------------------------------------ | ----- |
+    | LoadVar, StoreVar, Pop                           | 24301 |
+    | LoadVar, Literal(int14), BinOp(+)                | 16313 |
+    | LoadVar, Literal(int14), BinOp(<), Branch        |  8052 |
+    | LoadVar, LoadVar, BinOp(+)                       |  8024 |
+    | LoadGlobal, Literal(undefined)                   |  5040 |
+    | Call, Return                                     |  4151 |
+    | LoadArg, Literal(int14), BinOp(-)                |  4009 |
+    | LoadArg, Literal(int14), BinOp(<=), Branch       |  2013 |
+    | Literal(string), ObjectGet                       |   410 |
+    | LoadVar, Literal(string), ObjectGet              |   249 |
+
+    The counts are dominated by the loops in a few of the scripts, so they
+    were also checked against the scripts that aren't loop-heavy, where
+    \`LoadGlobal, Literal(undefined)\` is the most frequent pair and
+    \`Literal, ObjectGet\` is among the most frequent.
+
+    \`LoadVar, StoreVar, Pop\` is an assignment used as a statement, which
+    stores a copy of the value and then pops the original. It's not fused,
+    since a store-and-pop instruction would need an extended opcode that makes
+    it larger than the unfused sequence.
+
+    The superinstructions are:
+
+      - \`LoadVar(a)\`, \`LoadVar(b)\`, \`BinOp\` is emitted as
+        \`VM_OP4_VAR_NUM_OP\`, and \`LoadVar(a)\`, \`Literal(n)\`, \`BinOp\`
+        as \`VM_OP4_VAR_LIT_NUM_OP\` where \`n\` is an integer in the range
+        -128 to 127. The payload is the full instruction byte of the binary
+        \`VM_OP_NUM_OP\` or \`VM_OP_BIT_OP\` for the operation, followed by
+        the 8-bit slot of the left operand and the 8-bit slot or signed literal
+        of the right operand. Unlike \`LOAD_VAR\`, the slots are relative to
+        the frame base rather than the top of the stack, which is the same as
+        the IL variable index. \`BinOp(+)\` is only selected where
+        \`VM_NUM_OP_ADD_NUM\` would be (see Type Specialization), and
+        polymorphic operations such as \`===\` are not covered.
+
+        When both operands are int14 and the result is an int14 or a boolean,
+        the engine also looks at the next instruction. If it's a
+        \`STORE_VAR_1\`, the result is written straight to the variable, so
+        \`i = i + 1\` is one dispatch rather than four. If it's a
+        \`BRANCH_1\`, the branch is taken or not straight away, which covers
+        the \`LoadVar, Literal, BinOp(<), Branch\` condition of a counting
+        loop with a small bound. The store or branch is still a real
+        instruction in the bytecode, and is executed normally in every other
+        case, including when the gas counter or breakpoints are active.
+        Operands that are not int14 are handed to the same implementation as
+        the stack instruction, so the choice only affects performance.
+      - \`LoadGlobal\` + \`Literal(undefined)\` is emitted as
+        \`VM_OP3_LOAD_GLOBAL_CALLEE\` (3 bytes instead of 4). This is how every
+        call to a global function begins: the callee followed by \`this\`.
+      - \`Literal\` + \`ObjectGet\` is emitted as \`VM_OP3_OBJECT_GET_2\` (3 bytes
+        instead of 4) when the literal key does not have a 1-byte form. This is
+        any property access with a constant key, such as \`o.x\`.
+      - \`Call\` + \`Return\` is emitted as \`VM_OP4_TAIL_CALL\`, which
+        replaces the current frame rather than returning to it.
+      - \`BinOp(<)\` or \`BinOp(<=)\` + \`Branch\` is emitted as
+        \`VM_OP2_BRANCH_LESS_THAN_1\` or \`VM_OP2_BRANCH_LESS_EQUAL_1\` when
+        type inference allows it (see the next section) and the comparison
+        hasn't already been fused into one of the variable instructions above.
+
+    The new opcodes use the free slots in the existing opcode ranges or are
+    appended to the Ex-4 range, so the opcode values of existing instructions
+    are unchanged. \`VM_OP3_LOAD_GLOBAL_CALLEE\` takes the free slot before
+    \`VM_OP3_DIVIDER_1\`, so unlike its neighbors it reads its own operand.
+
+    The remaining sequences are not fused. The \`LoadArg\` sequences come from
+    a single recursive function in one script and would need another pair of
+    Ex-4 instructions. \`LoadVar, Literal, ObjectGet\` is rare at run time,
+    and the \`Literal, ObjectGet\` part of it is already fused.
+
+    The gas counter charges a superinstruction for each of the operations it
+    was selected from, so the count seen by \`mvm_stopAfterNInstructions\` is
+    the same whether or not a sequence is fused. If the remaining count
+    doesn't cover the whole sequence, the VM stops before running any of it.
+  `
+}, {
+  title: 'Type Specialization',
+  content: `
+    Before emitting the bytecode for a function, the bytecode emitter runs a
+    flow analysis over its IL (\`lib/infer-types.ts\`) which tracks, for each
+    stack slot, whether it definitely holds a number or an integer. Local
+    variables live in stack slots, so this covers loop counters and
+    accumulators. Values that come from arguments, globals, closures, property
+    reads or calls are not analyzed and are treated as unknown. Functions that
+    use \`try\` or \`await\` are not analyzed at all.
+
+    The result is used to choose more specific instructions:
+
+      - \`BinOp(+)\` where neither operand can be a string is emitted as
+        \`VM_NUM_OP_ADD_NUM\` instead of \`VM_OP1_ADD\`, which skips the
+        string concatenation checks. This relies on the analysis being sound:
+        it only applies when both operands are definitely numbers.
+      - \`BinOp(<)\` and \`BinOp(<=)\` followed by a \`Branch\`, where both
+        operands are inferred to be integers, are fused into a single
+        compare-and-branch instruction. The engine checks for int14 operands
+        first and compares them directly, but falls back to the same general
+        number comparison as \`VM_OP_NUM_OP\` for anything else, so this choice
+        only affects performance and not behavior.
+  `
+}, {
+  title: 'Gas Metering',
+  content: `
+    By default, an engine compiled with \`MVM_GAS_COUNTER\` checks and
+    decrements the count set by \`mvm_stopAfterNInstructions\` before every
+    instruction. With \`MVM_GAS_PER_BLOCK\`, the check is instead done once
+    per basic block by a \`VM_OP4_GAS\` instruction, which the bytecode
+    emitter puts at the start of each IL block when the snapshot is created
+    with the \`gasMetering\` option (feature flag \`FF_GAS_METERING\`). Its
+    8-bit operand is the number of bytecode instructions up to the next
+    \`VM_OP4_GAS\`, not counting the \`VM_OP4_GAS\` itself, and counting
+    each superinstruction as the number of operations it replaces. A block of
+    more than 255 instructions starts with more than one.
+
+    So that instructions that don't run are not charged, a block is split into
+    segments that each start with a \`VM_OP4_GAS\`. A segment ends after any
+    instruction that can leave the block early: a call or \`VM_OP1_NEW\`,
+    which may throw to a catch block, and \`VM_OP4_ARRAY_ITER_NEXT\`, which
+    jumps when the iterator is done. A new segment also starts after
+    \`VM_OP3_ASYNC_RESUME\`, so that the continuation of an async function
+    is charged when it runs. The \`JUMP\` that follows a \`BRANCH\` is
+    preceded by its own \`VM_OP4_GAS(1)\`, since it doesn't run when the
+    branch is taken.
+
+    If the remaining count is less than the cost of a segment, the VM stops
+    before running any of it, so the count remains exact at segment boundaries.
+    The only instructions charged without running are the rest of a segment
+    that is cut short by an error that ends the call.
+
+    \`VM_OP4_GAS\` does not appear in the IL. The decoder skips it, and the
+    encoder adds it again if the snapshot has the flag. An engine compiled
+    without \`MVM_GAS_PER_BLOCK\` skips over it as a no-op.
+  `
 }];
 
 exports.instructionSetDocumentation = {
@@ -383,6 +533,24 @@ exports.instructionSetDocumentation = {
       For CALLs where the argument count and target are known, but the combination
       of target + argument count are only used up to 3 times in the application,
       a \`VM_OP_CALL_5\` call may be more efficient.
+
+      ### Tail Calls
+
+      A dynamic call followed immediately by a [Return](#Return) is how
+      \`return f(...)\` compiles, and the bytecode emitter fuses the pair into
+      \`VM_OP4_TAIL_CALL\`. Instead of saving the registers on top of the
+      current frame, the engine first pops the current frame as if returning,
+      moves the function and arguments down into the space where the current
+      frame's own function and arguments were, and then performs the call from
+      the caller's frame with the current frame's return address. The callee
+      inherits the \`AF_VOID_CALLED\` and \`AF_CALLED_FROM_HOST\` flags of the
+      frame it replaces, so its result goes directly to the original caller.
+
+      This means a chain of tail calls, such as a tail-recursive function or
+      state machine handlers that return the result of the next handler, runs
+      in constant stack space. The fused pair never occurs inside a \`try\`
+      block, because a \`return\` from a \`try\` block is preceded by
+      \`EndTry\`.
     `,
     literalOperands: [{
       name: 'argumentCount',
@@ -474,6 +642,16 @@ exports.instructionSetDocumentation = {
         type: 'UInt8',
         description: 'Argument count'
       }]
+    }, {
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_TAIL_CALL',
+      description: 'A `VM_OP2_CALL_3` followed by a `Return`, where the callee replaces the current frame (see [Tail Calls](#tail-calls)).' +
+        '\n\nWhen using this form, the function reference MUST be pushed onto the stack.',
+      payloads: [{
+        name: 'argCount',
+        type: 'UInt8',
+        description: 'Argument count'
+      }]
     }, {
       category: 'vm_TeOpcode',
       op: 'VM_OP_CALL_5',
@@ -652,6 +830,13 @@ exports.instructionSetDocumentation = {
       5th variable slot in the current scope but \`StoreScoped(5)\` accesses the
       first slot of the parent scope, etc.
 
+      When the compiler knows that the slot is in an outer scope at a small
+      depth, it emits \`VM_OP4_STORE_SCOPED_OUTER\` instead, which names the
+      scope by its depth in the chain and the slot by its index in that scope.
+      The engine remembers the scope chain of the most recently used closure
+      (see \`MVM_SCOPE_CACHE_SIZE\`), so repeated accesses from the same
+      closure don't walk the chain.
+
       See also [ScopePush](#ScopePush), [LoadScoped](#LoadScoped).
     `,
     literalOperands: [{
@@ -692,6 +877,19 @@ exports.instructionSetDocumentation = {
         type: 'UInt16',
         description: 'The index of the closure-scoped slot to access'
       }]
+    }, {
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_STORE_SCOPED_OUTER',
+      description: 'Accesses a slot in an outer scope, 1 to 15 scopes up the chain.',
+      payloads: [{
+        name: 'depthAndIndex',
+        type: 'UInt8',
+        description: 'The scope depth in the high nibble and the slot index within that scope in the low nibble'
+      }, {
+        name: 'index',
+        type: 'UInt8',
+        description: 'The relative index of the slot, as for the other forms. The engine skips it; it is there so that the bytecode can be decoded back to IL.'
+      }]
     }]
   },
   /* ----------------------------------------------------------------------- */
@@ -708,6 +906,13 @@ exports.instructionSetDocumentation = {
       5th variable slot in the current scope but \`LoadScoped(5)\` accesses the
       first slot of the parent scope, etc.
 
+      When the compiler knows that the slot is in an outer scope at a small
+      depth, it emits \`VM_OP4_LOAD_SCOPED_OUTER\` instead, which names the
+      scope by its depth in the chain and the slot by its index in that scope.
+      The engine remembers the scope chain of the most recently used closure
+      (see \`MVM_SCOPE_CACHE_SIZE\`), so repeated accesses from the same
+      closure don't walk the chain.
+
       See also [ScopePush](#ScopePush), [StoreScoped](#StoreScoped).
     `,
     literalOperands: [{
@@ -748,6 +953,19 @@ exports.instructionSetDocumentation = {
         type: 'UInt16',
         description: 'The index of the closure-scoped slot to access'
       }]
+    }, {
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_LOAD_SCOPED_OUTER',
+      description: 'Accesses a slot in an outer scope, 1 to 15 scopes up the chain.',
+      payloads: [{
+        name: 'depthAndIndex',
+        type: 'UInt8',
+        description: 'The scope depth in the high nibble and the slot index within that scope in the low nibble'
+      }, {
+        name: 'index',
+        type: 'UInt8',
+        description: 'The relative index of the slot, as for the other forms. The engine skips it; it is there so that the bytecode can be decoded back to IL.'
+      }]
     }]
   },
   /* ----------------------------------------------------------------------- */
@@ -813,4 +1031,143 @@ exports.instructionSetDocumentation = {
     }]
   },
   /* ----------------------------------------------------------------------- */
+  ['IterStart']: {
+    description: 'Starts iterating the array at the top of the stack, for a `for..of` loop',
+    longDescription: `
+      Leaves the array on the stack and pushes the index of the first element,
+      so the top two values are then the cursor that
+      [IterNext](#IterNext) advances. The cursor stays on the stack for the
+      whole loop, below the loop variable.
+
+      Microvium doesn't implement the iterator protocol, so iterating anything
+      other than an array is a \`TypeError\`.
+    `,
+    literalOperands: [],
+    poppedArgs: [],
+    pushedResults: [{
+      label: 'index',
+      type: 'Number',
+      description: 'The index of the next element (0)'
+    }],
+    bytecodeRepresentations: [{
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_ARRAY_ITER_START',
+      description: '',
+      payloads: []
+    }]
+  },
+  /* ----------------------------------------------------------------------- */
+  ['IterNext']: {
+    description: 'Pushes the next element of an array being iterated, or jumps if there are no more',
+    longDescription: `
+      The array and the index of the next element (see
+      [IterStart](#IterStart)) must be at the top of the stack. If the index
+      is less than the current length of the array, this increments the index
+      in place and pushes the element (holes are \`undefined\`). Otherwise, it
+      pushes \`undefined\` and jumps to the given block, so the stack depth is
+      the same on both paths.
+
+      The length is read on each iteration, so elements that the loop body
+      pushes to the array are also visited.
+
+      Nothing may be pushed between the cursor and this instruction, so the
+      compiler emits it before entering the scope of the loop variable, and
+      the pushed element is the slot of the loop variable (or is moved into
+      the closure scope). The bytecode verifier rejects any other layout.
+    `,
+    literalOperands: [{
+      name: 'doneTarget',
+      type: 'Label',
+      description: 'Block to jump to when there are no more elements'
+    }],
+    poppedArgs: [],
+    pushedResults: [{
+      label: 'element',
+      type: 'any',
+      description: 'The next element, or `undefined` if there are no more'
+    }],
+    bytecodeRepresentations: [{
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_ARRAY_ITER_NEXT',
+      description: '',
+      payloads: [{
+        name: 'offset',
+        type: 'SInt16',
+        description: 'Amount to offset the program counter by when there are no more elements, relative to the end of the instruction'
+      }]
+    }]
+  },
+  /* ----------------------------------------------------------------------- */
+  ['Switch']: {
+    description: 'Jumps to the block of the case matching the discriminant, or to the default block',
+    longDescription: `
+      The compiler emits this for a \`switch\` statement whose case labels are
+      all distinct integer literals in the int14 range, when there are at
+      least 3 and at most 255 of them. Other switch statements are compiled to
+      a chain of \`===\` comparisons.
+
+      The discriminant is peeked and not popped, so it is still on the stack
+      at the target block (the break block of the switch pops it). A
+      discriminant that is not an integer number never matches a case. \`-0\`
+      matches case \`0\`, as it would with \`===\`.
+
+      The emitter chooses a jump table when at least half of the values in the
+      range from the lowest to the highest case are cases, and a sorted lookup
+      table otherwise.
+
+      Note: target labels must reference blocks in the same function as the
+      switch instruction
+    `,
+    literalOperands: [{
+      name: 'defaultTarget',
+      type: 'Label',
+      description: 'Block to jump to if no case matches'
+    }, {
+      name: 'cases',
+      type: 'Cases',
+      description: 'List of case values and the block to jump to for each'
+    }],
+    poppedArgs: [],
+    pushedResults: [],
+    bytecodeRepresentations: [{
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_TABLE_SWITCH',
+      description: 'Jumps through a table indexed by the discriminant minus the lowest case value. Values in the gaps between cases have the default offset in the table.',
+      payloads: [{
+        name: 'low',
+        type: 'SInt16',
+        description: 'The lowest case value'
+      }, {
+        name: 'count',
+        type: 'UInt8',
+        description: 'The number of entries in the table'
+      }, {
+        name: 'defaultOffset',
+        type: 'SInt16',
+        description: 'Offset to jump by if no entry matches, relative to the end of the instruction'
+      }, {
+        name: 'entries',
+        type: 'SInt16[count]',
+        description: 'Offset to jump by for each value from `low` to `low + count - 1`, relative to the end of the instruction'
+      }]
+    }, {
+      category: 'vm_TeOpcodeEx4',
+      op: 'VM_OP4_LOOKUP_SWITCH',
+      description: 'Binary-searches a table of case values sorted in ascending order.',
+      payloads: [{
+        name: 'count',
+        type: 'UInt8',
+        description: 'The number of cases'
+      }, {
+        name: 'defaultOffset',
+        type: 'SInt16',
+        description: 'Offset to jump by if no case matches, relative to the end of the instruction'
+      }, {
+        name: 'cases',
+        type: '{ value: SInt16, offset: SInt16 }[count]',
+        description: 'Each case value and the offset to jump by if it matches, relative to the end of the instruction'
+      }]
+    }]
+  },
+  /* ----------------------------------------------------------------------- */
 };
\ No newline at end of file
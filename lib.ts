@@ -10,17 +10,22 @@ import { nodeStyleImporter } from "./lib/node-style-importer";
 import path from 'path';
 import { microviumDir } from "./lib/microvium-dir";
 import { decodeSnapshot } from './lib/decode-snapshot';
+import { generateNativeC } from './lib/generate-native-c';
 
 export { ExportID, HostFunctionID } from './lib/il';
 export { SnapshotIL } from './lib/snapshot-il';
 export { ModuleOptions } from './lib/node-style-importer';
 export * as IL from './lib/il';
-export { decodeSnapshot };
+export { decodeSnapshot, generateNativeC };
 
 export type ModuleSpecifier = string; // The string passed to `require` or `import`
 export type ModuleSourceText = string; // Source code for a module
 export type ModuleObject = Record<string, any>;
-export type Snapshot = { readonly data: Buffer };
+export type Snapshot = {
+  readonly data: Buffer;
+  // Bytecode offsets of the functions marked by the `nativeFunctions` option
+  readonly nativeFunctions?: ReadonlyMap<string, number>;
+};
 export type HostImportFunction = (hostFunctionID: IL.HostFunctionID) => Function;
 export type HostImportTable = Record<IL.HostFunctionID, Function>;
 export type HostImportMap = HostImportTable | HostImportFunction;
@@ -159,6 +164,20 @@ export interface SnapshottingOptions {
   outputSnapshotIL?: boolean;
   snapshotILFilename?: string;
   generateSourceMap?: boolean;
+  // If true, objects in the snapshot that have the same keys share a single
+  // copy of the keys in ROM (a "shape"), and hold only their values in RAM. The
+  // native engine must be compiled with MVM_SHAPED_OBJECTS to run the snapshot.
+  shapedObjects?: boolean;
+  // If true, the bytecode charges the gas counter (`mvm_stopAfterNInstructions`)
+  // once at the start of each basic block. The native engine must be compiled
+  // with MVM_GAS_PER_BLOCK to make use of it, and requires it in that case.
+  gasMetering?: boolean;
+  // Functions to compile ahead of time to C, by their ID in the snapshot IL, or
+  // 'all'. The functions are marked in the bytecode, and `generateNativeC`
+  // produces the C for them. The native engine runs them natively if it's
+  // compiled with MVM_AOT and given the generated table, and interprets them
+  // otherwise.
+  nativeFunctions?: 'all' | string[];
 }
 
 export interface ModuleSource {
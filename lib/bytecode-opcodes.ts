@@ -171,8 +171,10 @@ export enum vm_TeOpcodeEx2 {
   VM_OP2_STORE_ARG           = 0x1, // (+ 8-bit unsigned arg index)
   VM_OP2_STORE_SCOPED_2      = 0x2, // (+ 8-bit unsigned scoped variable index)
   VM_OP2_STORE_VAR_2         = 0x3, // (+ 8-bit unsigned variable index relative to stack pointer)
-  VM_OP2_ARRAY_GET_2_RESERVED = 0x4, // (+ 8-bit unsigned field index)
-  VM_OP2_ARRAY_SET_2_RESERVED = 0x5, // (+ 8-bit unsigned field index)
+
+  // Fused `NUM_OP` comparison and `BRANCH_1`. (number, number) -> void
+  VM_OP2_BRANCH_LESS_THAN_1  = 0x4, // (+ 8-bit signed offset)
+  VM_OP2_BRANCH_LESS_EQUAL_1 = 0x5, // (+ 8-bit signed offset)
 
   VM_OP2_DIVIDER_1, // <-- ops before this point pop from the stack into reg2
 
@@ -203,7 +205,11 @@ export enum vm_TeOpcodeEx3 {
   VM_OP3_AWAIT_CALL          = 0x4, // (+ 8-bit arg count)
   VM_OP3_ASYNC_RESUME        = 0x5, // (+ 8-bit stack restoration slot count)
 
-  VM_OP3_RESERVED_3          = 0x6,
+  // Superinstruction: LOAD_GLOBAL_3 followed by LOAD_SMALL_LITERAL(undefined),
+  // which is how a call to a global function starts (the callee and `this`).
+  // This is before DIVIDER_1 only because it takes the free opcode, so it
+  // reads its own 16-bit operand.
+  VM_OP3_LOAD_GLOBAL_CALLEE  = 0x6, // (+ 16-bit global variable index)
 
   VM_OP3_DIVIDER_1, // <-- ops before this point are miscellaneous and don't automatically get any literal values or stack values
 
@@ -218,6 +224,8 @@ export enum vm_TeOpcodeEx3 {
   VM_OP3_STORE_GLOBAL_3      = 0xC, // (+ 16-bit global variable index)
   VM_OP3_STORE_SCOPED_3      = 0xD, // (+ 16-bit scoped variable index)
 
+  // Superinstruction: LOAD_LITERAL followed by OBJECT_GET_1. The object is
+  // replaced on the stack by the property value.
   VM_OP3_OBJECT_GET_2        = 0xE, // (+ 16-bit property key)
   VM_OP3_OBJECT_SET_2        = 0xF, // (+ 16-bit property key)
 
@@ -247,6 +255,44 @@ export enum vm_TeOpcodeEx4 {
   VM_OP4_ENQUEUE_JOB         = 0x0C, // (No literal operands)
   VM_OP4_ASYNC_COMPLETE      = 0x0D, // (No literal operands)
 
+  // Superinstruction: CALL_3 followed by RETURN, for `return f(...)`. The
+  // callee replaces the current frame rather than being called from it.
+  VM_OP4_TAIL_CALL           = 0x0E, // (+ 8-bit unsigned arg count. Target is dynamic)
+
+  // Emitted at the start of each basic block when the snapshot is compiled
+  // with gas metering (see MVM_GAS_PER_BLOCK)
+  VM_OP4_GAS                 = 0x0F, // (+ 8-bit unsigned instruction count)
+
+  // Closure variable access by the depth of the scope in the scope chain and
+  // the slot index in that scope, rather than by the relative index of
+  // LOAD_SCOPED/STORE_SCOPED (see vm_findOuterScope)
+  VM_OP4_LOAD_SCOPED_OUTER   = 0x10, // (+ 4-bit depth and 4-bit index, + 8-bit relative index)
+  VM_OP4_STORE_SCOPED_OUTER  = 0x11, // (+ 4-bit depth and 4-bit index, + 8-bit relative index)
+
+  // Multi-way branch on the int14 value at the top of the stack, which is left
+  // on the stack. Jump offsets are relative to the end of the instruction,
+  // including the table.
+  VM_OP4_TABLE_SWITCH        = 0x12, // (+ 16-bit signed lowest case value, 8-bit entry count, 16-bit default offset, and a 16-bit offset per entry)
+  VM_OP4_LOOKUP_SWITCH       = 0x13, // (+ 8-bit case count, 16-bit default offset, and a 16-bit case value and 16-bit offset per case, in ascending order of value)
+
+  // Array iteration, for `for..of` loops. ARRAY_ITER_START checks that the
+  // value at the top of the stack is an array and pushes the index of the
+  // first element after it, and the pair is then the cursor for
+  // ARRAY_ITER_NEXT. ARRAY_ITER_NEXT pushes the next element and advances the
+  // cursor, or pushes `undefined` and jumps if there are no more elements.
+  VM_OP4_ARRAY_ITER_START    = 0x14, // (no literal operands)
+  VM_OP4_ARRAY_ITER_NEXT     = 0x15, // (+ 16-bit signed offset to jump by when the array is exhausted)
+
+  // Superinstructions for LoadVar+LoadVar+BinOp and LoadVar+Literal+BinOp,
+  // which read their operands directly from variable slots in the current
+  // frame rather than from the top of the stack. The operation is given as the
+  // full instruction byte of the equivalent binary VM_OP_NUM_OP or
+  // VM_OP_BIT_OP, and slot indexes are relative to the frame base (not the top
+  // of the stack). The result is pushed, unless the next instruction is a
+  // VM_OP_STORE_VAR_1, in which case the result may be stored directly to its
+  // destination and the store skipped.
+  VM_OP4_VAR_NUM_OP          = 0x16, // (+ 8-bit NUM_OP/BIT_OP instruction, 8-bit left slot, 8-bit right slot)
+  VM_OP4_VAR_LIT_NUM_OP      = 0x17, // (+ 8-bit NUM_OP/BIT_OP instruction, 8-bit left slot, 8-bit signed right literal)
 
   VM_OP4_END
 };
@@ -13,6 +13,9 @@ import { blockTerminatingOpcodes } from './il-opcodes';
 
 // TODO: Everything "notImplemented" in this file.
 
+// VM_PROPERTY_INDEX_MARKER, i.e. the int14 -0x1FFF
+const PROPERTY_INDEX_MARKER = 0x8007;
+
 type Offset = number;
 type Section = 'gc' | 'bytecode';
 
@@ -77,6 +80,7 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
   const gcAllocationsRegion: Region = [];
   const romAllocationsRegion: Region = [];
   const processedAllocationsByOffset = new Map<UInt16, IL.Value>();
+  const decodedShapes = new Map<Offset, string[]>();
   const resumePointByPhysicalAddress = new Map<UInt16, IL.ResumePoint>();
   const reconstructionInfo = (snapshot instanceof SnapshotClass
     ? snapshot.reconstructionInfo
@@ -695,7 +699,7 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
       case TeTypeCode.TC_REF_VIRTUAL: return reserved();
       case TeTypeCode.TC_REF_UINT8_ARRAY: return decodeUint8Array(region, offset, size, section);
       case TeTypeCode.TC_REF_CLASS: return decodeClass(region, offset, size);
-      case TeTypeCode.TC_REF_RESERVED_1: return unexpected();
+      case TeTypeCode.TC_REF_SHAPED_OBJECT: return decodeShapedObject(region, offset, size, section);
       default: return unexpected();
     }
   }
@@ -857,7 +861,9 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
     let functionEndOffset = offset;
     const instructionsCovered = new Set<number>();
     const blockEntryOffsets = new Set<number>();
-    const instructionsByOffset = new Map<number, [IL.Operation, string, number]>();
+    // The last element holds the operations that follow the first in a
+    // superinstruction (with their disassembly)
+    const instructionsByOffset = new Map<number, [IL.Operation, string, number, [IL.Operation, string][]]>();
     const decodingBlock = new Map<Offset, { stackDepth: number | undefined }>();
 
     // The entry point is at the beginning (and this will also explore the whole
@@ -897,7 +903,8 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
       const iter = instructionsInOrder[Symbol.iterator]();
       let iterResult = iter.next();
       while (!iterResult.done) {
-        const [instructionOffset, [instruction, disassembly, instructionSize]] = iterResult.value;
+        const [instructionOffset, [firstInstruction, disassembly, instructionSize, fusedInstructions]] = iterResult.value;
+        let instruction = firstInstruction;
 
         const isStartOfBlock = block.operations.length === 0;
 
@@ -927,6 +934,20 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
           }
         });
 
+        // A superinstruction expands to multiple IL operations
+        for (const [fusedInstruction, fusedDisassembly] of fusedInstructions) {
+          instruction = fusedInstruction;
+          block.operations.push(instruction);
+          blockRegion.push({
+            offset: instructionOffset + instructionSize,
+            size: 0,
+            content: {
+              type: 'Annotation',
+              text: fusedDisassembly
+            }
+          });
+        }
+
         iterResult = iter.next();
         if (!iterResult.done) {
           const [nextOffset, [nextInstruction]] = iterResult.value;
@@ -1023,7 +1044,21 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
         op.stackDepthAfter = stackDepth;
         const size = buffer.readOffset - instructionOffset;
         const disassembly = decodeResult.disassembly || stringifyOperation(op);
-        instructionsByOffset.set(instructionOffset, [op, disassembly, size]);
+
+        const fusedOps: [IL.Operation, string][] = [];
+        for (const fusedOperation of decodeResult.fusedOperations ?? []) {
+          const fusedOp: IL.Operation = {
+            ...fusedOperation,
+            opcode: fusedOperation.opcode as any,
+            stackDepthBefore: stackDepth,
+            stackDepthAfter: undefined as any,
+          };
+          stackDepth += IL.calcStaticStackChangeOfOp(fusedOp) ?? unexpected();
+          fusedOp.stackDepthAfter = stackDepth;
+          fusedOps.push([fusedOp, stringifyOperation(fusedOp)]);
+        }
+
+        instructionsByOffset.set(instructionOffset, [op, disassembly, size, fusedOps]);
 
         // Control flow operations
         if (decodeResult.jumpTo) {
@@ -1084,6 +1119,14 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
     return value;
   }
 
+  function propertyIndexSize(offset: number, size: number): number {
+    if (size < 8) return 0;
+    const markerOffset = offset + size - 4;
+    if (buffer.readUInt16LE(markerOffset) !== PROPERTY_INDEX_MARKER) return 0;
+    const bucketCount = buffer.readUInt16LE(markerOffset + 2) >> 2;
+    return bucketCount * 2 + 4;
+  }
+
   function decodePropertyList(region: Region, offset: number, size: number, section: Section): IL.Value {
     const allocationID = offsetToAllocationID(offset);
 
@@ -1129,7 +1172,11 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
       }
 
       const propsOffset = groupOffset + 4;
-      const propCount = (groupSize - 4) / 4; // Each key-value pair is 4 bytes
+      // A property list compacted by the GC may end with a hash index (see
+      // VM_PROPERTY_INDEX_MARKER in microvium_internals.h), which is not part
+      // of the logical object.
+      const indexSize = propertyIndexSize(groupOffset, groupSize);
+      const propCount = (groupSize - 4 - indexSize) / 4; // Each key-value pair is 4 bytes
       for (let i = 0; i < propCount; i++) {
         const propOffset = propsOffset + i * 4;
         const key = readLogicalAt(propOffset, groupRegion, 'key');
@@ -1154,6 +1201,16 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
           object.properties[keyStr] = logical;
         }
       }
+      if (indexSize) {
+        groupRegion.push({
+          offset: groupOffset + groupSize - indexSize,
+          size: indexSize,
+          content: {
+            type: 'Annotation',
+            text: 'Property hash index'
+          }
+        });
+      }
       // Next group, if there is one
       if (dpNext.type === 'NullValue') {
         break;
@@ -1191,6 +1248,126 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
     return ref;
   }
 
+  function decodeShapedObject(region: Region, offset: number, size: number, section: Section): IL.Value {
+    // See TsShapedObject
+    const allocationID = offsetToAllocationID(offset);
+
+    const object: IL.ObjectAllocation = {
+      type: 'ObjectAllocation',
+      allocationID,
+      prototype: undefined as any, // Will be populated below
+      properties: {},
+      memoryRegion: getAllocationMemoryRegion(section),
+      keysAreFixed: false,
+      internalSlots: [IL.deletedValue, IL.deletedValue]
+    };
+    snapshotInfo.allocations.set(allocationID, object);
+
+    const ref: IL.ReferenceValue = {
+      type: 'ReferenceValue',
+      value: allocationID
+    };
+    processedAllocationsByOffset.set(offset, ref);
+
+    const objRegion: Region = [];
+    let dpNext = readValueAt(offset, objRegion, 'dpNext', true);
+    object.prototype = readLogicalAt(offset + 2, objRegion, 'dpProto');
+    const dpShape = readValueAt(offset + 4, objRegion, 'dpShape', true);
+    if (dpShape.type !== 'Pointer') {
+      return unexpected();
+    }
+    const keys = decodeShape(dpShape.offset);
+    if (size !== 6 + keys.length * 2) {
+      return invalidOperation('Size of TsShapedObject does not match its shape');
+    }
+    for (const [i, key] of keys.entries()) {
+      const value = getLogicalValue(readValueAt(offset + 6 + i * 2, objRegion, `value[${key}]`));
+      if (value.type !== 'DeletedValue') {
+        object.properties[key] = value;
+      }
+    }
+
+    // Properties added after the object was created are in TsPropertyList
+    // groups, as for an unshaped object
+    while (dpNext.type !== 'NullValue') {
+      if (dpNext.type !== 'Pointer') {
+        return unexpected();
+      }
+      const groupRegion: Region = [];
+      const groupOffset = dpNext.offset;
+      const { size: groupSize, typeCode } = readAllocationHeader(groupOffset, region);
+      hardAssert(typeCode === TeTypeCode.TC_REF_PROPERTY_LIST);
+      dpNext = readValueAt(groupOffset, groupRegion, 'dpNext', true);
+      readLogicalAt(groupOffset + 2, groupRegion, 'dpProto');
+      for (let propOffset = groupOffset + 4; propOffset < groupOffset + groupSize; propOffset += 4) {
+        const key = readLogicalAt(propOffset, groupRegion, 'key');
+        const value = getLogicalValue(readValueAt(propOffset + 2, groupRegion, 'value'));
+        if (key.type !== 'StringValue') {
+          return invalidOperation('Expected property key to be string')
+        }
+        if (value.type !== 'DeletedValue') {
+          object.properties[key.value] = value;
+        }
+      }
+      region.push({
+        offset: groupOffset,
+        size: undefined as any, // Inferred
+        content: {
+          type: 'Region',
+          regionName: `Child TsPropertyList`,
+          value: groupRegion
+        }
+      })
+    }
+
+    region.push({
+      offset: offset,
+      size: size,
+      content: {
+        type: 'Region',
+        regionName: `TsShapedObject`,
+        value: objRegion
+      }
+    });
+
+    return ref;
+  }
+
+  // Reads the list of keys in a shape (see TsShapedObject). Shapes are shared,
+  // so each one is only added to the disassembly once.
+  function decodeShape(shapeOffset: Offset): string[] {
+    let keys = decodedShapes.get(shapeOffset);
+    if (keys) {
+      return keys;
+    }
+    const { offset: romOffset, end: romEnd } = getSectionInfo(mvm_TeBytecodeSection.BCS_ROM);
+    const section: Section = shapeOffset >= romOffset && shapeOffset < romEnd ? 'bytecode' : 'gc';
+    const region = getAllocationRegionForSection(section);
+    const { size, typeCode } = readAllocationHeader(shapeOffset, region);
+    hardAssert(typeCode === TeTypeCode.TC_REF_FIXED_LENGTH_ARRAY);
+
+    const shapeRegion: Region = [];
+    keys = [];
+    for (let i = 0; i < size / 2; i++) {
+      const key = readLogicalAt(shapeOffset + i * 2, shapeRegion, `key[${i}]`);
+      if (key.type !== 'StringValue') {
+        return invalidOperation('Expected property key to be string')
+      }
+      keys.push(key.value);
+    }
+    region.push({
+      offset: shapeOffset,
+      size,
+      content: {
+        type: 'Region',
+        regionName: 'Shape',
+        value: shapeRegion
+      }
+    });
+    decodedShapes.set(shapeOffset, keys);
+    return keys;
+  }
+
   function decodeClass(region: Region, offset: number, size: number): IL.Value {
     hardAssert(size === 4);
     const classRegion: Region = [];
@@ -1652,11 +1829,15 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
           case vm_TeOpcodeEx2.VM_OP2_STORE_VAR_2: {
             return notImplemented();
           }
-          case vm_TeOpcodeEx2.VM_OP2_ARRAY_GET_2_RESERVED: {
-            return notImplemented();
+          case vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_THAN_1: {
+            const offsetFromCurrent = buffer.readInt8();
+            const offset = buffer.readOffset + offsetFromCurrent;
+            return opCompareAndBranch('<', offset);
           }
-          case vm_TeOpcodeEx2.VM_OP2_ARRAY_SET_2_RESERVED: {
-            return notImplemented();
+          case vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_EQUAL_1: {
+            const offsetFromCurrent = buffer.readInt8();
+            const offset = buffer.readOffset + offsetFromCurrent;
+            return opCompareAndBranch('<=', offset);
           }
           case vm_TeOpcodeEx2.VM_OP2_JUMP_1: {
             const offsetFromCurrent = buffer.readInt8();
@@ -1875,6 +2056,132 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
                 };
               }
 
+              case vm_TeOpcodeEx4.VM_OP4_TAIL_CALL: {
+                // Superinstruction: Call + Return
+                const argCount = buffer.readUInt8();
+                return {
+                  operation: {
+                    opcode: 'Call',
+                    operands: [
+                      { type: 'CountOperand', count: argCount },
+                      { type: 'FlagOperand', flag: false },
+                    ]
+                  },
+                  fusedOperations: [{
+                    opcode: 'Return',
+                    operands: [],
+                    staticInfo: {
+                      returnUndefined: false
+                    }
+                  }],
+                  jumpTo: { targets: [], alsoContinue: false },
+                };
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_GAS: {
+                // Gas metering doesn't appear in the IL. The encoder adds it
+                // back at the start of each block if the snapshot has the
+                // GasMetering flag.
+                buffer.readUInt8(); // Instruction count
+                return decodeInstruction(region, stackDepthBefore, tryStack);
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_LOAD_SCOPED_OUTER: {
+                const depthAndIndex = buffer.readUInt8();
+                const relativeIndex = buffer.readUInt8();
+                return opScopedOuter('LoadScoped', relativeIndex, depthAndIndex >> 4, depthAndIndex & 0xF);
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_STORE_SCOPED_OUTER: {
+                const depthAndIndex = buffer.readUInt8();
+                const relativeIndex = buffer.readUInt8();
+                return opScopedOuter('StoreScoped', relativeIndex, depthAndIndex >> 4, depthAndIndex & 0xF);
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_TABLE_SWITCH: {
+                const low = buffer.readInt16LE();
+                const entryCount = buffer.readUInt8();
+                const defaultOffset = buffer.readInt16LE();
+                const entryOffsets = _.range(entryCount).map(() => buffer.readInt16LE());
+                const end = buffer.readOffset;
+                const cases = entryOffsets
+                  .map((offset, i) => ({ value: low + i, offset: end + offset }))
+                  // Values in the gaps between cases jump to the default
+                  .filter(c => c.offset !== end + defaultOffset);
+                return opSwitch(end + defaultOffset, cases);
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_LOOKUP_SWITCH: {
+                const caseCount = buffer.readUInt8();
+                const defaultOffset = buffer.readInt16LE();
+                const cases = _.range(caseCount).map(() => {
+                  const value = buffer.readInt16LE();
+                  const offset = buffer.readInt16LE();
+                  return { value, offset };
+                });
+                const end = buffer.readOffset;
+                return opSwitch(end + defaultOffset, cases.map(c => ({ value: c.value, offset: end + c.offset })));
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_ARRAY_ITER_START: {
+                return {
+                  operation: {
+                    opcode: 'IterStart',
+                    operands: []
+                  },
+                  disassembly: `IterStart()`
+                }
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_ARRAY_ITER_NEXT: {
+                const offsetFromCurrent = buffer.readInt16LE();
+                const doneOffset = buffer.readOffset + offsetFromCurrent;
+                return {
+                  operation: {
+                    opcode: 'IterNext',
+                    operands: [{
+                      type: 'LabelOperand',
+                      targetBlockId: offsetToBlockID(doneOffset)
+                    }]
+                  },
+                  disassembly: `IterNext(&${stringifyOffset(doneOffset)})`,
+                  jumpTo: {
+                    targets: [{
+                      offset: doneOffset,
+                      stackDepth: notUndefined(stackDepthBefore) + 1,
+                      tryStack
+                    }],
+                    alsoContinue: true
+                  }
+                }
+              }
+
+              case vm_TeOpcodeEx4.VM_OP4_VAR_NUM_OP:
+              case vm_TeOpcodeEx4.VM_OP4_VAR_LIT_NUM_OP: {
+                // Superinstruction: LoadVar + LoadVar or Literal + BinOp.
+                // The slots are relative to the frame base, like the IL
+                // variable indexes.
+                const stackOp = buffer.readUInt8();
+                const leftSlot = buffer.readUInt8();
+                const right: IL.Operand = subOp === vm_TeOpcodeEx4.VM_OP4_VAR_NUM_OP
+                  ? { type: 'IndexOperand', index: buffer.readUInt8() }
+                  : { type: 'LiteralOperand', literal: { type: 'NumberValue', value: buffer.readInt8() } };
+                const { operation: binOp } = (stackOp >> 4) === vm_TeOpcode.VM_OP_NUM_OP
+                  ? opNumOp(stackOp & 0xF)
+                  : opBitOp(stackOp & 0xF);
+                hardAssert(binOp.opcode === 'BinOp');
+                return {
+                  operation: {
+                    opcode: 'LoadVar',
+                    operands: [{ type: 'IndexOperand', index: leftSlot }]
+                  },
+                  fusedOperations: [{
+                    opcode: right.type === 'IndexOperand' ? 'LoadVar' : 'Literal',
+                    operands: [right]
+                  }, binOp],
+                };
+              }
+
               default: return assertUnreachable(subOp);
             }
           }
@@ -1961,7 +2268,24 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
             return opStoreGlobal(index);
           }
           case vm_TeOpcodeEx3.VM_OP3_OBJECT_GET_2: {
-            return notImplemented(); // TODO
+            // Superinstruction: Literal + ObjectGet
+            const u16 = buffer.readUInt16LE();
+            const value = decodeValue(u16);
+            const logical = getLogicalValue(value);
+            return {
+              operation: {
+                opcode: 'Literal',
+                operands: [{
+                  type: 'LiteralOperand',
+                  literal: logical
+                }]
+              },
+              disassembly: `Literal(${stringifyBytecodeValue(value)})`,
+              fusedOperations: [{
+                opcode: 'ObjectGet',
+                operands: []
+              }]
+            }
           }
           case vm_TeOpcodeEx3.VM_OP3_OBJECT_SET_2: {
             return notImplemented(); // TODO
@@ -2034,8 +2358,19 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
               disassembly: `AsyncResume(${slotCount})`
             }
           }
-          case vm_TeOpcodeEx3.VM_OP3_RESERVED_3: {
-            return notImplemented();
+          case vm_TeOpcodeEx3.VM_OP3_LOAD_GLOBAL_CALLEE: {
+            // Superinstruction: LoadGlobal + Literal(undefined)
+            const index = buffer.readUInt16LE();
+            return {
+              ...opLoadGlobal(index),
+              fusedOperations: [{
+                opcode: 'Literal',
+                operands: [{
+                  type: 'LiteralOperand',
+                  literal: IL.undefinedValue
+                }]
+              }]
+            }
           }
           default: {
             return assertUnreachable(subOp);
@@ -2065,79 +2400,85 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
         return notImplemented(); // TODO
       }
       case vm_TeOpcode.VM_OP_NUM_OP: {
-        const subOp: vm_TeNumberOp = param;
-        let binOp: IL.BinOpCode | undefined;
-        let unOp: IL.UnOpCode | undefined;
-        switch (subOp) {
-          case vm_TeNumberOp.VM_NUM_OP_LESS_THAN: binOp = '<'; break;
-          case vm_TeNumberOp.VM_NUM_OP_GREATER_THAN: binOp = '>'; break;
-          case vm_TeNumberOp.VM_NUM_OP_LESS_EQUAL: binOp = '<='; break;
-          case vm_TeNumberOp.VM_NUM_OP_GREATER_EQUAL: binOp = '>='; break;
-          case vm_TeNumberOp.VM_NUM_OP_ADD_NUM: return reserved();
-          case vm_TeNumberOp.VM_NUM_OP_SUBTRACT: binOp = '-'; break;
-          case vm_TeNumberOp.VM_NUM_OP_MULTIPLY: binOp = '*'; break;
-          case vm_TeNumberOp.VM_NUM_OP_DIVIDE: binOp = '/'; break;
-          case vm_TeNumberOp.VM_NUM_OP_DIVIDE_AND_TRUNC: binOp = 'DIVIDE_AND_TRUNC'; break;
-          case vm_TeNumberOp.VM_NUM_OP_REMAINDER: binOp = '%'; break;
-          case vm_TeNumberOp.VM_NUM_OP_POWER: binOp = '**'; break;
-          case vm_TeNumberOp.VM_NUM_OP_NEGATE: unOp = '-'; break;
-          case vm_TeNumberOp.VM_NUM_OP_UNARY_PLUS: unOp = '+'; break;
+        return opNumOp(param);
+      }
+      case vm_TeOpcode.VM_OP_BIT_OP: {
+        return opBitOp(param);
+      }
+      case vm_TeOpcode.VM_OP_END: {
+        return unexpected();
+      }
+      default: assertUnreachable(opcode);
+    }
+
+    function opNumOp(subOp: vm_TeNumberOp): DecodeInstructionResult {
+      let binOp: IL.BinOpCode | undefined;
+      let unOp: IL.UnOpCode | undefined;
+      switch (subOp) {
+        case vm_TeNumberOp.VM_NUM_OP_LESS_THAN: binOp = '<'; break;
+        case vm_TeNumberOp.VM_NUM_OP_GREATER_THAN: binOp = '>'; break;
+        case vm_TeNumberOp.VM_NUM_OP_LESS_EQUAL: binOp = '<='; break;
+        case vm_TeNumberOp.VM_NUM_OP_GREATER_EQUAL: binOp = '>='; break;
+        case vm_TeNumberOp.VM_NUM_OP_ADD_NUM: binOp = '+'; break;
+        case vm_TeNumberOp.VM_NUM_OP_SUBTRACT: binOp = '-'; break;
+        case vm_TeNumberOp.VM_NUM_OP_MULTIPLY: binOp = '*'; break;
+        case vm_TeNumberOp.VM_NUM_OP_DIVIDE: binOp = '/'; break;
+        case vm_TeNumberOp.VM_NUM_OP_DIVIDE_AND_TRUNC: binOp = 'DIVIDE_AND_TRUNC'; break;
+        case vm_TeNumberOp.VM_NUM_OP_REMAINDER: binOp = '%'; break;
+        case vm_TeNumberOp.VM_NUM_OP_POWER: binOp = '**'; break;
+        case vm_TeNumberOp.VM_NUM_OP_NEGATE: unOp = '-'; break;
+        case vm_TeNumberOp.VM_NUM_OP_UNARY_PLUS: unOp = '+'; break;
+      }
+      if (binOp !== undefined) {
+        return {
+          operation: {
+            opcode: 'BinOp',
+            operands: [{
+              type: 'OpOperand',
+              subOperation: binOp
+            }]
+          }
         }
-        if (binOp !== undefined) {
-          return {
-            operation: {
-              opcode: 'BinOp',
-              operands: [{
-                type: 'OpOperand',
-                subOperation: binOp
-              }]
-            }
+      }
+      if (unOp !== undefined) {
+        return {
+          operation: {
+            opcode: 'UnOp',
+            operands: [{
+              type: 'OpOperand',
+              subOperation: unOp
+            }]
           }
         }
-        if (unOp !== undefined) {
+      }
+      return unexpected();
+    }
+
+    function opBitOp(subOp: vm_TeBitwiseOp): DecodeInstructionResult {
+      let binOp: IL.BinOpCode;
+      switch (subOp) {
+        case vm_TeBitwiseOp.VM_BIT_OP_SHR_ARITHMETIC: binOp = '>>'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_SHR_LOGICAL: binOp = '>>>'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_SHL: binOp = '<<'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_OR: binOp = '|'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_AND: binOp = '&'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_XOR: binOp = '^'; break;
+        case vm_TeBitwiseOp.VM_BIT_OP_NOT: {
           return {
             operation: {
               opcode: 'UnOp',
-              operands: [{
-                type: 'OpOperand',
-                subOperation: unOp
-              }]
+              operands: [{ type: 'OpOperand', subOperation: '~' }]
             }
           }
         }
-        return unexpected();
+        default: return unexpected();
       }
-      case vm_TeOpcode.VM_OP_BIT_OP: {
-        const subOp: vm_TeBitwiseOp = param;
-        let binOp: IL.BinOpCode;
-        switch (subOp) {
-          case vm_TeBitwiseOp.VM_BIT_OP_SHR_ARITHMETIC: binOp = '>>'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_SHR_LOGICAL: binOp = '>>>'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_SHL: binOp = '<<'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_OR: binOp = '|'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_AND: binOp = '&'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_XOR: binOp = '^'; break;
-          case vm_TeBitwiseOp.VM_BIT_OP_NOT: {
-            return {
-              operation: {
-                opcode: 'UnOp',
-                operands: [{ type: 'OpOperand', subOperation: '~' }]
-              }
-            }
-          }
-          default: return unexpected();
-        }
-        return {
-          operation: {
-            opcode: 'BinOp',
-            operands: [{ type: 'OpOperand', subOperation: binOp }]
-          }
+      return {
+        operation: {
+          opcode: 'BinOp',
+          operands: [{ type: 'OpOperand', subOperation: binOp }]
         }
       }
-      case vm_TeOpcode.VM_OP_END: {
-        return unexpected();
-      }
-      default: assertUnreachable(opcode);
     }
 
     function opLoadVar(index: number): DecodeInstructionResult {
@@ -2216,6 +2557,22 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
       }
     }
 
+    function opScopedOuter(opcode: 'LoadScoped' | 'StoreScoped', relativeIndex: number, depth: number, index: number): DecodeInstructionResult {
+      // The engine only uses the depth and index, but the instruction also
+      // carries the relative index so that the original operand is recovered.
+      return {
+        operation: {
+          opcode,
+          operands: [{
+            type: 'IndexOperand',
+            index: relativeIndex
+          }],
+          staticInfo: { depth, index }
+        },
+        disassembly: `${opcode} [${relativeIndex}] [depth=${depth}, index=${index}]`
+      }
+    }
+
     function opScopeDiscard(): DecodeInstructionResult {
       return {
         operation: {
@@ -2272,6 +2629,64 @@ export function decodeSnapshot(snapshot: Snapshot): { snapshotInfo: SnapshotIL,
       }
     }
 
+    function opSwitch(defaultOffset: number, cases: { value: number, offset: number }[]): DecodeInstructionResult {
+      const stackDepth = notUndefined(stackDepthBefore);
+      return {
+        operation: {
+          opcode: 'Switch',
+          operands: [{
+            type: 'LabelOperand',
+            targetBlockId: offsetToBlockID(defaultOffset)
+          }, {
+            type: 'CasesOperand',
+            cases: cases.map(({ value, offset }) => ({
+              value,
+              target: { type: 'LabelOperand', targetBlockId: offsetToBlockID(offset) }
+            }))
+          }]
+        },
+        disassembly: `Switch &${stringifyOffset(defaultOffset)}, ${
+          cases.map(({ value, offset }) => `${value}: &${stringifyOffset(offset)}`).join(', ')
+        }`,
+        jumpTo: {
+          targets: [defaultOffset, ...cases.map(c => c.offset)]
+            .map(offset => ({ offset, stackDepth, tryStack })),
+          alsoContinue: false
+        }
+      }
+    }
+
+    // Superinstruction: BinOp + Branch
+    function opCompareAndBranch(binOp: IL.BinOpCode, offset: number): DecodeInstructionResult {
+      const offsetAlternate = buffer.readOffset;
+      return {
+        operation: {
+          opcode: 'BinOp',
+          operands: [{
+            type: 'OpOperand',
+            subOperation: binOp
+          }]
+        },
+        fusedOperations: [{
+          opcode: 'Branch',
+          operands: [{
+            type: 'LabelOperand',
+            targetBlockId: offsetToBlockID(offset)
+          }, {
+            type: 'LabelOperand',
+            targetBlockId: offsetToBlockID(offsetAlternate)
+          }]
+        }],
+        jumpTo: {
+          targets: [
+            { offset, stackDepth: notUndefined(stackDepthBefore) - 2, tryStack },
+            { offset: offsetAlternate, stackDepth: notUndefined(stackDepthBefore) - 2, tryStack }
+          ],
+          alsoContinue: false
+        }
+      }
+    }
+
     function opJump(offset: number): DecodeInstructionResult {
       // Special case for "Nop" which is the only time there is a valid jump to
       // an anonymous offset. This is where a jump instruction jumps to
@@ -2398,6 +2813,9 @@ function getLogicalValue(value: IL.Value | Pointer): IL.Value {
 interface DecodeInstructionResult {
   operation: Omit<IL.Operation, 'stackDepthBefore' | 'stackDepthAfter'>;
   disassembly?: string;
+  // Superinstructions decode to multiple IL operations. These are the
+  // operations that follow `operation`.
+  fusedOperations?: Omit<IL.Operation, 'stackDepthBefore' | 'stackDepthAfter'>[];
   jumpTo?: {
     targets: JumpTarget[];
     alsoContinue: boolean;
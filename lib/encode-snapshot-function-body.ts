@@ -12,6 +12,7 @@ import escapeHTML from 'escape-html';
 import { vm_TeOpcode, vm_TeOpcodeEx1, vm_TeOpcodeEx2, vm_TeOpcodeEx3, vm_TeSmallLiteralValue, vm_TeNumberOp, vm_TeBitwiseOp, vm_TeOpcodeEx4 } from './bytecode-opcodes';
 import fs from 'fs';
 import { Referenceable, programAddressToKey } from './encode-snapshot';
+import { BinOpOperandTypes, inferBinOpOperandTypes } from './infer-types';
 
 /*
 writeFunctionBody is essentially concerned with the layout and emission of
@@ -83,6 +84,7 @@ export function writeFunctionBody(
   const metaByBlock = new Map<IL.BlockID, BlockMeta>();
   const blockOutputOrder: string[] = []; // Will be filled in the first pass
   const addressableBlocks = findAddressableBlocks(func, addressableReferences);
+  const operandTypes = inferBinOpOperandTypes(func);
 
   pass1();
 
@@ -151,10 +153,59 @@ export function writeFunctionBody(
       // Within the context of this block, operations can request that certain other blocks should be next
       metaByBlock.set(blockId, {
         addressEstimate,
-        address: undefined as any
+        address: undefined as any,
       });
+
+      const writers: InstructionWriter[] = [];
+      // Indexes of the operations that start a new gas segment (see below)
+      const gasSegmentStarts: number[] = [0];
+      let endsGasSegment = false;
+      let absorbedCount = 0;
+      for (const [operationIndex, op] of block.operations.entries()) {
+        let writer: InstructionWriter;
+        if (absorbedCount) {
+          // Already emitted as part of the preceding superinstruction
+          writer = instructionAbsorbed;
+          absorbedCount--;
+        } else {
+          if (endsGasSegment) {
+            gasSegmentStarts.push(operationIndex);
+            endsGasSegment = false;
+          }
+          const superinstruction = trySuperinstruction(ctx, block.operations, operationIndex, operandTypes);
+          if (superinstruction) {
+            writer = superinstruction.writer;
+            absorbedCount = superinstruction.absorbedCount;
+          } else {
+            writer = trySpecializedInstruction(op, operandTypes) ?? emitPass1(emitter, ctx, op);
+          }
+        }
+        writers.push(writer);
+        if (operationLeavesBlockEarly(op)) {
+          endsGasSegment = true;
+        }
+      }
+
+      // With gas metering, each block is divided into segments that end after
+      // any operation that can leave the block before reaching the end of it
+      // (a call that throws, or an iterator that's done), and each segment
+      // starts with VM_OP4_GAS instructions that charge for all the bytecode
+      // instructions in the segment. This way, gas is only charged for
+      // instructions that run. An IL operation emits at most 3 bytecode
+      // instructions (a compare, BRANCH and JUMP) and each VM_OP4_GAS can
+      // charge at most 255, which fixes how many we need.
+      const gasInstructionCounts = new Map<number, number>();
+      if (ctx.gasMetering) {
+        for (const [i, start] of gasSegmentStarts.entries()) {
+          const end = gasSegmentStarts[i + 1] ?? block.operations.length;
+          gasInstructionCounts.set(start, Math.max(1, Math.ceil((end - start) * 3 / 255)));
+        }
+      }
+
       for (const [operationIndex, op] of block.operations.entries()) {
-        const { maxSize, emitPass2 } = emitPass1(emitter, ctx, op);
+        const gasInstructionCount = gasInstructionCounts.get(operationIndex) ?? 0;
+        addressEstimate += gasInstructionCount * 3;
+        const { maxSize, emitPass2 } = writers[operationIndex];
         const operationMeta: OperationMeta = {
           op,
           ilAddress: { type: 'ProgramAddressValue', funcId, blockId, operationIndex },
@@ -162,6 +213,8 @@ export function writeFunctionBody(
           address: undefined as any,
           sizeEstimate: maxSize,
           size: undefined as any,
+          instructionCount: undefined as any,
+          gasInstructionCount,
           emitPass2,
           emitPass3: undefined as any
         };
@@ -223,9 +276,11 @@ export function writeFunctionBody(
       for (const op of block.operations) {
         const opMeta = notUndefined(metaByOperation.get(op));
         currentOperationMeta = opMeta;
+        address += opMeta.gasInstructionCount * 3;
         const pass2Output = opMeta.emitPass2(ctx);
         opMeta.emitPass3 = pass2Output.emitPass3;
         opMeta.size = pass2Output.size;
+        opMeta.instructionCount = pass2Output.instructionCount ?? (pass2Output.size > 0 ? 1 : 0);
         hardAssert(opMeta.size <= opMeta.sizeEstimate);
         opMeta.address = address;
         address += pass2Output.size;
@@ -326,9 +381,17 @@ export function writeFunctionBody(
 
       ctx.addName(output.currentOffset, 'block', blockId);
 
-      for (const op of block.operations) {
-        const opMeta = notUndefined(metaByOperation.get(op));
+      const opMetas = block.operations.map(op => notUndefined(metaByOperation.get(op)));
+      for (const [operationIndex, opMeta] of opMetas.entries()) {
+        const op = opMeta.op;
         currentOperationMeta = opMeta;
+        if (opMeta.gasInstructionCount) {
+          // The sizes are final, so we know which operations emitted nothing.
+          // The segment runs up to the next operation that starts one.
+          const segmentEnd = opMetas.findIndex((m, i) => i > operationIndex && m.gasInstructionCount);
+          const segment = opMetas.slice(operationIndex, segmentEnd === -1 ? undefined : segmentEnd);
+          appendGasInstructions(output, _.sum(segment.map(m => m.instructionCount)), opMeta.gasInstructionCount);
+        }
         const offsetBefore = output.currentOffset;
         opMeta.emitPass3(innerCtx);
         const offsetAfter = output.currentOffset;
@@ -350,6 +413,43 @@ export function writeFunctionBody(
 }
 
 
+// Operations after which the rest of the block might not run, because the
+// operation can throw a catchable exception or jump out of the block.
+// Uncatchable errors end the call, so they're not included. An `AsyncResume` is
+// where the continuation of an async function starts, so what follows it is
+// charged when the continuation runs rather than before the `Await`.
+function operationLeavesBlockEarly(op: IL.Operation) {
+  switch (op.opcode) {
+    case 'AsyncResume':
+    case 'AwaitCall':
+    case 'Call':
+    case 'IterNext':
+    case 'New':
+      return true;
+    default:
+      return false;
+  }
+}
+
+function appendGasInstructions(region: BinaryRegion, cost: number, gasInstructionCount: number) {
+  for (let i = 0; i < gasInstructionCount; i++) {
+    const portion = Math.min(cost, 255);
+    cost -= portion;
+    const label = `VM_OP4_GAS(${portion})`;
+    region.append({ html: escapeHTML(label), binary: gasInstruction(portion) }, label, formats.preformatted(3));
+  }
+  hardAssert(cost === 0);
+}
+
+function gasInstruction(count: UInt8): UInt8[] {
+  return [
+    UInt4(vm_TeOpcodeEx2.VM_OP2_EXTENDED_4) |
+    (UInt4(vm_TeOpcode.VM_OP_EXTENDED_2) << 4),
+    UInt8(vm_TeOpcodeEx4.VM_OP4_GAS),
+    UInt8(count),
+  ];
+}
+
 interface OperationMeta {
   op: IL.Operation; // For debug purposes
   addressEstimate: number;
@@ -357,6 +457,8 @@ interface OperationMeta {
   ilAddress: IL.ProgramAddressValue;
   sizeEstimate: number;
   size: number;
+  instructionCount: number; // Number of bytecode instructions, for gas metering
+  gasInstructionCount: number; // Number of VM_OP4_GAS instructions before the operation
   emitPass2: EmitPass2;
   emitPass3: EmitPass3;
 };
@@ -383,6 +485,8 @@ export interface InstructionEmitContext {
   preferBlockToBeNext?: (blockId: IL.BlockID) => void;
   addName(offset: Future, type: string, name: string): void;
   sourceMapAdd?(mapping: FutureInstructionSourceMapping): void;
+  // If true, each block starts with VM_OP4_GAS (see IL.ExecutionFlag.GasMetering)
+  gasMetering?: boolean;
 }
 
 class InstructionEmitter {
@@ -401,90 +505,7 @@ class InstructionEmitter {
     consequentTargetBlockID: string,
     alternateTargetBlockID: string
   ): InstructionWriter {
-    ctx.preferBlockToBeNext!(alternateTargetBlockID);
-    // Note: branch IL instructions are a bit more complicated than most because
-    // they consist of two bytecode instructions
-    return {
-      maxSize: 6,
-      emitPass2: ctx => {
-        let tentativeConseqOffset = ctx.tentativeOffsetOfBlock(consequentTargetBlockID);
-        /* 😨😨😨 The offset is measured from the end of the bytecode
-         * instruction, but since this is a composite instruction, we need to
-         * compensate for the fact that we're branching from halfway through the
-         * composite instruction.
-         */
-        if (tentativeConseqOffset < 0) {
-          tentativeConseqOffset += 3; // 3 is the max size of the jump part of the composite instruction
-        }
-
-        const tentativeConseqOffsetIsFar = !isSInt8(tentativeConseqOffset);
-        const sizeOfBranchInstr = tentativeConseqOffsetIsFar ? 3 : 2;
-
-        const tentativeAltOffset = ctx.tentativeOffsetOfBlock(alternateTargetBlockID);
-        const tentativeAltOffsetDistance = getJumpDistance(tentativeAltOffset);
-        const sizeOfJumpInstr =
-          tentativeAltOffsetDistance === 'far' ? 3 :
-          tentativeAltOffsetDistance === 'close' ? 2 :
-          tentativeAltOffsetDistance === 'zero' ? 0 :
-          unexpected();
-
-        const size = sizeOfBranchInstr + sizeOfJumpInstr;
-
-        return {
-          size,
-          emitPass3: ctx => {
-            let label = '';
-            let binary: UInt8[] = [];
-            const finalOffsetOfConseq = ctx.offsetOfBlock(consequentTargetBlockID) + sizeOfJumpInstr;
-            const finalOffsetOfAlt = ctx.offsetOfBlock(alternateTargetBlockID);
-            hardAssert(Math.abs(finalOffsetOfConseq) <= Math.abs(tentativeConseqOffset));
-            hardAssert(Math.abs(finalOffsetOfAlt) <= Math.abs(tentativeAltOffset));
-
-            // Stick to our committed shape for the BRANCH instruction
-            if (tentativeConseqOffsetIsFar) {
-              label += `VM_OP3_BRANCH_2(0x${finalOffsetOfConseq.toString(16)})`;
-              binary.push(
-                (vm_TeOpcode.VM_OP_EXTENDED_3 << 4) | vm_TeOpcodeEx3.VM_OP3_BRANCH_2,
-                finalOffsetOfConseq & 0xFF,
-                (finalOffsetOfConseq >> 8) & 0xFF
-              )
-            } else {
-              label += `VM_OP2_BRANCH_1(0x${finalOffsetOfConseq.toString(16)})`;
-              binary.push(
-                (vm_TeOpcode.VM_OP_EXTENDED_2 << 4) | vm_TeOpcodeEx2.VM_OP2_BRANCH_1,
-                finalOffsetOfConseq & 0xFF
-              )
-            }
-
-            // Stick to our committed shape for the JUMP instruction
-            switch (tentativeAltOffsetDistance) {
-              case 'zero': break; // No instruction at all
-              case 'close': {
-                label += `, VM_OP2_JUMP_1(0x${finalOffsetOfAlt.toString(16)})`;
-                binary.push(
-                  (vm_TeOpcode.VM_OP_EXTENDED_2 << 4) | vm_TeOpcodeEx2.VM_OP2_JUMP_1,
-                  finalOffsetOfAlt & 0xFF
-                )
-                break;
-              }
-              case 'far': {
-                label += `, VM_OP3_JUMP_2(0x${finalOffsetOfAlt.toString(16)})`;
-                binary.push(
-                  (vm_TeOpcode.VM_OP_EXTENDED_3 << 4) | vm_TeOpcodeEx3.VM_OP3_JUMP_2,
-                  finalOffsetOfAlt & 0xFF,
-                  (finalOffsetOfAlt >> 8) & 0xFF
-                )
-                break;
-              }
-              default: assertUnreachable(tentativeAltOffsetDistance);
-            }
-
-            const html = escapeHTML(stringifyOperation(op));
-            ctx.region.append({ binary: BinaryData(binary), html }, label, formats.preformatted2);
-          }
-        }
-      }
-    }
+    return instructionBranch(ctx, op, consequentTargetBlockID, alternateTargetBlockID);
   }
 
   operationClosureNew(ctx: InstructionEmitContext, op: IL.Operation) {
@@ -548,6 +569,30 @@ class InstructionEmitter {
     });
   }
 
+  operationIterStart(ctx: InstructionEmitContext, op: IL.Operation) {
+    return instructionEx4(vm_TeOpcodeEx4.VM_OP4_ARRAY_ITER_START, op);
+  }
+
+  operationIterNext(ctx: InstructionEmitContext, op: IL.Operation, doneTargetBlockId: string): InstructionWriter {
+    // The offset is always 2 bytes, so the size is fixed
+    const size = 4;
+    return {
+      maxSize: size,
+      emitPass2: () => ({
+        size,
+        emitPass3: ctx => {
+          appendCustomInstruction(ctx.region, op, vm_TeOpcode.VM_OP_EXTENDED_2, vm_TeOpcodeEx2.VM_OP2_EXTENDED_4, {
+            type: 'UInt8',
+            value: vm_TeOpcodeEx4.VM_OP4_ARRAY_ITER_NEXT
+          }, {
+            type: 'SInt16',
+            value: ctx.offsetOfBlock(doneTargetBlockId)
+          });
+        }
+      })
+    }
+  }
+
   operationJump(ctx: InstructionEmitContext, op: IL.Operation, targetBlockId: string): InstructionWriter {
     ctx.preferBlockToBeNext!(targetBlockId);
     return {
@@ -757,44 +802,6 @@ class InstructionEmitter {
     } else {
       return instructionEx3Unsigned(vm_TeOpcodeEx3.VM_OP3_LOAD_LITERAL, ctx.encodeValue(param), op);
     }
-
-    function tryGetSmallLiteralCode(param: IL.Value): vm_TeSmallLiteralValue | undefined {
-      switch (param.type) {
-        case 'NullValue': return vm_TeSmallLiteralValue.VM_SLV_NULL;
-        case 'UndefinedValue': return vm_TeSmallLiteralValue.VM_SLV_UNDEFINED;
-        case 'NumberValue':
-          if (Object.is(param.value, -0)) return undefined;
-          switch (param.value) {
-            case -1: return vm_TeSmallLiteralValue.VM_SLV_INT_MINUS_1;
-            case 0: return vm_TeSmallLiteralValue.VM_SLV_INT_0;
-            case 1: return vm_TeSmallLiteralValue.VM_SLV_INT_1;
-            case 2: return vm_TeSmallLiteralValue.VM_SLV_INT_2;
-            case 3: return vm_TeSmallLiteralValue.VM_SLV_INT_3;
-            case 4: return vm_TeSmallLiteralValue.VM_SLV_INT_4;
-            case 5: return vm_TeSmallLiteralValue.VM_SLV_INT_5;
-            default: return undefined;
-          }
-        case 'StringValue':
-          return undefined;
-        case 'BooleanValue':
-          return param.value
-            ? vm_TeSmallLiteralValue.VM_SLV_TRUE
-            : vm_TeSmallLiteralValue.VM_SLV_FALSE;
-        case 'EphemeralFunctionValue':
-        case 'EphemeralObjectValue':
-        case 'ClassValue':
-        case 'FunctionValue':
-        case 'HostFunctionValue':
-        case 'DeletedValue':
-        case 'ReferenceValue':
-        case 'ProgramAddressValue':
-        case 'ResumePoint':
-        case 'NoOpFunction':
-          return undefined;
-        default:
-          return assertUnreachable(param);
-      }
-    }
   }
 
   operationLoadArg(_ctx: InstructionEmitContext, op: IL.Operation, index: number) {
@@ -826,6 +833,16 @@ class InstructionEmitter {
   }
 
   operationLoadScoped(ctx: InstructionEmitContext, op: IL.Operation, index: number) {
+    const outerOperand = outerScopedOperand(op, index);
+    if (outerOperand !== undefined) {
+      return customInstruction(op,
+        vm_TeOpcode.VM_OP_EXTENDED_2,
+        vm_TeOpcodeEx2.VM_OP2_EXTENDED_4,
+        { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_LOAD_SCOPED_OUTER },
+        { type: 'UInt8', value: outerOperand },
+        { type: 'UInt8', value: index },
+      );
+    }
     if (isUInt4(index)) {
       return instructionPrimary(vm_TeOpcode.VM_OP_LOAD_SCOPED_1, index, op);
     } else if (isUInt8(index)) {
@@ -930,6 +947,16 @@ class InstructionEmitter {
   }
 
   operationStoreScoped(ctx: InstructionEmitContext, op: IL.Operation, index: number) {
+    const outerOperand = outerScopedOperand(op, index);
+    if (outerOperand !== undefined) {
+      return customInstruction(op,
+        vm_TeOpcode.VM_OP_EXTENDED_2,
+        vm_TeOpcodeEx2.VM_OP2_EXTENDED_4,
+        { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_STORE_SCOPED_OUTER },
+        { type: 'UInt8', value: outerOperand },
+        { type: 'UInt8', value: index },
+      );
+    }
     if (isUInt4(index)) {
       return instructionPrimary(vm_TeOpcode.VM_OP_STORE_SCOPED_1, index, op);
     } else if (isUInt8(index)) {
@@ -940,6 +967,57 @@ class InstructionEmitter {
     }
   }
 
+  operationSwitch(ctx: InstructionEmitContext, op: IL.Operation, defaultTargetBlockId: string, cases: SwitchCase[]): InstructionWriter {
+    const sortedCases = _.sortBy(cases, c => c.value);
+    const low = sortedCases[0]?.value ?? 0;
+    const high = sortedCases[sortedCases.length - 1]?.value ?? 0;
+    const range = high - low + 1;
+    // A jump table costs 2 bytes for every value in the range, and a lookup
+    // table costs 4 bytes per case, so a jump table is used for ranges that are
+    // at least half full
+    const useJumpTable = cases.length > 0 && isUInt8(range) && range <= cases.length * 2;
+    const size = useJumpTable
+      ? 7 + range * 2
+      : 5 + cases.length * 4;
+    hardAssert(isUInt8(cases.length));
+
+    return {
+      maxSize: size,
+      emitPass2: () => ({
+        size,
+        emitPass3: ctx => {
+          const payload: InstructionPayloadPart[] = [];
+          if (useJumpTable) {
+            const targetByValue = new Map(cases.map(c => [c.value, c.targetBlockId]));
+            payload.push(
+              { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_TABLE_SWITCH },
+              { type: 'SInt16', value: low },
+              { type: 'UInt8', value: range },
+              { type: 'SInt16', value: ctx.offsetOfBlock(defaultTargetBlockId) },
+            );
+            for (let value = low; value <= high; value++) {
+              const targetBlockId = targetByValue.get(value) ?? defaultTargetBlockId;
+              payload.push({ type: 'SInt16', value: ctx.offsetOfBlock(targetBlockId) });
+            }
+          } else {
+            payload.push(
+              { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_LOOKUP_SWITCH },
+              { type: 'UInt8', value: cases.length },
+              { type: 'SInt16', value: ctx.offsetOfBlock(defaultTargetBlockId) },
+            );
+            for (const { value, targetBlockId } of sortedCases) {
+              payload.push(
+                { type: 'SInt16', value },
+                { type: 'SInt16', value: ctx.offsetOfBlock(targetBlockId) },
+              );
+            }
+          }
+          appendCustomInstruction(ctx.region, op, vm_TeOpcode.VM_OP_EXTENDED_2, vm_TeOpcodeEx2.VM_OP2_EXTENDED_4, ...payload);
+        }
+      })
+    }
+  }
+
   operationStoreVar(_ctx: InstructionEmitContext, op: IL.OtherOperation, index: number) {
     // Note: the index is relative to the stack depth _after_ popping
     const indexRelativeToSP = op.stackDepthBefore - 2 - index;
@@ -972,6 +1050,9 @@ type EmitPass2 = (ctx: Pass2Context) => EmitPass2Output;
 
 interface EmitPass2Output {
   size: number;
+  // Number of bytecode instructions emitted, if not exactly 1 (or 0 when the
+  // size is 0). This is what the operation costs under gas metering.
+  instructionCount?: number;
   emitPass3: EmitPass3;
 }
 
@@ -1015,6 +1096,21 @@ function appendInstructionEx1(region: BinaryRegion, opcode: vm_TeOpcodeEx1, op:
   appendCustomInstruction(region, op, vm_TeOpcode.VM_OP_EXTENDED_1, opcode);
 }
 
+// For a LoadScoped or StoreScoped of a variable in an outer closure scope,
+// returns the operand of the (depth, index) form of the instruction, which the
+// engine can resolve without walking the scope chain. Variables in the current
+// scope are already accessed directly by the relative-index form.
+//
+// The instruction also carries the relative index as a trailing byte. The
+// engine skips it, but the decoder needs it to recover the original operand.
+function outerScopedOperand(op: IL.Operation, index: number): UInt8 | undefined {
+  const staticInfo = (op as IL.ScopedOperation).staticInfo;
+  if (!staticInfo || staticInfo.depth === 0) return undefined;
+  if (!isUInt8(index)) return undefined;
+  if (!isUInt4(staticInfo.depth) || !isUInt4(staticInfo.index)) return undefined;
+  return (staticInfo.depth << 4) | staticInfo.index;
+}
+
 function instructionEx2Unsigned(opcode: vm_TeOpcodeEx2, param: UInt8, op: IL.Operation): InstructionWriter {
   return fixedSizeInstruction(2, r => appendInstructionEx2Unsigned(r, opcode, param, op));
 }
@@ -1124,6 +1220,140 @@ export function appendCustomInstruction(region: BinaryRegion, op: IL.Operation,
   }
 }
 
+/**
+ * The bytecode for a `Branch` operation. If `compareOp` is provided, it's a
+ * `BinOp` comparison immediately before the branch which is fused into the
+ * branch instruction (see `trySuperinstruction`).
+ */
+function instructionBranch(
+  ctx: InstructionEmitContext,
+  op: IL.Operation,
+  consequentTargetBlockID: string,
+  alternateTargetBlockID: string,
+  compareOp?: IL.Operation
+): InstructionWriter {
+  ctx.preferBlockToBeNext!(alternateTargetBlockID);
+  let compareBinOp: IL.BinOpCode | undefined;
+  if (compareOp) {
+    const [opOperand] = compareOp.operands;
+    hardAssert(opOperand.type === 'OpOperand');
+    compareBinOp = opOperand.subOperation as IL.BinOpCode;
+  }
+  // Note: branch IL instructions are a bit more complicated than most because
+  // they consist of two bytecode instructions. Under gas metering, the JUMP is
+  // charged by its own VM_OP4_GAS, since it doesn't run when the BRANCH is
+  // taken.
+  const gasMetering = ctx.gasMetering;
+  const maxSizeOfJumpPart = gasMetering ? 6 : 3;
+  return {
+    maxSize: (compareOp ? 4 : 3) + maxSizeOfJumpPart,
+    emitPass2: ctx => {
+      let tentativeConseqOffset = ctx.tentativeOffsetOfBlock(consequentTargetBlockID);
+      /* 😨😨😨 The offset is measured from the end of the bytecode
+       * instruction, but since this is a composite instruction, we need to
+       * compensate for the fact that we're branching from halfway through the
+       * composite instruction.
+       */
+      if (tentativeConseqOffset < 0) {
+        tentativeConseqOffset += maxSizeOfJumpPart;
+      }
+
+      const tentativeConseqOffsetIsFar = !isSInt8(tentativeConseqOffset);
+      // A fused comparison can only be used with an 8-bit offset. Otherwise
+      // the comparison needs its own instruction before the BRANCH
+      const sizeOfCompareInstr = compareOp && tentativeConseqOffsetIsFar ? 1 : 0;
+      const sizeOfBranchInstr = sizeOfCompareInstr + (tentativeConseqOffsetIsFar ? 3 : 2);
+
+      const tentativeAltOffset = ctx.tentativeOffsetOfBlock(alternateTargetBlockID);
+      const tentativeAltOffsetDistance = getJumpDistance(tentativeAltOffset);
+      const sizeOfJumpInstr =
+        tentativeAltOffsetDistance === 'far' ? 3 :
+        tentativeAltOffsetDistance === 'close' ? 2 :
+        tentativeAltOffsetDistance === 'zero' ? 0 :
+        unexpected();
+
+      const sizeOfGasInstr = gasMetering && sizeOfJumpInstr ? 3 : 0;
+
+      const size = sizeOfBranchInstr + sizeOfGasInstr + sizeOfJumpInstr;
+      const instructionCount = (sizeOfCompareInstr ? 1 : 0) + 1 + (sizeOfJumpInstr && !sizeOfGasInstr ? 1 : 0);
+
+      return {
+        size,
+        instructionCount,
+        emitPass3: ctx => {
+          let label = '';
+          let binary: UInt8[] = [];
+          const finalOffsetOfConseq = ctx.offsetOfBlock(consequentTargetBlockID) + sizeOfGasInstr + sizeOfJumpInstr;
+          const finalOffsetOfAlt = ctx.offsetOfBlock(alternateTargetBlockID);
+          hardAssert(Math.abs(finalOffsetOfConseq) <= Math.abs(tentativeConseqOffset));
+          hardAssert(Math.abs(finalOffsetOfAlt) <= Math.abs(tentativeAltOffset));
+
+          // Stick to our committed shape for the BRANCH instruction
+          if (compareOp && !tentativeConseqOffsetIsFar) {
+            const fusedOpcode = notUndefined(fusedCompareAndBranch[compareBinOp!]);
+            label += `${vm_TeOpcodeEx2[fusedOpcode]}(0x${finalOffsetOfConseq.toString(16)})`;
+            binary.push(
+              (vm_TeOpcode.VM_OP_EXTENDED_2 << 4) | fusedOpcode,
+              finalOffsetOfConseq & 0xFF
+            )
+          } else if (tentativeConseqOffsetIsFar) {
+            if (compareOp) {
+              const [opcode1, opcode2] = ilBinOpCodeToVm[compareBinOp!];
+              label += `${vm_TeOpcode[opcode1]}(0x${opcode2.toString(16)}), `;
+              binary.push((opcode1 << 4) | opcode2);
+            }
+            label += `VM_OP3_BRANCH_2(0x${finalOffsetOfConseq.toString(16)})`;
+            binary.push(
+              (vm_TeOpcode.VM_OP_EXTENDED_3 << 4) | vm_TeOpcodeEx3.VM_OP3_BRANCH_2,
+              finalOffsetOfConseq & 0xFF,
+              (finalOffsetOfConseq >> 8) & 0xFF
+            )
+          } else {
+            label += `VM_OP2_BRANCH_1(0x${finalOffsetOfConseq.toString(16)})`;
+            binary.push(
+              (vm_TeOpcode.VM_OP_EXTENDED_2 << 4) | vm_TeOpcodeEx2.VM_OP2_BRANCH_1,
+              finalOffsetOfConseq & 0xFF
+            )
+          }
+
+          if (sizeOfGasInstr) {
+            label += `, VM_OP4_GAS(1)`;
+            binary.push(...gasInstruction(1));
+          }
+
+          // Stick to our committed shape for the JUMP instruction
+          switch (tentativeAltOffsetDistance) {
+            case 'zero': break; // No instruction at all
+            case 'close': {
+              label += `, VM_OP2_JUMP_1(0x${finalOffsetOfAlt.toString(16)})`;
+              binary.push(
+                (vm_TeOpcode.VM_OP_EXTENDED_2 << 4) | vm_TeOpcodeEx2.VM_OP2_JUMP_1,
+                finalOffsetOfAlt & 0xFF
+              )
+              break;
+            }
+            case 'far': {
+              label += `, VM_OP3_JUMP_2(0x${finalOffsetOfAlt.toString(16)})`;
+              binary.push(
+                (vm_TeOpcode.VM_OP_EXTENDED_3 << 4) | vm_TeOpcodeEx3.VM_OP3_JUMP_2,
+                finalOffsetOfAlt & 0xFF,
+                (finalOffsetOfAlt >> 8) & 0xFF
+              )
+              break;
+            }
+            default: assertUnreachable(tentativeAltOffsetDistance);
+          }
+
+          const html = escapeHTML(compareOp
+            ? `${stringifyOperation(compareOp)}; ${stringifyOperation(op)}`
+            : stringifyOperation(op));
+          ctx.region.append({ binary: BinaryData(binary), html }, label, formats.preformatted2);
+        }
+      }
+    }
+  }
+}
+
 function fixedSizeInstruction(size: number, write: (region: BinaryRegion) => void): InstructionWriter {
   return {
     maxSize: size,
@@ -1142,6 +1372,238 @@ const instructionNotImplemented: InstructionWriter = {
   })
 }
 
+// A superinstruction absorbs the operations that follow it, which then occupy no
+// space in the bytecode. An absorbed operation still counts as an instruction
+// under gas metering, so that the gas charged for a block doesn't depend on
+// which operations were fused.
+const instructionAbsorbed: InstructionWriter = {
+  maxSize: 0,
+  emitPass2: () => ({
+    size: 0,
+    instructionCount: 1,
+    emitPass3: () => {}
+  })
+}
+
+interface Superinstruction {
+  writer: InstructionWriter;
+  // The number of IL operations after the first that the instruction covers
+  absorbedCount: number;
+}
+
+/**
+ * Peephole selection of superinstructions, which fuse a short sequence of IL
+ * operations into a single bytecode instruction. See "Superinstructions" in the
+ * instruction set documentation for how these sequences were chosen. Returns
+ * undefined if there is no superinstruction for the operations starting at
+ * `operations[index]`.
+ *
+ * The decoder expands each superinstruction back into the original operations,
+ * so this doesn't change the IL seen by the rest of the toolchain.
+ */
+function trySuperinstruction(
+  ctx: InstructionEmitContext,
+  operations: IL.Operation[],
+  index: number,
+  operandTypes: BinOpOperandTypes
+): Superinstruction | undefined {
+  const varBinOp = tryVarBinOpInstruction(operations, index, operandTypes);
+  if (varBinOp) {
+    return { writer: varBinOp, absorbedCount: 2 };
+  }
+
+  const op = operations[index];
+  const nextOp: IL.Operation | undefined = operations[index + 1];
+  const pair = nextOp && tryPairSuperinstruction(ctx, op, nextOp, operandTypes);
+  if (pair) {
+    return { writer: pair, absorbedCount: 1 };
+  }
+
+  return undefined;
+}
+
+/**
+ * `LoadVar(a)` followed by `LoadVar(b)` or a small integer `Literal`, followed
+ * by a number or bitwise `BinOp`: arithmetic and comparisons on local
+ * variables. The superinstruction names its operands by frame slot, which is
+ * what the IL variable index already is, so `a + b` is dispatched once rather
+ * than 3 times. It's 5 bytes rather than the 3 of the unfused sequence.
+ */
+function tryVarBinOpInstruction(
+  operations: IL.Operation[],
+  index: number,
+  operandTypes: BinOpOperandTypes
+): InstructionWriter | undefined {
+  const [load, right, binOp] = operations.slice(index, index + 3);
+  if (!binOp || load.opcode !== 'LoadVar' || binOp.opcode !== 'BinOp') {
+    return undefined;
+  }
+
+  const stackOp = varBinOpOperation(binOp, operandTypes);
+  if (stackOp === undefined) {
+    return undefined;
+  }
+
+  const leftSlot = frameSlotOfLoadVar(load);
+  if (leftSlot === undefined) {
+    return undefined;
+  }
+
+  if (right.opcode === 'LoadVar') {
+    const rightSlot = frameSlotOfLoadVar(right);
+    if (rightSlot === undefined) {
+      return undefined;
+    }
+    return customInstruction(binOp,
+      vm_TeOpcode.VM_OP_EXTENDED_2,
+      vm_TeOpcodeEx2.VM_OP2_EXTENDED_4,
+      { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_VAR_NUM_OP },
+      { type: 'UInt8', value: stackOp },
+      { type: 'UInt8', value: leftSlot },
+      { type: 'UInt8', value: rightSlot },
+    );
+  }
+
+  if (right.opcode === 'Literal') {
+    const [literalOperand] = right.operands;
+    hardAssert(literalOperand.type === 'LiteralOperand');
+    const literal = literalOperand.literal;
+    if (literal.type !== 'NumberValue' || !isSInt8(literal.value) || Object.is(literal.value, -0)) {
+      return undefined;
+    }
+    return customInstruction(binOp,
+      vm_TeOpcode.VM_OP_EXTENDED_2,
+      vm_TeOpcodeEx2.VM_OP2_EXTENDED_4,
+      { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_VAR_LIT_NUM_OP },
+      { type: 'UInt8', value: stackOp },
+      { type: 'UInt8', value: leftSlot },
+      { type: 'SInt8', value: literal.value },
+    );
+  }
+
+  return undefined;
+}
+
+/**
+ * The full instruction byte of the binary VM_OP_NUM_OP or VM_OP_BIT_OP
+ * equivalent to the `BinOp`, which is what VM_OP4_VAR_NUM_OP and
+ * VM_OP4_VAR_LIT_NUM_OP name as their operation. Undefined for operations that
+ * don't have one (e.g. `===`), and for `+` unless the operands are known to be
+ * numbers (see `trySpecializedInstruction`).
+ */
+function varBinOpOperation(binOp: IL.Operation, operandTypes: BinOpOperandTypes): number | undefined {
+  const [opOperand] = binOp.operands;
+  hardAssert(opOperand.type === 'OpOperand');
+  const opcode = opOperand.subOperation as IL.BinOpCode;
+  if (opcode === '+') {
+    const types = operandTypes.get(binOp);
+    if (types && types[0] !== 'unknown' && types[1] !== 'unknown') {
+      return (vm_TeOpcode.VM_OP_NUM_OP << 4) | vm_TeNumberOp.VM_NUM_OP_ADD_NUM;
+    }
+    return undefined;
+  }
+  const [opcode1, opcode2] = ilBinOpCodeToVm[opcode];
+  if (opcode1 !== vm_TeOpcode.VM_OP_NUM_OP && opcode1 !== vm_TeOpcode.VM_OP_BIT_OP) {
+    return undefined;
+  }
+  return (opcode1 << 4) | opcode2;
+}
+
+// The IL variable index is already relative to the frame base, which is how
+// VM_OP4_VAR_NUM_OP and VM_OP4_VAR_LIT_NUM_OP address their operands
+function frameSlotOfLoadVar(op: IL.Operation): number | undefined {
+  const [indexOperand] = op.operands;
+  hardAssert(indexOperand.type === 'IndexOperand');
+  return isUInt8(indexOperand.index) ? indexOperand.index : undefined;
+}
+
+// Superinstructions that fuse a pair of IL operations
+function tryPairSuperinstruction(
+  ctx: InstructionEmitContext,
+  op: IL.Operation,
+  nextOp: IL.Operation,
+  operandTypes: BinOpOperandTypes
+): InstructionWriter | undefined {
+  // `LoadGlobal` + `Literal(undefined)`: the callee and `this` for a call to a
+  // global function
+  if (op.opcode === 'LoadGlobal' && nextOp.opcode === 'Literal') {
+    const [nameOperand] = op.operands;
+    const [literalOperand] = nextOp.operands;
+    hardAssert(nameOperand.type === 'NameOperand' && literalOperand.type === 'LiteralOperand');
+    if (literalOperand.literal.type === 'UndefinedValue') {
+      const slotIndex = ctx.indexOfGlobalSlot(nameOperand.name);
+      return instructionEx3Unsigned(vm_TeOpcodeEx3.VM_OP3_LOAD_GLOBAL_CALLEE, slotIndex, op);
+    }
+  }
+
+  // `Literal` + `ObjectGet`: property access with a constant key. Literals that
+  // have a 1-byte form are not fused because the pair is already only 2 bytes.
+  if (op.opcode === 'Literal' && nextOp.opcode === 'ObjectGet') {
+    const [literalOperand] = op.operands;
+    hardAssert(literalOperand.type === 'LiteralOperand');
+    if (tryGetSmallLiteralCode(literalOperand.literal) === undefined) {
+      return instructionEx3Unsigned(vm_TeOpcodeEx3.VM_OP3_OBJECT_GET_2, ctx.encodeValue(literalOperand.literal), op);
+    }
+  }
+
+  // `BinOp(<)` or `BinOp(<=)` + `Branch`: the condition of a counting loop.
+  // Only fused where both operands are inferred to be integers, since that's
+  // the case the fused instruction is optimized for, although it still handles
+  // other types correctly.
+  if (op.opcode === 'BinOp' && nextOp.opcode === 'Branch') {
+    const [opOperand] = op.operands;
+    hardAssert(opOperand.type === 'OpOperand');
+    const types = operandTypes.get(op);
+    if (fusedCompareAndBranch[opOperand.subOperation as IL.BinOpCode] !== undefined &&
+      types && types[0] === 'int' && types[1] === 'int'
+    ) {
+      const [consequentOperand, alternateOperand] = nextOp.operands;
+      hardAssert(consequentOperand.type === 'LabelOperand' && alternateOperand.type === 'LabelOperand');
+      return instructionBranch(ctx, nextOp, consequentOperand.targetBlockId, alternateOperand.targetBlockId, op);
+    }
+  }
+
+  // `Call` + `Return`: a call in tail position, which is what `return f(...)`
+  // compiles to. Only dynamic calls are fused, since statically-resolved calls
+  // don't have the function on the stack for the callee frame to reuse. A
+  // return from inside a `try` block is preceded by `EndTry`, so the fused
+  // pair never occurs in a frame with an active catch target.
+  if (op.opcode === 'Call' && nextOp.opcode === 'Return') {
+    const [argCountOperand, isVoidCallOperand] = op.operands;
+    hardAssert(argCountOperand.type === 'CountOperand' && isVoidCallOperand.type === 'FlagOperand');
+    if (!(op as IL.CallOperation).staticInfo?.target && !isVoidCallOperand.flag && argCountOperand.count <= 127) {
+      return customInstruction(op,
+        vm_TeOpcode.VM_OP_EXTENDED_2,
+        vm_TeOpcodeEx2.VM_OP2_EXTENDED_4,
+        { type: 'UInt8', value: vm_TeOpcodeEx4.VM_OP4_TAIL_CALL },
+        { type: 'UInt8', value: argCountOperand.count },
+      );
+    }
+  }
+
+  return undefined;
+}
+
+/**
+ * Type-specialized instructions for operations whose operand types are known
+ * from `inferBinOpOperandTypes`. Returns undefined if the operation needs the
+ * general-purpose instruction.
+ */
+function trySpecializedInstruction(op: IL.Operation, operandTypes: BinOpOperandTypes): InstructionWriter | undefined {
+  // `+` where neither operand can be a string doesn't need the string checks
+  // in VM_OP1_ADD
+  if (op.opcode === 'BinOp') {
+    const [opOperand] = op.operands;
+    hardAssert(opOperand.type === 'OpOperand');
+    const types = operandTypes.get(op);
+    if (opOperand.subOperation === '+' && types && types[0] !== 'unknown' && types[1] !== 'unknown') {
+      return instructionPrimary(vm_TeOpcode.VM_OP_NUM_OP, vm_TeNumberOp.VM_NUM_OP_ADD_NUM, op);
+    }
+  }
+
+  return undefined;
+}
+
 const instructionNotImplementedFormat: Format<Labelled<undefined>> = {
   binaryFormat: () => [0],
   htmlFormat: formats.tableRow(() => 'Instruction not implemented')
@@ -1185,6 +1647,51 @@ const ilBinOpCodeToVm: Record<IL.BinOpCode, [vm_TeOpcode, vm_TeOpcodeEx1 | vm_Te
   // Note: Logical AND and OR are implemented via the BRANCH opcode
 }
 
+// Comparisons that can be fused with a following `Branch` (see
+// `trySuperinstruction`)
+const fusedCompareAndBranch: Partial<Record<IL.BinOpCode, vm_TeOpcodeEx2>> = {
+  ['<' ]: vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_THAN_1,
+  ['<=']: vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_EQUAL_1,
+}
+
+function tryGetSmallLiteralCode(param: IL.Value): vm_TeSmallLiteralValue | undefined {
+  switch (param.type) {
+    case 'NullValue': return vm_TeSmallLiteralValue.VM_SLV_NULL;
+    case 'UndefinedValue': return vm_TeSmallLiteralValue.VM_SLV_UNDEFINED;
+    case 'NumberValue':
+      if (Object.is(param.value, -0)) return undefined;
+      switch (param.value) {
+        case -1: return vm_TeSmallLiteralValue.VM_SLV_INT_MINUS_1;
+        case 0: return vm_TeSmallLiteralValue.VM_SLV_INT_0;
+        case 1: return vm_TeSmallLiteralValue.VM_SLV_INT_1;
+        case 2: return vm_TeSmallLiteralValue.VM_SLV_INT_2;
+        case 3: return vm_TeSmallLiteralValue.VM_SLV_INT_3;
+        case 4: return vm_TeSmallLiteralValue.VM_SLV_INT_4;
+        case 5: return vm_TeSmallLiteralValue.VM_SLV_INT_5;
+        default: return undefined;
+      }
+    case 'StringValue':
+      return undefined;
+    case 'BooleanValue':
+      return param.value
+        ? vm_TeSmallLiteralValue.VM_SLV_TRUE
+        : vm_TeSmallLiteralValue.VM_SLV_FALSE;
+    case 'EphemeralFunctionValue':
+    case 'EphemeralObjectValue':
+    case 'ClassValue':
+    case 'FunctionValue':
+    case 'HostFunctionValue':
+    case 'DeletedValue':
+    case 'ReferenceValue':
+    case 'ProgramAddressValue':
+    case 'ResumePoint':
+    case 'NoOpFunction':
+      return undefined;
+    default:
+      return assertUnreachable(param);
+  }
+}
+
 function getJumpDistance(offset: SInt16) {
   const distance: 'zero' | 'close' | 'far' =
     offset === 0 ? 'zero' :
@@ -1252,10 +1759,20 @@ function resolveOperand(operand: IL.Operand, expectedType: IL.OperandType) {
         return invalidOperation('Expected flag operand');
       }
       return operand.flag;
+    case 'CasesOperand':
+      if (operand.type !== 'CasesOperand') {
+        return invalidOperation('Expected cases operand');
+      }
+      return operand.cases.map<SwitchCase>(({ value, target }) => ({ value, targetBlockId: target.targetBlockId }));
     default: assertUnreachable(expectedType);
   }
 }
 
+interface SwitchCase {
+  value: number;
+  targetBlockId: string;
+}
+
 export type CallInfo = {
   type: 'InternalFunction'
   functionID: IL.FunctionID,
@@ -18,7 +18,13 @@ import { stringifyValue } from './stringify-il';
 import { CallInfo, InstructionEmitContext, FutureInstructionSourceMapping, writeFunctionBody } from './encode-snapshot-function-body';
 import { SourceMap } from './source-map';
 
-export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean, generateSourceMap: boolean): {
+export function encodeSnapshot(
+  snapshot: SnapshotIL,
+  generateDebugHTML: boolean,
+  generateSourceMap: boolean,
+  // Functions to mark with the native flag, for `generateNativeC`
+  isNativeFunction?: (functionID: IL.FunctionID) => boolean
+): {
   snapshot: SnapshotClass,
   html?: HTML
 } {
@@ -130,6 +136,9 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
 
   const shortCallTable = new Array<CallInfo>();
 
+  // Shapes (see TsShapedObject), keyed by the JSON of their list of keys
+  const shapes = new Map<string, Referenceable>();
+
   let requiredFeatureFlags = 0;
   for (const flag of snapshot.flags) {
     hardAssert(flag >=0 && flag < 32);
@@ -204,8 +213,18 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
     };
   }
 
+  let nativeFunctions: Map<IL.FunctionID, number> | undefined;
+  if (isNativeFunction) {
+    nativeFunctions = new Map();
+    for (const [functionID, offset] of functionOffsets) {
+      if (isNativeFunction(functionID)) {
+        nativeFunctions.set(functionID, offset.lastValue ?? unexpected());
+      }
+    }
+  }
+
   return {
-    snapshot: new SnapshotClass(snapshotBuffer, { names }, sourceMap),
+    snapshot: new SnapshotClass(snapshotBuffer, { names }, sourceMap, nativeFunctions),
     html: generateDebugHTML ? bytecode.toHTML() : undefined
   };
 
@@ -450,8 +469,8 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
     const errorMessage = getString('Not available on this host (detached)')
 
     // This is a stub function that just throws an MVM_E_DETACHED_EPHEMERAL
-    // error when called
-    const maxStackDepth = 0;
+    // error when called. The thrown message occupies one stack slot.
+    const maxStackDepth = 1;
 
     const name = 'Detached func';
     writeFunctionHeader(output, maxStackDepth, name);
@@ -712,6 +731,18 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
     const typeCode = TeTypeCode.TC_REF_PROPERTY_LIST;
     const keys = Object.keys(properties);
 
+    // Shapes only save space for objects in RAM with at least 2 keys, since
+    // the shape pointer itself costs 2 bytes. Objects with internal slots
+    // (e.g. promises) are accessed by slot index, so they keep the
+    // TsPropertyList layout.
+    if (snapshot.flags.has(IL.ExecutionFlag.ShapedObjects) &&
+      memoryRegion === 'gc' &&
+      keys.length >= 2 &&
+      internalSlots.length === 2
+    ) {
+      return writeShapedObject(region, prototype, properties, keys, memoryRegion, debugName);
+    }
+
     hardAssert(internalSlots.length >= 2); // The first two internal slots are reserved
     hardAssert(internalSlots[0].type === 'DeletedValue');
     hardAssert(internalSlots[1].type === 'DeletedValue');
@@ -740,6 +771,45 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
     return offsetToReferenceable(objectOffset, memoryRegion, `object(${debugName})`);
   }
 
+  function writeShapedObject(region: BinaryRegion, prototype: IL.Value, properties: IL.ObjectProperties, keys: string[], memoryRegion: MemoryRegionID, debugName: string): Referenceable {
+    // See TsShapedObject
+    const shape = getShape(keys);
+
+    const size = 6 + keys.length * 2;
+    const headerWord = makeHeaderWord(size, TeTypeCode.TC_REF_SHAPED_OBJECT);
+    padToNextAddressable(region, { headerSize: 2 });
+    region.append(headerWord, 'TsShapedObject.[header]', formats.uHex16LERow);
+    const objectOffset = region.currentOffset;
+    region.append(vm_TeWellKnownValues.VM_VALUE_NULL, 'TsShapedObject.dpNext', formats.uHex16LERow);
+    writeValue(region, prototype, memoryRegion, `TsShapedObject.dpProto`);
+    region.append(shape.getPointer(memoryRegion, 'TsShapedObject.dpShape'), 'TsShapedObject.dpShape', formats.uHex16LERow);
+
+    for (const k of keys) {
+      writeValue(region, properties[k], memoryRegion, `TsShapedObject.values[${k}]`);
+    }
+
+    return offsetToReferenceable(objectOffset, memoryRegion, `object(${debugName})`);
+  }
+
+  // Returns the shape for the given list of keys, writing it to ROM the first
+  // time it's used. A shape is a TsFixedLengthArray of keys.
+  function getShape(keys: string[]): Referenceable {
+    const shapeKey = JSON.stringify(keys);
+    let shape = shapes.get(shapeKey);
+    if (!shape) {
+      padToNextAddressable(romAllocations, { headerSize: 2 });
+      const headerWord = makeHeaderWord(keys.length * 2, TeTypeCode.TC_REF_FIXED_LENGTH_ARRAY);
+      romAllocations.append(headerWord, 'shape.[header]', formats.uHex16LERow);
+      const shapeOffset = romAllocations.currentOffset;
+      for (const [i, k] of keys.entries()) {
+        writeValue(romAllocations, { type: 'StringValue', value: k }, 'bytecode', `shape.keys[${i}]`);
+      }
+      shape = offsetToReferenceable(shapeOffset, 'bytecode', `shape(${keys.join(', ')})`);
+      shapes.set(shapeKey, shape);
+    }
+    return shape;
+  }
+
   // The exact encoding of a reference (pointer) depend on where the value is
   // being referenced from. For example, a pointer in ROM referencing an
   // allocation in GC memory will actually be a pointer to a handle. See
@@ -938,11 +1008,14 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
 
       sourceMapAdd: !generateSourceMap ? undefined : (mapping: FutureInstructionSourceMapping) => {
         futureSourceMap.push(mapping);
-      }
+      },
+
+      gasMetering: snapshot.flags.has(IL.ExecutionFlag.GasMetering),
     };
 
     for (const [name, func] of snapshot.functions.entries()) {
-      const { functionOffset } = writeFunction(output, func, ctx, addressableReferences);
+      const native = isNativeFunction?.(name) ?? false;
+      const { functionOffset } = writeFunction(output, func, native, ctx, addressableReferences);
       const offset = notUndefined(functionOffsets.get(name));
       offset.assign(functionOffset);
       const ref = notUndefined(functionReferences.get(name));
@@ -971,22 +1044,25 @@ export function encodeSnapshot(snapshot: SnapshotIL, generateDebugHTML: boolean,
 function writeFunction(
   output: BinaryRegion,
   func: IL.Function,
+  native: boolean,
   ctx: InstructionEmitContext,
   addressableReferences: Map<string, Future<Referenceable>>
 ) {
-  writeFunctionHeader(output, func.maxStackDepth, func.id);
+  writeFunctionHeader(output, func.maxStackDepth, func.id, native);
   const functionOffset = output.currentOffset;
   ctx.addName(functionOffset, 'allocation', func.id);
   writeFunctionBody(output, func, ctx, addressableReferences);
   return { functionOffset };
 }
 
-function writeFunctionHeader(output: BinaryRegion, maxStackDepth: number, funcId: string) {
+function writeFunctionHeader(output: BinaryRegion, maxStackDepth: number, funcId: string, native: boolean = false) {
   const typeCode = TeTypeCode.TC_REF_FUNCTION;
   const continuationFlag: 0 | 1 = 0;
+  // Set if the function is compiled ahead of time to C (see generateNativeC)
+  const nativeFlag: 0 | 1 = native ? 1 : 0;
   // Allocation headers on functions are different. Nothing needs the allocation
   // size specifically, so the 12 size bits are repurposed.
-  const headerWord = UInt8(maxStackDepth) | (continuationFlag << 11) | (typeCode << 12);
+  const headerWord = UInt8(maxStackDepth) | (nativeFlag << 8) | (continuationFlag << 11) | (typeCode << 12);
   output.padToQuad(formats.paddingRow, 2);
   output.append(headerWord, `Func alloc header (${funcId})`, formats.uHex16LERow);
 }
@@ -0,0 +1,526 @@
+import { Snapshot } from '../lib';
+import { invalidOperation, unexpected } from './utils';
+import { vm_TeOpcode, vm_TeOpcodeEx1, vm_TeOpcodeEx2, vm_TeOpcodeEx3, vm_TeOpcodeEx4, vm_TeNumberOp, vm_TeBitwiseOp, vm_TeSmallLiteralValue } from './bytecode-opcodes';
+import { vm_TeWellKnownValues } from './runtime-types';
+
+/*
+ * Ahead-of-time compiler from bytecode to C
+ *
+ * This translates the functions that a snapshot marks as native (the
+ * `nativeFunctions` snapshotting option) into a C file, to be compiled into a
+ * host whose engine has MVM_AOT enabled. It works from the final bytecode
+ * rather than the IL, since the generated code needs the bytecode address of
+ * every instruction at which it hands control back to the interpreter.
+ *
+ * The C for each instruction mirrors what the engine's JIT (MVM_JIT) emits:
+ * the function runs in the frame that the interpreter set up for the call, all
+ * values stay in the frame's stack slots (so the GC sees them), and anything
+ * that isn't translated, including `return`, calls, and arithmetic on
+ * anything other than int14 values, returns MVM_AOT_EXIT with the address and
+ * stack depth at which the interpreter takes over. The stack depth at each
+ * instruction is known at compile time, so every stack slot access is at a
+ * constant index.
+ */
+
+export interface GenerateNativeCOptions {
+  // Name of the exported `mvm_TsAotFunctionTable`. Defaults to `mvm_aotFunctions`.
+  tableName?: string;
+}
+
+type InstructionOp =
+  | 'exit' // Not translated. Exits to the interpreter.
+  | 'return' // Exits to the interpreter, which returns
+  | 'nop'
+  | 'literal' // operand: value
+  | 'loadVar' // operand: index relative to the stack pointer
+  | 'storeVar' // operand: index relative to the stack pointer, after the pop
+  | 'loadArg' // operand: argument index
+  | 'pop' // operand: count
+  | 'binary' // operand: NUM_OP or BIT_OP instruction byte, or BINARY_EQUAL/BINARY_NOT_EQUAL
+  | 'varBinary' // operand: as above; left, right: frame slots
+  | 'varLitBinary' // operand: as above; left: frame slot; right: int8 literal
+  | 'branch'
+  | 'branchCompare' // operand: vm_TeNumberOp
+  | 'jump'
+  | 'getProperty' // (key on the stack)
+  | 'getPropertyKey' // operand: key
+  | 'setProperty' // (key on the stack)
+  | 'setPropertyKey' // operand: key
+  | 'newObject';
+
+interface Instruction {
+  op: InstructionOp;
+  name: string;
+  size: number;
+  operand: number;
+  left: number;
+  right: number;
+  target: number; // Bytecode address of the branch or jump target
+}
+
+// Operands for 'binary' meaning strict equality and inequality, which aren't
+// NUM_OP instructions
+const BINARY_EQUAL = (vm_TeOpcode.VM_OP_EXTENDED_1 << 4) | vm_TeOpcodeEx1.VM_OP1_EQUAL;
+const BINARY_NOT_EQUAL = (vm_TeOpcode.VM_OP_EXTENDED_1 << 4) | vm_TeOpcodeEx1.VM_OP1_NOT_EQUAL;
+
+const smallLiterals: Record<number, number> = {
+  [vm_TeSmallLiteralValue.VM_SLV_DELETED]: vm_TeWellKnownValues.VM_VALUE_DELETED,
+  [vm_TeSmallLiteralValue.VM_SLV_UNDEFINED]: vm_TeWellKnownValues.VM_VALUE_UNDEFINED,
+  [vm_TeSmallLiteralValue.VM_SLV_NULL]: vm_TeWellKnownValues.VM_VALUE_NULL,
+  [vm_TeSmallLiteralValue.VM_SLV_FALSE]: vm_TeWellKnownValues.VM_VALUE_FALSE,
+  [vm_TeSmallLiteralValue.VM_SLV_TRUE]: vm_TeWellKnownValues.VM_VALUE_TRUE,
+  [vm_TeSmallLiteralValue.VM_SLV_INT_MINUS_1]: encodeInt14(-1),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_0]: encodeInt14(0),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_1]: encodeInt14(1),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_2]: encodeInt14(2),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_3]: encodeInt14(3),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_4]: encodeInt14(4),
+  [vm_TeSmallLiteralValue.VM_SLV_INT_5]: encodeInt14(5),
+};
+
+export function generateNativeC(snapshot: Snapshot, opts: GenerateNativeCOptions = {}): string {
+  const nativeFunctions = snapshot.nativeFunctions;
+  if (!nativeFunctions) {
+    return invalidOperation('The snapshot has no native functions. Create it with the `nativeFunctions` option.');
+  }
+  const tableName = opts.tableName ?? 'mvm_aotFunctions';
+  const bytecode = snapshot.data;
+  const bytecodeSize = bytecode.readUInt16LE(4);
+  const crc = bytecode.readUInt16LE(6);
+
+  const functions = [...nativeFunctions]
+    .map(([id, address]) => ({ id, address, cName: `aot_${id.replace(/[^A-Za-z0-9_]/g, '_')}_${hex(address)}` }))
+    .sort((a, b) => a.address - b.address);
+
+  const lines: string[] = [];
+  lines.push(
+    '/*',
+    ' * Generated by Microvium `generateNativeC`. Do not edit.',
+    ' *',
+    ` * Native implementations of ${functions.length} bytecode function(s) of the`,
+    ` * snapshot with CRC 0x${hex(crc)}. Pass \`&${tableName}\` to`,
+    ' * `mvm_aot_setFunctions` after restoring that snapshot.',
+    ' */',
+    '#include <stdint.h>',
+    '#include <stdbool.h>',
+    '#include "microvium.h"',
+    '',
+    '#if !MVM_AOT',
+    '#error "Native functions require MVM_AOT in the port file"',
+    '#endif',
+    '',
+    `#define AOT_UNDEFINED 0x${hex(vm_TeWellKnownValues.VM_VALUE_UNDEFINED)}`,
+    `#define AOT_TRUE 0x${hex(vm_TeWellKnownValues.VM_VALUE_TRUE)}`,
+    `#define AOT_FALSE 0x${hex(vm_TeWellKnownValues.VM_VALUE_FALSE)}`,
+    `#define AOT_DELETED 0x${hex(vm_TeWellKnownValues.VM_VALUE_DELETED)}`,
+    '#define AOT_IS_INT14(v) (((v) & 3) == 3)',
+    '#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)',
+    '#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)',
+    '#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))',
+    '#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))',
+    '#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)',
+    '',
+  );
+
+  const compiled: typeof functions = [];
+  for (const func of functions) {
+    const body = generateFunction(func.address);
+    if (!body) {
+      lines.push(`// ${func.id} (0x${hex(func.address)}) is not translated, since its stack depth isn't static`, '');
+      continue;
+    }
+    compiled.push(func);
+    lines.push(
+      `// ${func.id}`,
+      `static uint32_t ${func.cName}(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {`,
+      '  (void)vm; (void)pArgs; (void)argCount;',
+      ...body,
+      '}',
+      '',
+    );
+  }
+
+  lines.push(`static const mvm_TsAotFunction ${tableName}_entries[] = {`);
+  for (const func of compiled) {
+    lines.push(`  { 0x${hex(func.address)}, ${func.cName} },`);
+  }
+  if (compiled.length === 0) {
+    // C doesn't allow an empty initializer
+    lines.push('  { 0, 0 },');
+  }
+  lines.push(
+    '};',
+    '',
+    `const mvm_TsAotFunctionTable ${tableName} = {`,
+    `  0x${hex(crc)},`,
+    `  ${compiled.length},`,
+    `  ${tableName}_entries,`,
+    '};',
+    '',
+  );
+
+  return lines.join('\n');
+
+  /**
+   * The lines of C for the function body, or undefined if the function can't
+   * be translated
+   */
+  function generateFunction(entry: number): string[] | undefined {
+    const maxDepth = bytecode.readUInt16LE(entry - 2) & 0xFF;
+
+    // Pass 1: reachable instructions and the stack depth at each
+    const depths = new Map<number, number>();
+    const labels = new Set<number>();
+    const worklist = [entry];
+    depths.set(entry, 0);
+    while (worklist.length) {
+      const address = worklist.pop()!;
+      const depth = depths.get(address) ?? unexpected();
+      const instr = decode(address);
+      const after = depthAfter(instr, depth);
+      if (after < 0 || after > maxDepth) return undefined;
+      for (const next of successors(address, instr)) {
+        if (next >= bytecodeSize) return undefined;
+        if (next !== address + instr.size) labels.add(next);
+        const existing = depths.get(next);
+        if (existing === undefined) {
+          depths.set(next, after);
+          worklist.push(next);
+        } else if (existing !== after) {
+          return undefined;
+        }
+      }
+    }
+
+    // Pass 2: the C, in address order
+    const body: string[] = [];
+    const addresses = [...depths.keys()].sort((a, b) => a - b);
+    let fallthrough: number | undefined;
+    for (const address of addresses) {
+      if (fallthrough !== undefined && fallthrough !== address) {
+        body.push(`  goto L_${hex(fallthrough)};`);
+        labels.add(fallthrough);
+      }
+      const depth = depths.get(address)!;
+      const instr = decode(address);
+      body.push(`L_${hex(address)}: // ${instr.name}, depth ${depth}`);
+      body.push(...generateInstruction(address, instr, depth).map(line => '  ' + line));
+      fallthrough = (instr.op === 'exit' || instr.op === 'return' || instr.op === 'jump')
+        ? undefined
+        : address + instr.size;
+    }
+    if (fallthrough !== undefined) {
+      body.push(`  goto L_${hex(fallthrough)};`);
+      labels.add(fallthrough);
+    }
+
+    // Only the labels that are jumped to, since unused labels are a warning
+    return body.map(line => {
+      const match = line.match(/^L_([0-9A-F]{4}):(.*)$/);
+      if (match && !labels.has(parseInt(match[1], 16))) {
+        return '  ' + match[2].trim();
+      }
+      return line;
+    });
+  }
+
+  function generateInstruction(address: number, instr: Instruction, depth: number): string[] {
+    const exit = `return MVM_AOT_EXIT(0x${hex(address)}, ${depth});`;
+    const slot = (i: number) => `f[${i}]`;
+    switch (instr.op) {
+      case 'exit':
+      case 'return':
+        return [exit];
+      case 'nop':
+      case 'pop':
+        return [];
+      case 'literal':
+        return [`${slot(depth)} = 0x${hex(instr.operand)};`];
+      case 'loadVar': {
+        const source = slot(depth - instr.operand - 1);
+        return [
+          // The interpreter throws the TDZ error
+          `if (${source} == AOT_DELETED) ${exit}`,
+          `${slot(depth)} = ${source};`,
+        ];
+      }
+      case 'storeVar':
+        return [`${slot(depth - instr.operand - 2)} = ${slot(depth - 1)};`];
+      case 'loadArg':
+        return [`${slot(depth)} = (${instr.operand} < argCount) ? pArgs[${instr.operand}] : AOT_UNDEFINED;`];
+      case 'binary':
+        return binaryOp(instr.operand, slot(depth - 2), slot(depth - 1), slot(depth - 2), exit);
+      case 'varBinary':
+        // A deleted value isn't an int14, so the TDZ check is part of the
+        // int14 check
+        return binaryOp(instr.operand, slot(instr.left), slot(instr.right), slot(depth), exit);
+      case 'varLitBinary':
+        return binaryOp(instr.operand, slot(instr.left), `AOT_INT14(${instr.right})`, slot(depth), exit);
+      case 'branch': {
+        const v = slot(depth - 1);
+        return [
+          `if ((${v} == AOT_TRUE) || ((${v} != AOT_FALSE) && (${v} != AOT_INT14(0)) && (AOT_IS_INT14(${v}) || mvm_toBool(vm, ${v})))) goto L_${hex(instr.target)};`
+        ];
+      }
+      case 'branchCompare': {
+        const operator = instr.operand === vm_TeNumberOp.VM_NUM_OP_LESS_THAN ? '<' : '<=';
+        const a = slot(depth - 2);
+        const b = slot(depth - 1);
+        return [
+          `if (!AOT_BOTH_INT14(${a}, ${b})) ${exit}`,
+          `if ((int16_t)${a} ${operator} (int16_t)${b}) goto L_${hex(instr.target)};`,
+        ];
+      }
+      case 'jump':
+        return [`goto L_${hex(instr.target)};`];
+      case 'getProperty':
+        // Nothing has been written to the frame if the property read fails, so
+        // the interpreter reads it again and reports the error
+        return [`if (mvm_aot_getProperty(vm, &${slot(depth)}) != MVM_E_SUCCESS) ${exit}`];
+      case 'getPropertyKey':
+        return [`if (mvm_aot_getPropertyKey(vm, &${slot(depth)}, 0x${hex(instr.operand)}) != MVM_E_SUCCESS) ${exit}`];
+      case 'setProperty':
+        return [`if (mvm_aot_setProperty(vm, &${slot(depth)}) != MVM_E_SUCCESS) ${exit}`];
+      case 'setPropertyKey':
+        return [`if (mvm_aot_setPropertyKey(vm, &${slot(depth)}, 0x${hex(instr.operand)}) != MVM_E_SUCCESS) ${exit}`];
+      case 'newObject':
+        return [`if (mvm_aot_newObject(vm, &${slot(depth)}) != MVM_E_SUCCESS) ${exit}`];
+      default:
+        return unexpected();
+    }
+  }
+
+  /**
+   * The int14 case of a binary operation. Anything else exits.
+   */
+  function binaryOp(op: number, a: string, b: string, result: string, exit: string): string[] {
+    const check = `if (!AOT_BOTH_INT14(${a}, ${b})) ${exit}`;
+    // The encoding preserves the order of int14 values
+    const compare = (operator: string) => [check, `${result} = AOT_BOOL((int16_t)${a} ${operator} (int16_t)${b});`];
+    const arithmetic = (operator: string) => [
+      check,
+      `{`,
+      `  int32_t r = AOT_INT14_VALUE(${a}) ${operator} AOT_INT14_VALUE(${b});`,
+      `  if (!AOT_IN_INT14_RANGE(r)) ${exit}`,
+      `  ${result} = AOT_INT14(r);`,
+      `}`,
+    ];
+    switch (op) {
+      case numOp(vm_TeNumberOp.VM_NUM_OP_LESS_THAN): return compare('<');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_GREATER_THAN): return compare('>');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_LESS_EQUAL): return compare('<=');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_GREATER_EQUAL): return compare('>=');
+      case BINARY_EQUAL: return compare('==');
+      case BINARY_NOT_EQUAL: return compare('!=');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_ADD_NUM): return arithmetic('+');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_SUBTRACT): return arithmetic('-');
+      case numOp(vm_TeNumberOp.VM_NUM_OP_MULTIPLY): return arithmetic('*');
+      // The bitwise operations work directly on the encoded values, apart from
+      // the tag bits of XOR
+      case bitOp(vm_TeBitwiseOp.VM_BIT_OP_OR): return [check, `${result} = ${a} | ${b};`];
+      case bitOp(vm_TeBitwiseOp.VM_BIT_OP_AND): return [check, `${result} = ${a} & ${b};`];
+      case bitOp(vm_TeBitwiseOp.VM_BIT_OP_XOR): return [check, `${result} = (mvm_Value)((${a} ^ ${b}) | 3);`];
+      default: return unexpected();
+    }
+  }
+
+  function decode(address: number): Instruction {
+    const available = bytecodeSize - address;
+    const b = bytecode.readUInt8(address);
+    const n = b & 0xF;
+    const instr: Instruction = { op: 'exit', name: opcodeName(address), size: 1, operand: 0, left: 0, right: 0, target: 0 };
+    const set = (op: InstructionOp, operand = 0) => { instr.op = op; instr.operand = operand; };
+
+    switch (b >> 4) {
+      case vm_TeOpcode.VM_OP_LOAD_SMALL_LITERAL:
+        if (n in smallLiterals) set('literal', smallLiterals[n]);
+        return instr;
+      case vm_TeOpcode.VM_OP_LOAD_VAR_1: set('loadVar', n); return instr;
+      case vm_TeOpcode.VM_OP_LOAD_ARG_1: set('loadArg', n); return instr;
+      case vm_TeOpcode.VM_OP_STORE_VAR_1: set('storeVar', n); return instr;
+      case vm_TeOpcode.VM_OP_NUM_OP:
+      case vm_TeOpcode.VM_OP_BIT_OP:
+        if (isBinaryOp(b)) set('binary', b);
+        return instr;
+      case vm_TeOpcode.VM_OP_EXTENDED_1:
+        switch (n) {
+          case vm_TeOpcodeEx1.VM_OP1_RETURN: set('return'); break;
+          case vm_TeOpcodeEx1.VM_OP1_POP: set('pop', 1); break;
+          case vm_TeOpcodeEx1.VM_OP1_OBJECT_GET_1: set('getProperty'); break;
+          case vm_TeOpcodeEx1.VM_OP1_OBJECT_SET_1: set('setProperty'); break;
+          case vm_TeOpcodeEx1.VM_OP1_OBJECT_NEW: set('newObject'); break;
+          // The int14 case of `+` is the same as for VM_NUM_OP_ADD_NUM, and
+          // anything else exits
+          case vm_TeOpcodeEx1.VM_OP1_ADD: set('binary', numOp(vm_TeNumberOp.VM_NUM_OP_ADD_NUM)); break;
+          case vm_TeOpcodeEx1.VM_OP1_EQUAL:
+          case vm_TeOpcodeEx1.VM_OP1_NOT_EQUAL:
+            set('binary', b);
+            break;
+        }
+        return instr;
+      case vm_TeOpcode.VM_OP_EXTENDED_2: {
+        if (available < 2) return instr;
+        const x = bytecode.readUInt8(address + 1);
+        switch (n) {
+          case vm_TeOpcodeEx2.VM_OP2_BRANCH_1: set('branch'); break;
+          case vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_THAN_1: set('branchCompare', vm_TeNumberOp.VM_NUM_OP_LESS_THAN); break;
+          case vm_TeOpcodeEx2.VM_OP2_BRANCH_LESS_EQUAL_1: set('branchCompare', vm_TeNumberOp.VM_NUM_OP_LESS_EQUAL); break;
+          case vm_TeOpcodeEx2.VM_OP2_JUMP_1: set('jump'); break;
+          case vm_TeOpcodeEx2.VM_OP2_LOAD_VAR_2: set('loadVar', x); break;
+          case vm_TeOpcodeEx2.VM_OP2_STORE_VAR_2: set('storeVar', x); break;
+          case vm_TeOpcodeEx2.VM_OP2_LOAD_ARG_2: set('loadArg', x); break;
+          case vm_TeOpcodeEx2.VM_OP2_EXTENDED_4: decodeEx4(address, x, instr); return instr;
+          default: return instr;
+        }
+        instr.size = 2;
+        instr.target = address + 2 + ((x << 24) >> 24);
+        return instr;
+      }
+      case vm_TeOpcode.VM_OP_EXTENDED_3: {
+        if (n === vm_TeOpcodeEx3.VM_OP3_POP_N) {
+          if (available >= 2) {
+            set('pop', bytecode.readUInt8(address + 1));
+            instr.size = 2;
+          }
+          return instr;
+        }
+        if (available < 3) return instr;
+        const x = bytecode.readUInt16LE(address + 1);
+        switch (n) {
+          case vm_TeOpcodeEx3.VM_OP3_JUMP_2: set('jump'); break;
+          case vm_TeOpcodeEx3.VM_OP3_BRANCH_2: set('branch'); break;
+          case vm_TeOpcodeEx3.VM_OP3_LOAD_LITERAL: set('literal', x); break;
+          case vm_TeOpcodeEx3.VM_OP3_OBJECT_GET_2: set('getPropertyKey', x); break;
+          case vm_TeOpcodeEx3.VM_OP3_OBJECT_SET_2: set('setPropertyKey', x); break;
+          default: return instr;
+        }
+        instr.size = 3;
+        instr.target = address + 3 + ((x << 16) >> 16);
+        return instr;
+      }
+      default:
+        return instr;
+    }
+  }
+
+  function decodeEx4(address: number, x: number, instr: Instruction) {
+    const available = bytecodeSize - address;
+    switch (x) {
+      case vm_TeOpcodeEx4.VM_OP4_GAS:
+        // The native code only runs while the gas counter is off
+        if (available >= 3) {
+          instr.op = 'nop';
+          instr.size = 3;
+        }
+        return;
+      case vm_TeOpcodeEx4.VM_OP4_VAR_NUM_OP:
+      case vm_TeOpcodeEx4.VM_OP4_VAR_LIT_NUM_OP: {
+        if (available < 5) return;
+        const op = bytecode.readUInt8(address + 2);
+        if (!isBinaryOp(op) || (op >> 4) === vm_TeOpcode.VM_OP_EXTENDED_1) return;
+        instr.op = x === vm_TeOpcodeEx4.VM_OP4_VAR_NUM_OP ? 'varBinary' : 'varLitBinary';
+        instr.size = 5;
+        instr.operand = op;
+        instr.left = bytecode.readUInt8(address + 3);
+        instr.right = instr.op === 'varBinary'
+          ? bytecode.readUInt8(address + 4)
+          : bytecode.readInt8(address + 4);
+        return;
+      }
+    }
+  }
+
+  function opcodeName(address: number): string {
+    const b = bytecode.readUInt8(address);
+    const n = b & 0xF;
+    switch (b >> 4) {
+      case vm_TeOpcode.VM_OP_EXTENDED_1: return vm_TeOpcodeEx1[n] ?? hex(b);
+      case vm_TeOpcode.VM_OP_EXTENDED_2:
+        if (n === vm_TeOpcodeEx2.VM_OP2_EXTENDED_4 && address + 1 < bytecodeSize) {
+          return vm_TeOpcodeEx4[bytecode.readUInt8(address + 1)] ?? hex(b);
+        }
+        return vm_TeOpcodeEx2[n] ?? hex(b);
+      case vm_TeOpcode.VM_OP_EXTENDED_3: return vm_TeOpcodeEx3[n] ?? hex(b);
+      default: return vm_TeOpcode[b >> 4] ?? hex(b);
+    }
+  }
+}
+
+/**
+ * The stack depth after the instruction, or -1 if the instruction isn't valid
+ * at the given depth (in which case the function isn't translated).
+ */
+function depthAfter(instr: Instruction, depth: number): number {
+  switch (instr.op) {
+    case 'literal':
+    case 'loadArg':
+    case 'newObject':
+      return depth + 1;
+    case 'loadVar':
+      return instr.operand < depth ? depth + 1 : -1;
+    case 'storeVar':
+      return instr.operand + 1 < depth ? depth - 1 : -1;
+    case 'pop':
+      return depth - instr.operand;
+    case 'binary':
+    case 'getProperty':
+      return depth >= 2 ? depth - 1 : -1;
+    case 'varBinary':
+      return (instr.left < depth) && (instr.right < depth) ? depth + 1 : -1;
+    case 'varLitBinary':
+      return instr.left < depth ? depth + 1 : -1;
+    case 'branch':
+      return depth - 1;
+    case 'branchCompare':
+      return depth - 2;
+    case 'getPropertyKey':
+      return depth >= 1 ? depth : -1;
+    case 'setProperty':
+      return depth - 3;
+    case 'setPropertyKey':
+      return depth - 2;
+    default:
+      return depth;
+  }
+}
+
+function successors(address: number, instr: Instruction): number[] {
+  switch (instr.op) {
+    case 'exit':
+    case 'return':
+      return [];
+    case 'jump':
+      return [instr.target];
+    case 'branch':
+    case 'branchCompare':
+      return [address + instr.size, instr.target];
+    default:
+      return [address + instr.size];
+  }
+}
+
+function isBinaryOp(op: number): boolean {
+  const n = op & 0xF;
+  switch (op >> 4) {
+    case vm_TeOpcode.VM_OP_NUM_OP: return n <= vm_TeNumberOp.VM_NUM_OP_MULTIPLY;
+    case vm_TeOpcode.VM_OP_BIT_OP:
+      return n === vm_TeBitwiseOp.VM_BIT_OP_OR || n === vm_TeBitwiseOp.VM_BIT_OP_AND || n === vm_TeBitwiseOp.VM_BIT_OP_XOR;
+    default: return op === BINARY_EQUAL || op === BINARY_NOT_EQUAL;
+  }
+}
+
+function numOp(op: vm_TeNumberOp) {
+  return (vm_TeOpcode.VM_OP_NUM_OP << 4) | op;
+}
+
+function bitOp(op: vm_TeBitwiseOp) {
+  return (vm_TeOpcode.VM_OP_BIT_OP << 4) | op;
+}
+
+function encodeInt14(i: number) {
+  return ((i << 2) | 3) & 0xFFFF;
+}
+
+function hex(n: number) {
+  return n.toString(16).toUpperCase().padStart(4, '0');
+}
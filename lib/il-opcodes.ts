@@ -40,6 +40,8 @@ export const opcodes = {
   'ClosureNew':    { operands: [                              ], stackChange: 0                      },
   'EndTry':        { operands: [                              ], stackChange: undefined              },
   'EnqueueJob':    { operands: [                              ], stackChange: 0                      },
+  'IterNext':      { operands: ['LabelOperand'                ], stackChange: 1                      },
+  'IterStart':     { operands: [                              ], stackChange: 1                      },
   'Jump':          { operands: ['LabelOperand'                ], stackChange: 0                      },
   'Literal':       { operands: ['LiteralOperand'              ], stackChange: 1                      },
   'LoadArg':       { operands: ['IndexOperand'                ], stackChange: 1                      },
@@ -65,6 +67,7 @@ export const opcodes = {
   'StoreGlobal':   { operands: ['NameOperand'                 ], stackChange: -1                     },
   'StoreScoped':   { operands: ['IndexOperand'                ], stackChange: -1                     },
   'StoreVar':      { operands: ['IndexOperand'                ], stackChange: -1                     },
+  'Switch':        { operands: ['LabelOperand', 'CasesOperand'], stackChange: 0                      },
   'Throw':         { operands: [                              ], stackChange: -1                     },
   'TypeCodeOf':    { operands: [                              ], stackChange: 0                      },
   'Uint8ArrayNew': { operands: [                              ], stackChange: 0                      },
@@ -73,7 +76,7 @@ export const opcodes = {
 
 export type Opcode = keyof typeof opcodes;
 
-export const blockTerminatingOpcodes = new Set<Opcode>(['Jump', 'Branch', 'Return', 'AsyncReturn', 'Throw', 'AsyncComplete']);
+export const blockTerminatingOpcodes = new Set<Opcode>(['Jump', 'Branch', 'Switch', 'Return', 'AsyncReturn', 'Throw', 'AsyncComplete']);
 
 function count(operand: IL.Operand): number {
   if (!operand || operand.type !== 'CountOperand') unexpected();
@@ -106,6 +109,9 @@ export function labelOperandsOfOperation(op: IL.Operation): IL.LabelOperand[] {
   for (const [operandI, operandType] of meta.operands.entries()) {
     if (operandType === 'LabelOperand') {
       result.push(op.operands[operandI] as IL.LabelOperand ?? unexpected())
+    } else if (operandType === 'CasesOperand') {
+      const casesOperand = op.operands[operandI] as IL.CasesOperand ?? unexpected();
+      result.push(...casesOperand.cases.map(c => c.target));
     }
   }
   return result;
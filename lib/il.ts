@@ -58,6 +58,7 @@ export type Operation =
   | CallOperation
   | ReturnOperation
   | ArrayNewOperation
+  | ScopedOperation
   | OtherOperation
 
 export interface OperationBase {
@@ -108,6 +109,17 @@ export interface ArrayNewOperation extends OperationBase {
   }
 }
 
+export interface ScopedOperation extends OperationBase {
+  opcode: 'LoadScoped' | 'StoreScoped';
+  // The same slot as the (relative index) operand, as the number of closure
+  // allocations to step over and the index within the allocation at that
+  // depth. The operand still defines the behavior.
+  staticInfo?: {
+    depth: number;
+    index: number;
+  }
+}
+
 export interface ReturnOperation extends OperationBase {
   opcode: 'Return';
 }
@@ -128,12 +140,13 @@ export interface OtherOperation extends OperationBase {
     | 'ClosureNew'
     | 'EndTry'
     | 'EnqueueJob'
+    | 'IterNext'
+    | 'IterStart'
     | 'Jump'
     | 'Literal'
     | 'LoadArg'
     | 'LoadGlobal'
     | 'LoadReg'
-    | 'LoadScoped'
     | 'LoadVar'
     | 'New'
     | 'Nop'
@@ -150,8 +163,8 @@ export interface OtherOperation extends OperationBase {
     | 'ScopePush'
     | 'StartTry'
     | 'StoreGlobal'
-    | 'StoreScoped'
     | 'StoreVar'
+    | 'Switch'
     | 'Throw'
     | 'TypeCodeOf'
     | 'Uint8ArrayNew'
@@ -192,6 +205,7 @@ export type Operand =
   | IndexOperand
   | OpOperand
   | FlagOperand
+  | CasesOperand
 
 export type OperandType = Operand['type'];
 
@@ -230,6 +244,13 @@ export interface OpOperand {
   subOperation: string;
 }
 
+// The cases of a `Switch` operation. The values are int14 numbers, and are
+// distinct.
+export interface CasesOperand {
+  type: 'CasesOperand';
+  cases: { value: number, target: LabelOperand }[];
+}
+
 export interface Exception {
   type: 'Exception';
   exception: Value;
@@ -511,6 +532,12 @@ export interface EphemeralObjectValue {
 export enum ExecutionFlag {
   FloatSupport = 0,
   CompiledWithOverflowChecks = 1,
+  // Objects in the snapshot are encoded as TsShapedObject, with their keys in
+  // a shared shape (requires MVM_SHAPED_OBJECTS in the engine)
+  ShapedObjects = 2,
+  // Each block of bytecode starts with a VM_OP4_GAS instruction that charges
+  // the gas counter for the whole block (required by MVM_GAS_PER_BLOCK)
+  GasMetering = 3,
 }
 
 export function calcDynamicStackChangeOfOp(operation: Operation) {
@@ -0,0 +1,237 @@
+import * as IL from './il';
+import { labelOperandsOfOperation } from './il-opcodes';
+import { hardAssert, notUndefined } from './utils';
+
+/**
+ * What is statically known about a value on the stack. These form a chain
+ * from most to least specific:
+ *
+ *   - `int`: a number with an integer value (not necessarily int14 or int32)
+ *   - `number`: any number
+ *   - `unknown`: could be any value
+ */
+export type InferredType = 'int' | 'number' | 'unknown';
+
+/**
+ * The inferred types of the left and right operands of each `BinOp` operation
+ * in a function
+ */
+export type BinOpOperandTypes = Map<IL.Operation, [InferredType, InferredType]>;
+
+// Functions that contain these operations are not analyzed, since they move
+// the stack in ways that are not described by the stack depths of the
+// operations, or enter blocks that aren't the target of any label operand.
+const unsupportedOpcodes = new Set<IL.Opcode>([
+  'AsyncComplete',
+  'AsyncResume',
+  'AsyncReturn',
+  'AsyncStart',
+  'Await',
+  'AwaitCall',
+  'EndTry',
+  'StartTry',
+]);
+
+/**
+ * A flow analysis over the IL of a function which infers which stack slots
+ * (including local variables, which live on the stack) definitely hold
+ * numbers, and in particular integers. The bytecode emitter uses the result to
+ * choose type-specialized instructions.
+ *
+ * The analysis is conservative: anything not produced by a literal, a local
+ * variable or a number operation is `unknown`. Each block is simulated
+ * starting from the join of the slot types at the end of its predecessors,
+ * repeating until nothing changes.
+ *
+ * Returns an empty map if the function can't be analyzed.
+ */
+export function inferBinOpOperandTypes(func: IL.Function): BinOpOperandTypes {
+  const result: BinOpOperandTypes = new Map();
+
+  for (const block of Object.values(func.blocks)) {
+    for (const op of block.operations) {
+      if (unsupportedOpcodes.has(op.opcode)) {
+        return result;
+      }
+    }
+  }
+
+  const typesAtBlockEntry = new Map<IL.BlockID, InferredType[]>();
+  const entryBlock = func.blocks[func.entryBlockID];
+  typesAtBlockEntry.set(entryBlock.id, new Array(entryBlock.expectedStackDepthAtEntry).fill('unknown'));
+
+  const queue: IL.BlockID[] = [entryBlock.id];
+  const queued = new Set<IL.BlockID>(queue);
+
+  // Each time a block is visited, it overwrites the operand types of the
+  // operations in the block. The last visit is the one with the final entry
+  // types, since any change to those causes the block to be visited again.
+  while (queue.length) {
+    const blockId = queue.shift()!;
+    queued.delete(blockId);
+    const block = func.blocks[blockId];
+    const stack = [...notUndefined(typesAtBlockEntry.get(blockId))];
+
+    for (const op of block.operations) {
+      // Bail out if the stack depths in the IL don't agree with the simulation
+      if (stack.length !== op.stackDepthBefore) {
+        return new Map();
+      }
+      if (op.opcode === 'BinOp') {
+        result.set(op, [stack[stack.length - 2], stack[stack.length - 1]]);
+      }
+
+      simulateOperation(op, stack);
+
+      for (const { targetBlockId } of labelOperandsOfOperation(op)) {
+        const target = func.blocks[targetBlockId];
+        const incoming = stack.slice(0, target.expectedStackDepthAtEntry);
+        const existing = typesAtBlockEntry.get(targetBlockId);
+        let changed = false;
+        if (!existing) {
+          typesAtBlockEntry.set(targetBlockId, incoming);
+          changed = true;
+        } else {
+          for (const [i, type] of incoming.entries()) {
+            const joined = join(existing[i], type);
+            if (joined !== existing[i]) {
+              existing[i] = joined;
+              changed = true;
+            }
+          }
+        }
+        if (changed && !queued.has(targetBlockId)) {
+          queue.push(targetBlockId);
+          queued.add(targetBlockId);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+function simulateOperation(op: IL.Operation, stack: InferredType[]) {
+  const stackDepthAfter = op.stackDepthBefore + notUndefined(IL.calcStaticStackChangeOfOp(op));
+  switch (op.opcode) {
+    case 'Literal': {
+      const [operand] = op.operands;
+      hardAssert(operand.type === 'LiteralOperand');
+      stack.push(typeOfLiteral(operand.literal));
+      break;
+    }
+    case 'LoadVar': {
+      const [operand] = op.operands;
+      hardAssert(operand.type === 'IndexOperand');
+      stack.push(stack[operand.index]);
+      break;
+    }
+    case 'StoreVar': {
+      const [operand] = op.operands;
+      hardAssert(operand.type === 'IndexOperand');
+      stack[operand.index] = stack.pop()!;
+      break;
+    }
+    case 'BinOp': {
+      const [operand] = op.operands;
+      hardAssert(operand.type === 'OpOperand');
+      const right = stack.pop()!;
+      const left = stack.pop()!;
+      stack.push(typeOfBinOpResult(operand.subOperation as IL.BinOpCode, left, right));
+      break;
+    }
+    case 'UnOp': {
+      const [operand] = op.operands;
+      hardAssert(operand.type === 'OpOperand');
+      const arg = stack.pop()!;
+      stack.push(typeOfUnOpResult(operand.subOperation as IL.UnOpCode, arg));
+      break;
+    }
+    // Operations that only pop
+    case 'ArraySet':
+    case 'Branch':
+    case 'ObjectSet':
+    case 'Pop':
+    case 'Return':
+    case 'StoreGlobal':
+    case 'StoreScoped':
+    case 'Throw': {
+      stack.length = stackDepthAfter;
+      break;
+    }
+    // Operations that don't touch the stack
+    case 'EnqueueJob':
+    case 'Jump':
+    case 'Nop':
+    case 'ScopeClone':
+    case 'ScopeDiscard':
+    case 'ScopeNew':
+    case 'ScopePop':
+    case 'ScopePush':
+    case 'Switch': {
+      break;
+    }
+    // Operations that only push values of unknown type
+    case 'ArrayNew':
+    case 'LoadArg':
+    case 'LoadGlobal':
+    case 'LoadReg':
+    case 'LoadScoped':
+    case 'ObjectNew':
+    case 'ScopeSave': {
+      stack.push('unknown');
+      break;
+    }
+    default: {
+      // Everything else is assumed to consume at most one slot below the
+      // depth it leaves the stack at, and to produce values of unknown type
+      const firstAffected = Math.max(0, Math.min(op.stackDepthBefore, stackDepthAfter) - 1);
+      stack.length = stackDepthAfter;
+      stack.fill('unknown', firstAffected);
+      break;
+    }
+  }
+}
+
+function typeOfLiteral(value: IL.Value): InferredType {
+  if (value.type !== 'NumberValue') return 'unknown';
+  return Number.isInteger(value.value) && !Object.is(value.value, -0) ? 'int' : 'number';
+}
+
+function typeOfBinOpResult(op: IL.BinOpCode, left: InferredType, right: InferredType): InferredType {
+  const bothInt = left === 'int' && right === 'int';
+  switch (op) {
+    // Addition is only numeric if neither operand could be a string
+    case '+': return bothInt ? 'int' : (left !== 'unknown' && right !== 'unknown') ? 'number' : 'unknown';
+    // The rest of the arithmetic operators always produce a number
+    case '-':
+    case '*':
+    case '%': return bothInt ? 'int' : 'number';
+    case 'DIVIDE_AND_TRUNC': return 'int';
+    case '/':
+    case '**': return 'number';
+    // Bitwise operators produce an int32
+    case '&':
+    case '|':
+    case '^':
+    case '<<':
+    case '>>':
+    case '>>>': return 'int';
+    default: return 'unknown';
+  }
+}
+
+function typeOfUnOpResult(op: IL.UnOpCode, arg: InferredType): InferredType {
+  switch (op) {
+    case '-':
+    case '+': return arg === 'int' ? 'int' : 'number';
+    case '~': return 'int';
+    default: return 'unknown';
+  }
+}
+
+function join(a: InferredType, b: InferredType): InferredType {
+  if (a === b) return a;
+  if (a === 'unknown' || b === 'unknown') return 'unknown';
+  return 'number';
+}
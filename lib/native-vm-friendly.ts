@@ -7,7 +7,7 @@ import { SnapshotClass } from "./snapshot";
 export class NativeVMFriendly implements MicroviumNativeSubset {
   private vm: NativeVM.NativeVM;
 
-  constructor (snapshot: Snapshot, hostImportMap: HostImportMap = defaultHostEnvironment) {
+  constructor (snapshot: Snapshot, hostImportMap: HostImportMap = defaultHostEnvironment, nativeVMClass: NativeVM.NativeVMClass = NativeVM.NativeVM) {
     let hostImportFunction: HostImportFunction;
     if (typeof hostImportMap !== 'function') {
       hostImportFunction = (hostFunctionID: HostFunctionID): Function => {
@@ -20,7 +20,7 @@ export class NativeVMFriendly implements MicroviumNativeSubset {
       hostImportFunction = hostImportMap;
     }
 
-    this.vm = new NativeVM.NativeVM(snapshot.data, hostFunctionID => {
+    this.vm = new nativeVMClass(snapshot.data, hostFunctionID => {
       const inner = hostImportFunction(hostFunctionID);
       return this.hostFunctionToVM(inner);
     });
@@ -38,6 +38,15 @@ export class NativeVMFriendly implements MicroviumNativeSubset {
     this.vm.runGC(squeeze);
   }
 
+  // Returns true if the step completed the collection cycle. Requires an
+  // engine built with MVM_INCREMENTAL_GC.
+  garbageCollectStep(workUnits: number): boolean {
+    if (!this.vm.runGCStep) {
+      return invalidOperation('The engine was built without MVM_INCREMENTAL_GC');
+    }
+    return this.vm.runGCStep(workUnits);
+  }
+
   createSnapshot(): Snapshot {
     return new SnapshotClass(this.vm.createSnapshot());
   }
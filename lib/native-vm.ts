@@ -22,6 +22,17 @@ export type CoverageCallback = (id: number, mode: CoverageCaseMode, indexInTable
 
 export const NativeVM = addon.NativeVM as NativeVMClass;
 
+/**
+ * The engine built with the opt-in port options turned on (the
+ * `opt-in-features` target in binding.gyp, see MVM_TEST_OPT_IN_FEATURES in
+ * microvium_port_test.h). Only the tests use it, so it's loaded on first use
+ * from next to the main addon, and isn't in the published prebuilds.
+ */
+export function loadNativeVMWithOptInFeatures(): NativeVMClass {
+  const addonDir = path.dirname(require('node-gyp-build').path(rootPath));
+  return require(path.join(addonDir, 'opt-in-features.node')).NativeVM;
+}
+
 export interface NativeVMClass {
   new (snapshotBytecode: Buffer, resolveImport: ResolveImport): NativeVM;
   // Used for code coverage analysis
@@ -38,6 +49,8 @@ export interface NativeVM {
   newNumber(value: number): Value;
   newString(value: string): Value;
   runGC(squeeze: boolean): void;
+  // Only on engines built with MVM_INCREMENTAL_GC
+  runGCStep?(workUnits: number): boolean;
   createSnapshot(): Buffer;
   getMemoryStats(): MemoryStats;
   asyncStart(): Value;
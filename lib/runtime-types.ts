@@ -92,6 +92,9 @@ export enum mvm_TeError {
   /* 56 */ MVM_E_HEAP_CORRUPT, // Microvium's internal heap is not in a consistent state
   /* 57 */ MVM_E_CLASS_PROTOTYPE_MUST_BE_NULL_OR_OBJECT, // The prototype property of a class must be null or a plain object
   /* 58 */ MVM_E_UNINITIALIZED_GLOBAL, // A global variable was not set before it was used.
+  /* 59 */ MVM_E_BYTECODE_REQUIRES_SHAPED_OBJECTS, // The bytecode was compiled with shaped objects enabled, so the engine must be compiled with MVM_SHAPED_OBJECTS
+  /* 60 */ MVM_E_BYTECODE_REQUIRES_GAS_METERING, // The engine is compiled with MVM_GAS_PER_BLOCK, so the bytecode must be compiled with gas metering enabled
+  /* 61 */ MVM_E_NATIVE_FUNCTIONS_MISMATCH, // The table passed to `mvm_aot_setFunctions` was generated from a different snapshot
 };
 
 
@@ -177,7 +180,7 @@ export enum TeTypeCode {
 
   TC_REF_CLASS              = 0x9, // TsClass
   TC_REF_VIRTUAL            = 0xA, // Reserved: TsVirtual
-  TC_REF_RESERVED_1         = 0xB, // Reserved
+  TC_REF_SHAPED_OBJECT      = 0xB, // TsShapedObject - Object whose keys are in a shared shape (see MVM_SHAPED_OBJECTS)
   TC_REF_PROPERTY_LIST      = 0xC, // TsPropertyList - Object represented as linked list of properties
   TC_REF_ARRAY              = 0xD, // TsArray
   TC_REF_FIXED_LENGTH_ARRAY = 0xE, // TsFixedLengthArray
@@ -4,7 +4,7 @@ import { entriesInOrder, stringifyIdentifier } from './utils';
 import { stringifyValue, stringifyFunction, stringifyAllocation, StringifyILOpts } from './stringify-il';
 import { crc16ccitt } from 'crc';
 
-export const ENGINE_MAJOR_VERSION = 8  /* aka MVM_BYTECODE_VERSION */;
+export const ENGINE_MAJOR_VERSION = 10  /* aka MVM_BYTECODE_VERSION */;
 export const HEADER_SIZE = 28;
 export const ENGINE_MINOR_VERSION = 0  /* aka MVM_ENGINE_VERSION */;
 
@@ -9,7 +9,13 @@ import { SourceMap } from './source-map';
  * A snapshot of the state of a virtual machine
  */
 export class SnapshotClass implements Snapshot {
-  constructor(data: Buffer, public reconstructionInfo?: SnapshotReconstructionInfo, public sourceMap?: SourceMap) {
+  constructor(
+    data: Buffer,
+    public reconstructionInfo?: SnapshotReconstructionInfo,
+    public sourceMap?: SourceMap,
+    // Bytecode offset of each function marked as native (see generateNativeC)
+    public nativeFunctions?: ReadonlyMap<string, number>
+  ) {
     const errInfo = validateSnapshotBinary(data);
     if (errInfo) {
       return invalidOperation('Snapshot bytecode is invalid: ' + errInfo);
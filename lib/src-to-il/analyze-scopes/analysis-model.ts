@@ -149,10 +149,14 @@ export interface ScopeBase {
 
   isTryScope?: boolean; // True if this block is for a `try` clause
   isCatchScope?: boolean; // True if this block is for a `catch` clause
+  isForOfScope?: boolean; // True if this block is for the loop variable of a `for..of`
   // If the block corresponds to a catch statement, then this will contain
   // information about the variable binding for the exception
   catchExceptionBinding?: Binding;
   catchExceptionSlotAccess?: SlotAccessInfo;
+  // If the block corresponds to a `for..of` loop, then this is the binding for
+  // the loop variable
+  forOfVariableBinding?: Binding;
 
   /** The outer scope */
   parent: Scope | undefined;
@@ -259,6 +263,8 @@ export type PrologueStep =
   | { type: 'DiscardCatchParam' }
   | { type: 'StartTry' }
   | { type: 'DummyPushException' } // A dummy stack increment to represent the action of a `throw` pushing the exception to the stack
+  | { type: 'InitForOfVariable', slot: SlotAccessInfo }
+  | { type: 'DummyPushIterElement' } // A dummy stack increment to represent the action of `IterNext` pushing the element to the stack
 
 export type EpilogueStep =
   | { type: 'Pop', requiredDuringReturn: false, count: number }
@@ -373,6 +379,11 @@ export type SlotAccessInfo =
 export interface ClosureSlotAccess {
   type: 'ClosureSlotAccess';
   relativeIndex: number;
+  // The same slot as `relativeIndex`, but as the number of closure allocations
+  // to step over and the index within the allocation at that depth. The
+  // bytecode emitter can use this to avoid walking the scope chain.
+  depth: number;
+  index: number;
 }
 
 // A value that always reads as `undefined`
@@ -385,6 +396,7 @@ export type ScopeNode =
   | B.SupportedFunctionNode
   | B.Block
   | B.ForStatement
+  | B.ForOfStatement
   | B.ClassDeclaration
   | B.ClassExpression
 
@@ -51,6 +51,7 @@ export function pass1_findScopesAndBindings({
       case 'FunctionExpression': return traverseFunctionExpressionScope(cur, node);
       case 'BlockStatement': return traverseBlockScope(node);
       case 'ForStatement': return traverseForStatement(node);
+      case 'ForOfStatement': return traverseForOfStatement(node);
       case 'TryStatement': return traverseTryStatement(node);
 
       // Reference nodes
@@ -319,6 +320,46 @@ export function pass1_findScopesAndBindings({
       popScope(scope);
     }
 
+    function traverseForOfStatement(node: B.ForOfStatement) {
+      if (node.left.type !== 'VariableDeclaration' || node.left.kind === 'var') {
+        visitingNode(cur, node.left);
+        return compileError(cur, 'Only `const` and `let` declarations are supported in `for..of` loops');
+      }
+      if (node.await) {
+        return compileError(cur, 'Not supported: for await');
+      }
+
+      // The iterable is evaluated once, before the loop, so it's outside the
+      // scope of the loop variable
+      traverse(node.right);
+
+      // Unlike a `for` loop, the scope of the loop variable is entered afresh
+      // on each iteration rather than cloned, so closures in each iteration see
+      // their own instance of the variable.
+      const sameInstanceCountAsParent = false;
+      const scope = pushBlockScope(node, sameInstanceCountAsParent);
+      scope.isForOfScope = true;
+
+      // Like a catch parameter, the loop variable is not a normal lexical
+      // declaration because `IterNext` pushes its initial value onto the stack
+      hardAssert(node.left.declarations.length === 1);
+      const declaration = node.left.declarations[0];
+      if (declaration.id.type !== 'Identifier') {
+        visitingNode(cur, declaration.id);
+        return compileError(cur, 'Only simple binding supported in `for..of` loops');
+      }
+      scope.forOfVariableBinding = createBindingAndSelfReference(declaration.id.name, node.left.kind, declaration, false);
+
+      if (node.body.type === 'BlockStatement') {
+        // The loop body has the same lifetime as the loop variable
+        traverseBlockScope(node.body, true);
+      } else {
+        traverse(node.body);
+      }
+
+      popScope(scope);
+    }
+
     function handleAssignmentExpression(node: B.AssignmentExpression) {
       traverseChildren(cur, node, traverse);
 
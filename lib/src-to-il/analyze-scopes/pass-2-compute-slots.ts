@@ -244,6 +244,14 @@ export function pass2_computeSlots({
         stackDepth += 2;
       }
 
+      // The array and index of a `for..of` loop (see `IterStart`) are pushed
+      // before the scope of the loop variable is entered, and stay on the stack
+      // until the end of the loop
+      const isForOfScope = 'isForOfScope' in blockScope && blockScope.isForOfScope;
+      if (isForOfScope) {
+        stackDepth += 2;
+      }
+
       const blockStartStackDepth = stackDepth;
       let expectedVariablePopCount = 0;
 
@@ -287,6 +295,24 @@ export function pass2_computeSlots({
         }
       }
 
+      // The `for..of` loop variable is handled the same way as the catch
+      // parameter above, since `IterNext` pushes its value onto the stack
+      // before the scope is entered. It's the first slot in the block, and
+      // doesn't need to be moved if it's a local.
+      if (isForOfScope) {
+        const binding = blockScope.forOfVariableBinding ?? unexpected();
+        binding.slot = nextBlockLocalOrClosureSlot(binding, binding.name);
+        if (binding.slot.type === 'ClosureSlot') {
+          blockScope.prologue.push({
+            type: 'InitForOfVariable',
+            slot: accessSlotForInitialization(binding.slot)
+          })
+        } else {
+          hardAssert(binding.slot.type === 'LocalSlot');
+          expectedVariablePopCount++;
+        }
+      }
+
       // Hoisted var declarations.
       //
       // Note: most var declarations will hoisted to the function level, but var
@@ -396,6 +422,12 @@ export function pass2_computeSlots({
         }
       }
 
+      // `IterNext` pushes the element before the scope is entered, so the
+      // element is already on the stack when `ScopeNew` or `ScopePush` runs
+      if (isForOfScope) {
+        blockScope.prologue.unshift({ type: 'DummyPushIterElement' });
+      }
+
       // Note: we don't need to pop variables off the stack in a `try` block
       // because the `EndTry` already truncates the stack to the right level.
       if (blockScope.type === 'BlockScope' && !isTryScope) {
@@ -408,6 +440,10 @@ export function pass2_computeSlots({
 
       stackDepth = blockStartStackDepth;
 
+      if (isForOfScope) {
+        stackDepth -= 2;
+      }
+
       if (isTryScope) {
         blockScope.epilogue.push({
           type: 'EndTry',
@@ -536,7 +572,9 @@ function accessSlotForInitialization(slot: Slot): SlotAccessInfo {
   if (slot.type === 'ClosureSlot') {
     return {
       type: 'ClosureSlotAccess',
-      relativeIndex: slot.index
+      relativeIndex: slot.index,
+      depth: 0,
+      index: slot.index
     }
   }
   return slot;
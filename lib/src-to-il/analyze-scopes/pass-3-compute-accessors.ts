@@ -60,6 +60,8 @@ export function pass3_computeSlotAccessors(state: AnalysisState) {
         const targetScope = binding.scope;
 
         let relativeIndex = 0;
+        // Number of closure allocations stepped over at runtime
+        let depth = 0;
 
         // While we're not in the scope containing the variable, move to the parent scope
         while (scope !== targetScope) {
@@ -68,6 +70,7 @@ export function pass3_computeSlotAccessors(state: AnalysisState) {
             // but has the same instance count as the parent
             hardAssert(!scope.sameInstanceCountAsParent);
             relativeIndex += scope.closureSlots.length;
+            depth++;
           }
 
           // If we're stepping from a function scope to its parent scope, and
@@ -76,6 +79,7 @@ export function pass3_computeSlotAccessors(state: AnalysisState) {
           // parent.
           if (scope.type === 'FunctionScope' && !scope.embeddedInParentSlot) {
             relativeIndex += 2;
+            depth++;
           }
 
           // In order for us to hop from the child to the parent function,
@@ -90,7 +94,9 @@ export function pass3_computeSlotAccessors(state: AnalysisState) {
 
         return {
           type: 'ClosureSlotAccess',
-          relativeIndex
+          relativeIndex,
+          depth,
+          index: slot.index
         }
       }
       default: assertUnreachable(slot);
@@ -159,6 +159,8 @@ function renderPrologueStep(step: PrologueStep) {
     case 'AsyncStart': return inline`AsyncStart(${step.slotCount}, ${step.captureParent})`
     case 'StartTry': return inline`StartTry`
     case 'DummyPushException': return inline`Stack has exception`
+    case 'InitForOfVariable': return inline`Pop element -> ${renderSlotReference(step.slot)}`
+    case 'DummyPushIterElement': return inline`Stack has element`
     default: return assertUnreachable(step);
   }
 }
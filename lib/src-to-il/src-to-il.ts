@@ -2,8 +2,8 @@ import * as babylon from '@babel/parser';
 import * as B from './supported-babel-types';
 import * as IL from '../il';
 import { unexpected, assertUnreachable, hardAssert, isNameString, entries, notUndefined, notImplemented, MicroviumSyntaxError } from '../utils';
-import { isUInt16 } from '../runtime-types';
-import { minOperandCount } from '../il-opcodes';
+import { isUInt16, isSInt14 } from '../runtime-types';
+import { labelOperandsOfOperation, minOperandCount } from '../il-opcodes';
 import { analyzeScopes, AnalysisModel, SlotAccessInfo, PrologueStep, BlockScope, Scope } from './analyze-scopes';
 import { compileError, compileErrorIfReachable, featureNotSupported, internalCompileError, SourceCursor, visitingNode } from './common';
 import { formatSourceLoc } from '../stringify-il';
@@ -505,6 +505,20 @@ export function compilePrologue(cur: Cursor, prolog: PrologueStep[]) {
         cur.stackDepth++;
         break;
       }
+      case 'InitForOfVariable': {
+        // Same as `InitCatchParam`: the element is already at the top of the
+        // stack (pushed by `IterNext`), so only the store is emitted.
+        const value = LazyValue(() => {});
+        hardAssert(step.slot.type === 'ClosureSlotAccess')
+        initializeSlot(step.slot, value);
+        break;
+      }
+      case 'DummyPushIterElement': {
+        // Like `DummyPushException`, the element is pushed by `IterNext` just
+        // before the scope is entered, so the prologue accounts for it.
+        cur.stackDepth++;
+        break;
+      }
       case 'StartTry': {
         addOp(cur, 'StartTry', labelOfBlock(cur.scopeStack?.catchTarget ?? unexpected()));
         break;
@@ -641,6 +655,61 @@ export function compileForStatement(cur: Cursor, statement: B.ForStatement): voi
   scope.leaveScope(cur, 'normal'); // Also compiles the epilog
 }
 
+export function compileForOfStatement(cur: Cursor, statement: B.ForOfStatement): void {
+  const loopBlock = predeclareBlock();
+  const exhaustedBlock = predeclareBlock();
+  const terminateBlock = predeclareBlock();
+
+  const forOfBlockScope = notUndefined(cur.ctx.scopeAnalysis.scopes.get(statement)) as BlockScope;
+  hardAssert(forOfBlockScope.type === 'BlockScope');
+
+  // The array and the index of the next element stay on the stack for the
+  // duration of the loop
+  compileExpression(cur, statement.right);
+  compilingNode(cur, statement);
+  addOp(cur, 'IterStart');
+
+  // Breaking out of the loop leaves the scope of the loop variable but not the
+  // array cursor, which is popped by the terminateBlock
+  pushBreakScope(cur, statement, terminateBlock);
+
+  addOp(cur, 'Jump', labelOfBlock(loopBlock));
+  const loopCur = createBlock(cur, loopBlock);
+
+  // Push the next element, or push `undefined` and jump to the exhaustedBlock
+  // if there are no more. This happens before the scope of the loop variable
+  // is entered, so that the element lands in the slot of the loop variable
+  // and nothing in the scope sits between the array cursor and the top of the
+  // stack when `IterNext` runs.
+  addOp(loopCur, 'IterNext', labelOfBlock(exhaustedBlock));
+  const afterIterNextCur = { ...loopCur };
+
+  // The element is accounted for by the `DummyPushIterElement` step in the
+  // prologue of the scope (see `InitForOfVariable`)
+  loopCur.stackDepth--;
+
+  // The scope of the loop variable is entered on each iteration, so that each
+  // iteration has a fresh instance of it for any closures in the body
+  const scope = enterScope(loopCur, forOfBlockScope); // Also compiles the prolog
+
+  compileStatement(loopCur, statement.body);
+
+  scope.leaveScope(loopCur, 'normal'); // Also compiles the epilog
+  addOp(loopCur, 'Jump', labelOfBlock(loopBlock));
+
+  // The exhaustedBlock is outside the scope of the loop variable, so it only
+  // needs to discard the `undefined` pushed by `IterNext`
+  const exhaustedCur = createBlock(afterIterNextCur, exhaustedBlock);
+  addOp(exhaustedCur, 'Pop', countOperand(1));
+  addOp(exhaustedCur, 'Jump', labelOfBlock(terminateBlock));
+
+  const terminateBlockCur = createBlock(loopCur, terminateBlock);
+  addOp(terminateBlockCur, 'Pop', countOperand(2));
+
+  moveCursor(cur, terminateBlockCur);
+  popBreakScope(cur, statement);
+}
+
 export function compileBlockEpilogue(cur: Cursor, block: BlockScope, currentOperation: 'break' | 'return' | 'normal') {
   for (const step of block.epilogue) {
     if (currentOperation === 'return' && !step.requiredDuringReturn) {
@@ -895,6 +964,16 @@ function addOp(cur: Cursor, opcode: IL.Opcode, ...operands: IL.Operand[]): IL.Op
         }
         break;
       }
+      case 'CasesOperand': {
+        const values = new Set<number>();
+        for (const { value } of operand.cases) {
+          if (!isSInt14(value) || values.has(value)) {
+            return internalCompileError(cur, `Switch case value must be a distinct int14: ${value}`);
+          }
+          values.add(value);
+        }
+        break;
+      }
     }
   }
 
@@ -967,6 +1046,25 @@ function addOp(cur: Cursor, opcode: IL.Opcode, ...operands: IL.Operand[]): IL.Op
         return internalCompileError(cur, `Branching (false branch) from stack depth of ${operation.stackDepthAfter} to block with stack depth of ${targetBlockFalse.expectedStackDepthAtEntry}`);
       }
     }
+  } else if (opcode === 'IterNext') {
+    const [target] = labelOperandsOfOperation(operation);
+    // Note: targetBlockId can be undefined if the block is predeclared (see predeclared blocks)
+    if (target.targetBlockId !== undefined) {
+      const targetBlock = cur.func.blocks[target.targetBlockId];
+      if (targetBlock.expectedStackDepthAtEntry !== operation.stackDepthAfter) {
+        return internalCompileError(cur, `IterNext from stack depth of ${operation.stackDepthAfter} to block with stack depth of ${targetBlock.expectedStackDepthAtEntry}`);
+      }
+    }
+  } else if (opcode === 'Switch') {
+    for (const target of labelOperandsOfOperation(operation)) {
+      // Note: targetBlockId can be undefined if the block is predeclared (see predeclared blocks)
+      if (target.targetBlockId !== undefined) {
+        const targetBlock = cur.func.blocks[target.targetBlockId];
+        if (targetBlock.expectedStackDepthAtEntry !== operation.stackDepthAfter) {
+          return internalCompileError(cur, `Switching from stack depth of ${operation.stackDepthAfter} to block with stack depth of ${targetBlock.expectedStackDepthAtEntry}`);
+        }
+      }
+    }
   }
 
   return operation;
@@ -1078,6 +1176,7 @@ export function compileStatement(cur: Cursor, statement_: B.Statement) {
     case 'DoWhileStatement': return compileDoWhileStatement(cur, statement);
     case 'VariableDeclaration': return compileVariableDeclaration(cur, statement);
     case 'ForStatement': return compileForStatement(cur, statement);
+    case 'ForOfStatement': return compileForOfStatement(cur, statement);
     case 'ReturnStatement': return compileReturnStatement(cur, statement);
     case 'ThrowStatement': return compileThrowStatement(cur, statement);
     case 'SwitchStatement': return compileSwitchStatement(cur, statement);
@@ -1413,10 +1512,16 @@ function popBreakScope(cur: Cursor, statement: B.SupportedLoopStatement | B.Swit
   cur.breakScope = cur.breakScope.parent;
 }
 
+// Switch statements with at least this many int14 literal cases are compiled
+// to a single `Switch` operation rather than a chain of comparisons
+const minCasesForSwitchOperation = 3;
+
+// The most cases that the `Switch` bytecode instructions can hold
+const maxCasesForSwitchOperation = 255;
+
 export function compileSwitchStatement(cur: Cursor, statement: B.SwitchStatement) {
 
   // Predeclarations for all the blocks
-  const testBlocks = statement.cases.map(predeclareBlock);
   const consequentBlocks = statement.cases.map(predeclareBlock);
   const breakBlock = predeclareBlock();
 
@@ -1425,6 +1530,118 @@ export function compileSwitchStatement(cur: Cursor, statement: B.SwitchStatement
   // While in the switch statement, `break` statements go to the break block
   pushBreakScope(cur, statement, breakBlock);
 
+  const caseValues = getInt14CaseValues(statement);
+  if (caseValues) {
+    compileSwitchOperation(cur, statement, caseValues, consequentBlocks, breakBlock);
+  } else {
+    compileSwitchTests(cur, statement, consequentBlocks, breakBlock);
+  }
+
+  // Loop through all the consequents
+  let consequentIndex = 0;
+  for (const { consequent } of statement.cases) {
+    const consequentBlockCur = createBlock(cur, consequentBlocks[consequentIndex]);
+
+    for (const statement of consequent) {
+      compileStatement(consequentBlockCur, statement);
+    }
+
+    // Fall through from one consequent to the next or break out of the switch
+    const nextConsequentBlock = consequentBlocks[consequentIndex + 1] ?? breakBlock;
+    addOp(consequentBlockCur, 'Jump', labelOfBlock(nextConsequentBlock));
+
+    consequentIndex++;
+  }
+
+  // The break block needs to perform the matching `pop` of the original test
+  // value. This can't be done in the consequents because each falls into the
+  // next (and it would be more instructions)
+  const breakBlockCur = createBlock(cur, breakBlock);
+  addOp(breakBlockCur, 'Pop', countOperand(1));
+
+  moveCursor(cur, breakBlockCur);
+  popBreakScope(cur, statement);
+}
+
+// If every case of the switch (other than `default`) is an int14 number
+// literal, returns the value of each case (`undefined` for `default`)
+function getInt14CaseValues(statement: B.SwitchStatement): (number | undefined)[] | undefined {
+  const values: (number | undefined)[] = [];
+  let caseCount = 0;
+  for (const { test } of statement.cases) {
+    if (!test) {
+      values.push(undefined);
+      continue;
+    }
+    let value: number;
+    if (test.type === 'NumericLiteral') {
+      value = test.value;
+    } else if (test.type === 'UnaryExpression' && test.operator === '-' && test.argument.type === 'NumericLiteral') {
+      value = -test.argument.value;
+    } else {
+      return undefined;
+    }
+    if (!isSInt14(value)) return undefined;
+    // Normalize -0 to 0, which is the same case under `===`
+    values.push(value + 0);
+    caseCount++;
+  }
+  if (caseCount < minCasesForSwitchOperation || caseCount > maxCasesForSwitchOperation) {
+    return undefined;
+  }
+  return values;
+}
+
+// Jumps to the matching consequent with a single `Switch` operation. The
+// discriminant stays on the stack, as it does for the tests.
+function compileSwitchOperation(
+  cur: Cursor,
+  statement: B.SwitchStatement,
+  caseValues: (number | undefined)[],
+  consequentBlocks: IL.Block[],
+  breakBlock: IL.Block
+) {
+  // A case with no statements falls through, so it jumps straight to the
+  // first non-empty consequent after it (or out of the switch). Otherwise
+  // the encoder lays out the empty blocks at the same address, and the cases
+  // would only reach the consequent through a chain of jumps.
+  const targetOfCase = (i: number) => {
+    while (i < statement.cases.length && statement.cases[i].consequent.length === 0) i++;
+    return i < statement.cases.length ? consequentBlocks[i] : breakBlock;
+  };
+
+  let defaultBlock: IL.Block | undefined;
+  const cases: IL.CasesOperand['cases'] = [];
+  const seen = new Set<number>();
+  for (const [i, value] of caseValues.entries()) {
+    if (value === undefined) {
+      if (defaultBlock) {
+        compilingNode(cur, statement.cases[i]);
+        return compileError(cur, 'Duplicate `default` block in switch statement');
+      }
+      defaultBlock = targetOfCase(i);
+    } else if (!seen.has(value)) {
+      // Only the first of a set of duplicate cases can be reached
+      seen.add(value);
+      cases.push({ value, target: labelOfBlock(targetOfCase(i)) });
+    }
+  }
+
+  // In ascending order of value, which is how the encoder lays them out
+  cases.sort((a, b) => a.value - b.value);
+
+  addOp(cur, 'Switch', labelOfBlock(defaultBlock ?? breakBlock), { type: 'CasesOperand', cases });
+}
+
+// Jumps to the matching consequent by testing each case in turn
+function compileSwitchTests(
+  cur: Cursor,
+  statement: B.SwitchStatement,
+  consequentBlocks: IL.Block[],
+  breakBlock: IL.Block
+) {
+  const testBlocks = statement.cases.map(predeclareBlock);
+
   // Jump to first test block
   const firstBlock = testBlocks[0] ?? breakBlock;
   addOp(cur, 'Jump', labelOfBlock(firstBlock));
@@ -1475,31 +1692,6 @@ export function compileSwitchStatement(cur: Cursor, statement: B.SwitchStatement
   }
 
   generateDefaultCase && generateDefaultCase();
-
-  // Loop through all the consequents
-  consequentIndex = 0;
-  for (const { consequent } of statement.cases) {
-    const consequentBlockCur = createBlock(cur, consequentBlocks[consequentIndex]);
-
-    for (const statement of consequent) {
-      compileStatement(consequentBlockCur, statement);
-    }
-
-    // Fall through from one consequent to the next or break out of the switch
-    const nextConsequentBlock = consequentBlocks[consequentIndex + 1] ?? breakBlock;
-    addOp(consequentBlockCur, 'Jump', labelOfBlock(nextConsequentBlock));
-
-    consequentIndex++;
-  }
-
-  // The break block needs to perform the matching `pop` of the original test
-  // value. This can't be done in the consequents because each falls into the
-  // next (and it would be more instructions)
-  const breakBlockCur = createBlock(cur, breakBlock);
-  addOp(breakBlockCur, 'Pop', countOperand(1));
-
-  moveCursor(cur, breakBlockCur);
-  popBreakScope(cur, statement);
 }
 
 export function compileExpression(cur: Cursor, expression_: B.Expression | B.PrivateName) {
@@ -2074,11 +2266,13 @@ export function getSlotAccessor(cur: Cursor, slotAccess: SlotAccessInfo, readonl
         load(cur: Cursor) {
           const op = addOp(cur, 'LoadScoped', indexOperand(slotAccess.relativeIndex));
           op.nameHint = nameHint;
+          op.staticInfo = { depth: slotAccess.depth, index: slotAccess.index };
         },
         store(cur: Cursor, value: LazyValue) {
           value.load(cur);
           const op = addOp(cur, 'StoreScoped', indexOperand(slotAccess.relativeIndex));
           op.nameHint = nameHint;
+          op.staticInfo = { depth: slotAccess.depth, index: slotAccess.index };
         }
       }
     }
@@ -21,6 +21,7 @@ export {
   Expression,
   ExpressionStatement,
   File,
+  ForOfStatement,
   ForStatement,
   FunctionDeclaration,
   FunctionExpression,
@@ -70,6 +71,7 @@ export type SupportedStatement =
   | B.DoWhileStatement
   | B.VariableDeclaration
   | B.ForStatement
+  | B.ForOfStatement
   | B.ReturnStatement
   | B.ThrowStatement
   | B.ExportNamedDeclaration
@@ -84,6 +86,7 @@ export type SupportedLoopStatement =
   | B.WhileStatement
   | B.DoWhileStatement
   | B.ForStatement
+  | B.ForOfStatement
 
 export type SupportedFunctionExpression =
   | B.FunctionExpression
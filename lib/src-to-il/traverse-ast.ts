@@ -50,6 +50,7 @@ export function traverseChildren<TContext = unknown>(
     case 'ExpressionStatement': return f(n.expression);
     case 'NewExpression': return f(n.callee), n.arguments.forEach(f);
     case 'ForStatement': return n.init && f(n.init), n.test && f(n.test), n.update && f(n.update), f(n.body);
+    case 'ForOfStatement': return f(n.left), f(n.right), f(n.body);
     case 'IfStatement': return f(n.test), f(n.consequent), n.alternate && f(n.alternate);
     case 'LogicalExpression': return f(n.left), f(n.right);
     case 'ObjectExpression': return n.properties.forEach(f);
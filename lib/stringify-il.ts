@@ -162,6 +162,7 @@ export function stringifyOperand(operand: IL.Operand): string {
     case 'IndexOperand': return 'index ' + operand.index;
     case 'NameOperand': return `name '${operand.name}'`;
     case 'OpOperand': return `op '${operand.subOperation}'`;
+    case 'CasesOperand': return `cases [${operand.cases.map(c => `${c.value}: @${c.target.targetBlockId}`).join(', ')}]`;
     default: return assertUnreachable(operand);
   }
 }
@@ -116,6 +116,18 @@ export class VirtualMachineFriendly implements Microvium {
     if (opts.optimizationHook) {
       snapshotInfo = opts.optimizationHook(snapshotInfo);
     }
+    if (opts.shapedObjects) {
+      snapshotInfo = {
+        ...snapshotInfo,
+        flags: new Set([...snapshotInfo.flags, IL.ExecutionFlag.ShapedObjects])
+      };
+    }
+    if (opts.gasMetering) {
+      snapshotInfo = {
+        ...snapshotInfo,
+        flags: new Set([...snapshotInfo.flags, IL.ExecutionFlag.GasMetering])
+      };
+    }
     if (opts.outputSnapshotIL && opts.snapshotILFilename) {
       fs.writeFileSync(opts.snapshotILFilename, stringifySnapshotIL(snapshotInfo, {
         commentSourceLocations: true,
@@ -125,7 +137,11 @@ export class VirtualMachineFriendly implements Microvium {
       }));
     }
     const generateHTML = false; // For debugging
-    const { snapshot, html } = encodeSnapshot(snapshotInfo, generateHTML, opts?.generateSourceMap ?? false);
+    const nativeFunctions = opts.nativeFunctions;
+    const isNativeFunction = nativeFunctions === undefined ? undefined
+      : nativeFunctions === 'all' ? () => true
+      : (functionID: IL.FunctionID) => nativeFunctions.includes(functionID);
+    const { snapshot, html } = encodeSnapshot(snapshotInfo, generateHTML, opts?.generateSourceMap ?? false, isNativeFunction);
     if (html) writeTextFile('snapshot.html', html);
     return snapshot;
   }
@@ -893,6 +893,8 @@ export class VirtualMachine {
       case 'ClosureNew'   : return this.operationClosureNew();
       case 'EndTry'       : return this.operationEndTry();
       case 'EnqueueJob'   : return this.operationEnqueueJob();
+      case 'IterNext'     : return this.operationIterNext(operands[0]);
+      case 'IterStart'    : return this.operationIterStart();
       case 'Jump'         : return this.operationJump(operands[0]);
       case 'Literal'      : return this.operationLiteral(operands[0]);
       case 'LoadArg'      : return this.operationLoadArg(operands[0]);
@@ -918,6 +920,7 @@ export class VirtualMachine {
       case 'StoreGlobal'  : return this.operationStoreGlobal(operands[0]);
       case 'StoreScoped'  : return this.operationStoreScoped(operands[0]);
       case 'StoreVar'     : return this.operationStoreVar(operands[0]);
+      case 'Switch'       : return this.operationSwitch(operands[0], operands[1]);
       case 'Throw'        : return this.operationThrow();
       case 'TypeCodeOf'   : return this.operationTypeCodeOf();
       case 'Uint8ArrayNew': return this.operationUint8ArrayNew();
@@ -1011,6 +1014,11 @@ export class VirtualMachine {
           return this.ilError('Expected sub-operation operand');
         }
         return operand.subOperation;
+      case 'CasesOperand':
+        if (operand.type !== 'CasesOperand') {
+          return this.ilError('Expected cases operand');
+        }
+        return operand.cases.map(({ value, target }) => ({ value, targetBlockId: target.targetBlockId }));
       default: assertUnreachable(expectedType);
     }
   }
@@ -1526,6 +1534,39 @@ export class VirtualMachine {
     )
   }
 
+  private operationIterStart() {
+    // Microvium doesn't implement the iterator protocol, so only arrays can be
+    // iterated. The array stays on the stack as part of the cursor.
+    const pArray = this.variables[this.variables.length - 1] ?? this.ilError('Stack unbalanced');
+    const array = pArray.type === 'ReferenceValue' ? this.dereference(pArray) : undefined;
+    if (!array || array.type !== 'ArrayAllocation' || array.lengthIsFixed) {
+      return this.runtimeError(`TypeError: value of type "${this.getType(pArray)}" is not iterable`);
+    }
+    this.push(this.numberValue(0));
+  }
+
+  private operationIterNext(doneTargetBlockId: string) {
+    const index = this.pop();
+    const pArray = this.pop();
+    if (index.type !== 'NumberValue' || pArray.type !== 'ReferenceValue') {
+      return this.ilError('IterNext expects an array cursor');
+    }
+    const array = this.dereference(pArray);
+    if (array.type !== 'ArrayAllocation') return this.ilError('IterNext expects an array cursor');
+    // The length is checked on each iteration because the loop body may change it
+    if (index.value < array.items.length) {
+      this.push(pArray);
+      this.push(this.numberValue(index.value + 1));
+      // Holes in the array
+      this.push(array.items[index.value] ?? IL.undefinedValue);
+    } else {
+      this.push(pArray);
+      this.push(index);
+      this.push(IL.undefinedValue);
+      this.operationJump(doneTargetBlockId);
+    }
+  }
+
   private operationJump(targetBlockId: string) {
     this.block = this.func.blocks[targetBlockId];
     if (!this.block) {
@@ -1534,6 +1575,15 @@ export class VirtualMachine {
     this.nextOperationIndex = 0;
   }
 
+  private operationSwitch(defaultTargetBlockId: string, cases: { value: number, targetBlockId: string }[]) {
+    // The discriminant stays on the stack for the consequents
+    const discriminant = this.variables[this.variables.length - 1] ?? this.ilError('Stack unbalanced');
+    const match = discriminant.type === 'NumberValue'
+      ? cases.find(c => c.value === discriminant.value)
+      : undefined;
+    this.operationJump(match ? match.targetBlockId : defaultTargetBlockId);
+  }
+
   private operationLiteral(value: IL.Value) {
     this.push(value);
   }
@@ -1,6 +1,7 @@
 #include <map>
 #include <napi.h>
 #include <stdexcept>
+#include <vector>
 #include "NativeVM.hh"
 #include "misc.hh"
 #include "error_descriptions.hh"
@@ -21,7 +22,7 @@ Napi::FunctionReference NativeVM::constructor;
 Napi::FunctionReference NativeVM::coverageCallback;
 
 void NativeVM::Init(Napi::Env env, Napi::Object exports) {
-  Napi::Function ctr = DefineClass(env, "NativeVM", {
+  std::vector<PropertyDescriptor> members = {
     NativeVM::InstanceMethod("resolveExport", &NativeVM::resolveExport),
     NativeVM::InstanceMethod("uint8ArrayFromBytes", &NativeVM::uint8ArrayFromBytes),
     NativeVM::InstanceMethod("typeOf", &NativeVM::typeOf),
@@ -38,7 +39,11 @@ void NativeVM::Init(Napi::Env env, Napi::Object exports) {
     NativeVM::InstanceMethod("stopAfterNInstructions", &NativeVM::stopAfterNInstructions),
     NativeVM::InstanceMethod("getInstructionCountRemaining", &NativeVM::getInstructionCountRemaining),
     NativeVM::StaticValue("MVM_PORT_INT32_OVERFLOW_CHECKS", Napi::Boolean::New(env, MVM_PORT_INT32_OVERFLOW_CHECKS)),
-  });
+  };
+  #if MVM_INCREMENTAL_GC
+  members.push_back(NativeVM::InstanceMethod("runGCStep", &NativeVM::runGCStep));
+  #endif
+  Napi::Function ctr = DefineClass(env, "NativeVM", members);
   constructor = Napi::Persistent(ctr);
   exports.Set(Napi::String::New(env, "NativeVM"), ctr);
   constructor.SuppressDestruct();
@@ -221,6 +226,18 @@ void NativeVM::runGC(const Napi::CallbackInfo& info) {
   mvm_runGC(this->vm, squeeze);
 }
 
+#if MVM_INCREMENTAL_GC
+Napi::Value NativeVM::runGCStep(const Napi::CallbackInfo& info) {
+  auto env = info.Env();
+  if (info.Length() < 1 || !info[0].IsNumber()) {
+    Napi::TypeError::New(env, "Expected workUnits argument").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+  uint16_t workUnits = (uint16_t)info[0].ToNumber().Uint32Value();
+  return Napi::Boolean::New(env, mvm_runGCStep(this->vm, workUnits));
+}
+#endif // MVM_INCREMENTAL_GC
+
 Napi::Value NativeVM::createSnapshot(const Napi::CallbackInfo& info) {
   size_t size;
   uint8_t* bytecode = (uint8_t*)mvm_createSnapshot(this->vm, &size);
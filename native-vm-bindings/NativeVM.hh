@@ -23,6 +23,9 @@ public:
   Napi::Value newString(const Napi::CallbackInfo&);
   Napi::Value newNumber(const Napi::CallbackInfo&);
   void runGC(const Napi::CallbackInfo&);
+  #if MVM_INCREMENTAL_GC
+  Napi::Value runGCStep(const Napi::CallbackInfo&);
+  #endif
   Napi::Value createSnapshot(const Napi::CallbackInfo&);
   Napi::Value getMemoryStats(const Napi::CallbackInfo&);
   Napi::Value asyncStart(const Napi::CallbackInfo&);
@@ -59,4 +59,7 @@ std::map<mvm_TeError, std::string> errorDescriptions = {
   { MVM_E_TYPE_ERROR_AWAIT_NON_PROMISE, "Can only await a promise in Microvium" },
   { MVM_E_HEAP_CORRUPT, "Microvium's internal heap is not in a consistent state" },
   { MVM_E_CLASS_PROTOTYPE_MUST_BE_NULL_OR_OBJECT, "The prototype property of a class must be null or a plain object" },
+  { MVM_E_BYTECODE_REQUIRES_SHAPED_OBJECTS, "The bytecode was compiled with shaped objects enabled, so the engine must be compiled with MVM_SHAPED_OBJECTS" },
+  { MVM_E_BYTECODE_REQUIRES_GAS_METERING, "The engine is compiled with MVM_GAS_PER_BLOCK, so the bytecode must be compiled with gas metering enabled" },
+  { MVM_E_NATIVE_FUNCTIONS_MISMATCH, "The table passed to `mvm_aot_setFunctions` was generated from a different snapshot" },
 };
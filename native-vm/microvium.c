@@ -43,6 +43,15 @@
 #include "math.h"
 #endif
 
+#if MVM_JIT
+#include <sys/mman.h> // For the JIT code buffer
+#endif
+
+#if MVM_RESERVED_HEAP
+#include <sys/mman.h> // For the reserved heap ranges
+#include <unistd.h> // For sysconf
+#endif
+
 /**
  * Public API to call into the VM to run the given function with the given
  * arguments (also contains the run loop).
@@ -124,7 +133,7 @@ TeError mvm_call(VM* vm, Value targetFunc, Value* out_result, Value* args, uint8
     reg->argCountAndFlags = POP(); \
     reg->closure = POP(); \
     pStackPointer--; \
-    pFrameBase = (uint16_t*)((uint8_t*)pStackPointer - *pStackPointer); \
+    pFrameBase = (Value*)((uint8_t*)pStackPointer - *pStackPointer); \
     reg->pArgs = pFrameBase - VM_FRAME_BOUNDARY_SAVE_SIZE_WORDS - (reg->argCountAndFlags & AF_ARG_COUNT_MASK); \
   } while (false)
 
@@ -152,6 +161,37 @@ TeError mvm_call(VM* vm, Value targetFunc, Value* out_result, Value* args, uint8
 
   #define INSTRUCTION_RESERVED() VM_ASSERT(vm, false)
 
+  // Charge the gas counter for the `n` instructions that a superinstruction
+  // replaces, in addition to the superinstruction itself, so that
+  // `mvm_stopAfterNInstructions` counts the same whether or not instructions
+  // are fused. If the remaining count doesn't cover the whole sequence, none of
+  // it is executed. With MVM_GAS_PER_BLOCK, the VM_OP4_GAS at the start of the
+  // block already includes these.
+  #if defined(MVM_GAS_COUNTER) && !MVM_GAS_PER_BLOCK
+    #define CHARGE_FUSED_INSTRUCTIONS(n) do { \
+      if (vm->stopAfterNInstructions >= 0) { \
+        if (vm->stopAfterNInstructions < (n)) { \
+          vm->stopAfterNInstructions = 0; \
+          err = MVM_E_INSTRUCTION_COUNT_REACHED; \
+          goto SUB_EXIT; \
+        } \
+        vm->stopAfterNInstructions -= (n); \
+      } \
+    } while (false)
+  #else
+    #define CHARGE_FUSED_INSTRUCTIONS(n)
+  #endif
+
+  // Case label for an instruction in one of the opcode switches. When using
+  // computed-goto dispatch, each case is also given a regular label
+  // `LBL_<opcode>` so that the dispatch stubs can jump to it directly without
+  // going through the switch.
+  #if MVM_COMPUTED_GOTO_DISPATCH
+    #define VM_OP_CASE(op) MVM_CASE(op): LBL_##op
+  #else
+    #define VM_OP_CASE(op) MVM_CASE(op)
+  #endif
+
   // ------------------------------ Common Variables --------------------------
 
   VM_SAFE_CHECK_NOT_NULL(vm);
@@ -163,8 +203,8 @@ TeError mvm_call(VM* vm, Value targetFunc, Value* out_result, Value* args, uint8
   // chosen only the most important registers to be cached here, in the hope
   // that the C compiler will promote these eagerly to the CPU registers,
   // although it may choose not to.
-  register uint16_t* pFrameBase;
-  register uint16_t* pStackPointer; // Name is confusing. This is the stack pointer, not a pointer to the stack pointer.
+  register Value* pFrameBase;
+  register Value* pStackPointer; // Name is confusing. This is the stack pointer, not a pointer to the stack pointer.
   register LongPtr lpProgramCounter;
 
   // These are general-purpose scratch "registers". Note: probably the compiler
@@ -174,19 +214,145 @@ TeError mvm_call(VM* vm, Value targetFunc, Value* out_result, Value* args, uint8
   register uint16_t reg1;
   register uint16_t reg2;
   register uint16_t reg3;
-  uint16_t* regP1;
-  uint16_t* regP2;
+  Value* regP1;
+  Value* regP2;
   LongPtr regLP1;
 
-  uint16_t* globals;
+  Value* globals;
   vm_TsRegisters* reg;
   vm_TsRegisters registerValuesAtEntry;
 
-  #if MVM_DONT_TRUST_BYTECODE
+  #if MVM_DONT_TRUST_BYTECODE && !MVM_VERIFY_BYTECODE
     LongPtr maxProgramCounter;
     LongPtr minProgramCounter = getBytecodeSection(vm, BCS_ROM, &maxProgramCounter);
   #endif
 
+  #if MVM_UNBOXED_INT32
+    // An int32 result that hasn't been allocated, and the stack slot it belongs
+    // in, or NULL if there isn't one (see SUB_TAIL_PUSH_INT32)
+    int32_t unboxedInt32 = 0;
+    Value* pUnboxedInt32 = NULL;
+  #endif
+
+  #if MVM_UNBOXED_FLOAT64
+    // Non-integer results that haven't been allocated yet, and the stack slots
+    // they belong in, from the bottom of the stack up (see SUB_NUM_OP_FLOAT64)
+    MVM_FLOAT64 unboxedFloat64[VM_UNBOXED_FLOAT64_MAX];
+    Value* pUnboxedFloat64[VM_UNBOXED_FLOAT64_MAX];
+    uint8_t unboxedFloat64Count = 0;
+  #endif
+
+  #if MVM_COMPUTED_GOTO_DISPATCH
+    // Dispatch table indexed by the first byte of each instruction (see
+    // doc/ideas/computed-jump-loop.md). Primary opcodes each occupy 16
+    // consecutive entries because the low nibble is an operand, while the
+    // extended opcode groups have one entry per sub-opcode. Instructions that
+    // need operand preprocessing (popping reg2 or reading a literal into reg1)
+    // are dispatched to a stub which does the preprocessing before jumping to
+    // the case label. The rest are dispatched directly to the case label.
+    #define VM_DISPATCH_PRIMARY(op) [((op) << 4) ... (((op) << 4) | 0xF)] = &&LBL_##op
+    #define VM_DISPATCH_PRIMARY_STUB(op) [((op) << 4) ... (((op) << 4) | 0xF)] = &&DISPATCH_##op
+    #define VM_DISPATCH_EX(group, op) [((group) << 4) | (op)] = &&LBL_##op
+    #define VM_DISPATCH_EX_STUB(group, op) [((group) << 4) | (op)] = &&DISPATCH_##op
+    #define VM_DISPATCH_RESERVED(group, op) [((group) << 4) | (op)] = &&SUB_DISPATCH_RESERVED
+    static const void* const dispatchTable[256] = {
+      VM_DISPATCH_PRIMARY(VM_OP_LOAD_SMALL_LITERAL),
+      VM_DISPATCH_PRIMARY(VM_OP_LOAD_VAR_1),
+      VM_DISPATCH_PRIMARY(VM_OP_LOAD_SCOPED_1),
+      VM_DISPATCH_PRIMARY(VM_OP_LOAD_ARG_1),
+      VM_DISPATCH_PRIMARY(VM_OP_CALL_1),
+      VM_DISPATCH_PRIMARY(VM_OP_FIXED_ARRAY_NEW_1),
+
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_RETURN),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_THROW),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_CLOSURE_NEW),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_NEW),
+      VM_DISPATCH_RESERVED(VM_OP_EXTENDED_1, VM_OP1_RESERVED_VIRTUAL_NEW),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_SCOPE_NEW),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_TYPE_CODE_OF),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_POP),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_TYPEOF),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_OBJECT_NEW),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_LOGICAL_NOT),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_OBJECT_GET_1),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_ADD),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_EQUAL),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_NOT_EQUAL),
+      VM_DISPATCH_EX(VM_OP_EXTENDED_1, VM_OP1_OBJECT_SET_1),
+
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_BRANCH_1),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_STORE_ARG),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_STORE_SCOPED_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_STORE_VAR_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_BRANCH_LESS_THAN_1),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_BRANCH_LESS_EQUAL_1),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_JUMP_1),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_CALL_HOST),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_CALL_3),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_CALL_6),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_LOAD_SCOPED_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_LOAD_VAR_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_LOAD_ARG_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_EXTENDED_4),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_ARRAY_NEW),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_2, VM_OP2_FIXED_ARRAY_NEW_2),
+
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_POP_N),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_SCOPE_DISCARD),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_SCOPE_CLONE),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_AWAIT),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_AWAIT_CALL),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_ASYNC_RESUME),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_LOAD_GLOBAL_CALLEE),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_JUMP_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_LOAD_LITERAL),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_LOAD_GLOBAL_3),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_LOAD_SCOPED_3),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_BRANCH_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_STORE_GLOBAL_3),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_STORE_SCOPED_3),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_OBJECT_GET_2),
+      VM_DISPATCH_EX_STUB(VM_OP_EXTENDED_3, VM_OP3_OBJECT_SET_2),
+
+      VM_DISPATCH_PRIMARY(VM_OP_CALL_5),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_STORE_VAR_1),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_STORE_SCOPED_1),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_ARRAY_GET_1),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_ARRAY_SET_1),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_NUM_OP),
+      VM_DISPATCH_PRIMARY_STUB(VM_OP_BIT_OP),
+    };
+
+    // Ex-4 instructions have no common preprocessing, so this table points
+    // directly at the case labels.
+    static const void* const ex4DispatchTable[VM_OP4_END] = {
+      [VM_OP4_START_TRY] = &&LBL_VM_OP4_START_TRY,
+      [VM_OP4_END_TRY] = &&LBL_VM_OP4_END_TRY,
+      [VM_OP4_OBJECT_KEYS] = &&LBL_VM_OP4_OBJECT_KEYS,
+      [VM_OP4_UINT8_ARRAY_NEW] = &&LBL_VM_OP4_UINT8_ARRAY_NEW,
+      [VM_OP4_CLASS_CREATE] = &&LBL_VM_OP4_CLASS_CREATE,
+      [VM_OP4_TYPE_CODE_OF] = &&LBL_VM_OP4_TYPE_CODE_OF,
+      [VM_OP4_LOAD_REG_CLOSURE] = &&LBL_VM_OP4_LOAD_REG_CLOSURE,
+      [VM_OP4_SCOPE_PUSH] = &&LBL_VM_OP4_SCOPE_PUSH,
+      [VM_OP4_SCOPE_POP] = &&LBL_VM_OP4_SCOPE_POP,
+      [VM_OP4_SCOPE_SAVE] = &&LBL_VM_OP4_SCOPE_SAVE,
+      [VM_OP4_ASYNC_START] = &&LBL_VM_OP4_ASYNC_START,
+      [VM_OP4_ASYNC_RETURN] = &&LBL_VM_OP4_ASYNC_RETURN,
+      [VM_OP4_ENQUEUE_JOB] = &&LBL_VM_OP4_ENQUEUE_JOB,
+      [VM_OP4_ASYNC_COMPLETE] = &&LBL_VM_OP4_ASYNC_COMPLETE,
+      [VM_OP4_TAIL_CALL] = &&LBL_VM_OP4_TAIL_CALL,
+      [VM_OP4_GAS] = &&LBL_VM_OP4_GAS,
+      [VM_OP4_LOAD_SCOPED_OUTER] = &&LBL_VM_OP4_LOAD_SCOPED_OUTER,
+      [VM_OP4_STORE_SCOPED_OUTER] = &&LBL_VM_OP4_STORE_SCOPED_OUTER,
+      [VM_OP4_TABLE_SWITCH] = &&LBL_VM_OP4_TABLE_SWITCH,
+      [VM_OP4_LOOKUP_SWITCH] = &&LBL_VM_OP4_LOOKUP_SWITCH,
+      [VM_OP4_ARRAY_ITER_START] = &&LBL_VM_OP4_ARRAY_ITER_START,
+      [VM_OP4_ARRAY_ITER_NEXT] = &&LBL_VM_OP4_ARRAY_ITER_NEXT,
+      [VM_OP4_VAR_NUM_OP] = &&LBL_VM_OP4_VAR_NUM_OP,
+      [VM_OP4_VAR_LIT_NUM_OP] = &&LBL_VM_OP4_VAR_LIT_NUM_OP,
+    };
+  #endif // MVM_COMPUTED_GOTO_DISPATCH
+
   // Note: these initial values are not actually used, but some compilers give a
   // warning if you omit them.
   pFrameBase = 0;
@@ -312,7 +478,7 @@ SUB_DO_NEXT_INSTRUCTION:
 
   VM_ASSERT(vm, reg->usingCachedRegisters);
 
-  #ifdef MVM_GAS_COUNTER
+  #if defined(MVM_GAS_COUNTER) && !MVM_GAS_PER_BLOCK
   if (vm->stopAfterNInstructions >= 0) {
     CODE_COVERAGE(650); // Hit
     if (vm->stopAfterNInstructions == 0) {
@@ -327,7 +493,7 @@ SUB_DO_NEXT_INSTRUCTION:
   #endif
 
   // Check we're within range
-  #if MVM_DONT_TRUST_BYTECODE
+  #if MVM_DONT_TRUST_BYTECODE && !MVM_VERIFY_BYTECODE
   if ((lpProgramCounter < minProgramCounter) || (lpProgramCounter >= maxProgramCounter)) {
     VM_INVALID_BYTECODE(vm);
   }
@@ -336,25 +502,34 @@ SUB_DO_NEXT_INSTRUCTION:
   // Check breakpoints
   #if MVM_INCLUDE_DEBUG_CAPABILITY
     if (vm->pBreakpoints) {
-      TsBreakpoint* pBreakpoint = vm->pBreakpoints;
+      CODE_COVERAGE_UNTESTED(830); // Not hit
+      vm_TsBreakpoints* pBreakpoints = vm->pBreakpoints;
       uint16_t currentBytecodeAddress = LongPtr_sub(lpProgramCounter, vm->lpBytecode);
-      do {
-        if ((pBreakpoint->bytecodeAddress == -1) || (pBreakpoint->bytecodeAddress == (int)currentBytecodeAddress)) {
-          FLUSH_REGISTER_CACHE();
-          mvm_TfBreakpointCallback breakpointCallback = vm->breakpointCallback;
-          if (breakpointCallback)
-            breakpointCallback(vm, currentBytecodeAddress);
-          CACHE_REGISTERS();
-          break;
-        }
-        pBreakpoint = pBreakpoint->next;
-      } while (pBreakpoint);
+      if (pBreakpoints->breakOnEveryInstruction || (
+        (currentBytecodeAddress < pBreakpoints->addressLimit) &&
+        (pBreakpoints->bits[currentBytecodeAddress >> 3] & (1 << (currentBytecodeAddress & 7)))
+      )) {
+        CODE_COVERAGE_UNTESTED(831); // Not hit
+        FLUSH_REGISTER_CACHE();
+        mvm_TfBreakpointCallback breakpointCallback = vm->breakpointCallback;
+        if (breakpointCallback)
+          breakpointCallback(vm, currentBytecodeAddress);
+        CACHE_REGISTERS();
+      }
     }
   #endif // MVM_INCLUDE_DEBUG_CAPABILITY
 
   // Instruction bytes are divided into two nibbles
   READ_PGM_1(reg3);
   reg1 = reg3 & 0xF; // Primary opcode
+
+  #if MVM_COMPUTED_GOTO_DISPATCH
+  // A single indirect jump on the whole instruction byte replaces the primary
+  // switch and the extended-opcode switches below. The dispatch stubs perform
+  // the equivalent operand preprocessing.
+  goto *dispatchTable[reg3];
+  #endif
+
   reg3 = reg3 >> 4;  // Secondary opcode or data
 
   if (reg3 >= VM_OP_DIVIDER_1) {
@@ -373,11 +548,11 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: small literal ID                                                */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE(VM_OP_LOAD_SMALL_LITERAL): {
+    VM_OP_CASE(VM_OP_LOAD_SMALL_LITERAL): {
       CODE_COVERAGE(60); // Hit
       TABLE_COVERAGE(reg1, smallLiteralsSize, 448); // Hit 11/12
 
-      #if MVM_DONT_TRUST_BYTECODE
+      #if MVM_DONT_TRUST_BYTECODE && !MVM_VERIFY_BYTECODE
       if (reg1 >= smallLiteralsSize) {
         err = vm_newError(vm, MVM_E_INVALID_BYTECODE);
         goto SUB_EXIT;
@@ -393,7 +568,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: variable index                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_LOAD_VAR_1):
+    VM_OP_CASE (VM_OP_LOAD_VAR_1):
       CODE_COVERAGE(61); // Hit
     SUB_OP_LOAD_VAR:
       reg1 = pStackPointer[-reg1 - 1];
@@ -409,7 +584,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: variable index                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_LOAD_SCOPED_1):
+    VM_OP_CASE (VM_OP_LOAD_SCOPED_1):
       CODE_COVERAGE(62); // Hit
       LongPtr lpVar;
     SUB_OP_LOAD_SCOPED:
@@ -423,7 +598,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: argument index                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_LOAD_ARG_1):
+    VM_OP_CASE (VM_OP_LOAD_ARG_1):
       CODE_COVERAGE(63); // Hit
       goto SUB_OP_LOAD_ARG;
 
@@ -433,7 +608,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: index into short-call table                                     */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_CALL_1): {
+    VM_OP_CASE (VM_OP_CALL_1): {
       CODE_COVERAGE_UNTESTED(66); // Not hit
       goto SUB_CALL_SHORT;
     }
@@ -444,7 +619,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: length of new fixed-length-array                                */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_FIXED_ARRAY_NEW_1): {
+    VM_OP_CASE (VM_OP_FIXED_ARRAY_NEW_1): {
       CODE_COVERAGE_UNTESTED(134); // Not hit
       goto SUB_FIXED_ARRAY_NEW;
     }
@@ -485,7 +660,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: argCount                                                        */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_CALL_5): {
+    VM_OP_CASE (VM_OP_CALL_5): {
       /* Note: this isn't actually used at the moment, because we don't have the
       static analysis to statically determine the target. But my expectation is
       that when we have this static analysis, most function calls are going to
@@ -506,7 +681,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_STORE_VAR_1): {
+    VM_OP_CASE (VM_OP_STORE_VAR_1): {
       CODE_COVERAGE(73); // Hit
     SUB_OP_STORE_VAR:
       // Note: the value to store has already been popped off the stack at this
@@ -523,7 +698,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_STORE_SCOPED_1): {
+    VM_OP_CASE (VM_OP_STORE_SCOPED_1): {
       CODE_COVERAGE(74); // Hit
       LongPtr lpVar;
     SUB_OP_STORE_SCOPED:
@@ -532,6 +707,7 @@ SUB_DO_NEXT_INSTRUCTION:
       // It would be an illegal operation to write to a closure variable stored in ROM
       VM_BYTECODE_ASSERT(vm, lpVar == LongPtr_new(pVar));
       *pVar = reg2;
+      VM_SCOPED_WRITE_BARRIER(vm, pVar);
       goto SUB_TAIL_POP_0_PUSH_0;
     }
 
@@ -542,7 +718,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg2: reference to array                                              */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_ARRAY_GET_1): {
+    VM_OP_CASE (VM_OP_ARRAY_GET_1): {
       CODE_COVERAGE_UNTESTED(75); // Not hit
 
       // I think it makes sense for this instruction only to be an optimization for fixed-length arrays
@@ -561,7 +737,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg1: item index (4-bit)                                              */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_ARRAY_SET_1): {
+    VM_OP_CASE (VM_OP_ARRAY_SET_1): {
       CODE_COVERAGE_UNTESTED(76); // Not hit
       reg2 = POP(); // array reference
       // I think it makes sense for this instruction only to be an optimization for fixed-length arrays
@@ -571,6 +747,7 @@ SUB_DO_NEXT_INSTRUCTION:
       // These indexes should be compiler-generated, so they should never be out of range
       VM_ASSERT(vm, reg1 < (vm_getAllocationSize(regP1) >> 1));
       regP1[reg1] = reg2;
+      VM_WRITE_BARRIER(vm, regP1);
       goto SUB_TAIL_POP_0_PUSH_0;
     }
 
@@ -581,7 +758,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg2: first popped operand                                            */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_NUM_OP): {
+    VM_OP_CASE (VM_OP_NUM_OP): {
       CODE_COVERAGE(77); // Hit
       goto SUB_OP_NUM_OP;
     } // End of case VM_OP_NUM_OP
@@ -593,7 +770,7 @@ SUB_DO_NEXT_INSTRUCTION:
 /*     reg2: first popped operand                                            */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP_BIT_OP): {
+    VM_OP_CASE (VM_OP_BIT_OP): {
       CODE_COVERAGE(92); // Hit
       goto SUB_OP_BIT_OP;
     }
@@ -603,6 +780,86 @@ SUB_DO_NEXT_INSTRUCTION:
   // All cases should loop explicitly back
   VM_ASSERT_UNREACHABLE(vm);
 
+#if MVM_COMPUTED_GOTO_DISPATCH
+/* ------------------------------------------------------------------------- */
+/*                             Dispatch stubs                                */
+/*                                                                           */
+/*   Targets of `dispatchTable` for instructions that need operand           */
+/*   preprocessing. Each stub sets up reg1 and reg2 the same way as the      */
+/*   switch-based dispatch would for its opcode, and then jumps directly to  */
+/*   the case label for the opcode. The conditions are compile-time          */
+/*   constants, so each stub reduces to just the operations that apply.      */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: low nibble of the instruction byte                              */
+/* ------------------------------------------------------------------------- */
+
+  #define VM_DISPATCH_STUB_PRIMARY(op) \
+    DISPATCH_##op: \
+      reg2 = POP(); \
+      goto LBL_##op;
+
+  #define VM_DISPATCH_STUB_EX2(op) \
+    DISPATCH_##op: \
+      READ_PGM_1(reg1); \
+      if (op < VM_OP2_DIVIDER_1) reg2 = POP(); \
+      goto LBL_##op;
+
+  #define VM_DISPATCH_STUB_EX3(op) \
+    DISPATCH_##op: \
+      if (op >= VM_OP3_DIVIDER_1) READ_PGM_2(reg1); \
+      if (op >= VM_OP3_DIVIDER_2) reg2 = POP(); \
+      goto LBL_##op;
+
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_STORE_VAR_1)
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_STORE_SCOPED_1)
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_ARRAY_GET_1)
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_ARRAY_SET_1)
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_NUM_OP)
+  VM_DISPATCH_STUB_PRIMARY(VM_OP_BIT_OP)
+
+  VM_DISPATCH_STUB_EX2(VM_OP2_BRANCH_1)
+  VM_DISPATCH_STUB_EX2(VM_OP2_STORE_ARG)
+  VM_DISPATCH_STUB_EX2(VM_OP2_STORE_SCOPED_2)
+  VM_DISPATCH_STUB_EX2(VM_OP2_STORE_VAR_2)
+  VM_DISPATCH_STUB_EX2(VM_OP2_BRANCH_LESS_THAN_1)
+  VM_DISPATCH_STUB_EX2(VM_OP2_BRANCH_LESS_EQUAL_1)
+  VM_DISPATCH_STUB_EX2(VM_OP2_JUMP_1)
+  VM_DISPATCH_STUB_EX2(VM_OP2_CALL_HOST)
+  VM_DISPATCH_STUB_EX2(VM_OP2_CALL_3)
+  VM_DISPATCH_STUB_EX2(VM_OP2_CALL_6)
+  VM_DISPATCH_STUB_EX2(VM_OP2_LOAD_SCOPED_2)
+  VM_DISPATCH_STUB_EX2(VM_OP2_LOAD_VAR_2)
+  VM_DISPATCH_STUB_EX2(VM_OP2_LOAD_ARG_2)
+  VM_DISPATCH_STUB_EX2(VM_OP2_EXTENDED_4)
+  VM_DISPATCH_STUB_EX2(VM_OP2_ARRAY_NEW)
+  VM_DISPATCH_STUB_EX2(VM_OP2_FIXED_ARRAY_NEW_2)
+
+  VM_DISPATCH_STUB_EX3(VM_OP3_POP_N)
+  VM_DISPATCH_STUB_EX3(VM_OP3_SCOPE_DISCARD)
+  VM_DISPATCH_STUB_EX3(VM_OP3_SCOPE_CLONE)
+  VM_DISPATCH_STUB_EX3(VM_OP3_AWAIT)
+  VM_DISPATCH_STUB_EX3(VM_OP3_AWAIT_CALL)
+  VM_DISPATCH_STUB_EX3(VM_OP3_ASYNC_RESUME)
+  VM_DISPATCH_STUB_EX3(VM_OP3_LOAD_GLOBAL_CALLEE)
+  VM_DISPATCH_STUB_EX3(VM_OP3_JUMP_2)
+  VM_DISPATCH_STUB_EX3(VM_OP3_LOAD_LITERAL)
+  VM_DISPATCH_STUB_EX3(VM_OP3_LOAD_GLOBAL_3)
+  VM_DISPATCH_STUB_EX3(VM_OP3_LOAD_SCOPED_3)
+  VM_DISPATCH_STUB_EX3(VM_OP3_BRANCH_2)
+  VM_DISPATCH_STUB_EX3(VM_OP3_STORE_GLOBAL_3)
+  VM_DISPATCH_STUB_EX3(VM_OP3_STORE_SCOPED_3)
+  VM_DISPATCH_STUB_EX3(VM_OP3_OBJECT_GET_2)
+  VM_DISPATCH_STUB_EX3(VM_OP3_OBJECT_SET_2)
+
+SUB_DISPATCH_RESERVED: {
+  CODE_COVERAGE_ERROR_PATH(750); // Not hit
+  INSTRUCTION_RESERVED();
+  err = vm_newError(vm, MVM_E_INVALID_BYTECODE);
+  goto SUB_EXIT;
+}
+#endif // MVM_COMPUTED_GOTO_DISPATCH
+
 /* ------------------------------------------------------------------------- */
 /*                             SUB_OP_LOAD_ARG                               */
 /*   Expects:                                                                */
@@ -670,6 +927,51 @@ SUB_OP_BIT_OP: {
   int32_t reg2I = 0;
   int8_t reg2B = 0;
 
+  #if MVM_UNBOXED_INT32
+  if (pUnboxedInt32) {
+    CODE_COVERAGE(914); // Not hit
+    reg3 = (VM_OP_BIT_OP << 4) | reg1;
+    goto SUB_UNBOXED_INT32_OP;
+  }
+  #endif // MVM_UNBOXED_INT32
+
+  #if MVM_UNBOXED_FLOAT64
+  // Only NUM_OPs run while there are unboxed float64 results
+  VM_ASSERT(vm, !unboxedFloat64Count);
+  #endif
+
+  #if MVM_INT14_FAST_PATHS
+  // Fast path for the bitwise operations whose result is always an int14 if
+  // the operands are. Left shifts can overflow the int14 range and unsigned
+  // right shifts make negative numbers large, so those take the general path.
+  if (Value_isVirtualInt14(reg2) && (reg1 != VM_BIT_OP_SHL) && (reg1 != VM_BIT_OP_SHR_LOGICAL)) {
+    CODE_COVERAGE(815); // Not hit
+    int16_t right = VirtualInt14_decode(vm, reg2);
+
+    if (reg1 == VM_BIT_OP_NOT) {
+      CODE_COVERAGE(816); // Not hit
+      reg1 = VirtualInt14_encode(vm, ~right);
+      goto SUB_TAIL_POP_0_PUSH_REG1;
+    }
+
+    if (Value_isVirtualInt14(pStackPointer[-1])) {
+      CODE_COVERAGE(817); // Not hit
+      int16_t left = VirtualInt14_decode(vm, pStackPointer[-1]);
+      int16_t result = 0;
+
+      MVM_SWITCH (reg1, (VM_BIT_OP_DIVIDER_2 - 1)) {
+        MVM_CASE(VM_BIT_OP_SHR_ARITHMETIC): result = left >> (right & 0x1F); break;
+        MVM_CASE(VM_BIT_OP_OR): result = left | right; break;
+        MVM_CASE(VM_BIT_OP_AND): result = left & right; break;
+        MVM_CASE(VM_BIT_OP_XOR): result = left ^ right; break;
+      }
+
+      reg1 = VirtualInt14_encode(vm, result);
+      goto SUB_TAIL_POP_1_PUSH_REG1;
+    }
+  }
+  #endif // MVM_INT14_FAST_PATHS
+
   reg3 = reg1;
 
   // Convert second operand to an int32
@@ -753,6 +1055,10 @@ SUB_OP_BIT_OP: {
     reg1 = VirtualInt14_encode(vm, (uint16_t)reg1I);
   } else {
     CODE_COVERAGE(35); // Hit
+    #if MVM_UNBOXED_INT32
+    unboxedInt32 = reg1I;
+    goto SUB_TAIL_PUSH_INT32;
+    #endif
     FLUSH_REGISTER_CACHE();
     reg1 = mvm_newInt32(vm, reg1I);
     CACHE_REGISTERS();
@@ -781,13 +1087,13 @@ SUB_OP_EXTENDED_1: {
 /*     reg1: vm_TeOpcodeEx1                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_RETURN): {
+    VM_OP_CASE (VM_OP1_RETURN): {
       CODE_COVERAGE(107); // Hit
       reg1 = POP();
       goto SUB_RETURN;
     }
 
-    MVM_CASE (VM_OP1_THROW): {
+    VM_OP_CASE (VM_OP1_THROW): {
       CODE_COVERAGE(106); // Hit
 
       reg1 = POP(); // The exception value
@@ -800,7 +1106,7 @@ SUB_OP_EXTENDED_1: {
 /*     reg3: vm_TeOpcodeEx1                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_CLOSURE_NEW): {
+    VM_OP_CASE (VM_OP1_CLOSURE_NEW): {
       CODE_COVERAGE(599); // Hit
 
       FLUSH_REGISTER_CACHE();
@@ -819,7 +1125,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_NEW): {
+    VM_OP_CASE (VM_OP1_NEW): {
       CODE_COVERAGE(347); // Hit
       READ_PGM_1(reg1); // arg count
       reg1 /*argCountAndFlags*/ |= AF_PUSHED_FUNCTION;
@@ -832,7 +1138,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_SCOPE_NEW): {
+    VM_OP_CASE (VM_OP1_SCOPE_NEW): {
       CODE_COVERAGE(605); // Hit
       // A SCOPE_NEW is just like a SCOPE_PUSH without capturing the parent
       reg3 /*capture parent*/ = false;
@@ -845,7 +1151,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_TYPE_CODE_OF): {
+    VM_OP_CASE (VM_OP1_TYPE_CODE_OF): {
       CODE_COVERAGE_UNTESTED(607); // Not hit
       reg1 = POP();
       reg1 = mvm_typeOf(vm, reg1);
@@ -858,7 +1164,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_POP): {
+    VM_OP_CASE (VM_OP1_POP): {
       CODE_COVERAGE(138); // Hit
       pStackPointer--;
       goto SUB_TAIL_POP_0_PUSH_0;
@@ -870,7 +1176,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_TYPEOF): {
+    VM_OP_CASE (VM_OP1_TYPEOF): {
       CODE_COVERAGE(167); // Hit
       // TODO: This is should really be done using some kind of built-in helper
       // function, but we don't support those yet. The trouble with this
@@ -894,7 +1200,7 @@ SUB_OP_EXTENDED_1: {
 /*     (nothing)                                                             */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_OBJECT_NEW): {
+    VM_OP_CASE (VM_OP1_OBJECT_NEW): {
       CODE_COVERAGE(112); // Hit
       FLUSH_REGISTER_CACHE();
       TsPropertyList* pObject = GC_ALLOCATE_TYPE(vm, TsPropertyList, TC_REF_PROPERTY_LIST);
@@ -911,7 +1217,7 @@ SUB_OP_EXTENDED_1: {
 /*     (nothing)                                                             */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_LOGICAL_NOT): {
+    VM_OP_CASE (VM_OP1_LOGICAL_NOT): {
       CODE_COVERAGE(113); // Hit
       reg2 = POP(); // value to negate
       reg1 = mvm_toBool(vm, reg2) ? VM_VALUE_FALSE : VM_VALUE_TRUE;
@@ -925,8 +1231,20 @@ SUB_OP_EXTENDED_1: {
 /*     reg2: propertyName                                                    */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_OBJECT_GET_1): {
+    VM_OP_CASE (VM_OP1_OBJECT_GET_1): {
       CODE_COVERAGE(114); // Hit
+      // Fast path for reading an array element by index, such as `arr[i]` in
+      // an indexed loop. Out-of-range indexes take the general path.
+      reg1 = pStackPointer[-2];
+      reg2 = pStackPointer[-1];
+      if (Value_isVirtualUInt12(reg2) && (deepTypeOf(vm, reg1) == TC_REF_ARRAY)) {
+        CODE_COVERAGE(876); // Hit
+        reg1 = vm_readArrayElement(vm, reg1, VirtualInt14_decode(vm, reg2));
+        if (reg1 != VM_VALUE_DELETED) {
+          CODE_COVERAGE(877); // Hit
+          goto SUB_TAIL_POP_2_PUSH_REG1;
+        }
+      }
       FLUSH_REGISTER_CACHE();
       err = getProperty(vm, reg->pStackPointer - 2, reg->pStackPointer - 1, reg->pStackPointer - 2);
       CACHE_REGISTERS();
@@ -941,7 +1259,7 @@ SUB_OP_EXTENDED_1: {
 /*     reg2: right operand                                                   */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_ADD): {
+    VM_OP_CASE (VM_OP1_ADD): {
       CODE_COVERAGE(115); // Hit
       reg1 = pStackPointer[-2];
       reg2 = pStackPointer[-1];
@@ -955,6 +1273,16 @@ SUB_OP_EXTENDED_1: {
       } else {
         CODE_COVERAGE(119); // Hit
       }
+      #if MVM_INT14_FAST_PATHS
+      // Other int14 additions can skip the string checks and go straight to
+      // the int14 fast path in SUB_OP_NUM_OP
+      if (Value_isVirtualInt14(reg1) && Value_isVirtualInt14(reg2)) {
+        CODE_COVERAGE(818); // Not hit
+        (void)POP();
+        reg1 = VM_NUM_OP_ADD_NUM;
+        goto SUB_OP_NUM_OP;
+      }
+      #endif
       if (vm_isString(vm, reg1) || vm_isString(vm, reg2)) {
         CODE_COVERAGE(120); // Hit
         FLUSH_REGISTER_CACHE();
@@ -983,7 +1311,7 @@ SUB_OP_EXTENDED_1: {
 /*     reg2: right operand                                                   */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_EQUAL): {
+    VM_OP_CASE (VM_OP1_EQUAL): {
       CODE_COVERAGE(122); // Hit
       // TODO: This popping should be done on the egress rather than the ingress
       reg2 = POP();
@@ -1007,7 +1335,7 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_NOT_EQUAL): {
+    VM_OP_CASE (VM_OP1_NOT_EQUAL): {
       reg1 = pStackPointer[-2];
       reg2 = pStackPointer[-1];
       // TODO: there seem to be so many places where we have to flush the
@@ -1035,10 +1363,17 @@ SUB_OP_EXTENDED_1: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP1_OBJECT_SET_1): {
+    VM_OP_CASE (VM_OP1_OBJECT_SET_1): {
       CODE_COVERAGE(124); // Hit
+      #if MVM_INLINE_CACHE
+      reg3 /* site */ = (uint16_t)LongPtr_sub(lpProgramCounter, vm->lpBytecode);
+      #endif
       FLUSH_REGISTER_CACHE();
+      #if MVM_INLINE_CACHE
+      err = vm_setPropertyCached(vm, reg3, reg->pStackPointer - 3, reg->pStackPointer - 2, reg->pStackPointer - 1);
+      #else
       err = setProperty(vm, reg->pStackPointer - 3, reg->pStackPointer - 2, reg->pStackPointer - 1);
+      #endif
       CACHE_REGISTERS();
       if (err != MVM_E_SUCCESS) {
         CODE_COVERAGE_UNTESTED(265); // Not hit
@@ -1139,6 +1474,62 @@ SUB_OP_SCOPE_PUSH_OR_NEW: {
 SUB_OP_NUM_OP: {
   CODE_COVERAGE(25); // Hit
 
+  #if MVM_UNBOXED_INT32
+  if (pUnboxedInt32) {
+    CODE_COVERAGE(915); // Not hit
+    reg3 = (VM_OP_NUM_OP << 4) | reg1;
+    goto SUB_UNBOXED_INT32_OP;
+  }
+  #endif // MVM_UNBOXED_INT32
+
+  #if MVM_UNBOXED_FLOAT64
+  if (unboxedFloat64Count) {
+    Value* pTop = pUnboxedFloat64[unboxedFloat64Count - 1];
+    if ((pTop == pStackPointer) || ((pTop == pStackPointer - 1) && (reg1 < VM_NUM_OP_DIVIDER))) {
+      CODE_COVERAGE(928); // Not hit
+      goto SUB_UNBOXED_FLOAT64_OP;
+    }
+  }
+  #endif // MVM_UNBOXED_FLOAT64
+
+  #if MVM_INT14_FAST_PATHS
+  // Fast path for binary operations where both operands are int14, which is
+  // the common case for things like loop counters. The result of these can't
+  // overflow an int32, so the only check needed is whether it still fits in an
+  // int14. Anything else, including division, takes the general path below.
+  if ((reg1 < VM_NUM_OP_DIVIDE) && Value_isVirtualInt14(reg2) && Value_isVirtualInt14(pStackPointer[-1])) {
+    CODE_COVERAGE(811); // Not hit
+    int32_t left = VirtualInt14_decode(vm, pStackPointer[-1]);
+    int32_t right = VirtualInt14_decode(vm, reg2);
+    int32_t result = 0;
+
+    MVM_SWITCH (reg1, (VM_NUM_OP_DIVIDE - 1)) {
+      MVM_CASE(VM_NUM_OP_LESS_THAN): result = left < right; break;
+      MVM_CASE(VM_NUM_OP_GREATER_THAN): result = left > right; break;
+      MVM_CASE(VM_NUM_OP_LESS_EQUAL): result = left <= right; break;
+      MVM_CASE(VM_NUM_OP_GREATER_EQUAL): result = left >= right; break;
+      MVM_CASE(VM_NUM_OP_ADD_NUM): result = left + right; break;
+      MVM_CASE(VM_NUM_OP_SUBTRACT): result = left - right; break;
+      MVM_CASE(VM_NUM_OP_MULTIPLY): result = left * right; break;
+    }
+
+    if (reg1 < VM_NUM_OP_ADD_NUM) {
+      CODE_COVERAGE(812); // Not hit
+      reg1 = result ? VM_VALUE_TRUE : VM_VALUE_FALSE;
+      goto SUB_TAIL_POP_1_PUSH_REG1;
+    }
+
+    if ((result >= VM_MIN_INT14) && (result <= VM_MAX_INT14)) {
+      CODE_COVERAGE(813); // Not hit
+      reg1 = VirtualInt14_encode(vm, (int16_t)result);
+      goto SUB_TAIL_POP_1_PUSH_REG1;
+    }
+
+    // Otherwise the result needs to be allocated as an int32
+    CODE_COVERAGE(814); // Not hit
+  }
+  #endif // MVM_INT14_FAST_PATHS
+
   int32_t reg1I = 0;
   int32_t reg2I = 0;
 
@@ -1320,6 +1711,10 @@ SUB_OP_NUM_OP: {
     reg1 = VirtualInt14_encode(vm, (uint16_t)reg1I);
   } else {
     CODE_COVERAGE(104); // Hit
+    #if MVM_UNBOXED_INT32
+    unboxedInt32 = reg1I;
+    goto SUB_TAIL_PUSH_INT32;
+    #endif
     FLUSH_REGISTER_CACHE();
     reg1 = mvm_newInt32(vm, reg1I);
     CACHE_REGISTERS();
@@ -1360,7 +1755,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg2: condition to branch on                                          */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_BRANCH_1): {
+    VM_OP_CASE (VM_OP2_BRANCH_1): {
       CODE_COVERAGE(130); // Hit
       SIGN_EXTEND_REG_1();
       goto SUB_BRANCH_COMMON;
@@ -1373,7 +1768,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_STORE_ARG): {
+    VM_OP_CASE (VM_OP2_STORE_ARG): {
       CODE_COVERAGE_UNTESTED(131); // Not hit
       #if MVM_DONT_TRUST_BYTECODE
         // The ability to write to argument slots is intended as an optimization
@@ -1399,7 +1794,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_STORE_SCOPED_2): {
+    VM_OP_CASE (VM_OP2_STORE_SCOPED_2): {
       CODE_COVERAGE(132); // Hit
       goto SUB_OP_STORE_SCOPED;
     }
@@ -1411,18 +1806,40 @@ SUB_OP_EXTENDED_2: {
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_STORE_VAR_2): {
+    VM_OP_CASE (VM_OP2_STORE_VAR_2): {
       CODE_COVERAGE_UNTESTED(133); // Not hit
       goto SUB_OP_STORE_VAR;
     }
 
+/* ------------------------------------------------------------------------- */
+/*                          VM_OP2_BRANCH_LESS_THAN_1                        */
+/*                          VM_OP2_BRANCH_LESS_EQUAL_1                       */
+/*   Expects:                                                                */
+/*     reg1: signed 8-bit offset to branch to, encoded in 16-bit unsigned    */
+/*     reg2: right operand of the comparison                                 */
+/* ------------------------------------------------------------------------- */
+
+    VM_OP_CASE (VM_OP2_BRANCH_LESS_THAN_1): {
+      CODE_COVERAGE(819); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(1);
+      reg3 = VM_NUM_OP_LESS_THAN;
+      goto SUB_BRANCH_COMPARE;
+    }
+
+    VM_OP_CASE (VM_OP2_BRANCH_LESS_EQUAL_1): {
+      CODE_COVERAGE(820); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(1);
+      reg3 = VM_NUM_OP_LESS_EQUAL;
+      goto SUB_BRANCH_COMPARE;
+    }
+
 /* ------------------------------------------------------------------------- */
 /*                             VM_OP2_JUMP_1                                 */
 /*   Expects:                                                                */
 /*     reg1: signed 8-bit offset to branch to, encoded in 16-bit unsigned    */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_JUMP_1): {
+    VM_OP_CASE (VM_OP2_JUMP_1): {
       CODE_COVERAGE(136); // Hit
       SIGN_EXTEND_REG_1();
       goto SUB_JUMP_COMMON;
@@ -1434,7 +1851,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: arg count                                                       */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_CALL_HOST): {
+    VM_OP_CASE (VM_OP2_CALL_HOST): {
       CODE_COVERAGE_UNTESTED(137); // Not hit
       // TODO: Unit tests for the host calling itself etc.
 
@@ -1452,7 +1869,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: arg count | isVoidCall flag 0x80                                */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_CALL_3): {
+    VM_OP_CASE (VM_OP2_CALL_3): {
       CODE_COVERAGE(142); // Hit
 
       // Note: The first 7 bits of `reg1` are the argument count, and the 8th
@@ -1464,7 +1881,32 @@ SUB_OP_EXTENDED_2: {
 
       reg3 /* cpsCallback */ = VM_VALUE_UNDEFINED;
 
+      #if MVM_CALL_CACHE
+      {
+        reg1 /* argCountAndFlags */ |= AF_PUSHED_FUNCTION;
+        reg2 /* target */ = pStackPointer[-(int16_t)(reg1 & AF_ARG_COUNT_MASK) - 1];
+        uint16_t site = (uint16_t)LongPtr_sub(lpProgramCounter, vm->lpBytecode);
+        vm_TsCallCacheEntry* entry = &vm->callCache[site & (MVM_CALL_CACHE_SIZE - 1)];
+        if ((entry->site == site) && (entry->callee == reg2) && ((reg2 == entry->function) ||
+          (READ_FIELD_2(DynamicPtr_decode_long(vm, reg2), TsClosure, target) == entry->function))
+        ) {
+          CODE_COVERAGE(879); // Not hit
+          vm->callCacheStats.hits++;
+          reg->cpsCallback = reg3;
+          reg3 /* scope */ = (reg2 == entry->function) ? VM_VALUE_UNDEFINED : reg2;
+          regLP1 /* lpReturnAddress */ = lpProgramCounter;
+          lpProgramCounter = LongPtr_add(vm->lpBytecode, entry->functionOffset);
+          reg2 /* requiredFrameSizeWords */ = entry->frameSizeWords;
+          goto SUB_CALL_BYTECODE_FRAME;
+        }
+        CODE_COVERAGE(880); // Not hit
+        vm->callCacheStats.misses++;
+        vm_fillCallCache(vm, entry, site, reg2);
+        goto SUB_CALL;
+      }
+      #else
       goto SUB_CALL_DYNAMIC;
+      #endif
     }
 
 
@@ -1474,7 +1916,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: index into short-call table                                      */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_CALL_6): {
+    VM_OP_CASE (VM_OP2_CALL_6): {
       CODE_COVERAGE_UNTESTED(145); // Not hit
       goto SUB_CALL_SHORT;
     }
@@ -1485,7 +1927,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: unsigned closure scoped variable index                          */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_LOAD_SCOPED_2): {
+    VM_OP_CASE (VM_OP2_LOAD_SCOPED_2): {
       CODE_COVERAGE(146); // Hit
       goto SUB_OP_LOAD_SCOPED;
     }
@@ -1496,7 +1938,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: unsigned variable index relative to stack pointer               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_LOAD_VAR_2): {
+    VM_OP_CASE (VM_OP2_LOAD_VAR_2): {
       CODE_COVERAGE_UNTESTED(147); // Not hit
       goto SUB_OP_LOAD_VAR;
     }
@@ -1507,7 +1949,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: unsigned variable index relative to stack pointer               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_LOAD_ARG_2): {
+    VM_OP_CASE (VM_OP2_LOAD_ARG_2): {
       CODE_COVERAGE_UNTESTED(148); // Not hit
       VM_NOT_IMPLEMENTED(vm);
       err = MVM_E_FATAL_ERROR_MUST_KILL_VM;
@@ -1520,7 +1962,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: The Ex-4 instruction opcode                                     */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_EXTENDED_4): {
+    VM_OP_CASE (VM_OP2_EXTENDED_4): {
       CODE_COVERAGE(149); // Hit
       goto SUB_OP_EXTENDED_4;
     }
@@ -1530,7 +1972,7 @@ SUB_OP_EXTENDED_2: {
 /*   reg1: Array capacity                                                    */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_ARRAY_NEW): {
+    VM_OP_CASE (VM_OP2_ARRAY_NEW): {
       CODE_COVERAGE(100); // Hit
 
       FLUSH_REGISTER_CACHE();
@@ -1548,7 +1990,7 @@ SUB_OP_EXTENDED_2: {
 /*     reg1: Fixed-array length (8-bit)                                      */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP2_FIXED_ARRAY_NEW_2): {
+    VM_OP_CASE (VM_OP2_FIXED_ARRAY_NEW_2): {
       CODE_COVERAGE_UNTESTED(135); // Not hit
       goto SUB_FIXED_ARRAY_NEW;
     }
@@ -1568,9 +2010,9 @@ SUB_OP_EXTENDED_2: {
 
 SUB_FIXED_ARRAY_NEW: {
   FLUSH_REGISTER_CACHE();
-  uint16_t* arr = mvm_allocate(vm, reg1 * 2, TC_REF_FIXED_LENGTH_ARRAY);
+  Value* arr = mvm_allocate(vm, reg1 * sizeof (Value), TC_REF_FIXED_LENGTH_ARRAY);
   CACHE_REGISTERS();
-  uint16_t* p = arr;
+  Value* p = arr;
   // Note: when reading a DELETED value from the array, it will read as
   // `undefined`. When fixed-length arrays are used to hold closure values, the
   // `DELETED` value can be used to represent the TDZ.
@@ -1614,7 +2056,7 @@ SUB_OP_EXTENDED_3: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_POP_N): {
+    VM_OP_CASE (VM_OP3_POP_N): {
       CODE_COVERAGE(602); // Hit
       READ_PGM_1(reg1);
       while (reg1--)
@@ -1628,7 +2070,7 @@ SUB_OP_EXTENDED_3: {
 /*     Nothing                                                              */
 /* -------------------------------------------------------------------------*/
 
-    MVM_CASE (VM_OP3_SCOPE_DISCARD): {
+    VM_OP_CASE (VM_OP3_SCOPE_DISCARD): {
       CODE_COVERAGE(634); // Hit
       reg->closure = VM_VALUE_UNDEFINED;
       goto SUB_TAIL_POP_0_PUSH_0;
@@ -1644,7 +2086,7 @@ SUB_OP_EXTENDED_3: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_SCOPE_CLONE): {
+    VM_OP_CASE (VM_OP3_SCOPE_CLONE): {
       CODE_COVERAGE(635); // Hit
 
       VM_ASSERT(vm, reg->closure != VM_VALUE_UNDEFINED);
@@ -1662,7 +2104,7 @@ SUB_OP_EXTENDED_3: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_AWAIT): {
+    VM_OP_CASE (VM_OP3_AWAIT): {
       /*
       This instruction is invoked at a syntactic `await` point, which is after
       the awaited expression has been pushed to the stack. If the awaited thing
@@ -1678,7 +2120,7 @@ SUB_OP_EXTENDED_3: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_AWAIT_CALL): {
+    VM_OP_CASE (VM_OP3_AWAIT_CALL): {
       CODE_COVERAGE(667); // Hit
       // reg1 = arg count
       READ_PGM_1(reg1);
@@ -1698,6 +2140,7 @@ SUB_OP_EXTENDED_3: {
       VM_ASSERT(vm, deepTypeOf(vm, reg->closure) == TC_REF_CLOSURE);
       regP1 /* current scope */ = ShortPtr_decode(vm, reg->closure);
       regP1[0] = reg2;
+      VM_WRITE_BARRIER(vm, regP1);
 
       // Similar to VM_OP2_CALL_3 except that cpsCallback points to the current closure
       reg3 /* cpsCallback */ = reg->closure;
@@ -1713,7 +2156,7 @@ SUB_OP_EXTENDED_3: {
 
     // This instruction is the first instruction executed after an await point
     // in an async function.
-    MVM_CASE (VM_OP3_ASYNC_RESUME): {
+    VM_OP_CASE (VM_OP3_ASYNC_RESUME): {
       CODE_COVERAGE(668); // Hit
 
       READ_PGM_1(reg1 /* stack restoration slot count */);
@@ -1727,6 +2170,8 @@ SUB_OP_EXTENDED_3: {
         regLP1 = vm_findScopedVariable(vm, 0);
         regP1 = (Value*)LongPtr_truncate(vm, regLP1);
         *regP1 = VM_VALUE_DELETED;
+        // Slot 0 is the start of the closure
+        VM_WRITE_BARRIER(vm, regP1);
       #endif
 
       // The synchronous stack will be empty when the async function is resumed
@@ -1753,6 +2198,7 @@ SUB_OP_EXTENDED_3: {
       // state.
       regP1 /* closure */ = (Value*)DynamicPtr_decode_native(vm, reg->closure);
       VM_ASSERT(vm, vm_getAllocationSize(regP1) >= (2 + reg1) * 2);
+      VM_WRITE_BARRIER(vm, regP1);
       regP1 += 2; // Skip over continuation and callback
 
       TABLE_COVERAGE(reg1 ? 1 : 0, 2, 685); // Hit 2/2
@@ -1800,13 +2246,38 @@ SUB_OP_EXTENDED_3: {
       goto SUB_TAIL_POP_0_PUSH_REG1;
     }
 
+/* ------------------------------------------------------------------------- */
+/*                          VM_OP3_LOAD_GLOBAL_CALLEE                        */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/* ------------------------------------------------------------------------- */
+
+    // Superinstruction for LOAD_GLOBAL_3 followed by pushing `undefined`. The
+    // opcode is below VM_OP3_DIVIDER_1, so it reads its own operand.
+    VM_OP_CASE (VM_OP3_LOAD_GLOBAL_CALLEE): {
+      CODE_COVERAGE(762); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(1);
+      READ_PGM_2(reg1);
+      reg1 = globals[reg1];
+      if (reg1 == VM_VALUE_DELETED) {
+        CODE_COVERAGE_ERROR_PATH(763); // Not hit
+        err = vm_newError(vm, MVM_E_UNINITIALIZED_GLOBAL);
+        goto SUB_EXIT;
+      } else {
+        CODE_COVERAGE(764); // Not hit
+      }
+      PUSH(reg1);
+      reg1 = VM_VALUE_UNDEFINED;
+      goto SUB_TAIL_POP_0_PUSH_REG1;
+    }
+
 /* ------------------------------------------------------------------------- */
 /*                             VM_OP3_JUMP_2                                 */
 /*   Expects:                                                                */
 /*     reg1: signed offset                                                   */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_JUMP_2): {
+    VM_OP_CASE (VM_OP3_JUMP_2): {
       CODE_COVERAGE(153); // Hit
       goto SUB_JUMP_COMMON;
     }
@@ -1817,7 +2288,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg1: literal value                                                   */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_LOAD_LITERAL): {
+    VM_OP_CASE (VM_OP3_LOAD_LITERAL): {
       CODE_COVERAGE(154); // Hit
       goto SUB_TAIL_POP_0_PUSH_REG1;
     }
@@ -1828,7 +2299,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg1: global variable index                                           */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_LOAD_GLOBAL_3): {
+    VM_OP_CASE (VM_OP3_LOAD_GLOBAL_3): {
       CODE_COVERAGE(155); // Hit
       reg1 = globals[reg1];
       if (reg1 == VM_VALUE_DELETED) {
@@ -1847,7 +2318,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg1: scoped variable index                                           */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_LOAD_SCOPED_3): {
+    VM_OP_CASE (VM_OP3_LOAD_SCOPED_3): {
       CODE_COVERAGE_UNTESTED(600); // Not hit
       goto SUB_OP_LOAD_SCOPED;
     }
@@ -1859,7 +2330,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg2: condition                                                       */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_BRANCH_2): {
+    VM_OP_CASE (VM_OP3_BRANCH_2): {
       CODE_COVERAGE(156); // Hit
       goto SUB_BRANCH_COMMON;
     }
@@ -1871,7 +2342,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_STORE_GLOBAL_3): {
+    VM_OP_CASE (VM_OP3_STORE_GLOBAL_3): {
       CODE_COVERAGE(157); // Hit
       globals[reg1] = reg2;
       goto SUB_TAIL_POP_0_PUSH_0;
@@ -1884,7 +2355,7 @@ SUB_OP_EXTENDED_3: {
 /*     reg2: value to store                                                  */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_STORE_SCOPED_3): {
+    VM_OP_CASE (VM_OP3_STORE_SCOPED_3): {
       CODE_COVERAGE_UNTESTED(601); // Not hit
       goto SUB_OP_STORE_SCOPED;
     }
@@ -1896,11 +2367,27 @@ SUB_OP_EXTENDED_3: {
 /*     reg2: object value                                                    */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_OBJECT_GET_2): {
-      CODE_COVERAGE_UNTESTED(158); // Not hit
-      VM_NOT_IMPLEMENTED(vm);
-      err = MVM_E_FATAL_ERROR_MUST_KILL_VM;
-      goto SUB_EXIT;
+    // Superinstruction for LOAD_LITERAL followed by OBJECT_GET_1. The object is
+    // pushed back so that it's still a GC root while getting the property, and
+    // is then replaced by the result. The key doesn't need to be on the stack
+    // because literals in the bytecode never point into the GC heap.
+    VM_OP_CASE (VM_OP3_OBJECT_GET_2): {
+      CODE_COVERAGE(158); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(1);
+      Value propertyKey = reg1;
+      PUSH(reg2);
+      #if MVM_INLINE_CACHE
+      reg3 /* site */ = (uint16_t)LongPtr_sub(lpProgramCounter, vm->lpBytecode);
+      #endif
+      FLUSH_REGISTER_CACHE();
+      #if MVM_INLINE_CACHE
+      err = vm_getPropertyCached(vm, reg3, reg->pStackPointer - 1, &propertyKey, reg->pStackPointer - 1);
+      #else
+      err = getProperty(vm, reg->pStackPointer - 1, &propertyKey, reg->pStackPointer - 1);
+      #endif
+      CACHE_REGISTERS();
+      if (err != MVM_E_SUCCESS) goto SUB_EXIT;
+      goto SUB_TAIL_POP_0_PUSH_0;
     }
 
 /* ------------------------------------------------------------------------- */
@@ -1910,11 +2397,26 @@ SUB_OP_EXTENDED_3: {
 /*     reg2: value                                                           */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP3_OBJECT_SET_2): {
+    // Pops the object and the value. The key is a literal in the bytecode.
+    VM_OP_CASE (VM_OP3_OBJECT_SET_2): {
       CODE_COVERAGE_UNTESTED(159); // Not hit
-      VM_NOT_IMPLEMENTED(vm);
-      err = MVM_E_FATAL_ERROR_MUST_KILL_VM;
-      goto SUB_EXIT;
+      Value propertyKey = reg1;
+      #if MVM_INLINE_CACHE
+      reg3 /* site */ = (uint16_t)LongPtr_sub(lpProgramCounter, vm->lpBytecode);
+      #endif
+      // The value goes back on the stack so that it's still a GC root while
+      // setting the property
+      PUSH(reg2);
+      FLUSH_REGISTER_CACHE();
+      #if MVM_INLINE_CACHE
+      err = vm_setPropertyCached(vm, reg3, reg->pStackPointer - 2, &propertyKey, reg->pStackPointer - 1);
+      #else
+      err = setProperty(vm, reg->pStackPointer - 2, &propertyKey, reg->pStackPointer - 1);
+      #endif
+      CACHE_REGISTERS();
+      if (err != MVM_E_SUCCESS) goto SUB_EXIT;
+      pStackPointer -= 2;
+      goto SUB_TAIL_POP_0_PUSH_0;
     }
 
   } // End of vm_TeOpcodeEx3 switch
@@ -1929,6 +2431,14 @@ SUB_OP_EXTENDED_3: {
 /*     reg1: The Ex-4 instruction opcode                                     */
 /* ------------------------------------------------------------------------- */
 SUB_OP_EXTENDED_4: {
+  #if MVM_COMPUTED_GOTO_DISPATCH
+  if (reg1 < VM_OP4_END) {
+    goto *ex4DispatchTable[reg1];
+  } else {
+    goto SUB_DISPATCH_RESERVED;
+  }
+  #endif
+
   MVM_SWITCH(reg1, (VM_NUM_OP4_END - 1)) {
 
 /* ------------------------------------------------------------------------- */
@@ -1936,7 +2446,7 @@ SUB_OP_EXTENDED_4: {
 /*   Expects: nothing                                                        */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE(VM_OP4_START_TRY): {
+    VM_OP_CASE(VM_OP4_START_TRY): {
       CODE_COVERAGE(206); // Hit
 
       // Location to jump to if there's an exception
@@ -1946,7 +2456,7 @@ SUB_OP_EXTENDED_4: {
       goto SUB_TAIL_POP_0_PUSH_0;
     } // End of VM_OP4_START_TRY
 
-    MVM_CASE(VM_OP4_END_TRY): {
+    VM_OP_CASE(VM_OP4_END_TRY): {
       CODE_COVERAGE(207); // Hit
 
       // Note: EndTry can be invoked either at the normal ending of a `try`
@@ -1963,7 +2473,7 @@ SUB_OP_EXTENDED_4: {
       goto SUB_TAIL_POP_0_PUSH_0;
     } // End of VM_OP4_END_TRY
 
-    MVM_CASE(VM_OP4_OBJECT_KEYS): {
+    VM_OP_CASE(VM_OP4_OBJECT_KEYS): {
       CODE_COVERAGE(223); // Hit
 
       // Note: leave object on the stack in case a GC cycle is triggered by the array allocation
@@ -1976,7 +2486,7 @@ SUB_OP_EXTENDED_4: {
       goto SUB_TAIL_POP_0_PUSH_0; // Pop the object and push the keys
     } // End of VM_OP4_OBJECT_KEYS
 
-    MVM_CASE(VM_OP4_UINT8_ARRAY_NEW): {
+    VM_OP_CASE(VM_OP4_UINT8_ARRAY_NEW): {
       CODE_COVERAGE(324); // Hit
 
       FLUSH_REGISTER_CACHE();
@@ -1992,7 +2502,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP4_CLASS_CREATE): {
+    VM_OP_CASE (VM_OP4_CLASS_CREATE): {
       CODE_COVERAGE(614); // Hit
       // TODO: I think we could save some flash space if we grouped all the
       // opcodes together according to whether they flush the register cache.
@@ -2012,7 +2522,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP4_TYPE_CODE_OF): {
+    VM_OP_CASE (VM_OP4_TYPE_CODE_OF): {
       CODE_COVERAGE(631); // Hit
       reg1 = mvm_typeOf(vm, pStackPointer[-1]);
       reg1 = VirtualInt14_encode(vm, reg1);
@@ -2025,7 +2535,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP4_LOAD_REG_CLOSURE): {
+    VM_OP_CASE (VM_OP4_LOAD_REG_CLOSURE): {
       CODE_COVERAGE(644); // Hit
       reg1 = reg->closure;
       goto SUB_TAIL_POP_0_PUSH_REG1;
@@ -2037,7 +2547,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
 
-    MVM_CASE (VM_OP4_SCOPE_PUSH): {
+    VM_OP_CASE (VM_OP4_SCOPE_PUSH): {
       CODE_COVERAGE(648); // Hit
       reg3 /*capture parent*/ = true;
       goto SUB_OP_SCOPE_PUSH_OR_NEW;
@@ -2048,7 +2558,7 @@ SUB_OP_EXTENDED_4: {
 /*   Expects:                                                                */
 /*     Nothing                                                               */
 /* ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_SCOPE_POP): {
+    VM_OP_CASE (VM_OP4_SCOPE_POP): {
       CODE_COVERAGE(649); // Hit
       reg1 = reg->closure;
       VM_ASSERT(vm, reg1 != VM_VALUE_UNDEFINED);
@@ -2074,7 +2584,7 @@ SUB_OP_EXTENDED_4: {
  *   Expects:
  *     Nothing
  * ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_SCOPE_SAVE): {
+    VM_OP_CASE (VM_OP4_SCOPE_SAVE): {
       CODE_COVERAGE(728); // Hit
       PUSH(reg->closure);
       goto SUB_TAIL_POP_0_PUSH_0;
@@ -2087,7 +2597,7 @@ SUB_OP_EXTENDED_4: {
 /*                                                                           */
 /*   This should be the first instruction in an async function.              */
 /* ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_ASYNC_START): {
+    VM_OP_CASE (VM_OP4_ASYNC_START): {
       CODE_COVERAGE(696); // Hit
       READ_PGM_1(reg1); // Closure size and parent reference flag
 
@@ -2133,7 +2643,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /*                                                                           */
 /* ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_ASYNC_RETURN): {
+    VM_OP_CASE (VM_OP4_ASYNC_RETURN): {
       // This operation is used in place of a normal RETURN when compiling an
       // async function. It indirectly calls the callback function with the
       // result instead of passing it to the synchronous caller (it does so via
@@ -2159,7 +2669,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /*                                                                           */
 /* ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_ENQUEUE_JOB): {
+    VM_OP_CASE (VM_OP4_ENQUEUE_JOB): {
       // This instruction enqueues the current closure to the job queue (for the
       // moment there is only one job queue, for executing async callbacks)
       CODE_COVERAGE_UNTESTED(671); // Not hit
@@ -2176,7 +2686,7 @@ SUB_OP_EXTENDED_4: {
 /*     Nothing                                                               */
 /*                                                                           */
 /* ------------------------------------------------------------------------- */
-    MVM_CASE (VM_OP4_ASYNC_COMPLETE): {
+    VM_OP_CASE (VM_OP4_ASYNC_COMPLETE): {
       // This instruction implements the completion of an async function. The
       // main functionality is in SUB_ASYNC_COMPLETE which is shared between the
       // 3 different async completion paths: return (AsyncReturn), catch
@@ -2188,6 +2698,226 @@ SUB_OP_EXTENDED_4: {
       goto SUB_ASYNC_COMPLETE;
     }
 
+/* ------------------------------------------------------------------------- */
+/*                             VM_OP4_TAIL_CALL                              */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_TAIL_CALL): {
+      CODE_COVERAGE(826); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(1);
+      READ_PGM_1(reg1 /* argCount */);
+      goto SUB_TAIL_CALL;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                         VM_OP4_LOAD_SCOPED_OUTER                          */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_LOAD_SCOPED_OUTER): {
+      CODE_COVERAGE(862); // Hit
+      READ_PGM_1(reg1 /* depth and index */);
+      // Skip the relative index, which is only there for the decoder
+      lpProgramCounter = LongPtr_add(lpProgramCounter, 1);
+      LongPtr lpVar = vm_findOuterScopedVariable(vm, (uint8_t)reg1);
+      reg1 = LongPtr_read2_aligned(lpVar);
+      goto SUB_TAIL_POP_0_PUSH_REG1;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                         VM_OP4_STORE_SCOPED_OUTER                         */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_STORE_SCOPED_OUTER): {
+      CODE_COVERAGE(863); // Hit
+      READ_PGM_1(reg1 /* depth and index */);
+      // Skip the relative index, which is only there for the decoder
+      lpProgramCounter = LongPtr_add(lpProgramCounter, 1);
+      LongPtr lpVar = vm_findOuterScopedVariable(vm, (uint8_t)reg1);
+      Value* pVar = (Value*)LongPtr_truncate(vm, lpVar);
+      // It would be an illegal operation to write to a closure variable stored in ROM
+      VM_BYTECODE_ASSERT(vm, lpVar == LongPtr_new(pVar));
+      *pVar = pStackPointer[-1];
+      VM_SCOPED_WRITE_BARRIER(vm, pVar);
+      goto SUB_TAIL_POP_1_PUSH_0;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                           VM_OP4_TABLE_SWITCH                             */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   Jumps to the table entry for the discriminant at the top of the stack,  */
+/*   or to the default offset if it isn't in the range of the table. The     */
+/*   discriminant is left on the stack.                                      */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_TABLE_SWITCH): {
+      CODE_COVERAGE(864); // Hit
+      READ_PGM_2(reg2 /* lowest case value */);
+      READ_PGM_1(reg3 /* entry count */);
+      READ_PGM_2(reg1 /* default offset */);
+      LongPtr lpTable = lpProgramCounter;
+      lpProgramCounter = LongPtr_add(lpProgramCounter, reg3 * 2);
+      int16_t key;
+      if (vm_getSwitchKey(vm, pStackPointer[-1], &key)) {
+        // Both are int14, so the difference fits in 16 bits, and keys below
+        // the lowest case value wrap around to large unsigned numbers
+        uint16_t entryIndex = (uint16_t)(key - (int16_t)reg2);
+        if (entryIndex < reg3) {
+          CODE_COVERAGE(865); // Hit
+          reg1 = LongPtr_read2_unaligned(LongPtr_add(lpTable, entryIndex * 2));
+        }
+      }
+      goto SUB_JUMP_COMMON;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                           VM_OP4_LOOKUP_SWITCH                            */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   Like VM_OP4_TABLE_SWITCH, but for case values that are too sparse for   */
+/*   a table. The cases are sorted by value and binary-searched.             */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_LOOKUP_SWITCH): {
+      CODE_COVERAGE(869); // Hit
+      READ_PGM_1(reg3 /* case count */);
+      READ_PGM_2(reg1 /* default offset */);
+      LongPtr lpTable = lpProgramCounter;
+      lpProgramCounter = LongPtr_add(lpProgramCounter, reg3 * 4);
+      int16_t key;
+      if (vm_getSwitchKey(vm, pStackPointer[-1], &key)) {
+        uint16_t low = 0;
+        uint16_t high = reg3;
+        while (low < high) {
+          uint16_t mid = (low + high) >> 1;
+          LongPtr lpCase = LongPtr_add(lpTable, mid * 4);
+          int16_t caseValue = (int16_t)LongPtr_read2_unaligned(lpCase);
+          if (caseValue == key) {
+            CODE_COVERAGE(870); // Hit
+            reg1 = LongPtr_read2_unaligned(LongPtr_add(lpCase, 2));
+            break;
+          } else if (caseValue < key) {
+            low = mid + 1;
+          } else {
+            high = mid;
+          }
+        }
+      }
+      goto SUB_JUMP_COMMON;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                         VM_OP4_ARRAY_ITER_START                           */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   Pushes the cursor index for iterating the array at the top of the       */
+/*   stack. Microvium doesn't implement the iterator protocol, so only       */
+/*   arrays can be iterated.                                                 */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_ARRAY_ITER_START): {
+      CODE_COVERAGE(871); // Hit
+      if (deepTypeOf(vm, pStackPointer[-1]) != TC_REF_ARRAY) {
+        CODE_COVERAGE_ERROR_PATH(872); // Not hit
+        err = vm_newError(vm, MVM_E_TYPE_ERROR);
+        goto SUB_EXIT;
+      }
+      reg1 = VirtualInt14_encode(vm, 0);
+      goto SUB_TAIL_POP_0_PUSH_REG1;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                         VM_OP4_ARRAY_ITER_NEXT                            */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   The array and cursor index are the top two values on the stack. The     */
+/*   length is read on each iteration, since the loop body may change it.    */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_ARRAY_ITER_NEXT): {
+      CODE_COVERAGE(873); // Hit
+      READ_PGM_2(reg2 /* offset to jump by when done */);
+      reg3 /* index */ = pStackPointer[-1];
+      // Only ARRAY_ITER_START and this instruction write the cursor
+      VM_BYTECODE_ASSERT(vm, Value_isVirtualUInt12(reg3));
+      VM_BYTECODE_ASSERT(vm, deepTypeOf(vm, pStackPointer[-2]) == TC_REF_ARRAY);
+      reg1 = vm_readArrayElement(vm, pStackPointer[-2], VirtualInt14_decode(vm, reg3));
+      if (reg1 != VM_VALUE_DELETED) {
+        CODE_COVERAGE(874); // Hit
+        pStackPointer[-1] = reg3 + VirtualInt14_encode(vm, 1) - VirtualInt14_encode(vm, 0);
+        goto SUB_TAIL_POP_0_PUSH_REG1;
+      }
+      CODE_COVERAGE(875); // Hit
+      PUSH(VM_VALUE_UNDEFINED);
+      reg1 = reg2;
+      goto SUB_JUMP_COMMON;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                           VM_OP4_VAR_NUM_OP                               */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   Binary operation on two variables in the current frame.                 */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_VAR_NUM_OP): {
+      CODE_COVERAGE(888); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(2);
+      READ_PGM_1(reg3 /* NUM_OP or BIT_OP instruction */);
+      READ_PGM_1(reg1 /* left slot */);
+      READ_PGM_1(reg2 /* right slot */);
+      reg1 = pFrameBase[reg1];
+      reg2 = pFrameBase[reg2];
+      goto SUB_VAR_NUM_OP;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                          VM_OP4_VAR_LIT_NUM_OP                            */
+/*   Expects:                                                                */
+/*     Nothing                                                               */
+/*                                                                           */
+/*   Binary operation on a variable in the current frame and a small         */
+/*   integer literal.                                                        */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_VAR_LIT_NUM_OP): {
+      CODE_COVERAGE(889); // Not hit
+      CHARGE_FUSED_INSTRUCTIONS(2);
+      READ_PGM_1(reg3 /* NUM_OP or BIT_OP instruction */);
+      READ_PGM_1(reg1 /* left slot */);
+      READ_PGM_1(reg2 /* right literal */);
+      reg1 = pFrameBase[reg1];
+      reg2 = VirtualInt14_encode(vm, (int8_t)reg2);
+      goto SUB_VAR_NUM_OP;
+    }
+
+/* ------------------------------------------------------------------------- */
+/*                               VM_OP4_GAS                                  */
+/*   Expects:                                                                */
+/*     reg1: number of instructions in the basic block                       */
+/* ------------------------------------------------------------------------- */
+    VM_OP_CASE (VM_OP4_GAS): {
+      CODE_COVERAGE_UNTESTED(837); // Not hit
+      READ_PGM_1(reg1 /* instruction count */);
+      #if defined(MVM_GAS_COUNTER) && MVM_GAS_PER_BLOCK
+      if (vm->stopAfterNInstructions >= 0) {
+        CODE_COVERAGE_UNTESTED(838); // Not hit
+        if (vm->stopAfterNInstructions < (int32_t)reg1) {
+          CODE_COVERAGE_UNTESTED(839); // Not hit
+          // Nothing in the segment has run yet, but the counter is cleared so
+          // that later calls stop as well, as they do in per-instruction mode
+          vm->stopAfterNInstructions = 0;
+          err = MVM_E_INSTRUCTION_COUNT_REACHED;
+          goto SUB_EXIT;
+        }
+        vm->stopAfterNInstructions -= reg1;
+      }
+      #endif
+      goto SUB_TAIL_POP_0_PUSH_0;
+    }
+
   } // End of switch inside SUB_OP_EXTENDED_4
 } // End of SUB_OP_EXTENDED_4
 
@@ -2258,6 +2988,7 @@ SUB_AWAIT: {
   VM_ASSERT(vm, LongPtr_read1(LongPtr_add(vm->lpBytecode, reg2)) == ((VM_OP_EXTENDED_3 << 4) | VM_OP3_ASYNC_RESUME));
 
   regP2[0] /* resume point bytecode pointer */ = vm_encodeBytecodeOffsetAsPointer(vm, reg2);
+  VM_WRITE_BARRIER(vm, regP2);
 
 
   // Preserve the stack
@@ -2389,6 +3120,7 @@ SUB_ASYNC_COMPLETE: {
     // Mark the promise as settled
     pPromise[VM_OIS_PROMISE_STATUS] = reg2 == VM_VALUE_TRUE ? VM_PROMISE_STATUS_RESOLVED : VM_PROMISE_STATUS_REJECTED;
     pPromise[VM_OIS_PROMISE_OUT] = reg3; // Note: need to assign this before vm_scheduleContinuation to avoid GC issues
+    VM_WRITE_BARRIER(vm, pPromise);
 
     tc = deepTypeOf(vm, callbackList);
     if (tc == TC_VAL_UNDEFINED) {
@@ -2443,58 +3175,296 @@ SUB_BRANCH_COMMON: {
 }
 
 /* ------------------------------------------------------------------------- */
-/*                             SUB_JUMP_COMMON                               */
+/*                             SUB_BRANCH_COMPARE                            */
+/*                                                                           */
+/*   A number comparison followed by a branch on the result. The compiler    */
+/*   only emits these where it has inferred that the operands are integers,  */
+/*   so the int14 case is checked first, but other operands are still        */
+/*   handled with the same semantics as VM_OP_NUM_OP.                        */
+/*                                                                           */
 /*   Expects:                                                                */
-/*     reg1: signed 16-bit amount to jump by                                 */
-/* ------------------------------------------------------------------------- */
-SUB_JUMP_COMMON: {
-  CODE_COVERAGE(161); // Hit
-  lpProgramCounter = LongPtr_add(lpProgramCounter, (int16_t)reg1);
+/*     reg1: signed 8-bit amount to jump by if the comparison is true        */
+/*     reg2: right operand                                                   */
+/*     reg3: vm_TeNumberOp comparison                                        */
+/* ------------------------------------------------------------------------- */
+SUB_BRANCH_COMPARE: {
+  CODE_COVERAGE(821); // Not hit
+  SIGN_EXTEND_REG_1();
+  Value left = POP();
+  bool condition;
+  if (Value_isVirtualInt14(left) && Value_isVirtualInt14(reg2)) {
+    CODE_COVERAGE(822); // Not hit
+    int16_t leftI = VirtualInt14_decode(vm, left);
+    int16_t rightI = VirtualInt14_decode(vm, reg2);
+    condition = (reg3 == VM_NUM_OP_LESS_THAN) ? (leftI < rightI) : (leftI <= rightI);
+  } else {
+    CODE_COVERAGE(823); // Not hit
+    condition = vm_compareNumbers(vm, left, reg2, (vm_TeNumberOp)reg3);
+  }
+  if (condition) {
+    lpProgramCounter = LongPtr_add(lpProgramCounter, (int16_t)reg1);
+  }
   goto SUB_TAIL_POP_0_PUSH_0;
 }
 
+#if MVM_UNBOXED_INT32
 /* ------------------------------------------------------------------------- */
+/*                            SUB_TAIL_PUSH_INT32                            */
 /*                                                                           */
-/*                                  SUB_RETURN                               */
-/*                                                                           */
-/*   Return from the current frame                                           */
+/*   Pushes the int32 result of a NUM_OP or BIT_OP. If it's outside the      */
+/*   int14 range and will be consumed by the arithmetic that follows (see    */
+/*   vm_arithmeticResultIsConsumed), it isn't allocated. The value is kept   */
+/*   in `unboxedInt32` and its slot holds VM_VALUE_DELETED as a              */
+/*   placeholder, which the GC skips, until the consuming instruction picks  */
+/*   it up in SUB_UNBOXED_INT32_OP.                                          */
 /*                                                                           */
 /*   Expects:                                                                */
-/*     reg1: the return value                                                */
-/* ------------------------------------------------------------------------- */
-SUB_RETURN: {
-  CODE_COVERAGE(105); // Hit
-
-  // Pop variables
-  pStackPointer = pFrameBase;
-
-  // Save argCountAndFlags from this frame
-  reg3 = reg->argCountAndFlags;
-
-  // Restore caller state
-  POP_REGISTERS();
+/*     unboxedInt32: the result                                              */
+/* ------------------------------------------------------------------------- */
+SUB_TAIL_PUSH_INT32: {
+  CODE_COVERAGE(916); // Not hit
+  VM_ASSERT(vm, !pUnboxedInt32);
+  if ((unboxedInt32 >= VM_MIN_INT14) && (unboxedInt32 <= VM_MAX_INT14)) {
+    CODE_COVERAGE(917); // Not hit
+    reg1 = VirtualInt14_encode(vm, (int16_t)unboxedInt32);
+    goto SUB_TAIL_POP_0_PUSH_REG1;
+  }
 
-  // If the catch target isn't earlier than the stack pointer then possibly the
-  // catch blocks weren't unwound properly (e.g. the compiler didn't generate
-  // matching EndTry instructions).
-  VM_ASSERT(vm, reg->pCatchTarget < pStackPointer);
+  if (vm_arithmeticResultIsConsumed(vm, lpProgramCounter, pStackPointer, true)) {
+    CODE_COVERAGE(918); // Not hit
+    vm->unboxedInt32Stats.unboxedResults++;
+    pUnboxedInt32 = pStackPointer;
+    reg1 = VM_VALUE_DELETED;
+    goto SUB_TAIL_POP_0_PUSH_REG1;
+  }
 
-  goto SUB_POP_ARGS;
+  CODE_COVERAGE(919); // Not hit
+  vm->unboxedInt32Stats.allocatedResults++;
+  FLUSH_REGISTER_CACHE();
+  reg1 = mvm_newInt32(vm, unboxedInt32);
+  CACHE_REGISTERS();
+  goto SUB_TAIL_POP_0_PUSH_REG1;
 }
 
 /* ------------------------------------------------------------------------- */
+/*                           SUB_UNBOXED_INT32_OP                            */
 /*                                                                           */
-/*                                SUB_POP_ARGS                               */
-/*                                                                           */
-/*   The second part of a "RETURN". Assumes that we're already in the        */
-/*   caller stack frame by this point.                                       */
+/*   A NUM_OP or BIT_OP where one of the operands is the unboxed int32 left  */
+/*   by the previous arithmetic instruction. If the other operand is an      */
+/*   integer and the result is an int32 or a boolean, the operation is done  */
+/*   here. Otherwise the int32 is allocated after all, and the instruction   */
+/*   continues as normal.                                                    */
 /*                                                                           */
 /*   Expects:                                                                */
-/*     reg1: returning result                                                */
-/*     reg3: argCountAndFlags for callee frame                               */
-/* ------------------------------------------------------------------------- */
-SUB_POP_ARGS: {
-  // Pop arguments
+/*     reg1: vm_TeNumberOp or vm_TeBitwiseOp                                 */
+/*     reg2: first popped operand                                            */
+/*     reg3: instruction byte                                                */
+/* ------------------------------------------------------------------------- */
+SUB_UNBOXED_INT32_OP: {
+  CODE_COVERAGE(920); // Not hit
+  bool isBinary = ((reg3 >> 4) == VM_OP_NUM_OP)
+    ? (reg1 < VM_NUM_OP_DIVIDER)
+    : (reg1 < VM_BIT_OP_DIVIDER_2);
+  bool isRight = pUnboxedInt32 == pStackPointer;
+  // The right operand (or the only operand) was popped into reg2, so it's the
+  // slot at the stack pointer, and the left operand is the one below it
+  VM_ASSERT(vm, isRight || (isBinary && (pUnboxedInt32 == pStackPointer - 1)));
+  Value other = isRight
+    ? (isBinary ? pStackPointer[-1] : VirtualInt14_encode(vm, 0))
+    : reg2;
+  TeTypeCode otherType = deepTypeOf(vm, other);
+
+  if ((otherType == TC_VAL_INT14) || (otherType == TC_REF_INT32)) {
+    int32_t otherI = vm_readInt32(vm, otherType, other);
+    int32_t result;
+    if (vm_int32Op((uint8_t)reg3,
+      isRight ? otherI : unboxedInt32,
+      isRight ? unboxedInt32 : otherI,
+      &result)
+    ) {
+      CODE_COVERAGE(921); // Not hit
+      pUnboxedInt32 = NULL;
+      if (isBinary) pStackPointer--;
+      if (((reg3 >> 4) == VM_OP_NUM_OP) && (reg1 < VM_NUM_OP_ADD_NUM)) {
+        CODE_COVERAGE(922); // Not hit
+        reg1 = result;
+        goto SUB_TAIL_PUSH_REG1_BOOL;
+      }
+      unboxedInt32 = result;
+      goto SUB_TAIL_PUSH_INT32;
+    }
+  }
+
+  // Allocate the int32 after all. reg2 is pushed back while allocating so that
+  // the GC sees it, since its slot still holds it (unless reg2 is the
+  // placeholder itself).
+  CODE_COVERAGE(923); // Not hit
+  vm->unboxedInt32Stats.allocatedResults++;
+  pStackPointer++;
+  FLUSH_REGISTER_CACHE();
+  Value boxed = mvm_newInt32(vm, unboxedInt32);
+  CACHE_REGISTERS();
+  *pUnboxedInt32 = boxed;
+  pUnboxedInt32 = NULL;
+  reg2 = POP();
+  if ((reg3 >> 4) == VM_OP_NUM_OP) {
+    CODE_COVERAGE(924); // Not hit
+    goto SUB_OP_NUM_OP;
+  }
+  goto SUB_OP_BIT_OP;
+}
+#endif // MVM_UNBOXED_INT32
+
+/* ------------------------------------------------------------------------- */
+/*                             SUB_VAR_NUM_OP                                */
+/*                                                                           */
+/*   The common part of VM_OP4_VAR_NUM_OP and VM_OP4_VAR_LIT_NUM_OP. The     */
+/*   int14 cases are handled here, and the result stored directly into the   */
+/*   destination if the next instruction is a VM_OP_STORE_VAR_1, or branched */
+/*   on if it is a VM_OP2_BRANCH_1. Anything else is handed to the           */
+/*   stack-machine implementation of the operation, with the left operand    */
+/*   pushed as if by the equivalent LOAD_VAR.                                */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: left operand                                                    */
+/*     reg2: right operand                                                   */
+/*     reg3: binary VM_OP_NUM_OP or VM_OP_BIT_OP instruction byte            */
+/* ------------------------------------------------------------------------- */
+SUB_VAR_NUM_OP: {
+  CODE_COVERAGE(890); // Not hit
+  if (Value_isVirtualInt14(reg1) && Value_isVirtualInt14(reg2)) {
+    CODE_COVERAGE(891); // Not hit
+    int16_t left = VirtualInt14_decode(vm, reg1);
+    int16_t right = VirtualInt14_decode(vm, reg2);
+    int32_t result;
+
+    switch (reg3) {
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_THAN: reg1 = left < right; goto SUB_VAR_NUM_OP_BOOL;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_THAN: reg1 = left > right; goto SUB_VAR_NUM_OP_BOOL;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_EQUAL: reg1 = left <= right; goto SUB_VAR_NUM_OP_BOOL;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_EQUAL: reg1 = left >= right; goto SUB_VAR_NUM_OP_BOOL;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_ADD_NUM: result = left + right; break;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_SUBTRACT: result = left - right; break;
+      case (VM_OP_NUM_OP << 4) | VM_NUM_OP_MULTIPLY: result = (int32_t)left * right; break;
+      case (VM_OP_BIT_OP << 4) | VM_BIT_OP_OR: result = left | right; break;
+      case (VM_OP_BIT_OP << 4) | VM_BIT_OP_AND: result = left & right; break;
+      case (VM_OP_BIT_OP << 4) | VM_BIT_OP_XOR: result = left ^ right; break;
+      default: goto SUB_VAR_NUM_OP_GENERAL;
+    }
+
+    if ((result < VM_MIN_INT14) || (result > VM_MAX_INT14)) {
+      CODE_COVERAGE(892); // Not hit
+      goto SUB_VAR_NUM_OP_GENERAL;
+    }
+    reg1 = VirtualInt14_encode(vm, (int16_t)result);
+    goto SUB_VAR_NUM_OP_RESULT;
+
+  SUB_VAR_NUM_OP_BOOL:
+    reg1 = reg1 ? VM_VALUE_TRUE : VM_VALUE_FALSE;
+
+  SUB_VAR_NUM_OP_RESULT:
+    // The store is not folded when something is observing individual
+    // instructions, so that the gas counter and breakpoints still see it
+    #if defined(MVM_GAS_COUNTER) && !MVM_GAS_PER_BLOCK
+    if (vm->stopAfterNInstructions >= 0) goto SUB_TAIL_POP_0_PUSH_REG1;
+    #endif
+    #if MVM_INCLUDE_DEBUG_CAPABILITY
+    if (vm->pBreakpoints) goto SUB_TAIL_POP_0_PUSH_REG1;
+    #endif
+    reg2 = LongPtr_read1(lpProgramCounter);
+    if ((reg2 >> 4) == VM_OP_STORE_VAR_1) {
+      CODE_COVERAGE(893); // Not hit
+      lpProgramCounter = LongPtr_add(lpProgramCounter, 1);
+      // Same indexing as SUB_OP_STORE_VAR, where the value has been popped
+      pStackPointer[-(int16_t)(reg2 & 0xF) - 1] = reg1;
+      goto SUB_TAIL_POP_0_PUSH_0;
+    }
+    // Similarly, a comparison followed by a VM_OP2_BRANCH_1 (the condition of
+    // a typical loop) takes the branch directly. The result is a boolean or an
+    // int14, so its truthiness doesn't need the full mvm_toBool.
+    if (reg2 == ((VM_OP_EXTENDED_2 << 4) | VM_OP2_BRANCH_1)) {
+      CODE_COVERAGE(981); // Not hit
+      reg2 = LongPtr_read1(LongPtr_add(lpProgramCounter, 1));
+      lpProgramCounter = LongPtr_add(lpProgramCounter, 2);
+      if ((reg1 != VM_VALUE_FALSE) && (reg1 != VirtualInt14_encode(vm, 0))) {
+        CODE_COVERAGE(982); // Not hit
+        lpProgramCounter = LongPtr_add(lpProgramCounter, (int8_t)reg2);
+      }
+      goto SUB_TAIL_POP_0_PUSH_0;
+    }
+    goto SUB_TAIL_POP_0_PUSH_REG1;
+  }
+
+SUB_VAR_NUM_OP_GENERAL:
+  CODE_COVERAGE(894); // Not hit
+  // The slots are read without the TDZ check of LOAD_VAR, so it's done here
+  if ((reg1 == VM_VALUE_DELETED) || (reg2 == VM_VALUE_DELETED)) {
+    CODE_COVERAGE_ERROR_PATH(895); // Not hit
+    err = vm_newError(vm, MVM_E_TDZ_ERROR);
+    goto SUB_EXIT;
+  }
+  PUSH(reg1);
+  reg1 = reg3 & 0xF;
+  if ((reg3 >> 4) == VM_OP_BIT_OP) {
+    CODE_COVERAGE(896); // Not hit
+    goto SUB_OP_BIT_OP;
+  }
+  goto SUB_OP_NUM_OP;
+}
+
+/* ------------------------------------------------------------------------- */
+/*                             SUB_JUMP_COMMON                               */
+/*   Expects:                                                                */
+/*     reg1: signed 16-bit amount to jump by                                 */
+/* ------------------------------------------------------------------------- */
+SUB_JUMP_COMMON: {
+  CODE_COVERAGE(161); // Hit
+  lpProgramCounter = LongPtr_add(lpProgramCounter, (int16_t)reg1);
+  goto SUB_TAIL_POP_0_PUSH_0;
+}
+
+/* ------------------------------------------------------------------------- */
+/*                                                                           */
+/*                                  SUB_RETURN                               */
+/*                                                                           */
+/*   Return from the current frame                                           */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: the return value                                                */
+/* ------------------------------------------------------------------------- */
+SUB_RETURN: {
+  CODE_COVERAGE(105); // Hit
+
+  // Pop variables
+  pStackPointer = pFrameBase;
+
+  // Save argCountAndFlags from this frame
+  reg3 = reg->argCountAndFlags;
+
+  // Restore caller state
+  POP_REGISTERS();
+
+  // If the catch target isn't earlier than the stack pointer then possibly the
+  // catch blocks weren't unwound properly (e.g. the compiler didn't generate
+  // matching EndTry instructions).
+  VM_ASSERT(vm, reg->pCatchTarget < pStackPointer);
+
+  goto SUB_POP_ARGS;
+}
+
+/* ------------------------------------------------------------------------- */
+/*                                                                           */
+/*                                SUB_POP_ARGS                               */
+/*                                                                           */
+/*   The second part of a "RETURN". Assumes that we're already in the        */
+/*   caller stack frame by this point.                                       */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: returning result                                                */
+/*     reg3: argCountAndFlags for callee frame                               */
+/* ------------------------------------------------------------------------- */
+SUB_POP_ARGS: {
+  // Pop arguments
   pStackPointer -= (reg3 & AF_ARG_COUNT_MASK);
 
   // Pop function reference
@@ -2644,6 +3614,11 @@ SUB_NEW: {
     }
   } else if (tc == TC_VAL_NULL) {
     CODE_COVERAGE_UNTESTED(724); // Not hit
+  #if MVM_SHAPED_OBJECTS
+  } else if (tc == TC_REF_SHAPED_OBJECT) {
+    CODE_COVERAGE_UNTESTED(784); // Not hit
+    // Objects with internal slots are never shaped, so there's no magic key
+  #endif
   } else {
     CODE_COVERAGE_ERROR_PATH(725); // Not hit
     err = vm_newError(vm, MVM_E_CLASS_PROTOTYPE_MUST_BE_NULL_OR_OBJECT);
@@ -2739,6 +3714,66 @@ SUB_CALL: {
   }
 }
 
+/* ------------------------------------------------------------------------- */
+/*                                SUB_TAIL_CALL                              */
+/*                                                                           */
+/*   Performs a dynamic call in place of returning from the current frame,   */
+/*   so that a chain of tail calls runs in constant stack space.             */
+/*                                                                           */
+/*   The current frame is popped as if returning, and the function and       */
+/*   arguments are moved down to where the current frame's function and      */
+/*   arguments were. The call is then performed from the caller frame, with  */
+/*   the return address and call flags of the current frame, so the callee   */
+/*   returns directly to whoever called the current frame.                   */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: argCount (not including flags)                                  */
+/*     The stack should have the function, this, and args                    */
+/* ------------------------------------------------------------------------- */
+SUB_TAIL_CALL: {
+  CODE_COVERAGE(827); // Not hit
+
+  VM_ASSERT(vm, (reg1 & AF_ARG_COUNT_MASK) == reg1);
+
+  regP1 /* pFunction */ = pStackPointer - reg1 - 1;
+
+  // argCountAndFlags of the frame being replaced
+  reg3 = reg->argCountAndFlags;
+
+  // Pop the current frame (see SUB_RETURN). The function and arguments being
+  // called are still physically on the stack above the new stack pointer.
+  pStackPointer = pFrameBase;
+  POP_REGISTERS();
+
+  // The compiler only emits a tail call where the frame has no active `try`
+  VM_ASSERT(vm, reg->pCatchTarget < pStackPointer);
+
+  // Pop the arguments and function of the frame being replaced (see
+  // SUB_POP_ARGS)
+  pStackPointer -= (reg3 & AF_ARG_COUNT_MASK);
+  if (reg3 & AF_PUSHED_FUNCTION) {
+    CODE_COVERAGE(828); // Not hit
+    pStackPointer--;
+  } else {
+    CODE_COVERAGE_UNTESTED(829); // Not hit
+  }
+
+  // Move the function and arguments down into the space. This is always a
+  // move to a lower address, so copying forwards is safe for the overlap.
+  VM_ASSERT(vm, pStackPointer <= regP1);
+  reg2 /* word count */ = reg1 + 1;
+  while (reg2--) {
+    *pStackPointer++ = *regP1++;
+  }
+
+  // The callee inherits how the result is used by the original caller
+  reg1 /* argCountAndFlags */ |= AF_PUSHED_FUNCTION | (reg3 & (AF_VOID_CALLED | AF_CALLED_FROM_HOST));
+  reg2 /* target */ = pStackPointer[-(int16_t)(reg1 & AF_ARG_COUNT_MASK) - 1];
+  reg3 /* cpsCallback */ = VM_VALUE_UNDEFINED;
+
+  goto SUB_CALL;
+}
+
 /* ------------------------------------------------------------------------- */
 /*                          SUB_CALL_HOST_COMMON                             */
 /*   Expects:                                                                */
@@ -2866,7 +3901,6 @@ SUB_CALL_HOST_COMMON: {
 SUB_CALL_BYTECODE_FUNC: {
   CODE_COVERAGE(163); // Hit
 
-  regP1 /* pArgs */ = pStackPointer - (reg1 & AF_ARG_COUNT_MASK);
   regLP1 /* lpReturnAddress */ = lpProgramCounter;
 
   // Move PC to point to new function code
@@ -2888,6 +3922,27 @@ SUB_CALL_BYTECODE_FUNC: {
   // frame size in words is stored in the header itself
   reg2 /* requiredFrameSizeWords */ = reg2 /* function header */ & VM_FUNCTION_HEADER_STACK_HEIGHT_MASK;
   reg2 /* requiredFrameSizeWords */ += VM_FRAME_BOUNDARY_SAVE_SIZE_WORDS;
+
+  goto SUB_CALL_BYTECODE_FRAME;
+} // End of SUB_CALL_BYTECODE_FUNC
+
+/* ------------------------------------------------------------------------- */
+/*                         SUB_CALL_BYTECODE_FRAME                           */
+/*                                                                           */
+/*   Second half of SUB_CALL_BYTECODE_FUNC, after the target function's      */
+/*   header has been read. The call-site cache (MVM_CALL_CACHE) jumps here   */
+/*   directly with the frame size it remembered.                             */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: new argCountAndFlags                                            */
+/*     reg2: required frame size in words, including the saved registers     */
+/*     reg3: scope, if reg1 & AF_SCOPE, else unused                          */
+/*     regLP1: return address                                                */
+/*     lpProgramCounter: start of the target function's code                 */
+/* ------------------------------------------------------------------------- */
+SUB_CALL_BYTECODE_FRAME: {
+  regP1 /* pArgs */ = pStackPointer - (reg1 & AF_ARG_COUNT_MASK);
+
   // The +5 is for various temporaries that `mvm_call` pushes to the stack, and
   // the result slot if we call the host
   err = vm_requireStackSpace(vm, pStackPointer, reg2 /* requiredFrameSizeWords */ + 5);
@@ -2905,8 +3960,28 @@ SUB_CALL_BYTECODE_FUNC: {
   reg->closure = reg3;
   reg->pArgs = regP1;
 
+  #if MVM_AOT
+  // A function compiled ahead of time runs its C implementation, and the
+  // interpreter continues from wherever that leaves off
+  if (vm->pAotFunctions && (LongPtr_read2_aligned(LongPtr_add(lpProgramCounter, -2)) & VM_FUNCTION_HEADER_NATIVE_FLAG)) {
+    FLUSH_REGISTER_CACHE();
+    reg1 /* ran */ = vm_aotEnter(vm);
+    CACHE_REGISTERS();
+    if (reg1) goto SUB_TAIL_POP_0_PUSH_0;
+  }
+  #endif
+
+  #if MVM_JIT
+  // If the function has been compiled, the native code runs until it returns
+  // or reaches something it doesn't handle, and the interpreter continues from
+  // there
+  FLUSH_REGISTER_CACHE();
+  vm_jitEnter(vm);
+  CACHE_REGISTERS();
+  #endif
+
   goto SUB_TAIL_POP_0_PUSH_0;
-} // End of SUB_CALL_BYTECODE_FUNC
+} // End of SUB_CALL_BYTECODE_FRAME
 
 /* ------------------------------------------------------------------------- */
 /*                             SUB_NUM_OP_FLOAT64                            */
@@ -2923,6 +3998,20 @@ SUB_NUM_OP_FLOAT64: {
   if (reg1) reg1F = mvm_toFloat64(vm, reg1);
   MVM_FLOAT64 reg2F = mvm_toFloat64(vm, reg2);
 
+  #if MVM_UNBOXED_FLOAT64
+  // Operands that are placeholders for unboxed results. The left operand is
+  // in the slot that reg1 was just popped from, and the right one above it.
+  while (unboxedFloat64Count && (pUnboxedFloat64[unboxedFloat64Count - 1] >= pStackPointer)) {
+    CODE_COVERAGE(929); // Not hit
+    unboxedFloat64Count--;
+    if ((reg3 < VM_NUM_OP_DIVIDER) && (pUnboxedFloat64[unboxedFloat64Count] == pStackPointer)) {
+      reg1F = unboxedFloat64[unboxedFloat64Count];
+    } else {
+      reg2F = unboxedFloat64[unboxedFloat64Count];
+    }
+  }
+  #endif // MVM_UNBOXED_FLOAT64
+
   VM_ASSERT(vm, reg3 < VM_NUM_OP_END);
   MVM_SWITCH (reg3, (VM_NUM_OP_END - 1)) {
     MVM_CASE(VM_NUM_OP_LESS_THAN): {
@@ -2996,12 +4085,99 @@ SUB_NUM_OP_FLOAT64: {
     }
   } // End of switch vm_TeNumberOp for float64
 
+  #if MVM_UNBOXED_FLOAT64
+  // A result that mvm_newNumber would allocate as a float64 isn't allocated if
+  // it's only used by a later NUM_OP (see SUB_UNBOXED_FLOAT64_OP). Its slot
+  // holds VM_VALUE_DELETED as a placeholder in the meantime.
+  if (!MVM_FLOAT_IS_NAN(reg1F) && !MVM_FLOAT_IS_NEG_ZERO(reg1F)) {
+    int32_t reg1I = mvm_float64ToInt32(reg1F);
+    if (reg1F == (MVM_FLOAT64)reg1I) {
+      CODE_COVERAGE(930); // Not hit
+      #if MVM_UNBOXED_INT32
+      unboxedInt32 = reg1I;
+      goto SUB_TAIL_PUSH_INT32;
+      #endif
+    } else if (
+      (unboxedFloat64Count < VM_UNBOXED_FLOAT64_MAX) &&
+      vm_arithmeticResultIsConsumed(vm, lpProgramCounter, pStackPointer, false)
+    ) {
+      CODE_COVERAGE(931); // Not hit
+      vm->unboxedFloat64Stats.unboxedResults++;
+      unboxedFloat64[unboxedFloat64Count] = reg1F;
+      pUnboxedFloat64[unboxedFloat64Count] = pStackPointer;
+      unboxedFloat64Count++;
+      reg1 = VM_VALUE_DELETED;
+      goto SUB_TAIL_POP_0_PUSH_REG1;
+    } else {
+      CODE_COVERAGE(932); // Not hit
+      vm->unboxedFloat64Stats.allocatedResults++;
+    }
+  }
+  #endif // MVM_UNBOXED_FLOAT64
+
   // Convert the result from a float
   FLUSH_REGISTER_CACHE();
   reg1 = mvm_newNumber(vm, reg1F);
   CACHE_REGISTERS();
   goto SUB_TAIL_POP_0_PUSH_REG1;
 } // End of SUB_NUM_OP_FLOAT64
+
+#if MVM_UNBOXED_FLOAT64
+/* ------------------------------------------------------------------------- */
+/*                          SUB_UNBOXED_FLOAT64_OP                           */
+/*                                                                           */
+/*   A NUM_OP where one or both of the operands are unboxed float64 results. */
+/*   A non-integer operand always takes the float64 path, so if the other    */
+/*   operand is a number, the operation goes straight to SUB_NUM_OP_FLOAT64, */
+/*   which picks up the unboxed values. Otherwise the float64 is allocated   */
+/*   after all, and the instruction continues as normal.                     */
+/*                                                                           */
+/*   Expects:                                                                */
+/*     reg1: vm_TeNumberOp                                                   */
+/*     reg2: first popped operand                                            */
+/* ------------------------------------------------------------------------- */
+SUB_UNBOXED_FLOAT64_OP: {
+  CODE_COVERAGE(933); // Not hit
+  bool isBinary = reg1 < VM_NUM_OP_DIVIDER;
+  Value* pTop = pUnboxedFloat64[unboxedFloat64Count - 1];
+  bool rightIsUnboxed = pTop == pStackPointer;
+  bool leftIsUnboxed = isBinary && (
+    (pTop == pStackPointer - 1) ||
+    (rightIsUnboxed && (unboxedFloat64Count >= 2) && (pUnboxedFloat64[unboxedFloat64Count - 2] == pStackPointer - 1))
+  );
+
+  bool otherIsNumber = true;
+  if (isBinary && !(leftIsUnboxed && rightIsUnboxed)) {
+    TeTypeCode otherType = deepTypeOf(vm, rightIsUnboxed ? pStackPointer[-1] : reg2);
+    otherIsNumber =
+      (otherType == TC_VAL_INT14) ||
+      (otherType == TC_REF_INT32) ||
+      (otherType == TC_REF_FLOAT64) ||
+      (otherType == TC_VAL_NAN) ||
+      (otherType == TC_VAL_NEG_ZERO);
+  }
+
+  if (otherIsNumber) {
+    CODE_COVERAGE(934); // Not hit
+    reg3 = reg1;
+    reg1 = isBinary ? POP() : 0;
+    goto SUB_NUM_OP_FLOAT64;
+  }
+
+  // Allocate the float64 after all. As in SUB_UNBOXED_INT32_OP, reg2 is pushed
+  // back while allocating so that the GC sees it.
+  CODE_COVERAGE(935); // Not hit
+  vm->unboxedFloat64Stats.allocatedResults++;
+  pStackPointer++;
+  FLUSH_REGISTER_CACHE();
+  Value boxed = mvm_newNumber(vm, unboxedFloat64[unboxedFloat64Count - 1]);
+  CACHE_REGISTERS();
+  unboxedFloat64Count--;
+  *pUnboxedFloat64[unboxedFloat64Count] = boxed;
+  reg2 = POP();
+  goto SUB_OP_NUM_OP;
+}
+#endif // MVM_UNBOXED_FLOAT64
 #endif // MVM_SUPPORT_FLOAT
 
 /* --------------------------------------------------------------------------
@@ -3099,11 +4275,11 @@ static Value vm_newArray(VM* vm, uint16_t capacity) {
 
   if (capacity) {
     vm_push(vm, result); // GC-reachable
-    uint16_t* pData = mvm_allocate(vm, capacity * 2, TC_REF_FIXED_LENGTH_ARRAY);
+    Value* pData = mvm_allocate(vm, capacity * sizeof (Value), TC_REF_FIXED_LENGTH_ARRAY);
     result = vm_pop(vm);
     arr = ShortPtr_decode(vm, result); // Invalidated
     arr->dpData = ShortPtr_encode(vm, pData);
-    uint16_t* p = pData;
+    Value* p = pData;
     uint16_t n = capacity;
     while (n--)
       *p++ = VM_VALUE_DELETED;
@@ -3151,9 +4327,11 @@ static void vm_arrayPush(VM* vm, Value* pvArr, Value* pvItem) {
 
   // Write the item to the array
   pArr = ShortPtr_decode(vm, *pvArr); // May have moved
-  uint16_t* pData = ShortPtr_decode(vm, pArr->dpData);
+  Value* pData = ShortPtr_decode(vm, pArr->dpData);
   pData[length] = *pvItem;
   pArr->viLength = VirtualInt14_encode(vm, length + 1);
+  VM_WRITE_BARRIER(vm, pData);
+  VM_WRITE_BARRIER(vm, pArr);
 }
 
 static void vm_scheduleContinuation(VM* vm, Value continuation, Value isSuccess, Value resultOrError) {
@@ -3179,13 +4357,13 @@ static void vm_scheduleContinuation(VM* vm, Value continuation, Value isSuccess,
  * closure. If `captureParent` is true then the last slot of the new closure
  * will be set to reference the previously active closure.
  */
-static uint16_t* vm_scopePushOrNew(VM* vm, int slotCount, bool captureParent) {
+static Value* vm_scopePushOrNew(VM* vm, int slotCount, bool captureParent) {
   VM_ASSERT_NOT_USING_CACHED_REGISTERS(vm);
-  int size = slotCount * 2;
+  int size = slotCount * sizeof (Value);
 
-  uint16_t* newScope = mvm_allocate(vm, size, TC_REF_CLOSURE);
+  Value* newScope = mvm_allocate(vm, size, TC_REF_CLOSURE);
 
-  uint16_t* p = newScope;
+  Value* p = newScope;
   while (--slotCount) { // Note: pre-decrement so will stop one short of the end
     *p++ = VM_VALUE_DELETED; // Initial slot values
   }
@@ -3434,9 +4612,26 @@ TeError mvm_restore(mvm_VM** result, MVM_LONG_PTR_TYPE lpBytecode, size_t byteco
     return MVM_E_BYTECODE_REQUIRES_FLOAT_SUPPORT;
   }
 
+  if (!MVM_SHAPED_OBJECTS && (featureFlags & (1 << FF_SHAPED_OBJECTS))) {
+    CODE_COVERAGE_ERROR_PATH(783); // Not hit
+    return MVM_E_BYTECODE_REQUIRES_SHAPED_OBJECTS;
+  }
+
+  #if defined(MVM_GAS_COUNTER) && MVM_GAS_PER_BLOCK
+  if (!(featureFlags & (1 << FF_GAS_METERING))) {
+    CODE_COVERAGE_ERROR_PATH(840); // Not hit
+    return MVM_E_BYTECODE_REQUIRES_GAS_METERING;
+  }
+  #endif
+
   err = vm_validatePortFileMacros(lpBytecode, &header, context);
   if (err) return err;
 
+  #if MVM_VERIFY_BYTECODE
+  err = vm_verifyBytecode(lpBytecode, &header, context);
+  if (err) return err;
+  #endif
+
   uint16_t importTableSize = header.sectionOffsets[vm_sectionAfter(vm, BCS_IMPORT_TABLE)] - header.sectionOffsets[BCS_IMPORT_TABLE];
   uint16_t importCount = importTableSize / sizeof (vm_TsImportTableEntry);
 
@@ -3660,8 +4855,21 @@ void* mvm_getContext(VM* vm) {
 void mvm_free(VM* vm) {
   CODE_COVERAGE(166); // Hit
 
+  #if MVM_INCREMENTAL_GC
+  gc_incrementalAbandon(vm);
+  #endif
+
   gc_freeGCMemory(vm);
 
+  #if MVM_JIT
+  vm_jitFree(vm);
+  #endif
+
+  #if MVM_INCLUDE_DEBUG_CAPABILITY
+  // A compliant implementation of `free` will already check for null
+  vm_free(vm, vm->pBreakpoints);
+  #endif
+
   // The stack may be allocated if `mvm_free` is called from the an error
   // handler, right before terminating the thread or longjmp'ing out of the VM.
   #if MVM_SAFE_MODE
@@ -3814,6 +5022,9 @@ static LongPtr vm_findScopedVariable(VM* vm, uint16_t varIndex) {
     // The bytecode is corrupt or the compiler has a bug if we hit the bottom of
     // the scope chain without finding the variable.
     VM_ASSERT(vm, scope != VM_VALUE_DELETED);
+    // The verifier (MVM_VERIFY_BYTECODE) can't check scoped variable indexes
+    // statically, so a bad index must not take us off the end of the chain
+    VM_BYTECODE_ASSERT(vm, Value_isShortPtr(scope) || (Value_isBytecodeMappedPtrOrWellKnown(scope) && (scope >= VM_VALUE_WELLKNOWN_END)));
 
     LongPtr lpArr = DynamicPtr_decode_long(vm, scope);
     uint16_t headerWord = readAllocationHeaderWord_long(lpArr);
@@ -3829,6 +5040,75 @@ static LongPtr vm_findScopedVariable(VM* vm, uint16_t varIndex) {
   }
 }
 
+// Decodes a scope reference taken from the closure register or from the
+// parent slot of another scope
+static inline LongPtr vm_decodeScope(VM* vm, Value scope) {
+  // The verifier (MVM_VERIFY_BYTECODE) can't check scope depths statically,
+  // so a bad depth must not take us off the end of the chain
+  VM_BYTECODE_ASSERT(vm, Value_isShortPtr(scope) || (Value_isBytecodeMappedPtrOrWellKnown(scope) && (scope >= VM_VALUE_WELLKNOWN_END)));
+  LongPtr lpScope = DynamicPtr_decode_long(vm, scope);
+  VM_ASSERT(vm, vm_getTypeCodeFromHeaderWord(readAllocationHeaderWord_long(lpScope)) == TC_REF_CLOSURE);
+  return lpScope;
+}
+
+// Finds the scope `depth` steps up the scope chain from the current closure.
+// The steps taken from the same closure are remembered in `vm->scopeCache`,
+// which is safe because the parent of a scope never changes after it is
+// created.
+static LongPtr vm_findOuterScope(VM* vm, uint8_t depth) {
+  Value scope = vm->stack->reg.closure;
+  uint8_t i = 0;
+
+  #if MVM_SCOPE_CACHE_SIZE
+  if (vm->scopeCacheKey != scope) {
+    CODE_COVERAGE(858); // Hit
+    vm->scopeCacheKey = scope;
+    vm->scopeCacheCount = 0;
+  }
+  i = vm->scopeCacheCount;
+  if (i > depth) {
+    CODE_COVERAGE(859); // Hit
+    i = depth;
+  }
+  if (i) {
+    CODE_COVERAGE(860); // Hit
+    scope = vm->scopeCache[i - 1];
+  }
+  #endif // MVM_SCOPE_CACHE_SIZE
+
+  LongPtr lpScope = vm_decodeScope(vm, scope);
+  while (i < depth) {
+    CODE_COVERAGE(861); // Hit
+    uint16_t size = vm_getAllocationSize_long(lpScope);
+    VM_BYTECODE_ASSERT(vm, size >= 2);
+    // The reference to the parent is kept in the last slot
+    scope = LongPtr_read2_aligned(LongPtr_add(lpScope, size - 2));
+    lpScope = vm_decodeScope(vm, scope);
+    #if MVM_SCOPE_CACHE_SIZE
+    if (i < MVM_SCOPE_CACHE_SIZE) {
+      VM_ASSERT(vm, i == vm->scopeCacheCount);
+      vm->scopeCache[i] = scope;
+      vm->scopeCacheCount = i + 1;
+    }
+    #endif // MVM_SCOPE_CACHE_SIZE
+    i++;
+  }
+  return lpScope;
+}
+
+// Finds a closure variable given the operand of VM_OP4_LOAD_SCOPED_OUTER or
+// VM_OP4_STORE_SCOPED_OUTER, which is the scope depth in the high nibble and
+// the slot index within that scope in the low nibble.
+static LongPtr vm_findOuterScopedVariable(VM* vm, uint8_t depthAndIndex) {
+  LongPtr lpScope = vm_findOuterScope(vm, depthAndIndex >> 4);
+  // Slots are 2 bytes
+  uint16_t offset = (depthAndIndex & 0xF) << 1;
+  // The last slot is the parent reference in a scope created by SCOPE_PUSH, but
+  // it's a variable in one created by SCOPE_NEW, so it can't be ruled out here
+  VM_BYTECODE_ASSERT(vm, offset + 2 <= vm_getAllocationSize_long(lpScope));
+  return LongPtr_add(lpScope, offset);
+}
+
 // Read a scoped variable from the current closure. Assumes the current closure
 // is stored in RAM.
 static inline Value vm_readScopedFromThisClosure(VM* vm, uint16_t varIndex) {
@@ -3847,6 +5127,41 @@ static inline void vm_writeScopedToThisClosure(VM* vm, uint16_t varIndex, Value
   Value* slot = &closure[varIndex];
   VM_ASSERT(vm, slot == LongPtr_truncate(vm, vm_findScopedVariable(vm, varIndex)));
   *slot = value;
+  VM_WRITE_BARRIER(vm, closure);
+}
+
+// Reads the element at `index` of an array (TC_REF_ARRAY) for callers that
+// have already checked the type. Holes read as `undefined`, and an index past
+// the end of the array gives VM_VALUE_DELETED.
+static inline Value vm_readArrayElement(VM* vm, Value array, uint16_t index) {
+  LongPtr lpArr = DynamicPtr_decode_long(vm, array);
+  uint16_t length = (uint16_t)VirtualInt14_decode(vm, READ_FIELD_2(lpArr, TsArray, viLength));
+  if (index >= length) {
+    CODE_COVERAGE(878); // Hit
+    return VM_VALUE_DELETED;
+  }
+  // The capacity is at least the length, so the data can't be null here
+  LongPtr lpData = DynamicPtr_decode_long(vm, READ_FIELD_2(lpArr, TsArray, dpData));
+  Value value = LongPtr_read2_aligned(LongPtr_add(lpData, index * 2));
+  return (value == VM_VALUE_DELETED) ? VM_VALUE_UNDEFINED : value;
+}
+
+// Gets the int14 case value that a switch discriminant is strictly equal to,
+// if any. Numbers are normalized when they're created (see mvm_newNumber), so
+// the only other value equal to an int14 is negative zero.
+static inline bool vm_getSwitchKey(VM* vm, Value discriminant, int16_t* out_key) {
+  if (Value_isVirtualInt14(discriminant)) {
+    CODE_COVERAGE(866); // Hit
+    *out_key = VirtualInt14_decode(vm, discriminant);
+    return true;
+  } else if (discriminant == VM_VALUE_NEG_ZERO) {
+    CODE_COVERAGE(867); // Hit
+    *out_key = 0;
+    return true;
+  } else {
+    CODE_COVERAGE(868); // Hit
+    return false;
+  }
 }
 
 static inline void* getBucketDataBegin(TsBucket* bucket) {
@@ -3926,6 +5241,91 @@ void mvm_getMemoryStats(VM* vm, mvm_TsMemoryStats* r) {
     heapOverheadSize;
 }
 
+#if MVM_RESERVED_HEAP
+/**
+ * The size of each of the 2 ranges of address space reserved for the heap (see
+ * MVM_RESERVED_HEAP): a bucket header and MVM_MAX_HEAP_SIZE bytes, rounded up
+ * to whole pages.
+ */
+static size_t vm_reservedHeapRangeSize(void) {
+  size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  return (sizeof (TsBucket) + MVM_MAX_HEAP_SIZE + pageSize - 1) / pageSize * pageSize;
+}
+
+/**
+ * Grows the heap in reserved range `rangeIndex` to `capacity` bytes, committing
+ * pages as needed, and returns the new end of its capacity.
+ *
+ * The heap in a reserved range is a single bucket at the start of the range,
+ * which is created on first use (`*ppBucket` is NULL) and then grows in place
+ * rather than being followed by new buckets. That makes the heap contiguous, so
+ * ShortPtr_decode and ShortPtr_encode are just an offset from the start of the
+ * bucket rather than a search through a bucket list.
+ */
+static uint16_t* vm_reservedHeapGrow(VM* vm, uint8_t rangeIndex, TsBucket** ppBucket, uint16_t capacity) {
+  size_t rangeSize = vm_reservedHeapRangeSize();
+  if (!vm->pReservedHeap) {
+    CODE_COVERAGE(937); // Hit
+    // Reserve the address space for both ranges, without committing any of it
+    void* p = mmap(NULL, rangeSize * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) {
+      CODE_COVERAGE_ERROR_PATH(938); // Not hit
+      MVM_FATAL_ERROR(vm, MVM_E_MALLOC_FAIL);
+    }
+    vm->pReservedHeap = p;
+  }
+  uint8_t* pRange = vm->pReservedHeap + rangeIndex * rangeSize;
+
+  size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  size_t required = (sizeof (TsBucket) + capacity + pageSize - 1) / pageSize * pageSize;
+  size_t committed = vm->reservedHeapCommitted[rangeIndex];
+  VM_ASSERT(vm, required <= rangeSize);
+  if (required > committed) {
+    CODE_COVERAGE(939); // Hit
+    if (mprotect(pRange + committed, required - committed, PROT_READ | PROT_WRITE) != 0) {
+      CODE_COVERAGE_ERROR_PATH(940); // Not hit
+      MVM_FATAL_ERROR(vm, MVM_E_MALLOC_FAIL);
+    }
+    vm->reservedHeapCommitted[rangeIndex] = required;
+  } else {
+    CODE_COVERAGE(941); // Hit
+  }
+
+  TsBucket* bucket = *ppBucket;
+  if (!bucket) {
+    CODE_COVERAGE(942); // Hit
+    bucket = (TsBucket*)pRange;
+    bucket->offsetStart = 0;
+    bucket->prev = NULL;
+    bucket->next = NULL;
+    bucket->pEndOfUsedSpace = getBucketDataBegin(bucket);
+    *ppBucket = bucket;
+  } else {
+    CODE_COVERAGE(943); // Hit
+    VM_ASSERT(vm, (uint8_t*)bucket == pRange);
+  }
+  uint16_t* pEndCapacity = (uint16_t*)((intptr_t)getBucketDataBegin(bucket) + capacity);
+  #if MVM_SAFE_MODE
+    memset(bucket->pEndOfUsedSpace, 0x7E, (uint8_t*)pEndCapacity - (uint8_t*)bucket->pEndOfUsedSpace);
+  #endif
+  return pEndCapacity;
+}
+
+// Decommits the pages of reserved range `rangeIndex`, keeping the address space
+static void vm_reservedHeapRelease(VM* vm, uint8_t rangeIndex) {
+  size_t committed = vm->reservedHeapCommitted[rangeIndex];
+  if (!committed) {
+    CODE_COVERAGE_UNTESTED(944); // Not hit
+    return;
+  }
+  CODE_COVERAGE(945); // Hit
+  uint8_t* pRange = vm->pReservedHeap + rangeIndex * vm_reservedHeapRangeSize();
+  madvise(pRange, committed, MADV_DONTNEED);
+  mprotect(pRange, committed, PROT_NONE);
+  vm->reservedHeapCommitted[rangeIndex] = 0;
+}
+#endif // MVM_RESERVED_HEAP
+
 /**
  * Expand the VM heap by allocating a new "bucket" of memory from the host.
  *
@@ -3962,6 +5362,10 @@ static void gc_createNextBucket(VM* vm, uint16_t bucketSize, uint16_t minBucketS
     bucketSize = MVM_MAX_HEAP_SIZE - heapSize;
   }
 
+  #if MVM_RESERVED_HEAP
+  // The heap grows in place, from the allocation cursor
+  vm->pLastBucketEndCapacity = vm_reservedHeapGrow(vm, vm->reservedHeapRange, &vm->pLastBucket, heapSize + bucketSize);
+  #else // !MVM_RESERVED_HEAP
   size_t allocSize = sizeof (TsBucket) + bucketSize;
   TsBucket* bucket = vm_malloc(vm, allocSize);
   if (!bucket) {
@@ -3988,11 +5392,21 @@ static void gc_createNextBucket(VM* vm, uint16_t bucketSize, uint16_t minBucketS
     CODE_COVERAGE(200); // Hit
   }
   vm->pLastBucket = bucket;
+  #endif // !MVM_RESERVED_HEAP
 }
 
 static void gc_freeGCMemory(VM* vm) {
   CODE_COVERAGE(10); // Hit
   TABLE_COVERAGE(vm->pLastBucket ? 1 : 0, 2, 201); // Hit 2/2
+  #if MVM_RESERVED_HEAP
+  if (vm->pReservedHeap) {
+    munmap(vm->pReservedHeap, vm_reservedHeapRangeSize() * 2);
+    vm->pReservedHeap = NULL;
+  }
+  vm->reservedHeapCommitted[0] = 0;
+  vm->reservedHeapCommitted[1] = 0;
+  vm->pLastBucket = NULL;
+  #else // !MVM_RESERVED_HEAP
   while (vm->pLastBucket) {
     CODE_COVERAGE(169); // Hit
     TsBucket* prev = vm->pLastBucket->prev;
@@ -4000,10 +5414,11 @@ static void gc_freeGCMemory(VM* vm) {
     TABLE_COVERAGE(prev ? 1 : 0, 2, 202); // Hit 1/2
     vm->pLastBucket = prev;
   }
+  #endif // !MVM_RESERVED_HEAP
   vm->pLastBucketEndCapacity = NULL;
 }
 
-#if MVM_INCLUDE_SNAPSHOT_CAPABILITY || (!MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE)
+#if MVM_INCLUDE_SNAPSHOT_CAPABILITY || (!MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE && !MVM_RESERVED_HEAP)
 /**
  * Given a pointer `ptr` into the heap, this returns the equivalent offset from
  * the start of the heap (0 meaning that `ptr` points to the beginning of the
@@ -4056,7 +5471,7 @@ static uint16_t pointerOffsetInHeap(VM* vm, TsBucket* pLastBucket, void* ptr) {
   MVM_FATAL_ERROR(vm, MVM_E_UNEXPECTED);
   return 0;
 }
-#endif // MVM_INCLUDE_SNAPSHOT_CAPABILITY || (!MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE)
+#endif // MVM_INCLUDE_SNAPSHOT_CAPABILITY || (!MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE && !MVM_RESERVED_HEAP)
 
 // Encodes a bytecode offset as a Value
 static inline Value vm_encodeBytecodeOffsetAsPointer(VM* vm, uint16_t offset) {
@@ -4097,7 +5512,22 @@ static inline Value vm_encodeBytecodeOffsetAsPointer(VM* vm, uint16_t offset) {
     VM_ASSERT(gc->vm, ((intptr_t)ptr - (intptr_t)MVM_RAM_PAGE_ADDR) <= 0xFFFF);
     return (ShortPtr)(uintptr_t)ptr;
   }
-#else // !MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE
+#elif MVM_RESERVED_HEAP
+  // The heap is a single contiguous bucket (see vm_reservedHeapGrow)
+  static inline void* ShortPtr_decode(VM* vm, ShortPtr ptr) {
+    VM_ASSERT(vm, (ptr & 1) == 0);
+    VM_ASSERT(vm, ptr < getHeapSize(vm));
+    return (void*)((intptr_t)getBucketDataBegin(vm->pLastBucket) + ptr);
+  }
+  static inline ShortPtr ShortPtr_encode(VM* vm, void* ptr) {
+    VM_ASSERT(vm, ((intptr_t)ptr - (intptr_t)getBucketDataBegin(vm->pLastBucket)) <= 0xFFFF);
+    return (ShortPtr)((intptr_t)ptr - (intptr_t)getBucketDataBegin(vm->pLastBucket));
+  }
+  static inline ShortPtr ShortPtr_encodeInToSpace(gc_TsGCCollectionState* gc, void* ptr) {
+    VM_ASSERT(gc->vm, ((intptr_t)ptr - (intptr_t)getBucketDataBegin(gc->lastBucket)) <= 0xFFFF);
+    return (ShortPtr)((intptr_t)ptr - (intptr_t)getBucketDataBegin(gc->lastBucket));
+  }
+#else // !MVM_NATIVE_POINTER_IS_16_BIT && !MVM_USE_SINGLE_RAM_PAGE && !MVM_RESERVED_HEAP
   static void* ShortPtr_decode(VM* vm, ShortPtr shortPtr) {
     // It isn't strictly necessary that all short pointers are 2-byte aligned,
     // but it probably indicates a mistake somewhere if a short pointer is not
@@ -4329,6 +5759,11 @@ static void gc_newBucket(gc_TsGCCollectionState* gc, uint16_t newSpaceSize, uint
     CODE_COVERAGE(360); // Hit
   }
 
+  #if MVM_RESERVED_HEAP
+  // Tospace is the other reserved range, and grows in place
+  gc->lastBucketEndCapacity = vm_reservedHeapGrow(gc->vm, gc->vm->reservedHeapRange ^ 1, &gc->lastBucket, heapSize + newSpaceSize);
+  gc->firstBucket = gc->lastBucket;
+  #else // !MVM_RESERVED_HEAP
   TsBucket* pBucket = (TsBucket*)vm_malloc(gc->vm, sizeof (TsBucket) + newSpaceSize);
   if (!pBucket) {
     CODE_COVERAGE_ERROR_PATH(376); // Not hit
@@ -4359,6 +5794,7 @@ static void gc_newBucket(gc_TsGCCollectionState* gc, uint16_t newSpaceSize, uint
   }
   gc->lastBucket = pBucket;
   gc->lastBucketEndCapacity = (uint16_t*)((intptr_t)pDataInBucket + newSpaceSize);
+  #endif // !MVM_RESERVED_HEAP
 }
 
 static void gc_processShortPtrValue(gc_TsGCCollectionState* gc, Value* pValue) {
@@ -4469,6 +5905,21 @@ SUB_MOVE_ALLOCATION:
 
     Value dpNext = props->dpNext;
 
+    #if MVM_PROPERTY_INDEX
+    // An existing index remains valid across collections because it only
+    // refers to keys that don't move (see VM_PROPERTY_INDEX_MARKER). But if
+    // there are children to merge in, the index is dropped here so that the
+    // merged pairs are contiguous, and rebuilt below to cover them.
+    uint16_t indexSize = vm_propertyIndexSize(vm, LongPtr_new(props), size);
+    if (indexSize && (dpNext != VM_VALUE_NULL)) {
+      CODE_COVERAGE(807); // Not hit
+      size -= indexSize;
+      writePtr -= indexSize / 2;
+      setHeaderWord(vm, props, TC_REF_PROPERTY_LIST, size);
+      indexSize = 0;
+    }
+    #endif
+
     // If the object has children (detached extensions to the main
     // allocation), we take this opportunity to compact them into the parent
     // allocation to save space and improve access performance.
@@ -4530,6 +5981,35 @@ SUB_MOVE_ALLOCATION:
       setHeaderWord(vm, props, TC_REF_PROPERTY_LIST, newSize);
       props->dpNext = VM_VALUE_NULL;
     }
+
+    #if MVM_PROPERTY_INDEX
+    if (!indexSize) {
+      uint16_t pairCount = (vm_getAllocationSize(props) - sizeof (TsPropertyList)) / 4;
+      if (pairCount >= MVM_PROPERTY_INDEX_THRESHOLD) {
+        CODE_COVERAGE(808); // Not hit
+        // At most half full, so probes are short and always terminate
+        uint16_t bucketCount = 2;
+        while (bucketCount < pairCount * 2) {
+          bucketCount <<= 1;
+        }
+        uint16_t newSize = sizeof (TsPropertyList) + pairCount * 4 + bucketCount * 2 + 4;
+        // Objects too big to index are just left as linear property lists
+        if (newSize <= MAX_ALLOCATION_SIZE) {
+          if (writePtr + bucketCount + 2 > gc->lastBucketEndCapacity) {
+            CODE_COVERAGE(809); // Not hit
+            // Same revert-and-retry as for merging children, above
+            gc_newBucket(gc, MVM_ALLOCATION_BUCKET_SIZE, newSize + 2);
+            goto SUB_MOVE_ALLOCATION;
+          }
+          gc_buildPropertyIndex(vm, (uint16_t*)(props + 1), pairCount, bucketCount);
+          writePtr += bucketCount + 2;
+          setHeaderWord(vm, props, TC_REF_PROPERTY_LIST, newSize);
+        } else {
+          CODE_COVERAGE(810); // Not hit
+        }
+      }
+    }
+    #endif
   } else {
     CODE_COVERAGE(492); // Hit
   }
@@ -4557,85 +6037,56 @@ static inline void gc_processValue(gc_TsGCCollectionState* gc, Value* pValue) {
   }
 }
 
-void mvm_runGC(VM* vm, bool squeeze) {
-  CODE_COVERAGE(593); // Hit
-
-  /*
-  This is a semispace collection model based on Cheney's algorithm
-  https://en.wikipedia.org/wiki/Cheney%27s_algorithm. It collects by moving
-  reachable allocations from the fromspace to the tospace and then releasing the
-  fromspace. It starts by moving allocations reachable by the roots, and then
-  iterates through moved allocations, checking the pointers therein, moving the
-  allocations they reference.
-
-  When an object is moved, the space it occupied is changed to a tombstone
-  (TC_REF_TOMBSTONE) which contains a forwarding pointer. When a pointer in
-  tospace is seen to point to an allocation in fromspace, if the fromspace
-  allocation is a tombstone then the pointer can be updated to the forwarding
-  pointer.
-
-  This algorithm relies on allocations in tospace each have a header. Some
-  allocations, such as property cells, don't have a header, but will only be
-  found in fromspace. When copying objects into tospace, the detached property
-  cells are merged into the object's head allocation.
+// Forgets anything that the VM has cached about the location of heap
+// allocations, before they're moved by a collection
+static void gc_invalidateHeapCaches(VM* vm) {
+  #if MVM_INLINE_CACHE
+  // Cached property locations are pointers into the heap
+  vm_invalidateInlineCache(vm);
+  #endif
 
-  Note: all pointer _values_ are only processed once each (since their
-  corresponding container is only processed once). This means that fromspace and
-  tospace can be treated as distinct spaces. An unprocessed pointer is
-  interpreted in terms of _fromspace_. Forwarding pointers and pointers in
-  processed allocations always reference _tospace_.
-  */
+  #if MVM_CALL_CACHE
+  // Cached callees include closures
+  vm_invalidateCallCache(vm);
+  #endif
 
-  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
-  mvm_checkHeap(vm);
+  #if MVM_SCOPE_CACHE_SIZE
+  // Same for cached scope references
+  vm->scopeCacheCount = 0;
+  vm->scopeCacheKey = VM_VALUE_DELETED;
   #endif
+}
 
-  uint16_t n;
-  uint16_t* p;
-
-  uint16_t heapSize = getHeapSize(vm);
-  if (heapSize > vm->heapHighWaterMark)
-    vm->heapHighWaterMark = heapSize;
-
-  // A collection of variables shared by GC routines
-  gc_TsGCCollectionState gc;
-  memset(&gc, 0, sizeof gc);
-  gc.vm = vm;
+// Releases fromspace at the end of a collection and makes tospace the heap
+static void gc_adoptToSpace(VM* vm, gc_TsGCCollectionState* gc) {
+  // Release old heap
+  #if MVM_RESERVED_HEAP
+  vm_reservedHeapRelease(vm, vm->reservedHeapRange);
+  vm->reservedHeapRange ^= 1;
+  #else // !MVM_RESERVED_HEAP
+  TsBucket* oldBucket = vm->pLastBucket;
+  TABLE_COVERAGE(oldBucket ? 1 : 0, 2, 507); // Hit 2/2
+  while (oldBucket) {
+    TsBucket* prev = oldBucket->prev;
+    vm_free(vm, oldBucket);
+    oldBucket = prev;
+  }
+  #endif // !MVM_RESERVED_HEAP
 
-  // We don't know how big the heap needs to be, so we just allocate the same
-  // amount of space as used last time and then expand as-needed
-  uint16_t estimatedSize = vm->heapSizeUsedAfterLastGC;
+  // Adopt new heap
+  vm->pLastBucket = gc->lastBucket;
+  vm->pLastBucketEndCapacity = gc->lastBucketEndCapacity;
+}
 
-  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
-    // Move the heap address space by 2 bytes on each cycle (overflows at 256).
-    vm->gc_heap_shift += 2;
-    if (vm->gc_heap_shift == 0) {
-      // Minimum of 2 bytes just so we have consistency when it overflows
-      vm->gc_heap_shift = 2;
-    }
-    // We shift up the address space by `gc_heap_shift` amount by just
-    // allocating a bucket of that size at the beginning and marking it full.
-    gc_newBucket(&gc, vm->gc_heap_shift, 0);
-    // The heap must be parsable, so we need to have an allocation header to
-    // mark the space. In general, we do not allow allocations to be smaller
-    // than 4 bytes because a tombstone is 4 bytes. However, there can be no
-    // references to this "allocation" so no tombstone is required, so it can
-    // be as small as 2 bytes. I'm using a string here because it's a
-    // "non-container" type, so the GC will not interpret its contents.
-    VM_ASSERT(vm, vm->gc_heap_shift >= 2);
-    *gc.lastBucket->pEndOfUsedSpace = vm_makeHeaderWord(vm, TC_REF_STRING, vm->gc_heap_shift - 2);
-  #endif // MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+// A function that processes a root during a collection
+typedef void (*gc_TfProcessValue)(gc_TsGCCollectionState* gc, Value* pValue);
 
-  if (!estimatedSize) {
-    CODE_COVERAGE(494); // Hit
-    // Actually the value-copying algorithm can't deal with creating the heap from nothing, and
-    // I don't want to slow it down by adding extra checks, so we always create at least a small
-    // heap.
-    estimatedSize = 64;
-  } else {
-    CODE_COVERAGE(493); // Hit
-  }
-  gc_newBucket(&gc, estimatedSize, 0);
+// Passes each root (globals, handles, registers and the stack) to
+// `processValue`
+static inline void gc_processRoots(gc_TsGCCollectionState* gc, gc_TfProcessValue processValue) {
+  VM* vm = gc->vm;
+  uint16_t n;
+  Value* p;
 
   // Roots in global variables (including indirection handles)
   // Note: Interned strings are referenced from a handle and so will be GC'd here
@@ -4645,13 +6096,13 @@ void mvm_runGC(VM* vm, bool squeeze) {
   n = globalsSize / 2;
   TABLE_COVERAGE(n ? 1 : 0, 2, 495); // Hit 1/2
   while (n--)
-    gc_processValue(&gc, p++);
+    processValue(gc, p++);
 
   // Roots in gc_handles
   mvm_Handle* handle = vm->gc_handles;
   TABLE_COVERAGE(handle ? 1 : 0, 2, 496); // Hit 2/2
   while (handle) {
-    gc_processValue(&gc, &handle->_value);
+    processValue(gc, &handle->_value);
     TABLE_COVERAGE(handle->_next ? 1 : 0, 2, 497); // Hit 2/2
     handle = handle->_next;
   }
@@ -4664,14 +6115,14 @@ void mvm_runGC(VM* vm, bool squeeze) {
     VM_ASSERT(vm, reg->usingCachedRegisters == false);
 
     // Roots in registers
-    gc_processValue(&gc, &reg->closure);
-    gc_processValue(&gc, &reg->cpsCallback);
-    gc_processValue(&gc, &reg->jobQueue);
+    processValue(gc, &reg->closure);
+    processValue(gc, &reg->cpsCallback);
+    processValue(gc, &reg->jobQueue);
 
     // Roots on call stack
-    uint16_t* beginningOfStack = getBottomOfStack(stack);
-    uint16_t* beginningOfFrame = reg->pFrameBase;
-    uint16_t* endOfFrame = reg->pStackPointer;
+    Value* beginningOfStack = getBottomOfStack(stack);
+    Value* beginningOfFrame = reg->pFrameBase;
+    Value* endOfFrame = reg->pStackPointer;
 
     while (true) {
       VM_ASSERT(vm, beginningOfFrame >= beginningOfStack);
@@ -4681,7 +6132,7 @@ void mvm_runGC(VM* vm, bool squeeze) {
       while (p != endOfFrame) {
         VM_ASSERT(vm, p < endOfFrame);
         // TODO: It would be an interesting exercise to see if the GC can be written into a single function so that we don't need to pass around the &gc struct everywhere
-        gc_processValue(&gc, p++);
+        processValue(gc, p++);
       }
 
       if (beginningOfFrame == beginningOfStack) {
@@ -4697,16 +6148,109 @@ void mvm_runGC(VM* vm, bool squeeze) {
 
       // The saved scope pointer
       Value* pScope = endOfFrame + 1;
-      gc_processValue(&gc, pScope);
+      processValue(gc, pScope);
 
       // The first thing saved during a CALL is the size of the preceding frame
-      beginningOfFrame = (uint16_t*)((uint8_t*)endOfFrame - *endOfFrame);
+      beginningOfFrame = (Value*)((uint8_t*)endOfFrame - *endOfFrame);
 
       TABLE_COVERAGE(beginningOfFrame == beginningOfStack ? 1 : 0, 2, 499); // Hit 2/2
     }
   } else {
     CODE_COVERAGE(500); // Hit
   }
+}
+
+void mvm_runGC(VM* vm, bool squeeze) {
+  CODE_COVERAGE(593); // Hit
+
+  /*
+  This is a semispace collection model based on Cheney's algorithm
+  https://en.wikipedia.org/wiki/Cheney%27s_algorithm. It collects by moving
+  reachable allocations from the fromspace to the tospace and then releasing the
+  fromspace. It starts by moving allocations reachable by the roots, and then
+  iterates through moved allocations, checking the pointers therein, moving the
+  allocations they reference.
+
+  When an object is moved, the space it occupied is changed to a tombstone
+  (TC_REF_TOMBSTONE) which contains a forwarding pointer. When a pointer in
+  tospace is seen to point to an allocation in fromspace, if the fromspace
+  allocation is a tombstone then the pointer can be updated to the forwarding
+  pointer.
+
+  This algorithm relies on allocations in tospace each have a header. Some
+  allocations, such as property cells, don't have a header, but will only be
+  found in fromspace. When copying objects into tospace, the detached property
+  cells are merged into the object's head allocation.
+
+  Note: all pointer _values_ are only processed once each (since their
+  corresponding container is only processed once). This means that fromspace and
+  tospace can be treated as distinct spaces. An unprocessed pointer is
+  interpreted in terms of _fromspace_. Forwarding pointers and pointers in
+  processed allocations always reference _tospace_.
+  */
+
+  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+  mvm_checkHeap(vm);
+  #endif
+
+  #if MVM_INCREMENTAL_GC
+  // A cycle in progress is finished rather than abandoned, so that the work
+  // already done isn't wasted, and it then stands in for the full collection.
+  // It doesn't compact the heap, so a squeeze still goes on to do that.
+  if (vm->pIncrementalGC) {
+    CODE_COVERAGE(988); // Not hit
+    gc_incrementalFinish(vm);
+    if (!squeeze) return;
+  }
+  #endif
+
+  gc_invalidateHeapCaches(vm);
+
+  uint16_t heapSize = getHeapSize(vm);
+  if (heapSize > vm->heapHighWaterMark)
+    vm->heapHighWaterMark = heapSize;
+
+  // A collection of variables shared by GC routines
+  gc_TsGCCollectionState gc;
+  memset(&gc, 0, sizeof gc);
+  gc.vm = vm;
+
+  // We don't know how big the heap needs to be, so we just allocate the same
+  // amount of space as used last time and then expand as-needed
+  uint16_t estimatedSize = vm->heapSizeUsedAfterLastGC;
+
+  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+    // Move the heap address space by 2 bytes on each cycle (overflows at 256).
+    vm->gc_heap_shift += 2;
+    if (vm->gc_heap_shift == 0) {
+      // Minimum of 2 bytes just so we have consistency when it overflows
+      vm->gc_heap_shift = 2;
+    }
+    // We shift up the address space by `gc_heap_shift` amount by just
+    // allocating a bucket of that size at the beginning and marking it full.
+    gc_newBucket(&gc, vm->gc_heap_shift, 0);
+    // The heap must be parsable, so we need to have an allocation header to
+    // mark the space. In general, we do not allow allocations to be smaller
+    // than 4 bytes because a tombstone is 4 bytes. However, there can be no
+    // references to this "allocation" so no tombstone is required, so it can
+    // be as small as 2 bytes. I'm using a string here because it's a
+    // "non-container" type, so the GC will not interpret its contents.
+    VM_ASSERT(vm, vm->gc_heap_shift >= 2);
+    *gc.lastBucket->pEndOfUsedSpace = vm_makeHeaderWord(vm, TC_REF_STRING, vm->gc_heap_shift - 2);
+  #endif // MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+
+  if (!estimatedSize) {
+    CODE_COVERAGE(494); // Hit
+    // Actually the value-copying algorithm can't deal with creating the heap from nothing, and
+    // I don't want to slow it down by adding extra checks, so we always create at least a small
+    // heap.
+    estimatedSize = 64;
+  } else {
+    CODE_COVERAGE(493); // Hit
+  }
+  gc_newBucket(&gc, estimatedSize, 0);
+
+  gc_processRoots(&gc, gc_processValue);
 
   // Now we process moved allocations to make sure objects they point to are
   // also moved, and to update pointers to reference the new space
@@ -4757,18 +6301,7 @@ void mvm_runGC(VM* vm, bool squeeze) {
     TABLE_COVERAGE(bucket ? 1 : 0, 2, 506); // Hit 2/2
   }
 
-  // Release old heap
-  TsBucket* oldBucket = vm->pLastBucket;
-  TABLE_COVERAGE(oldBucket ? 1 : 0, 2, 507); // Hit 2/2
-  while (oldBucket) {
-    TsBucket* prev = oldBucket->prev;
-    vm_free(vm, oldBucket);
-    oldBucket = prev;
-  }
-
-  // Adopt new heap
-  vm->pLastBucket = gc.lastBucket;
-  vm->pLastBucketEndCapacity = gc.lastBucketEndCapacity;
+  gc_adoptToSpace(vm, &gc);
 
   uint16_t finalUsedSize = getHeapSize(vm);
   vm->heapSizeUsedAfterLastGC = finalUsedSize;
@@ -4811,99 +6344,438 @@ void mvm_runGC(VM* vm, bool squeeze) {
   }
 }
 
-/**
- * Create the call VM call stack and registers
+#if MVM_INCREMENTAL_GC
+/*
+ * Incremental collection (mvm_runGCStep)
+ *
+ * This is a replicating variant of the collection in mvm_runGC. Rather than
+ * moving allocations and leaving tombstones, it copies them into tospace and
+ * leaves fromspace untouched, so the mutator can keep running on fromspace
+ * between steps. The mapping from fromspace to tospace is kept in a forwarding
+ * table on the side, indexed by the fromspace ShortPtr.
+ *
+ * A replica is first created with just its header and, in its first word, the
+ * ShortPtr of the original. The scan then copies the original over it and
+ * forwards the pointers in it, replicating the allocations they refer to, in
+ * the same order as the Cheney scan in mvm_runGC. If the mutator writes to an
+ * allocation whose replica has already been scanned, the write barrier
+ * (VM_WRITE_BARRIER) puts the allocation in the dirty log, and it's copied
+ * again.
+ *
+ * The roots are not write-barriered. Instead, when the scan and the dirty log
+ * are both done, the roots are forwarded again. If that finds nothing new to
+ * replicate, then everything reachable has a replica that matches it, and the
+ * roots are switched over to tospace in the same step (gc_incrementalFlip).
+ *
+ * Since fromspace is never modified, a cycle can also be abandoned at any
+ * point by just discarding tospace, which is what mvm_free does. If mvm_runGC
+ * is needed in the middle of a cycle, it finishes the cycle instead
+ * (gc_incrementalFinish).
+ *
+ * Unlike mvm_runGC, this doesn't truncate arrays or merge property lists,
+ * because that would change the size of a replica after it's been created.
  */
-TeError vm_createStackAndRegisters(VM* vm) {
-  CODE_COVERAGE(225); // Hit
-  // This is freed again at the end of mvm_call. Note: the allocated
-  // memory includes the registers, which are part of the vm_TsStack
-  // structure
-  vm_TsStack* stack = vm_malloc(vm, sizeof (vm_TsStack) + MVM_STACK_SIZE);
-  if (!stack) {
-    CODE_COVERAGE_ERROR_PATH(231); // Not hit
-    return vm_newError(vm, MVM_E_MALLOC_FAIL);
-  }
-  vm->stack = stack;
-  vm_TsRegisters* reg = &stack->reg;
-  memset(reg, 0, sizeof *reg);
-  // The stack grows upward. The bottom is the lowest address.
-  uint16_t* bottomOfStack = getBottomOfStack(stack);
-  reg->pFrameBase = bottomOfStack;
-  reg->pStackPointer = bottomOfStack;
-  reg->lpProgramCounter = vm->lpBytecode; // This is essentially treated as a null value
-  reg->argCountAndFlags = 0;
-  reg->closure = VM_VALUE_UNDEFINED;
-  reg->pCatchTarget = NULL;
-  reg->cpsCallback = VM_VALUE_DELETED;
-  reg->jobQueue = VM_VALUE_UNDEFINED;
-  VM_ASSERT(vm, reg->pArgs == 0);
 
-  return MVM_E_SUCCESS;
+// Entries in each of the forwarding table and the dirty log. Allocations are
+// at least 4 bytes apart, so `ShortPtr >> 2` is unique to each allocation.
+#define GC_INCREMENTAL_TABLE_ENTRIES ((MVM_MAX_HEAP_SIZE + 3) / 4)
+
+// Decodes a pointer into tospace (the counterpart to ShortPtr_encodeInToSpace)
+static void* ShortPtr_decodeInToSpace(gc_TsGCCollectionState* gc, ShortPtr ptr) {
+  VM_ASSERT(gc->vm, (ptr & 1) == 0);
+  TsBucket* bucket = gc->lastBucket;
+  while (true) {
+    VM_ASSERT(gc->vm, bucket != NULL);
+    if (ptr >= bucket->offsetStart) {
+      return (void*)((intptr_t)getBucketDataBegin(bucket) + (ptr - bucket->offsetStart));
+    }
+    bucket = bucket->prev;
+  }
 }
 
-// Lowest address on stack
-static inline uint16_t* getBottomOfStack(vm_TsStack* stack) {
-  CODE_COVERAGE(510); // Hit
-  return (uint16_t*)(stack + 1);
+// Returns the tospace ShortPtr of the replica of `spSrc`, creating the replica
+// if there isn't one yet
+static ShortPtr gc_incrementalForward(gc_TsIncrementalGC* ig, ShortPtr spSrc) {
+  uint16_t* pEntry = &ig->pForwarding[spSrc >> 2];
+  if (*pEntry) {
+    CODE_COVERAGE(946); // Hit
+    return *pEntry & 0xFFFE;
+  }
+  CODE_COVERAGE(947); // Hit
+
+  gc_TsGCCollectionState* gc = &ig->gc;
+  uint16_t* pSrc = ShortPtr_decode(gc->vm, spSrc);
+  uint16_t headerWord = pSrc[-1];
+  VM_ASSERT(gc->vm, vm_getTypeCodeFromHeaderWord(headerWord) != TC_REF_TOMBSTONE);
+  uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+  uint16_t words = (size + 3) / 2; // Rounded up, including header
+  // Room for the ShortPtr of the original
+  VM_ASSERT(gc->vm, words >= 2);
+
+  uint16_t* writePtr = gc->lastBucket->pEndOfUsedSpace;
+  if (writePtr + words > gc->lastBucketEndCapacity) {
+    CODE_COVERAGE(948); // Hit
+    gc_newBucket(gc, MVM_ALLOCATION_BUCKET_SIZE, words * 2);
+    writePtr = gc->lastBucket->pEndOfUsedSpace;
+  } else {
+    CODE_COVERAGE(949); // Hit
+  }
+  writePtr[0] = headerWord;
+  writePtr[1] = spSrc;
+  gc->lastBucket->pEndOfUsedSpace = writePtr + words;
+
+  ShortPtr spNew = ShortPtr_encodeInToSpace(gc, writePtr + 1);
+  *pEntry = spNew;
+  ig->replicatedCount++;
+  return spNew;
 }
 
-// Highest possible address on stack (+1) before overflow
-static inline uint16_t* getTopOfStackSpace(vm_TsStack* stack) {
-  CODE_COVERAGE(511); // Hit
-  return getBottomOfStack(stack) + MVM_STACK_SIZE / 2;
+// Copies the current contents of the original `spSrc` over its replica
+// `pReplica`, and forwards the pointers in it. Returns the number of words
+// copied.
+static uint16_t gc_incrementalCopy(gc_TsIncrementalGC* ig, uint16_t* pReplica, ShortPtr spSrc) {
+  VM* vm = ig->gc.vm;
+  uint16_t* pSrc = ShortPtr_decode(vm, spSrc);
+  uint16_t headerWord = pSrc[-1];
+  uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+  // Allocations never change size in place, but the type code can change (see
+  // toInternedString)
+  VM_ASSERT(vm, size == vm_getAllocationSizeExcludingHeaderFromHeaderWord(pReplica[-1]));
+  pReplica[-1] = headerWord;
+  uint16_t words = (size + 1) >> 1; // round up
+  memcpy(pReplica, pSrc, words * 2);
+
+  // Same test as in mvm_runGC
+  if (headerWord >= (uint16_t)(TC_REF_DIVIDER_CONTAINER_TYPES << 12)) {
+    CODE_COVERAGE(950); // Hit
+    Value* p = pReplica;
+    uint16_t n = size >> 1; // round down
+    while (n--) {
+      if (Value_isShortPtr(*p))
+        *p = gc_incrementalForward(ig, *p);
+      p++;
+    }
+  } else {
+    CODE_COVERAGE_UNTESTED(951); // Not hit
+  }
+  return words + 1;
 }
 
-#if MVM_DEBUG
-// Some utility functions, mainly to execute in the debugger (could also be copy-pasted as expressions in some cases)
-uint16_t dbgStackDepth(VM* vm) {
-  return (uint16_t)((uint16_t*)vm->stack->reg.pStackPointer - (uint16_t*)(vm->stack + 1));
+// Heap offset in tospace of the next replica to scan
+static uint16_t gc_incrementalScanOffset(gc_TsIncrementalGC* ig) {
+  return ig->scanBucket->offsetStart + (uint16_t)((intptr_t)ig->pScan - (intptr_t)getBucketDataBegin(ig->scanBucket));
 }
-uint16_t* dbgStack(VM* vm) {
-  return (uint16_t*)(vm->stack + 1);
+
+// gc_TfProcessValue for the root passes before the flip, which replicate the
+// allocations referenced by the roots but leave the roots pointing at fromspace
+static void gc_incrementalForwardRoot(gc_TsGCCollectionState* gc, Value* pValue) {
+  if (Value_isShortPtr(*pValue)) {
+    CODE_COVERAGE(952); // Hit
+    gc_incrementalForward(gc->vm->pIncrementalGC, *pValue);
+  } else {
+    CODE_COVERAGE(953); // Hit
+  }
 }
-uint16_t dbgPC(VM* vm) {
-  return (uint16_t)((intptr_t)vm->stack->reg.lpProgramCounter - (intptr_t)vm->lpBytecode);
+
+// gc_TfProcessValue for the flip, which points the roots at tospace
+static void gc_incrementalFlipRoot(gc_TsGCCollectionState* gc, Value* pValue) {
+  if (Value_isShortPtr(*pValue)) {
+    CODE_COVERAGE(954); // Hit
+    *pValue = gc_incrementalForward(gc->vm->pIncrementalGC, *pValue);
+  } else {
+    CODE_COVERAGE(955); // Hit
+  }
 }
-#endif // MVM_DEBUG
 
-/**
- * Checks that we have enough stack space for the given size, and updates the
- * high water mark.
- */
-static TeError vm_requireStackSpace(VM* vm, uint16_t* pStackPointer, uint16_t sizeRequiredInWords) {
-  uint16_t* pStackHighWaterMark = pStackPointer + ((intptr_t)sizeRequiredInWords);
-  if (pStackHighWaterMark > getTopOfStackSpace(vm->stack)) {
-    CODE_COVERAGE_ERROR_PATH(233); // Not hit
+static void gc_incrementalStart(VM* vm) {
+  CODE_COVERAGE(956); // Hit
+  VM_ASSERT(vm, !vm->pIncrementalGC);
 
-    // TODO(low): Since we know the max stack depth for the function, we could
-    // actually grow the stack dynamically rather than allocate it fixed size.
-    // Actually, it seems likely that we could allocate the VM stack on the C
-    // stack, since it's a fixed-size structure anyway.
-    //
-    // (A way to do the allocation on the stack would be to perform a nested
-    // call to mvm_call, and the allocation can be at the beginning of
-    // mvm_call). Otherwise we could just malloc, which has the advantage of
-    // simplicity and we can grow the stack at any time.
-    //
-    // Rather than a segmented stack, it might also be simpler to just grow the
-    // stack size and copy across old data. This has the advantage of keeping
-    // the GC simple.
-    return vm_newError(vm, MVM_E_STACK_OVERFLOW);
+  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+  mvm_checkHeap(vm);
+  #endif
+
+  size_t tableSize = GC_INCREMENTAL_TABLE_ENTRIES * 2;
+  gc_TsIncrementalGC* ig = vm_malloc(vm, sizeof (gc_TsIncrementalGC) + tableSize * 2);
+  if (!ig) {
+    CODE_COVERAGE_ERROR_PATH(957); // Not hit
+    MVM_FATAL_ERROR(vm, MVM_E_MALLOC_FAIL);
+    return;
   }
+  // Only the forwarding table needs to start empty
+  memset(ig, 0, sizeof (gc_TsIncrementalGC) + tableSize);
+  ig->gc.vm = vm;
+  ig->pForwarding = (uint16_t*)(ig + 1);
+  ig->pDirty = ig->pForwarding + GC_INCREMENTAL_TABLE_ENTRIES;
 
-  // Stack high-water mark
-  uint16_t stackHighWaterMark = (uint16_t)((intptr_t)pStackHighWaterMark - (intptr_t)getBottomOfStack(vm->stack));
-  if (stackHighWaterMark > vm->stackHighWaterMark) {
-    vm->stackHighWaterMark = stackHighWaterMark;
+  // As in mvm_runGC
+  uint16_t estimatedSize = vm->heapSizeUsedAfterLastGC;
+  if (!estimatedSize) {
+    CODE_COVERAGE(958); // Hit
+    estimatedSize = 64;
+  } else {
+    CODE_COVERAGE(959); // Hit
   }
+  gc_newBucket(&ig->gc, estimatedSize, 0);
+  ig->scanBucket = ig->gc.firstBucket;
+  ig->pScan = getBucketDataBegin(ig->scanBucket);
 
-  return MVM_E_SUCCESS;
+  vm->pIncrementalGC = ig;
 }
 
-TeError vm_resolveExport(VM* vm, mvm_VMExportID id, Value* result) {
-  CODE_COVERAGE(17); // Hit
-
+// Discards the collection in progress, if any. The heap is unaffected.
+static void gc_incrementalAbandon(VM* vm) {
+  gc_TsIncrementalGC* ig = vm->pIncrementalGC;
+  if (!ig) {
+    CODE_COVERAGE(960); // Hit
+    return;
+  }
+  CODE_COVERAGE(961); // Hit
+
+  #if MVM_RESERVED_HEAP
+  vm_reservedHeapRelease(vm, vm->reservedHeapRange ^ 1);
+  #else // !MVM_RESERVED_HEAP
+  TsBucket* bucket = ig->gc.lastBucket;
+  while (bucket) {
+    TsBucket* prev = bucket->prev;
+    vm_free(vm, bucket);
+    bucket = prev;
+  }
+  #endif // !MVM_RESERVED_HEAP
+
+  vm_free(vm, ig);
+  vm->pIncrementalGC = NULL;
+}
+
+// Completes the collection in progress. Every allocation reachable from the
+// roots must have an up-to-date replica.
+static void gc_incrementalFlip(VM* vm, gc_TsIncrementalGC* ig) {
+  CODE_COVERAGE(962); // Hit
+  VM_ASSERT(vm, ig->dirtyCount == 0);
+
+  uint16_t heapSize = getHeapSize(vm);
+  if (heapSize > vm->heapHighWaterMark)
+    vm->heapHighWaterMark = heapSize;
+
+  gc_processRoots(&ig->gc, gc_incrementalFlipRoot);
+  gc_invalidateHeapCaches(vm);
+  gc_adoptToSpace(vm, &ig->gc);
+  vm->heapSizeUsedAfterLastGC = getHeapSize(vm);
+
+  vm_free(vm, ig);
+  vm->pIncrementalGC = NULL;
+
+  #if MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+  mvm_checkHeap(vm);
+  #endif
+}
+
+bool mvm_runGCStep(VM* vm, uint16_t workUnits) {
+  CODE_COVERAGE(963); // Hit
+  if (!vm->pIncrementalGC) {
+    CODE_COVERAGE(964); // Hit
+    gc_incrementalStart(vm);
+  } else {
+    CODE_COVERAGE(965); // Hit
+  }
+  gc_TsIncrementalGC* ig = vm->pIncrementalGC;
+  // The root pass isn't counted against `workUnits`, but there's at most one
+  // per step
+  bool rootPassDone = false;
+
+  while (true) {
+    if (ig->pScan != ig->scanBucket->pEndOfUsedSpace) {
+      CODE_COVERAGE(966); // Hit
+      if (!workUnits) {
+        CODE_COVERAGE(967); // Hit
+        return false;
+      }
+      uint16_t* pReplica = ig->pScan + 1;
+      uint16_t words = gc_incrementalCopy(ig, pReplica, pReplica[0]);
+      ig->pScan += words;
+      workUnits = words < workUnits ? workUnits - words : 0;
+    } else if (ig->scanBucket->next) {
+      CODE_COVERAGE(968); // Hit
+      ig->scanBucket = ig->scanBucket->next;
+      ig->pScan = getBucketDataBegin(ig->scanBucket);
+    } else if (ig->dirtyCount) {
+      CODE_COVERAGE(969); // Hit
+      if (!workUnits) {
+        CODE_COVERAGE(970); // Hit
+        return false;
+      }
+      ShortPtr spSrc = ig->pDirty[--ig->dirtyCount];
+      uint16_t* pEntry = &ig->pForwarding[spSrc >> 2];
+      VM_ASSERT(vm, *pEntry & 1);
+      *pEntry &= 0xFFFE;
+      // A replica that hasn't been scanned yet will be copied by the scan
+      if (*pEntry < gc_incrementalScanOffset(ig)) {
+        CODE_COVERAGE(971); // Hit
+        uint16_t words = gc_incrementalCopy(ig, ShortPtr_decodeInToSpace(&ig->gc, *pEntry), spSrc);
+        workUnits = words < workUnits ? workUnits - words : 0;
+      } else {
+        CODE_COVERAGE_UNTESTED(972); // Not hit
+        workUnits--;
+      }
+    } else if (!rootPassDone) {
+      CODE_COVERAGE(973); // Hit
+      rootPassDone = true;
+      uint16_t replicatedCount = ig->replicatedCount;
+      gc_processRoots(&ig->gc, gc_incrementalForwardRoot);
+      if (ig->replicatedCount == replicatedCount) {
+        CODE_COVERAGE(974); // Hit
+        gc_incrementalFlip(vm, ig);
+        return true;
+      } else {
+        CODE_COVERAGE(975); // Hit
+      }
+    } else {
+      CODE_COVERAGE(976); // Hit
+      return false;
+    }
+  }
+}
+
+// Completes the cycle in progress, without a limit on the work
+static void gc_incrementalFinish(VM* vm) {
+  CODE_COVERAGE(989); // Not hit
+  // Each step makes at most one pass over the roots, and nothing runs in
+  // between to create more work, so this takes at most a few steps
+  while (!mvm_runGCStep(vm, 0xFFFF)) {
+    CODE_COVERAGE(990); // Not hit
+  }
+}
+
+static void gc_incrementalWriteBarrier(VM* vm, void* pAllocation) {
+  gc_TsIncrementalGC* ig = vm->pIncrementalGC;
+  ShortPtr sp = ShortPtr_encode(vm, pAllocation);
+  uint16_t* pEntry = &ig->pForwarding[sp >> 2];
+  // Allocations that haven't been replicated yet will be copied when they are,
+  // and dirty ones are already in the log
+  if (*pEntry && !(*pEntry & 1)) {
+    CODE_COVERAGE(977); // Hit
+    *pEntry |= 1;
+    VM_ASSERT(vm, ig->dirtyCount < GC_INCREMENTAL_TABLE_ENTRIES);
+    ig->pDirty[ig->dirtyCount++] = sp;
+  } else {
+    CODE_COVERAGE(978); // Hit
+  }
+}
+
+// Write barrier for a closure variable, given only its slot. The slot is in
+// one of the scopes in the chain of the current closure (see
+// vm_findScopedVariable).
+static void gc_incrementalScopedWriteBarrier(VM* vm, Value* pVar) {
+  CODE_COVERAGE(979); // Hit
+  Value scope = vm->stack->reg.closure;
+  while (Value_isShortPtr(scope)) {
+    Value* pScope = ShortPtr_decode(vm, scope);
+    uint16_t size = vm_getAllocationSize(pScope);
+    if ((pVar >= pScope) && (pVar < pScope + size / 2)) {
+      gc_incrementalWriteBarrier(vm, pScope);
+      return;
+    }
+    // The reference to the parent is kept in the last slot
+    scope = pScope[size / 2 - 1];
+  }
+  // Scopes in ROM can't be written to
+  VM_ASSERT(vm, false);
+}
+#endif // MVM_INCREMENTAL_GC
+
+/**
+ * Create the call VM call stack and registers
+ */
+TeError vm_createStackAndRegisters(VM* vm) {
+  CODE_COVERAGE(225); // Hit
+  // This is freed again at the end of mvm_call. Note: the allocated
+  // memory includes the registers, which are part of the vm_TsStack
+  // structure
+  vm_TsStack* stack = vm_malloc(vm, sizeof (vm_TsStack) + MVM_STACK_SIZE);
+  if (!stack) {
+    CODE_COVERAGE_ERROR_PATH(231); // Not hit
+    return vm_newError(vm, MVM_E_MALLOC_FAIL);
+  }
+  vm->stack = stack;
+  vm_TsRegisters* reg = &stack->reg;
+  memset(reg, 0, sizeof *reg);
+  // The stack grows upward. The bottom is the lowest address.
+  uint16_t* bottomOfStack = getBottomOfStack(stack);
+  reg->pFrameBase = bottomOfStack;
+  reg->pStackPointer = bottomOfStack;
+  reg->lpProgramCounter = vm->lpBytecode; // This is essentially treated as a null value
+  reg->argCountAndFlags = 0;
+  reg->closure = VM_VALUE_UNDEFINED;
+  reg->pCatchTarget = NULL;
+  reg->cpsCallback = VM_VALUE_DELETED;
+  reg->jobQueue = VM_VALUE_UNDEFINED;
+  VM_ASSERT(vm, reg->pArgs == 0);
+
+  return MVM_E_SUCCESS;
+}
+
+// Lowest address on stack
+static inline Value* getBottomOfStack(vm_TsStack* stack) {
+  CODE_COVERAGE(510); // Hit
+  return (Value*)(stack + 1);
+}
+
+// Highest possible address on stack (+1) before overflow
+static inline Value* getTopOfStackSpace(vm_TsStack* stack) {
+  CODE_COVERAGE(511); // Hit
+  return getBottomOfStack(stack) + MVM_STACK_SIZE / sizeof (Value);
+}
+
+#if MVM_DEBUG
+// Some utility functions, mainly to execute in the debugger (could also be copy-pasted as expressions in some cases)
+uint16_t dbgStackDepth(VM* vm) {
+  return (uint16_t)((vm->stack->reg.pStackPointer - (Value*)(vm->stack + 1)));
+}
+Value* dbgStack(VM* vm) {
+  return (Value*)(vm->stack + 1);
+}
+uint16_t dbgPC(VM* vm) {
+  return (uint16_t)((intptr_t)vm->stack->reg.lpProgramCounter - (intptr_t)vm->lpBytecode);
+}
+#endif // MVM_DEBUG
+
+/**
+ * Checks that we have enough stack space for the given size, and updates the
+ * high water mark.
+ */
+static TeError vm_requireStackSpace(VM* vm, Value* pStackPointer, uint16_t sizeRequiredInWords) {
+  Value* pStackHighWaterMark = pStackPointer + ((intptr_t)sizeRequiredInWords);
+  if (pStackHighWaterMark > getTopOfStackSpace(vm->stack)) {
+    CODE_COVERAGE_ERROR_PATH(233); // Not hit
+
+    // TODO(low): Since we know the max stack depth for the function, we could
+    // actually grow the stack dynamically rather than allocate it fixed size.
+    // Actually, it seems likely that we could allocate the VM stack on the C
+    // stack, since it's a fixed-size structure anyway.
+    //
+    // (A way to do the allocation on the stack would be to perform a nested
+    // call to mvm_call, and the allocation can be at the beginning of
+    // mvm_call). Otherwise we could just malloc, which has the advantage of
+    // simplicity and we can grow the stack at any time.
+    //
+    // Rather than a segmented stack, it might also be simpler to just grow the
+    // stack size and copy across old data. This has the advantage of keeping
+    // the GC simple.
+    return vm_newError(vm, MVM_E_STACK_OVERFLOW);
+  }
+
+  // Stack high-water mark
+  uint16_t stackHighWaterMark = (uint16_t)((intptr_t)pStackHighWaterMark - (intptr_t)getBottomOfStack(vm->stack));
+  if (stackHighWaterMark > vm->stackHighWaterMark) {
+    vm->stackHighWaterMark = stackHighWaterMark;
+  }
+
+  return MVM_E_SUCCESS;
+}
+
+TeError vm_resolveExport(VM* vm, mvm_VMExportID id, Value* result) {
+  CODE_COVERAGE(17); // Hit
+
   LongPtr exportTableEnd;
   LongPtr exportTable = getBytecodeSection(vm, BCS_EXPORT_TABLE, &exportTableEnd);
 
@@ -5078,6 +6950,7 @@ static Value vm_convertToString(VM* vm, Value value) {
       CODE_COVERAGE(250); // Hit
       return value;
     }
+    case TC_REF_SHAPED_OBJECT:
     case TC_REF_PROPERTY_LIST: {
       CODE_COVERAGE_UNTESTED(251); // Not hit
       constStr = "[Object]";
@@ -5361,11 +7234,9 @@ bool mvm_toBool(VM* vm, Value value) {
       return MVM_E_FATAL_ERROR_MUST_KILL_VM;
 
     }
-    case TC_REF_RESERVED_1: {
+    case TC_REF_SHAPED_OBJECT: {
       CODE_COVERAGE_UNTESTED(610); // Not hit
-      VM_RESERVED(vm);
-      return MVM_E_FATAL_ERROR_MUST_KILL_VM;
-
+      return true;
     }
     case TC_VAL_UNDEFINED: {
       CODE_COVERAGE(315); // Hit
@@ -5790,6 +7661,9 @@ SUB_GET_PROPERTY:
       return MVM_E_SUCCESS;
     }
 
+    #if MVM_SHAPED_OBJECTS
+    case TC_REF_SHAPED_OBJECT:
+    #endif
     case TC_REF_PROPERTY_LIST: {
       CODE_COVERAGE(359); // Hit
 
@@ -5805,6 +7679,37 @@ SUB_GET_PROPERTY:
       while (lpPropertyList) {
         uint16_t headerWord = readAllocationHeaderWord_long(lpPropertyList);
         uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+
+        #if MVM_SHAPED_OBJECTS
+        // The object or any of its prototypes may be shaped. The shape holds
+        // the keys the object was created with, and any properties added since
+        // are in the `dpNext` chain as usual.
+        if (vm_getTypeCodeFromHeaderWord(headerWord) == TC_REF_SHAPED_OBJECT) {
+          CODE_COVERAGE(786); // Not hit
+          LongPtr lpSlot = vm_shapedObjectFindSlot(vm, lpPropertyList, propertyName);
+          if (lpSlot) {
+            CODE_COVERAGE(787); // Not hit
+            VM_EXEC_SAFE_MODE(*pObjectValue = VM_VALUE_NULL);
+            *out_propertyValue = LongPtr_read2_aligned(lpSlot);
+            return MVM_E_SUCCESS;
+          }
+          size = sizeof (TsPropertyList); // No key-value pairs
+        }
+        #endif
+
+        #if MVM_PROPERTY_INDEX
+        LongPtr lpSlot;
+        if (vm_propertyIndexFindSlot(vm, lpPropertyList, &size, propertyName, &lpSlot)) {
+          if (lpSlot) {
+            CODE_COVERAGE(805); // Not hit
+            VM_EXEC_SAFE_MODE(*pObjectValue = VM_VALUE_NULL);
+            *out_propertyValue = LongPtr_read2_aligned(lpSlot);
+            return MVM_E_SUCCESS;
+          }
+          size = sizeof (TsPropertyList); // Not in this segment
+        }
+        #endif
+
         uint16_t propCount = (size - sizeof (TsPropertyList)) / 4;
 
         LongPtr p = LongPtr_add(lpPropertyList, sizeof (TsPropertyList));
@@ -5960,7 +7865,7 @@ static void growArray(VM* vm, Value* pvArr, uint16_t newLength, uint16_t newCapa
   }
   VM_ASSERT(vm, newCapacity != 0);
 
-  uint16_t* pNewData = mvm_allocate(vm, newCapacity * 2, TC_REF_FIXED_LENGTH_ARRAY);
+  Value* pNewData = mvm_allocate(vm, newCapacity * sizeof (Value), TC_REF_FIXED_LENGTH_ARRAY);
   // Copy values from the old array. Note that the above allocation can trigger
   // a GC collection which moves the array, so we need to decode the value again
   TsArray* arr = DynamicPtr_decode_native(vm, *pvArr);
@@ -5982,13 +7887,14 @@ static void growArray(VM* vm, Value* pvArr, uint16_t newLength, uint16_t newCapa
   CODE_COVERAGE(325); // Hit
   VM_ASSERT(vm, newCapacity >= oldCapacity);
   // Fill in the rest of the memory as holes
-  uint16_t* p = &pNewData[oldCapacity];
-  uint16_t* end = &pNewData[newCapacity];
+  Value* p = &pNewData[oldCapacity];
+  Value* end = &pNewData[newCapacity];
   while (p != end) {
     *p++ = VM_VALUE_DELETED;
   }
   arr->dpData = ShortPtr_encode(vm, pNewData);
   arr->viLength = VirtualInt14_encode(vm, newLength);
+  VM_WRITE_BARRIER(vm, arr);
 }
 
 /**
@@ -6014,7 +7920,7 @@ SUB_OBJECT_KEYS:
   }
   CODE_COVERAGE(638); // Hit
 
-  if (tc != TC_REF_PROPERTY_LIST) {
+  if ((tc != TC_REF_PROPERTY_LIST) && (tc != TC_REF_SHAPED_OBJECT)) {
     CODE_COVERAGE_ERROR_PATH(639); // Not hit
     return MVM_E_OBJECT_KEYS_ON_NON_OBJECT;
   }
@@ -6027,7 +7933,23 @@ SUB_OBJECT_KEYS:
   // frequently be O(1) and only loop once
   do {
     LongPtr lpPropList = DynamicPtr_decode_long(vm, propList);
+    propList = LongPtr_read2_aligned(lpPropList) /* dpNext */;
+
+    #if MVM_SHAPED_OBJECTS
+    if (vm_getTypeCodeFromHeaderWord(readAllocationHeaderWord_long(lpPropList)) == TC_REF_SHAPED_OBJECT) {
+      CODE_COVERAGE(790); // Not hit
+      // The keys are in the shape (2 bytes each). Shaped objects don't have
+      // internal slots.
+      LongPtr lpShape = DynamicPtr_decode_long(vm, READ_FIELD_2(lpPropList, TsShapedObject, dpShape));
+      propsSize += vm_getAllocationSize_long(lpShape) * 2;
+      continue;
+    }
+    #endif
+
     uint16_t segmentSize = vm_getAllocationSize_long(lpPropList) - sizeof(TsPropertyList);
+    #if MVM_PROPERTY_INDEX
+    segmentSize -= vm_propertyIndexSize(vm, lpPropList, segmentSize + sizeof(TsPropertyList));
+    #endif
 
     // Skip internal properties
     LongPtr lpProp = LongPtr_add(lpPropList, sizeof(TsPropertyList));
@@ -6041,7 +7963,6 @@ SUB_OBJECT_KEYS:
     }
 
     propsSize += segmentSize;
-    propList = LongPtr_read2_aligned(lpPropList) /* dpNext */;
     TABLE_COVERAGE(propList != VM_VALUE_NULL ? 1 : 0, 2, 640); // Hit 2/2
   } while (propList != VM_VALUE_NULL);
 
@@ -6071,7 +7992,23 @@ SUB_OBJECT_KEYS:
     LongPtr lpPropList = DynamicPtr_decode_long(vm, propList);
     propList = LongPtr_read2_aligned(lpPropList) /* dpNext */;
 
+    #if MVM_SHAPED_OBJECTS
+    if (vm_getTypeCodeFromHeaderWord(readAllocationHeaderWord_long(lpPropList)) == TC_REF_SHAPED_OBJECT) {
+      CODE_COVERAGE(791); // Not hit
+      LongPtr lpShape = DynamicPtr_decode_long(vm, READ_FIELD_2(lpPropList, TsShapedObject, dpShape));
+      uint16_t keyCount = vm_getAllocationSize_long(lpShape) / 2;
+      while (keyCount--) {
+        *p++ = LongPtr_read2_aligned(lpShape);
+        lpShape = LongPtr_add(lpShape, 2);
+      }
+      continue;
+    }
+    #endif
+
     uint16_t propsSize = vm_getAllocationSize_long(lpPropList) - sizeof(TsPropertyList);
+    #if MVM_PROPERTY_INDEX
+    propsSize -= vm_propertyIndexSize(vm, lpPropList, propsSize + sizeof(TsPropertyList));
+    #endif
     LongPtr lpProp = LongPtr_add(lpPropList, sizeof(TsPropertyList));
     TABLE_COVERAGE(propsSize != 0 ? 1 : 0, 2, 642); // Hit 2/2
     while (propsSize) {
@@ -6160,10 +8097,14 @@ SUB_SET_PROPERTY:
       }
 
       p[index] = (uint8_t)VirtualInt14_decode(vm, byteValue);
+      VM_WRITE_BARRIER(vm, p);
       VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
       return MVM_E_SUCCESS;
     }
 
+    #if MVM_SHAPED_OBJECTS
+    case TC_REF_SHAPED_OBJECT:
+    #endif
     case TC_REF_PROPERTY_LIST: {
       CODE_COVERAGE(366); // Hit
       if (MVM_GET_LOCAL(vPropertyName) == VM_VALUE_STR_PROTO) {
@@ -6183,6 +8124,36 @@ SUB_SET_PROPERTY:
         CODE_COVERAGE(367); // Hit
         uint16_t headerWord = readAllocationHeaderWord(MVM_GET_LOCAL(pPropertyList));
         uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+
+        #if MVM_SHAPED_OBJECTS
+        if (vm_getTypeCodeFromHeaderWord(headerWord) == TC_REF_SHAPED_OBJECT) {
+          CODE_COVERAGE(788); // Not hit
+          LongPtr lpSlot = vm_shapedObjectFindSlot(vm, LongPtr_new(MVM_GET_LOCAL(pPropertyList)), MVM_GET_LOCAL(vPropertyName));
+          if (lpSlot) {
+            CODE_COVERAGE(789); // Not hit
+            *((Value*)LongPtr_truncate(vm, lpSlot)) = MVM_GET_LOCAL(vPropertyValue);
+            VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pPropertyList));
+            VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
+            return MVM_E_SUCCESS;
+          }
+          size = sizeof (TsPropertyList); // No key-value pairs
+        }
+        #endif
+
+        #if MVM_PROPERTY_INDEX
+        LongPtr lpSlot;
+        if (vm_propertyIndexFindSlot(vm, LongPtr_new(MVM_GET_LOCAL(pPropertyList)), &size, MVM_GET_LOCAL(vPropertyName), &lpSlot)) {
+          if (lpSlot) {
+            CODE_COVERAGE(806); // Not hit
+            *((Value*)LongPtr_truncate(vm, lpSlot)) = MVM_GET_LOCAL(vPropertyValue);
+            VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pPropertyList));
+            VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
+            return MVM_E_SUCCESS;
+          }
+          size = sizeof (TsPropertyList); // Not in this segment
+        }
+        #endif
+
         uint16_t propCount = (size - sizeof (TsPropertyList)) / 4;
 
         uint16_t* p = (uint16_t*)(MVM_GET_LOCAL(pPropertyList) + 1);
@@ -6194,6 +8165,7 @@ SUB_SET_PROPERTY:
           if (key == MVM_GET_LOCAL(vPropertyName)) {
             CODE_COVERAGE(368); // Hit
             *p = MVM_GET_LOCAL(vPropertyValue);
+            VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pPropertyList));
             VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
             return MVM_E_SUCCESS;
           } else {
@@ -6255,6 +8227,12 @@ SUB_SET_PROPERTY:
       // Note: `pPropertyList` currently points to the last property list in
       // the chain.
       MVM_GET_LOCAL(pPropertyList)->dpNext = spNewCell;
+      VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pPropertyList));
+
+      #if MVM_INLINE_CACHE
+      // The new property may shadow one that was cached from a prototype
+      vm_invalidateInlineCacheForKey(vm, MVM_GET_LOCAL(vPropertyName));
+      #endif
       VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
       return MVM_E_SUCCESS;
     }
@@ -6269,7 +8247,7 @@ SUB_SET_PROPERTY:
       VM_ASSERT(vm, Value_isVirtualInt14(viLength));
       uint16_t oldLength = VirtualInt14_decode(vm, viLength);
       MVM_LOCAL(DynamicPtr, dpData, MVM_GET_LOCAL(arr)->dpData);
-      MVM_LOCAL(uint16_t*, pData, NULL);
+      MVM_LOCAL(Value*, pData, NULL);
       uint16_t oldCapacity = 0;
       if (MVM_GET_LOCAL(dpData) != VM_VALUE_NULL) {
         CODE_COVERAGE(544); // Hit
@@ -6295,11 +8273,13 @@ SUB_SET_PROPERTY:
           VM_ASSERT(vm, MVM_GET_LOCAL(pData));
           // Wipe array items that aren't reachable
           uint16_t count = oldLength - newLength;
-          uint16_t* p = &MVM_GET_LOCAL(pData)[newLength];
+          Value* p = &MVM_GET_LOCAL(pData)[newLength];
           while (count--)
             *p++ = VM_VALUE_DELETED;
+          VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pData));
 
           MVM_GET_LOCAL(arr)->viLength = VirtualInt14_encode(vm, newLength);
+          VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(arr));
           VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
           return MVM_E_SUCCESS;
         } else if (newLength == oldLength) {
@@ -6311,6 +8291,7 @@ SUB_SET_PROPERTY:
           // We can just overwrite the length field. Note that the newly
           // uncovered memory is already filled with VM_VALUE_DELETED
           MVM_GET_LOCAL(arr)->viLength = VirtualInt14_encode(vm, newLength);
+          VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(arr));
           VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
           return MVM_E_SUCCESS;
         } else { // Make array bigger
@@ -6344,6 +8325,7 @@ SUB_SET_PROPERTY:
             // The length changes to include the value. The extra slots are
             // already filled in with holes from the original allocation.
             MVM_GET_LOCAL(arr)->viLength = VirtualInt14_encode(vm, newLength);
+            VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(arr));
           } else {
             CODE_COVERAGE(292); // Hit
             // We expand the capacity more aggressively here because this is the
@@ -6368,6 +8350,7 @@ SUB_SET_PROPERTY:
 
         // Write the item to memory
         MVM_GET_LOCAL(pData)[(uint16_t)index] = MVM_GET_LOCAL(vPropertyValue);
+        VM_WRITE_BARRIER(vm, MVM_GET_LOCAL(pData));
 
         VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
         return MVM_E_SUCCESS;
@@ -6390,888 +8373,3658 @@ SUB_SET_PROPERTY:
   }
 }
 
-/** Converts the argument to either an TC_VAL_INT14 or a TC_REF_INTERNED_STRING, or gives an error */
-static TeError toPropertyName(VM* vm, Value* value) {
-  CODE_COVERAGE(50); // Hit
-
-  // This function may trigger a GC cycle because it may add a cell to the string intern table
-  VM_ASSERT(vm, !vm->stack || !vm->stack->reg.usingCachedRegisters);
-  VM_POTENTIAL_GC_POINT(vm);
+#if MVM_SHAPED_OBJECTS
+/**
+ * Finds the value slot of a property that is in the shape of a TsShapedObject,
+ * or returns NULL if the shape doesn't have the property (it may still be in
+ * the `dpNext` chain if it was added after the object was created).
+ */
+static LongPtr vm_shapedObjectFindSlot(VM* vm, LongPtr lpObject, Value propertyName) {
+  CODE_COVERAGE(793); // Not hit
+  LongPtr lpShape = DynamicPtr_decode_long(vm, READ_FIELD_2(lpObject, TsShapedObject, dpShape));
+  uint16_t keyCount = vm_getAllocationSize_long(lpShape) / 2;
+  LongPtr lpValue = LongPtr_add(lpObject, sizeof (TsShapedObject));
 
-  // Property names in microvium are either integer indexes or non-integer interned strings
-  TeTypeCode type = deepTypeOf(vm, *value);
-  switch (type) {
-    // These are already valid property names
-    case TC_VAL_INT14: {
-      CODE_COVERAGE(279); // Hit
-      if (VirtualInt14_decode(vm, *value) < 0) {
-        CODE_COVERAGE_UNTESTED(280); // Not hit
-        return vm_newError(vm, MVM_E_RANGE_ERROR);
-      }
-      CODE_COVERAGE(281); // Hit
-      return MVM_E_SUCCESS;
-    }
-    case TC_REF_INTERNED_STRING: {
-      CODE_COVERAGE(373); // Hit
-      return MVM_E_SUCCESS;
+  while (keyCount--) {
+    if (LongPtr_read2_aligned(lpShape) == propertyName) {
+      CODE_COVERAGE(794); // Not hit
+      return lpValue;
     }
+    lpShape = LongPtr_add(lpShape, 2);
+    lpValue = LongPtr_add(lpValue, 2);
+  }
 
-    case TC_REF_INT32: {
-      CODE_COVERAGE_ERROR_PATH(374); // Not hit
-      // 32-bit numbers are out of the range of supported array indexes
-      return vm_newError(vm, MVM_E_RANGE_ERROR);
-    }
+  CODE_COVERAGE(795); // Not hit
+  return LongPtr_new(NULL);
+}
+#endif // MVM_SHAPED_OBJECTS
 
-    case TC_REF_STRING: {
-      CODE_COVERAGE(375); // Hit
+#if MVM_PROPERTY_INDEX
+// Keys in the index are int14s and ROM pointers, whose low 2 bits carry no
+// information
+#define VM_PROPERTY_INDEX_HASH(key) ((uint16_t)(((key) >> 2) ^ ((key) >> 9)))
 
-      // Note: In Microvium at the moment, it's illegal to use an integer-valued
-      // string as a property name. If the string is in bytecode, it will only
-      // have the type TC_REF_STRING if it's a number and is illegal.
-      if (!Value_isShortPtr(*value)) {
-        return vm_newError(vm, MVM_E_TYPE_ERROR);
-      }
+// Only keys that the GC never moves are indexed (see VM_PROPERTY_INDEX_MARKER).
+// Negative int14 keys are internal slots rather than properties.
+#define VM_PROPERTY_INDEX_IS_INDEXABLE(key) (!Value_isShortPtr(key) && (((key) & 0x8003) != 0x8003))
 
-      if (vm_ramStringIsNonNegativeInteger(vm, *value)) {
-        CODE_COVERAGE_ERROR_PATH(378); // Not hit
-        return vm_newError(vm, MVM_E_TYPE_ERROR);
-      } else {
-        CODE_COVERAGE(379); // Hit
-      }
+/**
+ * Returns the number of bytes at the end of a property list allocation of the
+ * given size that are taken by its hash index, or 0 if it doesn't have one.
+ */
+static uint16_t vm_propertyIndexSize(VM* vm, LongPtr lpPropertyList, uint16_t size) {
+  if (size < sizeof (TsPropertyList) + 4) {
+    CODE_COVERAGE(796); // Not hit
+    return 0;
+  }
+  LongPtr lpMarker = LongPtr_add(lpPropertyList, size - 4);
+  if (LongPtr_read2_aligned(lpMarker) != VM_PROPERTY_INDEX_MARKER) {
+    CODE_COVERAGE(797); // Not hit
+    return 0;
+  }
+  CODE_COVERAGE(798); // Not hit
+  uint16_t bucketCount = VirtualInt14_decode(vm, LongPtr_read2_aligned(LongPtr_add(lpMarker, 2)));
+  return bucketCount * 2 + 4;
+}
 
-      // Strings need to be converted to interned strings in order to be valid
-      // property names. This is because properties are searched by reference
-      // equality.
-      toInternedString(vm, value);
-      return MVM_E_SUCCESS;
-    }
+/**
+ * Looks up a property using the hash index of a property list segment.
+ *
+ * Returns false if the segment isn't indexed or the key isn't one that would be
+ * in the index, in which case the caller needs to scan the pairs linearly. On
+ * an indexed segment, `*inout_size` is reduced to exclude the index so that the
+ * scan only covers the pairs.
+ *
+ * Otherwise returns true with `*out_lpSlot` set to the value slot of the
+ * property, or NULL if the property isn't in this segment.
+ */
+static bool vm_propertyIndexFindSlot(VM* vm, LongPtr lpPropertyList, uint16_t* inout_size, Value propertyName, LongPtr* out_lpSlot) {
+  uint16_t indexSize = vm_propertyIndexSize(vm, lpPropertyList, *inout_size);
+  if (!indexSize) {
+    CODE_COVERAGE(799); // Not hit
+    return false;
+  }
+  *inout_size -= indexSize;
+  if (!VM_PROPERTY_INDEX_IS_INDEXABLE(propertyName)) {
+    CODE_COVERAGE(800); // Not hit
+    return false;
+  }
 
-    case TC_VAL_STR_LENGTH: {
-      CODE_COVERAGE(272); // Hit
-      return MVM_E_SUCCESS;
-    }
+  uint16_t mask = (indexSize - 4) / 2 - 1;
+  LongPtr lpBuckets = LongPtr_add(lpPropertyList, *inout_size);
+  LongPtr lpPairs = LongPtr_add(lpPropertyList, sizeof (TsPropertyList));
+  uint16_t i = VM_PROPERTY_INDEX_HASH(propertyName) & mask;
 
-    case TC_VAL_STR_PROTO: {
-      CODE_COVERAGE(273); // Hit
-      return MVM_E_SUCCESS;
+  // The index is at most half full, so there is always an empty bucket to stop
+  // the probe.
+  while (true) {
+    uint16_t entry = LongPtr_read2_aligned(LongPtr_add(lpBuckets, i * 2));
+    if (entry == VM_PROPERTY_INDEX_EMPTY) {
+      CODE_COVERAGE(801); // Not hit
+      *out_lpSlot = LongPtr_new(NULL);
+      return true;
     }
-    default: {
-      CODE_COVERAGE_ERROR_PATH(380); // Not hit
-      return vm_newError(vm, MVM_E_TYPE_ERROR);
+    LongPtr lpPair = LongPtr_add(lpPairs, VM_PROPERTY_INDEX_ENTRY_DECODE(entry) * 4);
+    if (LongPtr_read2_aligned(lpPair) == propertyName) {
+      CODE_COVERAGE(802); // Not hit
+      *out_lpSlot = LongPtr_add(lpPair, 2);
+      return true;
     }
+    i = (i + 1) & mask;
   }
 }
 
-// Converts a TC_REF_STRING to a TC_REF_INTERNED_STRING
-// TODO: Test cases for this function
-static void toInternedString(VM* vm, Value* pValue) {
-  CODE_COVERAGE(51); // Hit
-  Value value = *pValue;
-  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_STRING);
-
-  // This function may trigger a GC cycle because it may add a cell to the intern table
-  VM_ASSERT(vm, !vm->stack || !vm->stack->reg.usingCachedRegisters);
+/**
+ * Writes a hash index after the `pairCount` key-value pairs at `pPairs`. The
+ * caller is responsible for having space for `bucketCount + 2` words there
+ * and for updating the allocation header.
+ */
+static void gc_buildPropertyIndex(VM* vm, uint16_t* pPairs, uint16_t pairCount, uint16_t bucketCount) {
+  CODE_COVERAGE(803); // Not hit
+  uint16_t* pBuckets = pPairs + pairCount * 2;
+  uint16_t mask = bucketCount - 1;
 
-  // TC_REF_STRING values are always in GC memory. If they were in flash, they'd
-  // already be TC_REF_INTERNED_STRING.
-  char* pStr1 = DynamicPtr_decode_native(vm, value);
-  uint16_t str1Size = vm_getAllocationSize(pStr1);
+  for (uint16_t i = 0; i < bucketCount; i++) {
+    pBuckets[i] = VM_PROPERTY_INDEX_EMPTY;
+  }
 
-  LongPtr lpStr1 = LongPtr_new(pStr1);
-  // Note: the sizes here include the null terminator
-  if ((str1Size == sizeof PROTO_STR) && (memcmp_long(lpStr1, LongPtr_new((void*)&PROTO_STR), sizeof PROTO_STR) == 0)) {
-    CODE_COVERAGE_UNTESTED(547); // Not hit
-    *pValue = VM_VALUE_STR_PROTO;
-  } else if ((str1Size == sizeof LENGTH_STR) && (memcmp_long(lpStr1, LongPtr_new((void*)&LENGTH_STR), sizeof LENGTH_STR) == 0)) {
-    CODE_COVERAGE(548); // Hit
-    *pValue = VM_VALUE_STR_LENGTH;
-  } else {
-    CODE_COVERAGE(549); // Hit
+  for (uint16_t pairIndex = 0; pairIndex < pairCount; pairIndex++) {
+    Value key = pPairs[pairIndex * 2];
+    if (!VM_PROPERTY_INDEX_IS_INDEXABLE(key)) {
+      CODE_COVERAGE(804); // Not hit
+      continue;
+    }
+    uint16_t i = VM_PROPERTY_INDEX_HASH(key) & mask;
+    while (pBuckets[i] != VM_PROPERTY_INDEX_EMPTY) {
+      i = (i + 1) & mask;
+    }
+    pBuckets[i] = VM_PROPERTY_INDEX_ENTRY(pairIndex);
   }
 
-  LongPtr lpBytecode = vm->lpBytecode;
+  pBuckets[bucketCount] = VM_PROPERTY_INDEX_MARKER;
+  pBuckets[bucketCount + 1] = VirtualInt14_encode(vm, bucketCount);
+}
+#endif // MVM_PROPERTY_INDEX
 
-  // We start by searching the string table for interned strings that are baked
-  // into the ROM. These are stored alphabetically, so we can perform a binary
-  // search.
+#if MVM_INLINE_CACHE
+/**
+ * Finds the value slot of an existing property on a plain object, following
+ * the same search order as `getProperty`. Returns NULL if the object isn't a
+ * property list or the property isn't found, in which case the caller falls
+ * back to the general path.
+ *
+ * The key is compared as-is, so a key that isn't already a normalized
+ * property name just won't be found.
+ */
+static LongPtr vm_findPropertySlot(VM* vm, Value objectValue, Value propertyName, bool searchPrototypes) {
+  CODE_COVERAGE(765); // Not hit
 
-  uint16_t stringTableOffset = getSectionOffset(vm->lpBytecode, BCS_STRING_TABLE);
-  uint16_t stringTableSize = getSectionOffset(vm->lpBytecode, vm_sectionAfter(vm, BCS_STRING_TABLE)) - stringTableOffset;
-  int strCount = stringTableSize / sizeof (Value);
+  TeTypeCode tc = deepTypeOf(vm, objectValue);
+  if ((propertyName == VM_VALUE_STR_PROTO) || ((tc != TC_REF_PROPERTY_LIST) && (tc != TC_REF_SHAPED_OBJECT))) {
+    CODE_COVERAGE(766); // Not hit
+    return LongPtr_new(NULL);
+  }
 
-  int first = 0;
-  int last = strCount - 1;
+  LongPtr lpPropertyList = DynamicPtr_decode_long(vm, objectValue);
+  DynamicPtr dpProto = READ_FIELD_2(lpPropertyList, TsPropertyList, dpProto);
 
-  while (first <= last) {
-    CODE_COVERAGE(381); // Hit
-    int middle = (first + last) / 2;
-    uint16_t str2Offset = stringTableOffset + middle * 2;
-    Value vStr2 = LongPtr_read2_aligned(LongPtr_add(lpBytecode, str2Offset));
-    LongPtr lpStr2 = DynamicPtr_decode_long(vm, vStr2);
-    uint16_t header = readAllocationHeaderWord_long(lpStr2);
-    VM_ASSERT(vm, vm_getTypeCodeFromHeaderWord(header) == TC_REF_INTERNED_STRING);
-    uint16_t str2Size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(header);
-    int compareSize = str1Size < str2Size ? str1Size : str2Size;
-    int c = memcmp_long(lpStr1, lpStr2, compareSize);
+  while (lpPropertyList) {
+    uint16_t headerWord = readAllocationHeaderWord_long(lpPropertyList);
+    uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
 
-    // If they compare equal for the range that they have in common, we check the length
-    if (c == 0) {
-      CODE_COVERAGE(382); // Hit
-      if (str1Size < str2Size) {
-        CODE_COVERAGE_UNTESTED(383); // Not hit
-        c = -1;
-      } else if (str1Size > str2Size) {
-        CODE_COVERAGE_UNTESTED(384); // Not hit
-        c = 1;
-      } else {
-        CODE_COVERAGE(385); // Hit
-        // Exact match
-        *pValue = vStr2;
-        return;
-      }
+    #if MVM_SHAPED_OBJECTS
+    if (vm_getTypeCodeFromHeaderWord(headerWord) == TC_REF_SHAPED_OBJECT) {
+      CODE_COVERAGE(792); // Not hit
+      LongPtr lpSlot = vm_shapedObjectFindSlot(vm, lpPropertyList, propertyName);
+      if (lpSlot) return lpSlot;
+      size = sizeof (TsPropertyList); // No key-value pairs
     }
+    #endif
 
-    // c is > 0 if the string we're searching for comes after the middle point
-    if (c > 0) {
-      CODE_COVERAGE(386); // Hit
-      first = middle + 1;
-    } else {
-      CODE_COVERAGE(387); // Hit
-      last = middle - 1;
+    #if MVM_PROPERTY_INDEX
+    LongPtr lpSlot;
+    if (vm_propertyIndexFindSlot(vm, lpPropertyList, &size, propertyName, &lpSlot)) {
+      if (lpSlot) return lpSlot;
+      size = sizeof (TsPropertyList); // Not in this segment
     }
-  }
+    #endif
 
-  // At this point, we haven't found the interned string in the bytecode. We
-  // need to check in RAM. Now we're comparing an in-RAM string against other
-  // in-RAM strings. We're looking for an exact match, not performing a binary
-  // search with inequality comparison, since the linked list of interned
-  // strings in RAM is not sorted.
-  Value vInternedStrings = getBuiltin(vm, BIN_INTERNED_STRINGS);
-  Value spCell = vInternedStrings;
-  while (spCell != VM_VALUE_UNDEFINED) {
-    CODE_COVERAGE(388); // Hit
-    VM_ASSERT(vm, Value_isShortPtr(spCell));
-    TsInternedStringCell* pCell = ShortPtr_decode(vm, spCell);
-    Value vStr2 = pCell->str;
-    char* pStr2 = ShortPtr_decode(vm, vStr2);
-    uint16_t str2Header = readAllocationHeaderWord(pStr2);
-    uint16_t str2Size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(str2Header);
+    uint16_t propCount = (size - sizeof (TsPropertyList)) / 4;
 
-    // The sizes have to match for the strings to be equal
-    if (str2Size == str1Size) {
-      CODE_COVERAGE(389); // Hit
-      // Note: we use memcmp instead of strcmp because strings are allowed to
-      // have embedded null terminators.
-      int c = memcmp(pStr1, pStr2, str1Size);
-      // Equal?
-      if (c == 0) {
-        CODE_COVERAGE(390); // Hit
-        *pValue = vStr2;
-        return;
-      } else {
-        CODE_COVERAGE(391); // Hit
+    LongPtr p = LongPtr_add(lpPropertyList, sizeof (TsPropertyList));
+    while (propCount--) {
+      if (LongPtr_read2_aligned(p) == propertyName) {
+        CODE_COVERAGE(767); // Not hit
+        return LongPtr_add(p, 2);
+      }
+      p = LongPtr_add(p, 4);
+    }
+
+    DynamicPtr dpNext = READ_FIELD_2(lpPropertyList, TsPropertyList, dpNext);
+    if (dpNext != VM_VALUE_NULL) {
+      CODE_COVERAGE(768); // Not hit
+      lpPropertyList = DynamicPtr_decode_long(vm, dpNext);
+    } else if (searchPrototypes) {
+      CODE_COVERAGE(769); // Not hit
+      lpPropertyList = DynamicPtr_decode_long(vm, dpProto);
+      if (lpPropertyList) {
+        dpProto = READ_FIELD_2(lpPropertyList, TsPropertyList, dpProto);
       }
     } else {
-      CODE_COVERAGE(550); // Hit
+      CODE_COVERAGE(770); // Not hit
+      break;
     }
-    spCell = pCell->spNext;
-    TABLE_COVERAGE(spCell ? 1 : 0, 2, 551); // Hit 1/2
   }
 
-  CODE_COVERAGE(616); // Hit
+  return LongPtr_new(NULL);
+}
 
-  // If we get here, it means there was no matching interned string already
-  // existing in ROM or RAM. We upgrade the current string to a
-  // TC_REF_INTERNED_STRING, since we now know it doesn't conflict with any existing
-  // existing interned strings.
-  setHeaderWord(vm, pStr1, TC_REF_INTERNED_STRING, str1Size);
+/**
+ * The cached value slot of `propertyName` on `receiver`, or NULL if the entry
+ * doesn't apply. With MVM_SHAPED_OBJECTS, an entry filled from the shape of an
+ * object also applies to any other object with the same shape, since the
+ * properties in a shape are always found before any added later, at the same
+ * offset in each object.
+ */
+static LongPtr vm_inlineCacheLookup(VM* vm, vm_TsInlineCacheEntry* entry, uint16_t site, Value receiver, Value propertyName) {
+  if ((entry->site != site) || (entry->key != propertyName)) {
+    CODE_COVERAGE(983); // Not hit
+    return LongPtr_new(NULL);
+  }
+  if (entry->receiver == receiver) {
+    CODE_COVERAGE(984); // Not hit
+    return entry->lpSlot;
+  }
 
-  // Add the string to the linked list of interned strings
-  TsInternedStringCell* pCell = GC_ALLOCATE_TYPE(vm, TsInternedStringCell, TC_REF_FIXED_LENGTH_ARRAY);
-  value = *pValue; // Invalidated by potential GC collection
-  vInternedStrings = getBuiltin(vm, BIN_INTERNED_STRINGS);  // Invalidated by potential GC collection
-  // Push onto linked list2
-  pCell->spNext = vInternedStrings;
-  pCell->str = value;
-  setBuiltin(vm, BIN_INTERNED_STRINGS, ShortPtr_encode(vm, pCell));
-}
+  #if MVM_SHAPED_OBJECTS
+  // Writable objects are always in RAM
+  if ((entry->shape != VM_VALUE_UNDEFINED) && Value_isShortPtr(receiver) &&
+    (deepTypeOf(vm, receiver) == TC_REF_SHAPED_OBJECT)
+  ) {
+    LongPtr lpObject = DynamicPtr_decode_long(vm, receiver);
+    if (READ_FIELD_2(lpObject, TsShapedObject, dpShape) == entry->shape) {
+      CODE_COVERAGE(985); // Not hit
+      // The next access is most likely to be to the same object again
+      entry->receiver = receiver;
+      entry->lpSlot = LongPtr_add(lpObject, entry->shapeSlotOffset);
+      return entry->lpSlot;
+    }
+  }
+  #endif
 
-static int memcmp_long(LongPtr p1, LongPtr p2, size_t size) {
-  CODE_COVERAGE(471); // Hit
-  return MVM_LONG_MEM_CMP(p1, p2, size);
+  CODE_COVERAGE(986); // Not hit
+  return LongPtr_new(NULL);
 }
 
-static void memcpy_long(void* target, LongPtr source, size_t size) {
-  CODE_COVERAGE(9); // Hit
-  MVM_LONG_MEM_CPY(target, source, size);
-}
+static void vm_inlineCacheFill(VM* vm, vm_TsInlineCacheEntry* entry, uint16_t site, Value receiver, Value propertyName, LongPtr lpSlot) {
+  entry->site = site;
+  entry->receiver = receiver;
+  entry->key = propertyName;
+  entry->lpSlot = lpSlot;
 
-/** Size of string excluding bonus null terminator */
-static uint16_t vm_stringSizeUtf8(VM* vm, Value value) {
-  CODE_COVERAGE(53); // Hit
-  TeTypeCode typeCode = deepTypeOf(vm, value);
-  switch (typeCode) {
-    case TC_REF_STRING:
-    case TC_REF_INTERNED_STRING: {
-      LongPtr lpStr = DynamicPtr_decode_long(vm, value);
-      uint16_t headerWord = readAllocationHeaderWord_long(lpStr);
-      // Less 1 because of the bonus null terminator
-      return vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord) - 1;
-    }
-    case TC_VAL_STR_PROTO: {
-      CODE_COVERAGE_UNTESTED(552); // Not hit
-      return sizeof PROTO_STR - 1;
-    }
-    case TC_VAL_STR_LENGTH: {
-      CODE_COVERAGE(608); // Hit
-      return sizeof LENGTH_STR - 1;
+  #if MVM_SHAPED_OBJECTS
+  entry->shape = VM_VALUE_UNDEFINED;
+  // The slot may be in the shape of the receiver itself, which is searched
+  // first. `vm_findPropertySlot` has already excluded `__proto__`.
+  if (Value_isShortPtr(receiver) && (deepTypeOf(vm, receiver) == TC_REF_SHAPED_OBJECT)) {
+    LongPtr lpObject = DynamicPtr_decode_long(vm, receiver);
+    if (vm_shapedObjectFindSlot(vm, lpObject, propertyName) == lpSlot) {
+      CODE_COVERAGE(987); // Not hit
+      entry->shape = READ_FIELD_2(lpObject, TsShapedObject, dpShape);
+      entry->shapeSlotOffset = (uint16_t)LongPtr_sub(lpSlot, lpObject);
     }
-    default:
-      VM_ASSERT_UNREACHABLE(vm);
-      return 0;
   }
+  #endif
 }
 
 /**
- * Checks if a string contains only decimal digits (and is not empty). May only
- * be called on TC_REF_STRING and only those in GC memory.
+ * Same as `getProperty`, but first consults the inline cache entry for the
+ * instruction at bytecode address `site`.
  */
-static bool vm_ramStringIsNonNegativeInteger(VM* vm, Value str) {
-  CODE_COVERAGE(55); // Hit
-  VM_ASSERT(vm, deepTypeOf(vm, str) == TC_REF_STRING);
-
-  char* pStr = ShortPtr_decode(vm, str);
-
-  // Length excluding bonus null terminator
-  uint16_t len = vm_getAllocationSize(pStr) - 1;
-  char* p = pStr;
-  if (!len) {
-    CODE_COVERAGE_UNTESTED(554); // Not hit
-    return false;
-  } else {
-    CODE_COVERAGE(555); // Hit
+static TeError vm_getPropertyCached(VM* vm, uint16_t site, Value* pObjectValue, Value* pPropertyName, Value* out_propertyValue) {
+  CODE_COVERAGE(771); // Not hit
+  Value receiver = *pObjectValue;
+  Value propertyName = *pPropertyName;
+  vm_TsInlineCacheEntry* entry = &vm->inlineCache[site & (MVM_INLINE_CACHE_SIZE - 1)];
+
+  LongPtr lpSlot = vm_inlineCacheLookup(vm, entry, site, receiver, propertyName);
+  if (lpSlot) {
+    CODE_COVERAGE(772); // Not hit
+    vm->inlineCacheStats.hits++;
+    *out_propertyValue = LongPtr_read2_aligned(lpSlot);
+    return MVM_E_SUCCESS;
   }
-  while (len--) {
-    CODE_COVERAGE(398); // Hit
-    if (!isdigit(*p++)) {
-      CODE_COVERAGE(399); // Hit
-      return false;
-    } else {
-      CODE_COVERAGE_UNTESTED(400); // Not hit
-    }
+
+  vm->inlineCacheStats.misses++;
+  lpSlot = vm_findPropertySlot(vm, receiver, propertyName, true);
+  if (lpSlot) {
+    CODE_COVERAGE(773); // Not hit
+    vm_inlineCacheFill(vm, entry, site, receiver, propertyName, lpSlot);
+    *out_propertyValue = LongPtr_read2_aligned(lpSlot);
+    return MVM_E_SUCCESS;
   }
-  return true;
+
+  CODE_COVERAGE(774); // Not hit
+  return getProperty(vm, pObjectValue, pPropertyName, out_propertyValue);
 }
 
-// Convert a string to an integer
-TeError strToInt32(mvm_VM* vm, mvm_Value value, int32_t* out_result) {
-  CODE_COVERAGE(404); // Not hit
+/**
+ * Same as `setProperty`, but first consults the inline cache entry for the
+ * instruction at bytecode address `site`. Only existing properties in the
+ * object's own property list are cached, since setting a property never
+ * writes to a prototype.
+ */
+static TeError vm_setPropertyCached(VM* vm, uint16_t site, Value* pObject, Value* pPropertyName, Value* pPropertyValue) {
+  CODE_COVERAGE(775); // Not hit
+  VM_ASSERT_NOT_USING_CACHED_REGISTERS(vm);
+  Value receiver = *pObject;
+  Value propertyName = *pPropertyName;
+  vm_TsInlineCacheEntry* entry = &vm->inlineCache[site & (MVM_INLINE_CACHE_SIZE - 1)];
 
-  TeTypeCode type = deepTypeOf(vm, value);
-  VM_ASSERT(vm, type == TC_REF_STRING || type == TC_REF_INTERNED_STRING);
+  #if MVM_INCREMENTAL_GC
+  // A cached slot doesn't say which allocation it's in, which the write
+  // barrier needs
+  if (vm->pIncrementalGC) {
+    CODE_COVERAGE(980); // Hit
+    return setProperty(vm, pObject, pPropertyName, pPropertyValue);
+  }
+  #endif
 
-  bool isFloat = false;
+  LongPtr lpSlot = vm_inlineCacheLookup(vm, entry, site, receiver, propertyName);
+  if (lpSlot) {
+    CODE_COVERAGE(776); // Not hit
+    vm->inlineCacheStats.hits++;
+    *((Value*)LongPtr_truncate(vm, lpSlot)) = *pPropertyValue;
+    VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
+    return MVM_E_SUCCESS;
+  }
 
-  // Note: this function is implemented to use long pointers to access ROM
-  // memory. This is because the string may be in ROM and we don't want to copy
-  // the string to RAM. Copying to RAM involves allocating the available memory,
-  // which requires that the VM register cache be in a flushed state, which they
-  // aren't necessarily at this point in the code.
+  vm->inlineCacheStats.misses++;
+  // Writable objects are always in RAM
+  if (Value_isShortPtr(receiver)) {
+    CODE_COVERAGE(777); // Not hit
+    lpSlot = vm_findPropertySlot(vm, receiver, propertyName, false);
+    if (lpSlot) {
+      CODE_COVERAGE(778); // Not hit
+      vm_inlineCacheFill(vm, entry, site, receiver, propertyName, lpSlot);
+      *((Value*)LongPtr_truncate(vm, lpSlot)) = *pPropertyValue;
+      VM_EXEC_SAFE_MODE(*pObject = VM_VALUE_NULL);
+      return MVM_E_SUCCESS;
+    }
+  } else {
+    CODE_COVERAGE(779); // Not hit
+  }
 
-  LongPtr start = DynamicPtr_decode_long(vm, value);
-  LongPtr s = start;
-  uint16_t size = vm_getAllocationSize_long(s);
-  uint16_t len = size - 1; // Excluding null terminator
+  return setProperty(vm, pObject, pPropertyName, pPropertyValue);
+}
 
-  // Skip leading whitespace
-  while (isspace(LongPtr_read1(s))) {
-    s = LongPtr_add(s, 1);
+static void vm_invalidateInlineCache(VM* vm) {
+  CODE_COVERAGE(780); // Not hit
+  vm_TsInlineCacheEntry* entry = &vm->inlineCache[0];
+  vm_TsInlineCacheEntry* end = &vm->inlineCache[MVM_INLINE_CACHE_SIZE];
+  for (; entry != end; entry++) {
+    if (entry->site) {
+      vm->inlineCacheStats.invalidations++;
+      entry->site = 0;
+    }
   }
+}
 
-  int sign = (LongPtr_read1(s) == '-') ? -1 : 1;
-  if (LongPtr_read1(s) == '+' || LongPtr_read1(s) == '-') {
-    s = LongPtr_add(s, 1);
+// Adding a property only affects lookups of the same key, since existing
+// property slots don't move until the next GC collection
+static void vm_invalidateInlineCacheForKey(VM* vm, Value key) {
+  CODE_COVERAGE(781); // Not hit
+  vm_TsInlineCacheEntry* entry = &vm->inlineCache[0];
+  vm_TsInlineCacheEntry* end = &vm->inlineCache[MVM_INLINE_CACHE_SIZE];
+  for (; entry != end; entry++) {
+    if (entry->site && (entry->key == key)) {
+      vm->inlineCacheStats.invalidations++;
+      entry->site = 0;
+    }
   }
+}
 
-  // Find end of digits
-  int32_t n = 0;
-  while (isdigit(LongPtr_read1(s))) {
-    int32_t n2 = n * 10 + (LongPtr_read1(s) - '0');
-    s = LongPtr_add(s, 1);
-    // Overflow Int32
-    if (n2 < n) isFloat = true;
-    n = n2;
+void mvm_getInlineCacheStats(VM* vm, mvm_TsInlineCacheStats* r) {
+  CODE_COVERAGE(782); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, r != NULL);
+
+  *r = vm->inlineCacheStats;
+  r->entryCount = MVM_INLINE_CACHE_SIZE;
+  r->entriesUsed = 0;
+  for (uint16_t i = 0; i < MVM_INLINE_CACHE_SIZE; i++) {
+    if (vm->inlineCache[i].site) {
+      r->entriesUsed++;
+    }
   }
+}
+#endif // MVM_INLINE_CACHE
 
-  // Decimal point
-  if ((LongPtr_read1(s) == ',') || (LongPtr_read1(s) == '.')) {
-    CODE_COVERAGE(739); // Not hit
-    isFloat = true;
-    s = LongPtr_add(s, 1);
+#if MVM_CALL_CACHE
+/**
+ * Records the target of a dynamic call in the call-site cache entry for the
+ * call instruction ending at bytecode address `site`, if the callee is a
+ * bytecode function or a closure directly over one. Other callees (host
+ * functions, closures over closures, etc.) leave the entry as it is and always
+ * take the full call path.
+ */
+static void vm_fillCallCache(VM* vm, vm_TsCallCacheEntry* entry, uint16_t site, Value callee) {
+  CODE_COVERAGE(881); // Not hit
+  Value function = callee;
+  TeTypeCode tc = deepTypeOf(vm, callee);
+  if (tc == TC_REF_CLOSURE) {
+    CODE_COVERAGE(882); // Not hit
+    function = READ_FIELD_2(DynamicPtr_decode_long(vm, callee), TsClosure, target);
+    tc = deepTypeOf(vm, function);
+  }
+  if (tc != TC_REF_FUNCTION) {
+    CODE_COVERAGE(883); // Not hit
+    return;
   }
 
-  // Digits after decimal point
-  while (isdigit(LongPtr_read1(s))) s = LongPtr_add(s, 1);
+  VM_ASSERT(vm, DynamicPtr_isRomPtr(vm, function));
+  uint16_t functionOffset = function & 0xFFFE;
+  uint16_t header = LongPtr_read2_aligned(LongPtr_add(vm->lpBytecode, functionOffset - 2));
+  // Continuations are not called through CALL_3, and would need the header of
+  // the containing function
+  if (header & VM_FUNCTION_HEADER_CONTINUATION_FLAG) {
+    CODE_COVERAGE_UNTESTED(884); // Not hit
+    return;
+  }
 
-  // Skip trailing whitespace
-  while (isspace(LongPtr_read1(s))) s = LongPtr_add(s, 1);
+  CODE_COVERAGE(885); // Not hit
+  entry->site = site;
+  entry->callee = callee;
+  entry->function = function;
+  entry->functionOffset = functionOffset;
+  entry->frameSizeWords = (header & VM_FUNCTION_HEADER_STACK_HEIGHT_MASK) + VM_FRAME_BOUNDARY_SAVE_SIZE_WORDS;
+}
 
-  // Check if we reached the end of the string. If we haven't reached the end of
-  // the string then there is a non-digit character in the string.
-  if (LongPtr_sub(s, start) != len) {
-    CODE_COVERAGE(740); // Not hit
-    return MVM_E_NAN;
+static void vm_invalidateCallCache(VM* vm) {
+  CODE_COVERAGE(886); // Not hit
+  vm_TsCallCacheEntry* entry = &vm->callCache[0];
+  vm_TsCallCacheEntry* end = &vm->callCache[MVM_CALL_CACHE_SIZE];
+  for (; entry != end; entry++) {
+    if (entry->site) {
+      vm->callCacheStats.invalidations++;
+      entry->site = 0;
+    }
   }
+}
 
-  // This function cannot handle floating point numbers
-  if (isFloat) {
-    CODE_COVERAGE_UNTESTED(741); // Not hit
-    return MVM_E_FLOAT64;
+void mvm_getCallCacheStats(VM* vm, mvm_TsCallCacheStats* r) {
+  CODE_COVERAGE(887); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, r != NULL);
+
+  *r = vm->callCacheStats;
+  r->entryCount = MVM_CALL_CACHE_SIZE;
+  r->entriesUsed = 0;
+  for (uint16_t i = 0; i < MVM_CALL_CACHE_SIZE; i++) {
+    if (vm->callCache[i].site) {
+      r->entriesUsed++;
+    }
   }
+}
+#endif // MVM_CALL_CACHE
 
-  CODE_COVERAGE(656); // Hit
+#if MVM_UNBOXED_INT32 || MVM_UNBOXED_FLOAT64
+/**
+ * Whether the result of an arithmetic instruction, about to be pushed into
+ * `pResultSlot`, is used only as an operand of a later arithmetic instruction,
+ * so that it doesn't need to be allocated (see SUB_TAIL_PUSH_INT32 and
+ * SUB_NUM_OP_FLOAT64).
+ *
+ * The instructions in between may only push literals, arguments, or variables
+ * below the result, and (for a float64) do NUM_OPs on the values pushed after
+ * the result, as in the first product of `a * 0.3 + b * 0.7`. None of these can
+ * read the result, or throw, so the consuming instruction is guaranteed to be
+ * reached. An int32 result is passed in a single local, so it may only be
+ * followed by one push, and it can also be consumed by a BIT_OP.
+ *
+ * The gas counter may stop the VM in between, but that ends the call and
+ * discards the stack along with the placeholder, so it doesn't matter that the
+ * result is never consumed. Each instruction is still dispatched, so the count
+ * is the same either way.
+ */
+static bool vm_arithmeticResultIsConsumed(VM* vm, LongPtr lpNextInstruction, Value* pResultSlot, bool isInt32) {
+  CODE_COVERAGE(925); // Not hit
+  // A breakpoint callback could inspect the VM before the result is consumed
+  #if MVM_INCLUDE_DEBUG_CAPABILITY
+  if (vm->pBreakpoints) return false;
+  #endif
 
-  *out_result = sign * n;
+  // Number of values on the stack above the result
+  int depth = 0;
+
+  for (int i = 0; i < VM_UNBOXED_LOOKAHEAD; i++) {
+    uint8_t instr = LongPtr_read1(lpNextInstruction);
+    uint8_t index = instr & 0xF;
+
+    switch (instr >> 4) {
+      case VM_OP_NUM_OP:
+      case VM_OP_BIT_OP: {
+        bool isNumOp = (instr >> 4) == VM_OP_NUM_OP;
+        if (!isNumOp && !isInt32) return false;
+        bool isBinary = isNumOp
+          ? (index < VM_NUM_OP_DIVIDER)
+          : (index < VM_BIT_OP_DIVIDER_2);
+        // The result is the only operand, or one of the two
+        if ((depth == 0) || (isBinary && (depth == 1))) return true;
+        // Otherwise it's an operation on values pushed after the result
+        if (isInt32) return false;
+        if (isBinary) depth--;
+        break;
+      }
+      case VM_OP_LOAD_SMALL_LITERAL:
+        if (index >= smallLiteralsSize) return false;
+        depth++;
+        break;
+      case VM_OP_LOAD_ARG_1:
+        depth++;
+        break;
+      case VM_OP_LOAD_VAR_1:
+        // Same indexing as SUB_OP_LOAD_VAR. Only variables below the result
+        // qualify, and a variable in its TDZ throws. The slots of other results
+        // that haven't been allocated also hold VM_VALUE_DELETED.
+        if ((index <= depth) || (pResultSlot[depth - index] == VM_VALUE_DELETED)) return false;
+        depth++;
+        break;
+      case VM_OP_EXTENDED_3:
+        if (index != VM_OP3_LOAD_LITERAL) return false;
+        lpNextInstruction = LongPtr_add(lpNextInstruction, 2);
+        depth++;
+        break;
+      default:
+        return false;
+    }
 
-  return MVM_E_SUCCESS;
+    if (isInt32 && (depth > 1)) return false;
+    lpNextInstruction = LongPtr_add(lpNextInstruction, 1);
+  }
+
+  return false;
 }
+#endif // MVM_UNBOXED_INT32 || MVM_UNBOXED_FLOAT64
 
-TeError toInt32Internal(mvm_VM* vm, mvm_Value value, int32_t* out_result) {
-  CODE_COVERAGE(56); // Hit
-  // TODO: when the type codes are more stable, we should convert these to a table.
-  *out_result = 0;
-  TeTypeCode type = deepTypeOf(vm, value);
-  MVM_SWITCH(type, TC_END - 1) {
-    MVM_CASE(TC_VAL_INT14):
-    MVM_CASE(TC_REF_INT32): {
-      CODE_COVERAGE(401); // Hit
-      *out_result = vm_readInt32(vm, type, value);
-      return MVM_E_SUCCESS;
-    }
-    MVM_CASE(TC_REF_FLOAT64): {
-      CODE_COVERAGE(402); // Hit
-      return MVM_E_FLOAT64;
-    }
-    MVM_CASE(TC_REF_STRING):
-    MVM_CASE(TC_REF_INTERNED_STRING): {
-      CODE_COVERAGE(403); // Not hit
-      return strToInt32(vm, value, out_result);
-    }
-    MVM_CASE(TC_VAL_STR_LENGTH): {
-      CODE_COVERAGE(270); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_VAL_STR_PROTO): {
-      CODE_COVERAGE(271); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_PROPERTY_LIST): {
-      CODE_COVERAGE(405); // Hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_ARRAY): {
-      CODE_COVERAGE_UNTESTED(406); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_FUNCTION): {
-      CODE_COVERAGE(408); // Hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_HOST_FUNC): {
-      CODE_COVERAGE_UNTESTED(409); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_CLOSURE): {
-      CODE_COVERAGE_UNTESTED(410); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_UINT8_ARRAY): {
-      CODE_COVERAGE_UNTESTED(411); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_VIRTUAL): {
-      CODE_COVERAGE_UNTESTED(632); // Not hit
-      VM_RESERVED(vm);
-      return MVM_E_FATAL_ERROR_MUST_KILL_VM;
-    }
-    MVM_CASE(TC_REF_CLASS): {
-      CODE_COVERAGE(633); // Hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_REF_SYMBOL): {
-      CODE_COVERAGE_UNTESTED(412); // Not hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_VAL_UNDEFINED): {
-      CODE_COVERAGE(413); // Hit
-      return MVM_E_NAN;
-    }
-    MVM_CASE(TC_VAL_NULL): {
-      CODE_COVERAGE(414); // Hit
-      break;
-    }
-    MVM_CASE(TC_VAL_TRUE): {
-      CODE_COVERAGE_UNTESTED(415); // Not hit
-      *out_result = 1; break;
-    }
-    MVM_CASE(TC_VAL_FALSE): {
-      CODE_COVERAGE_UNTESTED(416); // Not hit
-      break;
+#if MVM_UNBOXED_INT32
+
+/**
+ * Performs the NUM_OP or BIT_OP with instruction byte `instr` on int32
+ * operands (for a unary operation, `right` is the operand), with the same
+ * result as the general implementation. Comparisons give 0 or 1. Returns false
+ * if the result isn't an int32 or a boolean (e.g. on overflow or division),
+ * which is left to the general implementation.
+ */
+static bool vm_int32Op(uint8_t instr, int32_t left, int32_t right, int32_t* out_result) {
+  CODE_COVERAGE(926); // Not hit
+  switch (instr) {
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_THAN: *out_result = left < right; return true;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_THAN: *out_result = left > right; return true;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_EQUAL: *out_result = left <= right; return true;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_EQUAL: *out_result = left >= right; return true;
+    #if MVM_SUPPORT_FLOAT && MVM_PORT_INT32_OVERFLOW_CHECKS && __has_builtin(__builtin_add_overflow)
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_ADD_NUM: return !__builtin_add_overflow(left, right, out_result);
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_SUBTRACT: return !__builtin_sub_overflow(left, right, out_result);
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_MULTIPLY: return !__builtin_mul_overflow(left, right, out_result);
+    #endif
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_DIVIDE_AND_TRUNC: {
+      if (right == 0) { *out_result = 0; return true; }
+      if ((left == INT32_MIN) && (right == -1)) return false;
+      *out_result = left / right;
+      return true;
     }
-    MVM_CASE(TC_VAL_NAN): {
-      CODE_COVERAGE(417); // Hit
-      return MVM_E_NAN;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_REMAINDER: {
+      if ((right == 0) || (right == -1)) return false;
+      *out_result = left % right;
+      return true;
     }
-    MVM_CASE(TC_VAL_NEG_ZERO): {
-      CODE_COVERAGE(418); // Hit
-      return MVM_E_NEG_ZERO;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_NEGATE: {
+      if ((right == 0) || (right == INT32_MIN)) return false;
+      *out_result = -right;
+      return true;
     }
-    MVM_CASE(TC_VAL_DELETED): {
-      CODE_COVERAGE_UNTESTED(419); // Not hit
-      return MVM_E_NAN;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_UNARY_PLUS: *out_result = right; return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_SHR_ARITHMETIC: *out_result = left >> (right & 0x1F); return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_SHR_LOGICAL: {
+      uint32_t result = (uint32_t)left >> (right & 0x1F);
+      if (result > INT32_MAX) return false;
+      *out_result = (int32_t)result;
+      return true;
     }
-    MVM_CASE(TC_VAL_NO_OP_FUNC): {
-      CODE_COVERAGE(742); // Not hit
-      return MVM_E_NAN;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_SHL: *out_result = (int32_t)((uint32_t)left << (right & 0x1F)); return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_OR: *out_result = left | right; return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_AND: *out_result = left & right; return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_XOR: *out_result = left ^ right; return true;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_NOT: *out_result = ~right; return true;
+    default: return false;
+  }
+}
+
+void mvm_getUnboxedInt32Stats(VM* vm, mvm_TsUnboxedInt32Stats* r) {
+  CODE_COVERAGE(927); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, r != NULL);
+  *r = vm->unboxedInt32Stats;
+}
+#endif // MVM_UNBOXED_INT32
+
+#if MVM_UNBOXED_FLOAT64
+void mvm_getUnboxedFloat64Stats(VM* vm, mvm_TsUnboxedFloat64Stats* r) {
+  CODE_COVERAGE(936); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, r != NULL);
+  *r = vm->unboxedFloat64Stats;
+}
+#endif // MVM_UNBOXED_FLOAT64
+
+#if MVM_JIT
+/*
+ * Baseline JIT (MVM_JIT)
+ *
+ * A function that has become hot is compiled in two passes over its bytecode.
+ * The first follows the control flow from the entry point to find the reachable
+ * instructions and the stack depth at each one. The second emits a fixed
+ * template of x86-64 code for each of those instructions.
+ *
+ * Since the depth at each instruction is known, every stack slot is at a fixed
+ * offset from the frame base, and the native code reads and writes the same
+ * slots that the interpreter would. At an instruction that isn't compiled, or a
+ * case that a template doesn't handle (such as a non-int14 operand), the native
+ * code returns to the interpreter with the bytecode address and stack depth to
+ * continue from, and the interpreter runs that instruction from the start. For
+ * this to work, a template doesn't write anything until its checks have passed.
+ *
+ * Values are never held in machine registers across a call out of the native
+ * code. The helpers that can allocate (vm_jitGetProperty and
+ * vm_jitGetPropertyKey) set the VM's stack pointer to the top of the native
+ * frame, so a GC during the call sees and updates every live slot.
+ *
+ * Register use in the generated code:
+ *
+ *   rbx: frame base (uint16_t*)
+ *   r12: vm
+ *   r13: pArgs
+ *   r14d: argument count
+ *   eax, ecx, edx, esi, edi: scratch
+ *
+ * The native function returns `address | (depth << 16)`, plus
+ * VM_JIT_EXIT_BAILOUT if it stopped anywhere other than at a `return`.
+ */
+
+// Control flow that goes further than this from the entry point leaves the
+// native code
+#define VM_JIT_MAX_FUNCTION_SIZE 1024
+
+#define VM_JIT_EXIT_BAILOUT 0x1000000
+
+// x86 condition codes (the low nibble of Jcc, SETcc and CMOVcc)
+#define VM_JIT_CC_O 0x0
+#define VM_JIT_CC_E 0x4
+#define VM_JIT_CC_NE 0x5
+#define VM_JIT_CC_A 0x7
+#define VM_JIT_CC_L 0xC
+#define VM_JIT_CC_GE 0xD
+#define VM_JIT_CC_LE 0xE
+#define VM_JIT_CC_G 0xF
+#define VM_JIT_CC_ALWAYS 0xFF
+
+// Operand for VM_JIT_OP_BINARY meaning strict equality and inequality, which
+// aren't NUM_OP instructions
+#define VM_JIT_BINARY_EQUAL ((VM_OP_EXTENDED_1 << 4) | VM_OP1_EQUAL)
+#define VM_JIT_BINARY_NOT_EQUAL ((VM_OP_EXTENDED_1 << 4) | VM_OP1_NOT_EQUAL)
+
+typedef uint32_t (*vm_TfJitFunction)(Value* pFrameBase, VM* vm, Value* pArgs, uint32_t argCount);
+
+typedef enum vm_TeJitOp {
+  VM_JIT_OP_EXIT,             // Not compiled. Exits to the interpreter.
+  VM_JIT_OP_RETURN,           // Exits to the interpreter, which returns
+  VM_JIT_OP_LITERAL,          // operand: value
+  VM_JIT_OP_LOAD_VAR,         // operand: index relative to the stack pointer
+  VM_JIT_OP_STORE_VAR,        // operand: index relative to the stack pointer, after the pop
+  VM_JIT_OP_LOAD_ARG,         // operand: argument index
+  VM_JIT_OP_POP,              // operand: count
+  VM_JIT_OP_BINARY,           // operand: NUM_OP or BIT_OP instruction byte, or VM_JIT_BINARY_...
+  VM_JIT_OP_VAR_BINARY,       // operand: as above; left, right: frame slots
+  VM_JIT_OP_VAR_LIT_BINARY,   // operand: as above; left: frame slot; right: int8 literal
+  VM_JIT_OP_BRANCH,           // target
+  VM_JIT_OP_BRANCH_COMPARE,   // operand: vm_TeNumberOp; target
+  VM_JIT_OP_JUMP,             // target
+  VM_JIT_OP_GET_PROPERTY,     // (key on the stack)
+  VM_JIT_OP_GET_PROPERTY_KEY, // operand: key
+} vm_TeJitOp;
+
+typedef struct vm_TsJitInstruction {
+  uint8_t op; // vm_TeJitOp
+  uint8_t size;
+  uint8_t left;
+  uint8_t right;
+  uint16_t operand;
+  uint16_t target; // Bytecode address of the branch or jump target
+} vm_TsJitInstruction;
+
+typedef struct vm_TsJitFixup {
+  uint32_t position; // Offset of a rel32 field in the code buffer
+  uint16_t target; // Bytecode address that it jumps to
+} vm_TsJitFixup;
+
+typedef struct vm_TsJitCompiler {
+  VM* vm;
+  uint16_t entry; // Bytecode address of the function
+  uint16_t span; // Number of bytecode bytes, from `entry`, that are compiled
+  int16_t* depths; // Stack depth at each bytecode address, or -1 if unreached
+  uint32_t* nativeOffsets; // Code buffer offset of each compiled instruction
+  vm_TsJitFixup* fixups;
+  uint16_t fixupCount; // Up to 2 * span
+  uint8_t* pCode; // Start of the code buffer
+  uint32_t codeSize; // Bytes written to the code buffer
+  uint32_t epilogue; // Code buffer offset of the function's epilogue
+  bool full;
+} vm_TsJitCompiler;
+
+static bool vm_jitIsBinaryOp(uint8_t op) {
+  uint8_t n = op & 0xF;
+  switch (op >> 4) {
+    case VM_OP_NUM_OP: return n <= VM_NUM_OP_MULTIPLY;
+    case VM_OP_BIT_OP: return (n == VM_BIT_OP_OR) || (n == VM_BIT_OP_AND) || (n == VM_BIT_OP_XOR);
+    default: return (op == VM_JIT_BINARY_EQUAL) || (op == VM_JIT_BINARY_NOT_EQUAL);
+  }
+}
+
+/**
+ * Decodes the instruction at `address` into the form the JIT compiles, or
+ * VM_JIT_OP_EXIT if it isn't one that the JIT compiles.
+ */
+static void vm_jitDecode(VM* vm, uint16_t address, uint16_t bytecodeSize, vm_TsJitInstruction* out) {
+  LongPtr lp = LongPtr_add(vm->lpBytecode, address);
+  uint16_t available = bytecodeSize - address;
+  uint8_t b = LongPtr_read1(lp);
+  uint8_t n = b & 0xF;
+
+  memset(out, 0, sizeof *out);
+  out->op = VM_JIT_OP_EXIT;
+  out->size = 1;
+
+  switch (b >> 4) {
+    case VM_OP_LOAD_SMALL_LITERAL:
+      if (n < smallLiteralsSize) {
+        out->op = VM_JIT_OP_LITERAL;
+        out->operand = smallLiterals[n];
+      }
+      return;
+    case VM_OP_LOAD_VAR_1: out->op = VM_JIT_OP_LOAD_VAR; out->operand = n; return;
+    case VM_OP_LOAD_ARG_1: out->op = VM_JIT_OP_LOAD_ARG; out->operand = n; return;
+    case VM_OP_STORE_VAR_1: out->op = VM_JIT_OP_STORE_VAR; out->operand = n; return;
+    case VM_OP_NUM_OP:
+    case VM_OP_BIT_OP:
+      if (vm_jitIsBinaryOp(b)) {
+        out->op = VM_JIT_OP_BINARY;
+        out->operand = b;
+      }
+      return;
+    case VM_OP_EXTENDED_1:
+      switch (n) {
+        case VM_OP1_RETURN: out->op = VM_JIT_OP_RETURN; break;
+        case VM_OP1_POP: out->op = VM_JIT_OP_POP; out->operand = 1; break;
+        case VM_OP1_OBJECT_GET_1: out->op = VM_JIT_OP_GET_PROPERTY; break;
+        case VM_OP1_ADD:
+          // The int14 case of `+` is the same as for VM_NUM_OP_ADD_NUM, and
+          // anything else exits
+          out->op = VM_JIT_OP_BINARY;
+          out->operand = (VM_OP_NUM_OP << 4) | VM_NUM_OP_ADD_NUM;
+          break;
+        case VM_OP1_EQUAL:
+        case VM_OP1_NOT_EQUAL:
+          out->op = VM_JIT_OP_BINARY;
+          out->operand = b;
+          break;
+      }
+      return;
+    case VM_OP_EXTENDED_2: {
+      if (available < 2) return;
+      uint8_t x = LongPtr_read1(LongPtr_add(lp, 1));
+      switch (n) {
+        case VM_OP2_BRANCH_1:
+          out->op = VM_JIT_OP_BRANCH;
+          break;
+        case VM_OP2_BRANCH_LESS_THAN_1:
+          out->op = VM_JIT_OP_BRANCH_COMPARE;
+          out->operand = VM_NUM_OP_LESS_THAN;
+          break;
+        case VM_OP2_BRANCH_LESS_EQUAL_1:
+          out->op = VM_JIT_OP_BRANCH_COMPARE;
+          out->operand = VM_NUM_OP_LESS_EQUAL;
+          break;
+        case VM_OP2_JUMP_1: out->op = VM_JIT_OP_JUMP; break;
+        case VM_OP2_LOAD_VAR_2: out->op = VM_JIT_OP_LOAD_VAR; out->operand = x; break;
+        case VM_OP2_STORE_VAR_2: out->op = VM_JIT_OP_STORE_VAR; out->operand = x; break;
+        case VM_OP2_LOAD_ARG_2: out->op = VM_JIT_OP_LOAD_ARG; out->operand = x; break;
+        case VM_OP2_EXTENDED_4:
+          if ((available >= 5) && ((x == VM_OP4_VAR_NUM_OP) || (x == VM_OP4_VAR_LIT_NUM_OP))) {
+            uint8_t op = LongPtr_read1(LongPtr_add(lp, 2));
+            if (vm_jitIsBinaryOp(op) && ((op >> 4) != VM_OP_EXTENDED_1)) {
+              out->op = (x == VM_OP4_VAR_NUM_OP) ? VM_JIT_OP_VAR_BINARY : VM_JIT_OP_VAR_LIT_BINARY;
+              out->size = 5;
+              out->operand = op;
+              out->left = LongPtr_read1(LongPtr_add(lp, 3));
+              out->right = LongPtr_read1(LongPtr_add(lp, 4));
+            }
+          }
+          return;
+        default: return;
+      }
+      out->size = 2;
+      out->target = (uint16_t)(address + 2 + (int8_t)x);
+      return;
+    }
+    case VM_OP_EXTENDED_3: {
+      if (n == VM_OP3_POP_N) {
+        if (available >= 2) {
+          out->op = VM_JIT_OP_POP;
+          out->size = 2;
+          out->operand = LongPtr_read1(LongPtr_add(lp, 1));
+        }
+        return;
+      }
+      if (available < 3) return;
+      uint16_t x = LongPtr_read2_unaligned(LongPtr_add(lp, 1));
+      switch (n) {
+        case VM_OP3_JUMP_2: out->op = VM_JIT_OP_JUMP; break;
+        case VM_OP3_BRANCH_2: out->op = VM_JIT_OP_BRANCH; break;
+        case VM_OP3_LOAD_LITERAL: out->op = VM_JIT_OP_LITERAL; out->operand = x; break;
+        case VM_OP3_OBJECT_GET_2: out->op = VM_JIT_OP_GET_PROPERTY_KEY; out->operand = x; break;
+        default: return;
+      }
+      out->size = 3;
+      out->target = (uint16_t)(address + 3 + (int16_t)x);
+      return;
     }
-    default:
-      VM_ASSERT_UNREACHABLE(vm);
+    default: return;
   }
-  return MVM_E_SUCCESS;
 }
 
-int32_t mvm_toInt32(mvm_VM* vm, mvm_Value value) {
-  CODE_COVERAGE(57); // Hit
-  int32_t result;
-  TeError err = toInt32Internal(vm, value, &result);
-  if (err == MVM_E_SUCCESS) {
-    CODE_COVERAGE(420); // Hit
-    return result;
-  } else if (err == MVM_E_NAN) {
-    CODE_COVERAGE(421); // Hit
-    return 0;
-  } else if (err == MVM_E_NEG_ZERO) {
-    CODE_COVERAGE_UNTESTED(422); // Not hit
-    return 0;
-  } else {
-    CODE_COVERAGE_UNTESTED(423); // Not hit
+static void vm_jitEmitBytes(vm_TsJitCompiler* c, const uint8_t* bytes, uint8_t count) {
+  if (c->full || (c->codeSize + count > MVM_JIT_CODE_SIZE)) {
+    c->full = true;
+    return;
   }
+  memcpy(c->pCode + c->codeSize, bytes, count);
+  c->codeSize += count;
+}
 
-  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_FLOAT64);
-  #if MVM_SUPPORT_FLOAT
-    return (int32_t)mvm_toFloat64(vm, value);
-  #else // !MVM_SUPPORT_FLOAT
-    // If things were compiled correctly, there shouldn't be any floats in the
-    // system at all
-    return 0;
-  #endif
+static void vm_jitEmit1(vm_TsJitCompiler* c, uint8_t b) {
+  vm_jitEmitBytes(c, &b, 1);
 }
 
-#if MVM_SUPPORT_FLOAT
-MVM_FLOAT64 mvm_toFloat64(mvm_VM* vm, mvm_Value value) {
-  CODE_COVERAGE(58); // Hit
-  int32_t result;
-  TeError err = toInt32Internal(vm, value, &result);
-  if (err == MVM_E_SUCCESS) {
-    CODE_COVERAGE(424); // Hit
-    return result;
-  } else if (err == MVM_E_NAN) {
-    CODE_COVERAGE(425); // Hit
-    return MVM_FLOAT64_NAN;
-  } else if (err == MVM_E_NEG_ZERO) {
-    CODE_COVERAGE(426); // Hit
-    return MVM_FLOAT_NEG_ZERO;
+static void vm_jitEmit4(vm_TsJitCompiler* c, uint32_t x) {
+  uint8_t bytes[4] = { (uint8_t)x, (uint8_t)(x >> 8), (uint8_t)(x >> 16), (uint8_t)(x >> 24) };
+  vm_jitEmitBytes(c, bytes, 4);
+}
+
+// ModRM (and displacement) for operand `[rbx + slot * 2]`
+static void vm_jitEmitSlot(vm_TsJitCompiler* c, uint8_t reg, uint16_t slot) {
+  uint32_t disp = slot * 2;
+  if (disp < 0x80) {
+    vm_jitEmit1(c, 0x40 | (reg << 3) | 3);
+    vm_jitEmit1(c, (uint8_t)disp);
   } else {
-    CODE_COVERAGE(427); // Hit
+    vm_jitEmit1(c, 0x80 | (reg << 3) | 3);
+    vm_jitEmit4(c, disp);
   }
+}
 
-  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_FLOAT64);
-  LongPtr lpFloat = DynamicPtr_decode_long(vm, value);
-  MVM_FLOAT64 f;
-  memcpy_long(&f, lpFloat, sizeof f);
-  return f;
+// movzx reg, word [slot]
+static void vm_jitEmitLoadSlot(vm_TsJitCompiler* c, uint8_t reg, uint16_t slot) {
+  static const uint8_t movzx[] = { 0x0F, 0xB7 };
+  vm_jitEmitBytes(c, movzx, 2);
+  vm_jitEmitSlot(c, reg, slot);
 }
-#endif // MVM_SUPPORT_FLOAT
 
-// See implementation of mvm_equal for the meaning of each
-typedef enum TeEqualityAlgorithm {
-  EA_NONE,
-  EA_COMPARE_PTR_VALUE_AND_TYPE,
-  EA_COMPARE_NON_PTR_TYPE,
-  EA_COMPARE_REFERENCE,
-  EA_NOT_EQUAL,
-  EA_COMPARE_STRING,
-} TeEqualityAlgorithm;
+// movsx reg, word [slot]
+static void vm_jitEmitLoadSlotSigned(vm_TsJitCompiler* c, uint8_t reg, uint16_t slot) {
+  static const uint8_t movsx[] = { 0x0F, 0xBF };
+  vm_jitEmitBytes(c, movsx, 2);
+  vm_jitEmitSlot(c, reg, slot);
+}
 
-static const TeEqualityAlgorithm equalityAlgorithmByTypeCode[TC_END] = {
-  EA_NONE,                       // TC_REF_TOMBSTONE          = 0x0
-  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_INT32              = 0x1
-  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_FLOAT64            = 0x2
-  EA_COMPARE_STRING,             // TC_REF_STRING             = 0x3
-  EA_COMPARE_STRING,             // TC_REF_INTERNED_STRING    = 0x4
-  EA_COMPARE_REFERENCE,          // TC_REF_FUNCTION           = 0x5
-  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_HOST_FUNC          = 0x6
-  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_BIG_INT            = 0x7
-  EA_COMPARE_REFERENCE,          // TC_REF_SYMBOL             = 0x8
-  EA_NONE,                       // TC_REF_CLASS              = 0x9
-  EA_NONE,                       // TC_REF_VIRTUAL            = 0xA
-  EA_NONE,                       // TC_REF_RESERVED_1         = 0xB
-  EA_COMPARE_REFERENCE,          // TC_REF_PROPERTY_LIST      = 0xC
-  EA_COMPARE_REFERENCE,          // TC_REF_ARRAY              = 0xD
-  EA_COMPARE_REFERENCE,          // TC_REF_FIXED_LENGTH_ARRAY = 0xE
-  EA_COMPARE_REFERENCE,          // TC_REF_CLOSURE            = 0xF
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_INT14              = 0x10
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_UNDEFINED          = 0x11
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NULL               = 0x12
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_TRUE               = 0x13
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_FALSE              = 0x14
-  EA_NOT_EQUAL,                  // TC_VAL_NAN                = 0x15
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NEG_ZERO           = 0x16
-  EA_NONE,                       // TC_VAL_DELETED            = 0x17
-  EA_COMPARE_STRING,             // TC_VAL_STR_LENGTH         = 0x18
-  EA_COMPARE_STRING,             // TC_VAL_STR_PROTO          = 0x19
-  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NO_OP_FUNC         = 0x1A
-};
+// mov word [slot], ax
+static void vm_jitEmitStoreSlot(vm_TsJitCompiler* c, uint16_t slot) {
+  static const uint8_t mov[] = { 0x66, 0x89 };
+  vm_jitEmitBytes(c, mov, 2);
+  vm_jitEmitSlot(c, 0, slot);
+}
 
-bool mvm_equal(mvm_VM* vm, mvm_Value a, mvm_Value b) {
-  CODE_COVERAGE(462); // Hit
-  VM_ASSERT_NOT_USING_CACHED_REGISTERS(vm);
+// Returns to the interpreter
+static void vm_jitEmitExit(vm_TsJitCompiler* c, uint32_t exitWord) {
+  vm_jitEmit1(c, 0xB8); // mov eax, exit point
+  vm_jitEmit4(c, exitWord);
+  vm_jitEmit1(c, 0xE9); // jmp epilogue
+  vm_jitEmit4(c, c->epilogue - (c->codeSize + 4));
+}
 
-  TeTypeCode aType = deepTypeOf(vm, a);
-  TeTypeCode bType = deepTypeOf(vm, b);
-  TeEqualityAlgorithm algorithmA = equalityAlgorithmByTypeCode[aType];
-  TeEqualityAlgorithm algorithmB = equalityAlgorithmByTypeCode[bType];
+// Emits a Jcc rel8 with the target left for vm_jitPatchJump8, and returns its
+// position
+static uint32_t vm_jitEmitJump8(vm_TsJitCompiler* c, uint8_t cc) {
+  vm_jitEmit1(c, 0x70 | cc);
+  vm_jitEmit1(c, 0);
+  return c->codeSize;
+}
 
-  TABLE_COVERAGE(algorithmA, 6, 556); // Hit 4/6
-  TABLE_COVERAGE(algorithmB, 6, 557); // Hit 4/6
-  TABLE_COVERAGE(aType, TC_END, 558); // Hit 7/27
-  TABLE_COVERAGE(bType, TC_END, 559); // Hit 9/27
+// Points the rel8 jump emitted at `position` to the current position
+static void vm_jitPatchJump8(vm_TsJitCompiler* c, uint32_t position) {
+  if (c->full) return;
+  VM_ASSERT(c->vm, c->codeSize - position < 0x80);
+  c->pCode[position - 1] = (uint8_t)(c->codeSize - position);
+}
 
-  // If the values aren't even in the same class of comparison, they're not
-  // equal. In particular, strings will not be equal to non-strings.
-  if (algorithmA != algorithmB) {
-    CODE_COVERAGE(560); // Hit
-    return false;
-  } else {
-    CODE_COVERAGE(561); // Hit
-  }
+static void vm_jitEmitExitIf(vm_TsJitCompiler* c, uint8_t cc, uint32_t exitWord) {
+  uint32_t skip = vm_jitEmitJump8(c, cc ^ 1);
+  vm_jitEmitExit(c, exitWord);
+  vm_jitPatchJump8(c, skip);
+}
 
-  if (algorithmA == EA_NOT_EQUAL) {
-    CODE_COVERAGE(562); // Hit
-    return false; // E.g. comparing NaN
+/**
+ * Jumps to the native code for the bytecode at `target` if `cc` holds (or
+ * always, for VM_JIT_CC_ALWAYS). If the target is outside the compiled span,
+ * this exits to the interpreter at the target instead.
+ */
+static void vm_jitEmitJumpTo(vm_TsJitCompiler* c, uint8_t cc, uint16_t target, uint8_t depth) {
+  if ((uint16_t)(target - c->entry) >= c->span) {
+    uint32_t skip = 0;
+    if (cc != VM_JIT_CC_ALWAYS) skip = vm_jitEmitJump8(c, cc ^ 1);
+    vm_jitEmitExit(c, target | ((uint32_t)depth << 16) | VM_JIT_EXIT_BAILOUT);
+    if (cc != VM_JIT_CC_ALWAYS) vm_jitPatchJump8(c, skip);
+    return;
+  }
+  if (cc == VM_JIT_CC_ALWAYS) {
+    vm_jitEmit1(c, 0xE9);
   } else {
-    CODE_COVERAGE(563); // Hit
+    vm_jitEmit1(c, 0x0F);
+    vm_jitEmit1(c, 0x80 | cc);
   }
+  // A conditional branch has up to 4 fixups (including the jump to it if it's
+  // out of line), so there are at most 2 per bytecode byte
+  VM_ASSERT(c->vm, c->fixupCount < 2 * c->span);
+  c->fixups[c->fixupCount].position = c->codeSize;
+  c->fixups[c->fixupCount].target = target;
+  c->fixupCount++;
+  vm_jitEmit4(c, 0);
+}
 
-  if (a == b) {
-    CODE_COVERAGE(564); // Hit
-    return true;
-  } else {
-    CODE_COVERAGE(565); // Hit
+// mov rax, helper; call rax
+static void vm_jitEmitCall(vm_TsJitCompiler* c, void* helper) {
+  uint64_t address = (uint64_t)(uintptr_t)helper;
+  vm_jitEmit1(c, 0x48);
+  vm_jitEmit1(c, 0xB8);
+  vm_jitEmit4(c, (uint32_t)address);
+  vm_jitEmit4(c, (uint32_t)(address >> 32));
+  vm_jitEmit1(c, 0xFF);
+  vm_jitEmit1(c, 0xD0);
+}
+
+/**
+ * Exits unless eax (and ecx, if `both`) hold int14 values
+ */
+static void vm_jitEmitInt14Check(vm_TsJitCompiler* c, bool both, uint32_t exitWord) {
+  static const uint8_t movEdxEax[] = { 0x89, 0xC2 };
+  static const uint8_t andEdxEcx[] = { 0x21, 0xCA };
+  static const uint8_t andEdx3[] = { 0x83, 0xE2, 0x03 };
+  static const uint8_t cmpEdx3[] = { 0x83, 0xFA, 0x03 };
+  vm_jitEmitBytes(c, movEdxEax, sizeof movEdxEax);
+  if (both) vm_jitEmitBytes(c, andEdxEcx, sizeof andEdxEcx);
+  vm_jitEmitBytes(c, andEdx3, sizeof andEdx3);
+  vm_jitEmitBytes(c, cmpEdx3, sizeof cmpEdx3);
+  vm_jitEmitExitIf(c, VM_JIT_CC_NE, exitWord);
+}
+
+/**
+ * Computes the binary operation `op` (see VM_JIT_OP_BINARY) on the int14
+ * values in eax and ecx (sign-extended), leaving the result in ax. Exits if the
+ * result doesn't fit in an int14.
+ */
+static void vm_jitEmitInt14Op(vm_TsJitCompiler* c, uint8_t op, uint32_t exitWord) {
+  static const uint8_t cmpEaxEcx[] = { 0x39, 0xC8 };
+  static const uint8_t sarEaxEcx2[] = { 0xC1, 0xF8, 0x02, 0xC1, 0xF9, 0x02 };
+  static const uint8_t addEaxEcx[] = { 0x01, 0xC8 };
+  static const uint8_t subEaxEcx[] = { 0x29, 0xC8 };
+  static const uint8_t imulEaxEcx[] = { 0x0F, 0xAF, 0xC1 };
+  static const uint8_t orEaxEcx[] = { 0x09, 0xC8 };
+  static const uint8_t andEaxEcx[] = { 0x21, 0xC8 };
+  static const uint8_t xorEaxEcx[] = { 0x31, 0xC8 };
+  static const uint8_t orEax3[] = { 0x83, 0xC8, 0x03 };
+  // lea edx, [rax + 0x2000]; cmp edx, 0x3FFF
+  static const uint8_t rangeCheck[] = { 0x8D, 0x90, 0x00, 0x20, 0x00, 0x00, 0x81, 0xFA, 0xFF, 0x3F, 0x00, 0x00 };
+  // lea eax, [rax * 4 + 3]
+  static const uint8_t encode[] = { 0x8D, 0x04, 0x85, 0x03, 0x00, 0x00, 0x00 };
+
+  uint8_t cc;
+  switch (op) {
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_THAN: cc = VM_JIT_CC_L; goto SUB_COMPARE;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_THAN: cc = VM_JIT_CC_G; goto SUB_COMPARE;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_LESS_EQUAL: cc = VM_JIT_CC_LE; goto SUB_COMPARE;
+    case (VM_OP_NUM_OP << 4) | VM_NUM_OP_GREATER_EQUAL: cc = VM_JIT_CC_GE; goto SUB_COMPARE;
+    case VM_JIT_BINARY_EQUAL: cc = VM_JIT_CC_E; goto SUB_COMPARE;
+    case VM_JIT_BINARY_NOT_EQUAL: cc = VM_JIT_CC_NE; goto SUB_COMPARE;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_OR: vm_jitEmitBytes(c, orEaxEcx, sizeof orEaxEcx); goto SUB_BITWISE;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_AND: vm_jitEmitBytes(c, andEaxEcx, sizeof andEaxEcx); goto SUB_BITWISE;
+    case (VM_OP_BIT_OP << 4) | VM_BIT_OP_XOR: vm_jitEmitBytes(c, xorEaxEcx, sizeof xorEaxEcx); goto SUB_BITWISE;
+    default: break;
+  }
+
+  // Arithmetic on the decoded values. The result of any of these is well
+  // within int32, so only the int14 range needs to be checked.
+  vm_jitEmitBytes(c, sarEaxEcx2, sizeof sarEaxEcx2);
+  switch (op & 0xF) {
+    case VM_NUM_OP_ADD_NUM: vm_jitEmitBytes(c, addEaxEcx, sizeof addEaxEcx); break;
+    case VM_NUM_OP_SUBTRACT: vm_jitEmitBytes(c, subEaxEcx, sizeof subEaxEcx); break;
+    default:
+      VM_ASSERT(c->vm, (op & 0xF) == VM_NUM_OP_MULTIPLY);
+      vm_jitEmitBytes(c, imulEaxEcx, sizeof imulEaxEcx);
+      break;
   }
+  vm_jitEmitBytes(c, rangeCheck, sizeof rangeCheck);
+  vm_jitEmitExitIf(c, VM_JIT_CC_A, exitWord);
+  vm_jitEmitBytes(c, encode, sizeof encode);
+  return;
+
+SUB_BITWISE:
+  // The bitwise operations work directly on the encoded values, apart from the
+  // tag bits of XOR
+  vm_jitEmitBytes(c, orEax3, sizeof orEax3);
+  return;
+
+SUB_COMPARE:
+  // The encoding preserves the order of int14 values
+  vm_jitEmitBytes(c, cmpEaxEcx, sizeof cmpEaxEcx);
+  vm_jitEmit1(c, 0xB8); // mov eax, false
+  vm_jitEmit4(c, VM_VALUE_FALSE);
+  vm_jitEmit1(c, 0xBA); // mov edx, true
+  vm_jitEmit4(c, VM_VALUE_TRUE);
+  vm_jitEmit1(c, 0x0F); // cmovcc eax, edx
+  vm_jitEmit1(c, 0x40 | cc);
+  vm_jitEmit1(c, 0xC2);
+}
+
+static TeError vm_jitGetProperty(VM* vm, Value* pStackPointer) {
+  CODE_COVERAGE(898); // Not hit
+  // The GC needs to see the native frame
+  vm->stack->reg.pStackPointer = pStackPointer;
+  return getProperty(vm, pStackPointer - 2, pStackPointer - 1, pStackPointer - 2);
+}
+
+static TeError vm_jitGetPropertyKey(VM* vm, Value* pStackPointer, Value key, uint16_t site) {
+  CODE_COVERAGE(899); // Not hit
+  vm->stack->reg.pStackPointer = pStackPointer;
+  #if MVM_INLINE_CACHE
+  return vm_getPropertyCached(vm, site, pStackPointer - 1, &key, pStackPointer - 1);
+  #else
+  (void)site;
+  return getProperty(vm, pStackPointer - 1, &key, pStackPointer - 1);
+  #endif
+}
 
-  switch (algorithmA) {
-    case EA_COMPARE_REFERENCE: {
-      // Reference equality comparison assumes that two values with different
-      // locations in memory must be different values, since their identity is
-      // their address. Since we've already checked `a == b`, this must be false.
-      return false;
+static void vm_jitEmitInstruction(vm_TsJitCompiler* c, uint16_t address, vm_TsJitInstruction* instr, uint8_t depth) {
+  static const uint8_t movRdiR12[] = { 0x4C, 0x89, 0xE7 };
+  static const uint8_t testEaxEax[] = { 0x85, 0xC0 };
+  uint32_t exitWord = address | ((uint32_t)depth << 16) | VM_JIT_EXIT_BAILOUT;
+
+  switch (instr->op) {
+    case VM_JIT_OP_RETURN:
+      // The interpreter does the return, since it needs to restore the
+      // caller's frame
+      vm_jitEmitExit(c, exitWord & ~VM_JIT_EXIT_BAILOUT);
+      break;
+
+    case VM_JIT_OP_LITERAL:
+      vm_jitEmit1(c, 0x66); // mov word [slot], literal
+      vm_jitEmit1(c, 0xC7);
+      vm_jitEmitSlot(c, 0, depth);
+      vm_jitEmit1(c, (uint8_t)instr->operand);
+      vm_jitEmit1(c, (uint8_t)(instr->operand >> 8));
+      break;
+
+    case VM_JIT_OP_LOAD_VAR:
+      vm_jitEmitLoadSlot(c, 0, depth - instr->operand - 1);
+      vm_jitEmit1(c, 0x3D); // cmp eax, deleted
+      vm_jitEmit4(c, VM_VALUE_DELETED);
+      // The interpreter throws the TDZ error
+      vm_jitEmitExitIf(c, VM_JIT_CC_E, exitWord);
+      vm_jitEmitStoreSlot(c, depth);
+      break;
+
+    case VM_JIT_OP_STORE_VAR:
+      vm_jitEmitLoadSlot(c, 0, depth - 1);
+      vm_jitEmitStoreSlot(c, depth - 1 - instr->operand - 1);
+      break;
+
+    case VM_JIT_OP_LOAD_ARG: {
+      static const uint8_t cmpR14d[] = { 0x41, 0x81, 0xFE };
+      static const uint8_t movzxR13[] = { 0x41, 0x0F, 0xB7, 0x85 };
+      vm_jitEmit1(c, 0xB8); // mov eax, undefined
+      vm_jitEmit4(c, VM_VALUE_UNDEFINED);
+      vm_jitEmitBytes(c, cmpR14d, sizeof cmpR14d); // cmp r14d, index
+      vm_jitEmit4(c, instr->operand);
+      uint32_t skip = vm_jitEmitJump8(c, 0x6); // jbe
+      vm_jitEmitBytes(c, movzxR13, sizeof movzxR13); // movzx eax, word [r13 + index * 2]
+      vm_jitEmit4(c, instr->operand * 2);
+      vm_jitPatchJump8(c, skip);
+      vm_jitEmitStoreSlot(c, depth);
+      break;
     }
-    case EA_COMPARE_NON_PTR_TYPE: {
-      // Non-pointer types are those like Int14 and the well-known values
-      // (except NaN). These can just be compared with `a == b`, which we've
-      // already done.
-      return false;
+
+    case VM_JIT_OP_POP:
+      break;
+
+    case VM_JIT_OP_BINARY:
+      vm_jitEmitLoadSlotSigned(c, 0, depth - 2);
+      vm_jitEmitLoadSlotSigned(c, 1, depth - 1);
+      vm_jitEmitInt14Check(c, true, exitWord);
+      vm_jitEmitInt14Op(c, (uint8_t)instr->operand, exitWord);
+      vm_jitEmitStoreSlot(c, depth - 2);
+      break;
+
+    case VM_JIT_OP_VAR_BINARY:
+      // The frame slots are read without the TDZ check, but a deleted value
+      // isn't an int14 so it exits
+      vm_jitEmitLoadSlotSigned(c, 0, instr->left);
+      vm_jitEmitLoadSlotSigned(c, 1, instr->right);
+      vm_jitEmitInt14Check(c, true, exitWord);
+      vm_jitEmitInt14Op(c, (uint8_t)instr->operand, exitWord);
+      vm_jitEmitStoreSlot(c, depth);
+      break;
+
+    case VM_JIT_OP_VAR_LIT_BINARY:
+      vm_jitEmitLoadSlotSigned(c, 0, instr->left);
+      vm_jitEmit1(c, 0xB9); // mov ecx, literal
+      vm_jitEmit4(c, (uint32_t)(int32_t)(int16_t)VIRTUAL_INT14_ENCODE((int8_t)instr->right));
+      vm_jitEmitInt14Check(c, false, exitWord);
+      vm_jitEmitInt14Op(c, (uint8_t)instr->operand, exitWord);
+      vm_jitEmitStoreSlot(c, depth);
+      break;
+
+    case VM_JIT_OP_BRANCH: {
+      static const uint8_t cmpEsi[] = { 0x81, 0xFE };
+      static const uint8_t movEaxEsi[] = { 0x89, 0xF0 };
+      static const uint8_t andEax3[] = { 0x83, 0xE0, 0x03 };
+      static const uint8_t cmpEax3[] = { 0x83, 0xF8, 0x03 };
+      static const uint8_t testAlAl[] = { 0x84, 0xC0 };
+      vm_jitEmitLoadSlot(c, 6, depth - 1);
+      vm_jitEmitBytes(c, cmpEsi, sizeof cmpEsi);
+      vm_jitEmit4(c, VM_VALUE_TRUE);
+      vm_jitEmitJumpTo(c, VM_JIT_CC_E, instr->target, depth - 1);
+      vm_jitEmitBytes(c, cmpEsi, sizeof cmpEsi);
+      vm_jitEmit4(c, VM_VALUE_FALSE);
+      uint32_t skipFalse = vm_jitEmitJump8(c, VM_JIT_CC_E);
+      vm_jitEmitBytes(c, cmpEsi, sizeof cmpEsi);
+      vm_jitEmit4(c, VIRTUAL_INT14_ENCODE(0));
+      uint32_t skipZero = vm_jitEmitJump8(c, VM_JIT_CC_E);
+      vm_jitEmitBytes(c, movEaxEsi, sizeof movEaxEsi);
+      vm_jitEmitBytes(c, andEax3, sizeof andEax3);
+      vm_jitEmitBytes(c, cmpEax3, sizeof cmpEax3);
+      vm_jitEmitJumpTo(c, VM_JIT_CC_E, instr->target, depth - 1);
+      // Anything else is tested by mvm_toBool, which doesn't allocate
+      vm_jitEmitBytes(c, movRdiR12, sizeof movRdiR12);
+      vm_jitEmitCall(c, (void*)&mvm_toBool);
+      vm_jitEmitBytes(c, testAlAl, sizeof testAlAl);
+      vm_jitEmitJumpTo(c, VM_JIT_CC_NE, instr->target, depth - 1);
+      vm_jitPatchJump8(c, skipFalse);
+      vm_jitPatchJump8(c, skipZero);
+      break;
     }
 
-    case EA_COMPARE_STRING: {
-      // Strings are a pain to compare because there are edge cases like the
-      // fact that the string "length" _may_ be represented by
-      // VM_VALUE_STR_LENGTH rather than a pointer to a string (or it may be a
-      // TC_REF_STRING). To keep the code concise, I'm fetching a pointer to the
-      // string data itself and then comparing that. This is the only equality
-      // algorithm that doesn't check the type. It makes use of the check for
-      // `algorithmA != algorithmB` from earlier and the fact that only strings
-      // compare with this algorithm, which means we won't get to this point
-      // unless both `a` and `b` are strings.
-      if (a == b) {
-        CODE_COVERAGE_UNTESTED(566); // Not hit
-        return true;
+    case VM_JIT_OP_BRANCH_COMPARE:
+      vm_jitEmitLoadSlotSigned(c, 0, depth - 2);
+      vm_jitEmitLoadSlotSigned(c, 1, depth - 1);
+      vm_jitEmitInt14Check(c, true, exitWord);
+      vm_jitEmit1(c, 0x39); // cmp eax, ecx
+      vm_jitEmit1(c, 0xC8);
+      vm_jitEmitJumpTo(c, instr->operand == VM_NUM_OP_LESS_THAN ? VM_JIT_CC_L : VM_JIT_CC_LE, instr->target, depth - 2);
+      break;
+
+    case VM_JIT_OP_JUMP:
+      vm_jitEmitJumpTo(c, VM_JIT_CC_ALWAYS, instr->target, depth);
+      break;
+
+    case VM_JIT_OP_GET_PROPERTY:
+    case VM_JIT_OP_GET_PROPERTY_KEY: {
+      static const uint8_t leaRsi[] = { 0x48, 0x8D, 0xB3 };
+      vm_jitEmitBytes(c, movRdiR12, sizeof movRdiR12);
+      vm_jitEmitBytes(c, leaRsi, sizeof leaRsi); // lea rsi, [rbx + depth * 2]
+      vm_jitEmit4(c, depth * 2);
+      if (instr->op == VM_JIT_OP_GET_PROPERTY) {
+        vm_jitEmitCall(c, (void*)&vm_jitGetProperty);
       } else {
-        CODE_COVERAGE(567); // Hit
+        vm_jitEmit1(c, 0xBA); // mov edx, key
+        vm_jitEmit4(c, instr->operand);
+        vm_jitEmit1(c, 0xB9); // mov ecx, site
+        vm_jitEmit4(c, (uint16_t)(address + instr->size));
+        vm_jitEmitCall(c, (void*)&vm_jitGetPropertyKey);
       }
-      size_t sizeA;
-      size_t sizeB;
-      LongPtr lpStrA = vm_toStringUtf8_long(vm, a, &sizeA);
-      LongPtr lpStrB = vm_toStringUtf8_long(vm, b, &sizeB);
-      bool result = (sizeA == sizeB) && (memcmp_long(lpStrA, lpStrB, (uint16_t)sizeA) == 0);
-      TABLE_COVERAGE(result ? 1 : 0, 2, 568); // Hit 2/2
-      return result;
+      vm_jitEmitBytes(c, testEaxEax, sizeof testEaxEax);
+      // Nothing has been written to the frame if the property read failed, so
+      // the interpreter reads the property again and reports the error
+      vm_jitEmitExitIf(c, VM_JIT_CC_NE, exitWord);
+      break;
     }
 
-    /*
-    Compares two values that are both pointer values that point to non-reference
-    types (e.g. int32). These will be equal if the value pointed to has the same
-    type, the same size, and the raw data pointed to is the same.
-    */
-    case EA_COMPARE_PTR_VALUE_AND_TYPE: {
-      CODE_COVERAGE_UNTESTED(475); // Not hit
+    default:
+      VM_ASSERT(c->vm, instr->op == VM_JIT_OP_EXIT);
+      vm_jitEmitExit(c, exitWord);
+      break;
+  }
+}
 
-      if (a == b) {
-        CODE_COVERAGE_UNTESTED(569); // Not hit
-        return true;
+/**
+ * The stack depth after the instruction, or -1 if the instruction isn't valid
+ * at the given depth (in which case the function isn't compiled).
+ */
+static int16_t vm_jitDepthAfter(vm_TsJitInstruction* instr, int16_t depth) {
+  switch (instr->op) {
+    case VM_JIT_OP_LITERAL:
+    case VM_JIT_OP_LOAD_ARG:
+      return depth + 1;
+    case VM_JIT_OP_LOAD_VAR:
+      return (instr->operand < depth) ? depth + 1 : -1;
+    case VM_JIT_OP_STORE_VAR:
+      return (instr->operand + 1 < depth) ? depth - 1 : -1;
+    case VM_JIT_OP_POP:
+      return depth - instr->operand;
+    case VM_JIT_OP_BINARY:
+    case VM_JIT_OP_GET_PROPERTY:
+      return (depth >= 2) ? depth - 1 : -1;
+    case VM_JIT_OP_VAR_BINARY:
+      return (instr->left < depth) && (instr->right < depth) ? depth + 1 : -1;
+    case VM_JIT_OP_VAR_LIT_BINARY:
+      return (instr->left < depth) ? depth + 1 : -1;
+    case VM_JIT_OP_BRANCH:
+      return depth - 1;
+    case VM_JIT_OP_BRANCH_COMPARE:
+      return depth - 2;
+    case VM_JIT_OP_GET_PROPERTY_KEY:
+      return (depth >= 1) ? depth : -1;
+    default:
+      return depth;
+  }
+}
+
+/**
+ * Compiles the bytecode function at `address`, returning the offset of its
+ * entry point in the code buffer, or VM_JIT_FAILED.
+ */
+static uint32_t vm_jitCompile(VM* vm, uint16_t address) {
+  static const uint8_t epilogue[] = {
+    0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, // pop r15, r14, r13, r12, rbx
+    0xC3, // ret
+  };
+  static const uint8_t prologue[] = {
+    // The 5 pushes also align the stack for calls to helpers
+    0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, // push rbx, r12, r13, r14, r15
+    0x48, 0x89, 0xFB, // mov rbx, rdi
+    0x49, 0x89, 0xF4, // mov r12, rsi
+    0x49, 0x89, 0xD5, // mov r13, rdx
+    0x41, 0x89, 0xCE, // mov r14d, ecx
+  };
+
+  vm_TsJitCompiler c;
+  vm_TsJitInstruction instr;
+  uint16_t* worklist;
+  uint16_t worklistCount = 0;
+  uint32_t result = VM_JIT_FAILED;
+  uint16_t bytecodeSize = LongPtr_read2_aligned(LongPtr_add(vm->lpBytecode, OFFSETOF(mvm_TsBytecodeHeader, bytecodeSize)));
+  uint16_t header = LongPtr_read2_aligned(LongPtr_add(vm->lpBytecode, address - 2));
+  uint8_t maxDepth = header & VM_FUNCTION_HEADER_STACK_HEIGHT_MASK;
+
+  CODE_COVERAGE(900); // Not hit
+
+  // A continuation resumes partway through the frame of the containing
+  // function, which isn't at depth 0
+  if ((header & VM_FUNCTION_HEADER_CONTINUATION_FLAG) || (address >= bytecodeSize)) {
+    CODE_COVERAGE_UNTESTED(901); // Not hit
+    return VM_JIT_FAILED;
+  }
+
+  memset(&c, 0, sizeof c);
+  c.vm = vm;
+  c.entry = address;
+  c.span = bytecodeSize - address;
+  if (c.span > VM_JIT_MAX_FUNCTION_SIZE) c.span = VM_JIT_MAX_FUNCTION_SIZE;
+
+  // One allocation for the per-byte tables
+  uint8_t* pTables = vm_malloc(vm, (size_t)c.span * (sizeof *c.depths + sizeof *c.nativeOffsets + 2 * sizeof *c.fixups + sizeof *worklist));
+  if (!pTables) return VM_JIT_FAILED;
+  c.nativeOffsets = (uint32_t*)pTables;
+  c.fixups = (vm_TsJitFixup*)(c.nativeOffsets + c.span);
+  c.depths = (int16_t*)(c.fixups + 2 * c.span);
+  worklist = (uint16_t*)(c.depths + c.span);
+  for (uint16_t i = 0; i < c.span; i++) c.depths[i] = -1;
+
+  // Pass 1: reachable instructions and the stack depth at each
+  c.depths[0] = 0;
+  worklist[worklistCount++] = address;
+  while (worklistCount) {
+    uint16_t a = worklist[--worklistCount];
+    int16_t depth = c.depths[a - address];
+    vm_jitDecode(vm, a, bytecodeSize, &instr);
+    int16_t after = vm_jitDepthAfter(&instr, depth);
+    if ((after < 0) || (after > maxDepth)) goto SUB_EXIT;
+
+    for (uint8_t i = 0; i < 2; i++) {
+      uint16_t next;
+      if (i == 0) {
+        if ((instr.op == VM_JIT_OP_EXIT) || (instr.op == VM_JIT_OP_RETURN) || (instr.op == VM_JIT_OP_JUMP)) continue;
+        next = a + instr.size;
       } else {
-        CODE_COVERAGE_UNTESTED(570); // Not hit
+        if ((instr.op != VM_JIT_OP_BRANCH) && (instr.op != VM_JIT_OP_BRANCH_COMPARE) && (instr.op != VM_JIT_OP_JUMP)) continue;
+        next = instr.target;
       }
-      if (aType != bType) {
-        CODE_COVERAGE_UNTESTED(571); // Not hit
-        return false;
-      } else {
-        CODE_COVERAGE_UNTESTED(572); // Not hit
-        }
+      uint16_t offset = next - address;
+      if (offset >= c.span) continue; // Exits to the interpreter
+      if (c.depths[offset] == -1) {
+        c.depths[offset] = after;
+        worklist[worklistCount++] = next;
+      } else if (c.depths[offset] != after) {
+        goto SUB_EXIT;
+      }
+    }
+  }
 
-      LongPtr lpA = DynamicPtr_decode_long(vm, a);
-      LongPtr lpB = DynamicPtr_decode_long(vm, b);
-      uint16_t aHeaderWord = readAllocationHeaderWord_long(lpA);
-      uint16_t bHeaderWord = readAllocationHeaderWord_long(lpB);
-      // If the header words are different, the sizes or types are different
-      if (aHeaderWord != bHeaderWord) {
-        CODE_COVERAGE_UNTESTED(476); // Not hit
-        return false;
+  // Pass 2: emit the code
+  if (!vm->pJitCode) {
+    void* p = mmap(NULL, MVM_JIT_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) goto SUB_EXIT;
+    vm->pJitCode = p;
+  } else if (mprotect(vm->pJitCode, MVM_JIT_CODE_SIZE, PROT_READ | PROT_WRITE) != 0) {
+    goto SUB_EXIT;
+  }
+
+  c.pCode = vm->pJitCode;
+  c.codeSize = vm->jitStats.codeBytesUsed;
+  c.epilogue = c.codeSize;
+  vm_jitEmitBytes(&c, epilogue, sizeof epilogue);
+  uint32_t entry = c.codeSize;
+  vm_jitEmitBytes(&c, prologue, sizeof prologue);
+
+  int32_t fallthrough = -1; // Address that the previous instruction falls through to
+  for (uint16_t offset = 0; offset < c.span; offset++) {
+    int16_t depth = c.depths[offset];
+    if (depth < 0) continue;
+    uint16_t a = address + offset;
+    if ((fallthrough >= 0) && (fallthrough != a)) {
+      vm_jitEmitJumpTo(&c, VM_JIT_CC_ALWAYS, (uint16_t)fallthrough, (uint8_t)c.depths[fallthrough - address]);
+    }
+    c.nativeOffsets[offset] = c.codeSize;
+    vm_jitDecode(vm, a, bytecodeSize, &instr);
+    vm_jitEmitInstruction(&c, a, &instr, (uint8_t)depth);
+    fallthrough = -1;
+    if ((instr.op != VM_JIT_OP_EXIT) && (instr.op != VM_JIT_OP_RETURN) && (instr.op != VM_JIT_OP_JUMP)) {
+      uint16_t next = a + instr.size;
+      if ((uint16_t)(next - address) < c.span) {
+        fallthrough = next;
       } else {
-        CODE_COVERAGE_UNTESTED(477); // Not hit
+        vm_jitEmitExit(&c, next | ((uint32_t)vm_jitDepthAfter(&instr, depth) << 16) | VM_JIT_EXIT_BAILOUT);
       }
-      uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(aHeaderWord);
-      if (memcmp_long(lpA, lpB, size) == 0) {
-        CODE_COVERAGE_UNTESTED(481); // Not hit
-        return true;
-      } else {
-        CODE_COVERAGE_UNTESTED(482); // Not hit
-        return false;
+    }
+  }
+  if (fallthrough >= 0) {
+    vm_jitEmitJumpTo(&c, VM_JIT_CC_ALWAYS, (uint16_t)fallthrough, (uint8_t)c.depths[fallthrough - address]);
+  }
+
+  if (!c.full) {
+    for (uint16_t i = 0; i < c.fixupCount; i++) {
+      vm_TsJitFixup* fixup = &c.fixups[i];
+      uint32_t rel = c.nativeOffsets[fixup->target - address] - (fixup->position + 4);
+      memcpy(c.pCode + fixup->position, &rel, 4);
+    }
+    vm->jitStats.codeBytesUsed = c.codeSize;
+    result = entry;
+  }
+
+  if (mprotect(vm->pJitCode, MVM_JIT_CODE_SIZE, PROT_READ | PROT_EXEC) != 0) {
+    CODE_COVERAGE_ERROR_PATH(902); // Not hit
+    // None of the compiled code can run
+    for (uint16_t i = 0; i < MVM_JIT_FUNCTION_COUNT; i++) {
+      if (vm->jitFunctions[i].entry) vm->jitFunctions[i].entry = VM_JIT_FAILED;
+    }
+    result = VM_JIT_FAILED;
+  }
+
+SUB_EXIT:
+  vm_free(vm, pTables);
+  return result;
+}
+
+static vm_TsJitFunction* vm_jitFindFunction(VM* vm, uint16_t address) {
+  uint16_t i = (address >> 1) & (MVM_JIT_FUNCTION_COUNT - 1);
+  for (uint16_t n = 0; n < MVM_JIT_FUNCTION_COUNT; n++) {
+    vm_TsJitFunction* f = &vm->jitFunctions[i];
+    if (f->address == address) return f;
+    if (f->address == 0) {
+      f->address = address;
+      return f;
+    }
+    i = (i + 1) & (MVM_JIT_FUNCTION_COUNT - 1);
+  }
+  // Table full
+  return NULL;
+}
+
+/**
+ * Called on entry to a bytecode function, with the new frame set up and the
+ * register cache flushed. Counts the call, compiles the function if it has
+ * become hot, and runs the native code if there is any. Either way, the
+ * interpreter continues from `reg->lpProgramCounter` and `reg->pStackPointer`.
+ */
+static void vm_jitEnter(VM* vm) {
+  vm_TsRegisters* reg = &vm->stack->reg;
+
+  // The native code doesn't count instructions or check breakpoints
+  #ifdef MVM_GAS_COUNTER
+  if (vm->stopAfterNInstructions >= 0) return;
+  #endif
+  #if MVM_INCLUDE_DEBUG_CAPABILITY
+  if (vm->pBreakpoints) return;
+  #endif
+
+  uint16_t address = (uint16_t)LongPtr_sub(reg->lpProgramCounter, vm->lpBytecode);
+  vm_TsJitFunction* f = vm_jitFindFunction(vm, address);
+  if (!f) return;
+
+  if (!f->entry) {
+    if (++f->callCount < MVM_JIT_THRESHOLD) return;
+    CODE_COVERAGE(903); // Not hit
+    f->entry = vm_jitCompile(vm, address);
+    if (f->entry == VM_JIT_FAILED) {
+      vm->jitStats.failedFunctions++;
+    } else {
+      vm->jitStats.compiledFunctions++;
+    }
+  }
+  if (f->entry == VM_JIT_FAILED) return;
+
+  CODE_COVERAGE(904); // Not hit
+  VM_ASSERT(vm, reg->pStackPointer == reg->pFrameBase);
+  vm_TfJitFunction fn = (vm_TfJitFunction)(void*)(vm->pJitCode + f->entry);
+  uint32_t exitWord = fn(reg->pFrameBase, vm, reg->pArgs, reg->argCountAndFlags & AF_ARG_COUNT_MASK);
+
+  vm->jitStats.nativeCalls++;
+  if (exitWord & VM_JIT_EXIT_BAILOUT) vm->jitStats.bailouts++;
+  reg->lpProgramCounter = LongPtr_add(vm->lpBytecode, (uint16_t)exitWord);
+  reg->pStackPointer = reg->pFrameBase + ((exitWord >> 16) & 0xFF);
+}
+
+static void vm_jitFree(VM* vm) {
+  if (vm->pJitCode) {
+    munmap(vm->pJitCode, MVM_JIT_CODE_SIZE);
+    vm->pJitCode = NULL;
+  }
+}
+
+void mvm_getJitStats(VM* vm, mvm_TsJitStats* r) {
+  CODE_COVERAGE(905); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, r != NULL);
+  *r = vm->jitStats;
+}
+#endif // MVM_JIT
+
+#if MVM_AOT
+/*
+ * # Ahead-of-time compiled functions
+ *
+ * `generateNativeC` in the Microvium library translates bytecode functions to
+ * C, marks them in the snapshot with VM_FUNCTION_HEADER_NATIVE_FLAG, and emits
+ * a table of them that the host passes to `mvm_aot_setFunctions`. Like the
+ * JIT, the generated code runs in the frame that the interpreter set up for
+ * the call, keeps every value in the frame's stack slots, and returns to the
+ * interpreter (with MVM_AOT_EXIT) at the first instruction that it doesn't
+ * implement, including every `return`, so the interpreter does all the work
+ * of calls, returns and exceptions.
+ */
+
+/**
+ * Called on entry to a bytecode function whose header has
+ * VM_FUNCTION_HEADER_NATIVE_FLAG, with the new frame set up and the register
+ * cache flushed. Returns false if the function isn't run natively, and
+ * otherwise runs it and leaves `reg->lpProgramCounter` and
+ * `reg->pStackPointer` where the interpreter continues.
+ */
+static bool vm_aotEnter(VM* vm) {
+  vm_TsRegisters* reg = &vm->stack->reg;
+  const mvm_TsAotFunctionTable* table = vm->pAotFunctions;
+
+  // The native code doesn't count instructions or check breakpoints
+  #ifdef MVM_GAS_COUNTER
+  if (vm->stopAfterNInstructions >= 0) return false;
+  #endif
+  #if MVM_INCLUDE_DEBUG_CAPABILITY
+  if (vm->pBreakpoints) return false;
+  #endif
+
+  uint16_t address = (uint16_t)LongPtr_sub(reg->lpProgramCounter, vm->lpBytecode);
+  uint16_t lo = 0;
+  uint16_t hi = table->count;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) >> 1;
+    const mvm_TsAotFunction* f = &table->functions[mid];
+    if (f->address == address) {
+      CODE_COVERAGE(906); // Not hit
+      VM_ASSERT(vm, reg->pStackPointer == reg->pFrameBase);
+      uint32_t exitWord = f->fn(vm, reg->pFrameBase, reg->pArgs, (uint8_t)(reg->argCountAndFlags & AF_ARG_COUNT_MASK));
+      reg->lpProgramCounter = LongPtr_add(vm->lpBytecode, (uint16_t)exitWord);
+      reg->pStackPointer = reg->pFrameBase + (uint8_t)(exitWord >> 16);
+      return true;
+    } else if (f->address < address) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Not every function marked in the snapshot is necessarily in the table
+  return false;
+}
+
+mvm_TeError mvm_aot_setFunctions(VM* vm, const mvm_TsAotFunctionTable* table) {
+  CODE_COVERAGE(907); // Not hit
+  VM_ASSERT(NULL, vm != NULL);
+  VM_ASSERT(vm, table != NULL);
+  uint16_t crc = LongPtr_read2_aligned(LongPtr_add(vm->lpBytecode, OFFSETOF(mvm_TsBytecodeHeader, crc)));
+  if (table->snapshotCrc != crc) {
+    CODE_COVERAGE_ERROR_PATH(908); // Not hit
+    return MVM_E_NATIVE_FUNCTIONS_MISMATCH;
+  }
+  vm->pAotFunctions = table;
+  return MVM_E_SUCCESS;
+}
+
+mvm_TeError mvm_aot_getProperty(VM* vm, Value* pStackPointer) {
+  CODE_COVERAGE(909); // Not hit
+  // The GC needs to see the native frame
+  vm->stack->reg.pStackPointer = pStackPointer;
+  return getProperty(vm, pStackPointer - 2, pStackPointer - 1, pStackPointer - 2);
+}
+
+mvm_TeError mvm_aot_getPropertyKey(VM* vm, Value* pStackPointer, Value key) {
+  CODE_COVERAGE(910); // Not hit
+  vm->stack->reg.pStackPointer = pStackPointer;
+  return getProperty(vm, pStackPointer - 1, &key, pStackPointer - 1);
+}
+
+mvm_TeError mvm_aot_setProperty(VM* vm, Value* pStackPointer) {
+  CODE_COVERAGE(911); // Not hit
+  vm->stack->reg.pStackPointer = pStackPointer;
+  return setProperty(vm, pStackPointer - 3, pStackPointer - 2, pStackPointer - 1);
+}
+
+mvm_TeError mvm_aot_setPropertyKey(VM* vm, Value* pStackPointer, Value key) {
+  CODE_COVERAGE(912); // Not hit
+  vm->stack->reg.pStackPointer = pStackPointer;
+  return setProperty(vm, pStackPointer - 2, &key, pStackPointer - 1);
+}
+
+mvm_TeError mvm_aot_newObject(VM* vm, Value* pStackPointer) {
+  CODE_COVERAGE(913); // Not hit
+  vm->stack->reg.pStackPointer = pStackPointer;
+  TsPropertyList* pObject = GC_ALLOCATE_TYPE(vm, TsPropertyList, TC_REF_PROPERTY_LIST);
+  pObject->dpNext = VM_VALUE_NULL;
+  pObject->dpProto = VM_VALUE_NULL;
+  *pStackPointer = ShortPtr_encode(vm, pObject);
+  return MVM_E_SUCCESS;
+}
+#endif // MVM_AOT
+
+/** Converts the argument to either an TC_VAL_INT14 or a TC_REF_INTERNED_STRING, or gives an error */
+static TeError toPropertyName(VM* vm, Value* value) {
+  CODE_COVERAGE(50); // Hit
+
+  // This function may trigger a GC cycle because it may add a cell to the string intern table
+  VM_ASSERT(vm, !vm->stack || !vm->stack->reg.usingCachedRegisters);
+  VM_POTENTIAL_GC_POINT(vm);
+
+  // Property names in microvium are either integer indexes or non-integer interned strings
+  TeTypeCode type = deepTypeOf(vm, *value);
+  switch (type) {
+    // These are already valid property names
+    case TC_VAL_INT14: {
+      CODE_COVERAGE(279); // Hit
+      if (VirtualInt14_decode(vm, *value) < 0) {
+        CODE_COVERAGE_UNTESTED(280); // Not hit
+        return vm_newError(vm, MVM_E_RANGE_ERROR);
+      }
+      CODE_COVERAGE(281); // Hit
+      return MVM_E_SUCCESS;
+    }
+    case TC_REF_INTERNED_STRING: {
+      CODE_COVERAGE(373); // Hit
+      return MVM_E_SUCCESS;
+    }
+
+    case TC_REF_INT32: {
+      CODE_COVERAGE_ERROR_PATH(374); // Not hit
+      // 32-bit numbers are out of the range of supported array indexes
+      return vm_newError(vm, MVM_E_RANGE_ERROR);
+    }
+
+    case TC_REF_STRING: {
+      CODE_COVERAGE(375); // Hit
+
+      // Note: In Microvium at the moment, it's illegal to use an integer-valued
+      // string as a property name. If the string is in bytecode, it will only
+      // have the type TC_REF_STRING if it's a number and is illegal.
+      if (!Value_isShortPtr(*value)) {
+        return vm_newError(vm, MVM_E_TYPE_ERROR);
+      }
+
+      if (vm_ramStringIsNonNegativeInteger(vm, *value)) {
+        CODE_COVERAGE_ERROR_PATH(378); // Not hit
+        return vm_newError(vm, MVM_E_TYPE_ERROR);
+      } else {
+        CODE_COVERAGE(379); // Hit
+      }
+
+      // Strings need to be converted to interned strings in order to be valid
+      // property names. This is because properties are searched by reference
+      // equality.
+      toInternedString(vm, value);
+      return MVM_E_SUCCESS;
+    }
+
+    case TC_VAL_STR_LENGTH: {
+      CODE_COVERAGE(272); // Hit
+      return MVM_E_SUCCESS;
+    }
+
+    case TC_VAL_STR_PROTO: {
+      CODE_COVERAGE(273); // Hit
+      return MVM_E_SUCCESS;
+    }
+    default: {
+      CODE_COVERAGE_ERROR_PATH(380); // Not hit
+      return vm_newError(vm, MVM_E_TYPE_ERROR);
+    }
+  }
+}
+
+// Converts a TC_REF_STRING to a TC_REF_INTERNED_STRING
+// TODO: Test cases for this function
+static void toInternedString(VM* vm, Value* pValue) {
+  CODE_COVERAGE(51); // Hit
+  Value value = *pValue;
+  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_STRING);
+
+  // This function may trigger a GC cycle because it may add a cell to the intern table
+  VM_ASSERT(vm, !vm->stack || !vm->stack->reg.usingCachedRegisters);
+
+  // TC_REF_STRING values are always in GC memory. If they were in flash, they'd
+  // already be TC_REF_INTERNED_STRING.
+  char* pStr1 = DynamicPtr_decode_native(vm, value);
+  uint16_t str1Size = vm_getAllocationSize(pStr1);
+
+  LongPtr lpStr1 = LongPtr_new(pStr1);
+  // Note: the sizes here include the null terminator
+  if ((str1Size == sizeof PROTO_STR) && (memcmp_long(lpStr1, LongPtr_new((void*)&PROTO_STR), sizeof PROTO_STR) == 0)) {
+    CODE_COVERAGE_UNTESTED(547); // Not hit
+    *pValue = VM_VALUE_STR_PROTO;
+  } else if ((str1Size == sizeof LENGTH_STR) && (memcmp_long(lpStr1, LongPtr_new((void*)&LENGTH_STR), sizeof LENGTH_STR) == 0)) {
+    CODE_COVERAGE(548); // Hit
+    *pValue = VM_VALUE_STR_LENGTH;
+  } else {
+    CODE_COVERAGE(549); // Hit
+  }
+
+  LongPtr lpBytecode = vm->lpBytecode;
+
+  // We start by searching the string table for interned strings that are baked
+  // into the ROM. These are stored alphabetically, so we can perform a binary
+  // search.
+
+  uint16_t stringTableOffset = getSectionOffset(vm->lpBytecode, BCS_STRING_TABLE);
+  uint16_t stringTableSize = getSectionOffset(vm->lpBytecode, vm_sectionAfter(vm, BCS_STRING_TABLE)) - stringTableOffset;
+  int strCount = stringTableSize / sizeof (Value);
+
+  int first = 0;
+  int last = strCount - 1;
+
+  while (first <= last) {
+    CODE_COVERAGE(381); // Hit
+    int middle = (first + last) / 2;
+    uint16_t str2Offset = stringTableOffset + middle * 2;
+    Value vStr2 = LongPtr_read2_aligned(LongPtr_add(lpBytecode, str2Offset));
+    LongPtr lpStr2 = DynamicPtr_decode_long(vm, vStr2);
+    uint16_t header = readAllocationHeaderWord_long(lpStr2);
+    VM_ASSERT(vm, vm_getTypeCodeFromHeaderWord(header) == TC_REF_INTERNED_STRING);
+    uint16_t str2Size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(header);
+    int compareSize = str1Size < str2Size ? str1Size : str2Size;
+    int c = memcmp_long(lpStr1, lpStr2, compareSize);
+
+    // If they compare equal for the range that they have in common, we check the length
+    if (c == 0) {
+      CODE_COVERAGE(382); // Hit
+      if (str1Size < str2Size) {
+        CODE_COVERAGE_UNTESTED(383); // Not hit
+        c = -1;
+      } else if (str1Size > str2Size) {
+        CODE_COVERAGE_UNTESTED(384); // Not hit
+        c = 1;
+      } else {
+        CODE_COVERAGE(385); // Hit
+        // Exact match
+        *pValue = vStr2;
+        return;
+      }
+    }
+
+    // c is > 0 if the string we're searching for comes after the middle point
+    if (c > 0) {
+      CODE_COVERAGE(386); // Hit
+      first = middle + 1;
+    } else {
+      CODE_COVERAGE(387); // Hit
+      last = middle - 1;
+    }
+  }
+
+  // At this point, we haven't found the interned string in the bytecode. We
+  // need to check in RAM. Now we're comparing an in-RAM string against other
+  // in-RAM strings. We're looking for an exact match, not performing a binary
+  // search with inequality comparison, since the linked list of interned
+  // strings in RAM is not sorted.
+  Value vInternedStrings = getBuiltin(vm, BIN_INTERNED_STRINGS);
+  Value spCell = vInternedStrings;
+  while (spCell != VM_VALUE_UNDEFINED) {
+    CODE_COVERAGE(388); // Hit
+    VM_ASSERT(vm, Value_isShortPtr(spCell));
+    TsInternedStringCell* pCell = ShortPtr_decode(vm, spCell);
+    Value vStr2 = pCell->str;
+    char* pStr2 = ShortPtr_decode(vm, vStr2);
+    uint16_t str2Header = readAllocationHeaderWord(pStr2);
+    uint16_t str2Size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(str2Header);
+
+    // The sizes have to match for the strings to be equal
+    if (str2Size == str1Size) {
+      CODE_COVERAGE(389); // Hit
+      // Note: we use memcmp instead of strcmp because strings are allowed to
+      // have embedded null terminators.
+      int c = memcmp(pStr1, pStr2, str1Size);
+      // Equal?
+      if (c == 0) {
+        CODE_COVERAGE(390); // Hit
+        *pValue = vStr2;
+        return;
+      } else {
+        CODE_COVERAGE(391); // Hit
+      }
+    } else {
+      CODE_COVERAGE(550); // Hit
+    }
+    spCell = pCell->spNext;
+    TABLE_COVERAGE(spCell ? 1 : 0, 2, 551); // Hit 1/2
+  }
+
+  CODE_COVERAGE(616); // Hit
+
+  // If we get here, it means there was no matching interned string already
+  // existing in ROM or RAM. We upgrade the current string to a
+  // TC_REF_INTERNED_STRING, since we now know it doesn't conflict with any existing
+  // existing interned strings.
+  setHeaderWord(vm, pStr1, TC_REF_INTERNED_STRING, str1Size);
+  VM_WRITE_BARRIER(vm, pStr1);
+
+  // Add the string to the linked list of interned strings
+  TsInternedStringCell* pCell = GC_ALLOCATE_TYPE(vm, TsInternedStringCell, TC_REF_FIXED_LENGTH_ARRAY);
+  value = *pValue; // Invalidated by potential GC collection
+  vInternedStrings = getBuiltin(vm, BIN_INTERNED_STRINGS);  // Invalidated by potential GC collection
+  // Push onto linked list2
+  pCell->spNext = vInternedStrings;
+  pCell->str = value;
+  setBuiltin(vm, BIN_INTERNED_STRINGS, ShortPtr_encode(vm, pCell));
+}
+
+static int memcmp_long(LongPtr p1, LongPtr p2, size_t size) {
+  CODE_COVERAGE(471); // Hit
+  return MVM_LONG_MEM_CMP(p1, p2, size);
+}
+
+static void memcpy_long(void* target, LongPtr source, size_t size) {
+  CODE_COVERAGE(9); // Hit
+  MVM_LONG_MEM_CPY(target, source, size);
+}
+
+/** Size of string excluding bonus null terminator */
+static uint16_t vm_stringSizeUtf8(VM* vm, Value value) {
+  CODE_COVERAGE(53); // Hit
+  TeTypeCode typeCode = deepTypeOf(vm, value);
+  switch (typeCode) {
+    case TC_REF_STRING:
+    case TC_REF_INTERNED_STRING: {
+      LongPtr lpStr = DynamicPtr_decode_long(vm, value);
+      uint16_t headerWord = readAllocationHeaderWord_long(lpStr);
+      // Less 1 because of the bonus null terminator
+      return vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord) - 1;
+    }
+    case TC_VAL_STR_PROTO: {
+      CODE_COVERAGE_UNTESTED(552); // Not hit
+      return sizeof PROTO_STR - 1;
+    }
+    case TC_VAL_STR_LENGTH: {
+      CODE_COVERAGE(608); // Hit
+      return sizeof LENGTH_STR - 1;
+    }
+    default:
+      VM_ASSERT_UNREACHABLE(vm);
+      return 0;
+  }
+}
+
+/**
+ * Checks if a string contains only decimal digits (and is not empty). May only
+ * be called on TC_REF_STRING and only those in GC memory.
+ */
+static bool vm_ramStringIsNonNegativeInteger(VM* vm, Value str) {
+  CODE_COVERAGE(55); // Hit
+  VM_ASSERT(vm, deepTypeOf(vm, str) == TC_REF_STRING);
+
+  char* pStr = ShortPtr_decode(vm, str);
+
+  // Length excluding bonus null terminator
+  uint16_t len = vm_getAllocationSize(pStr) - 1;
+  char* p = pStr;
+  if (!len) {
+    CODE_COVERAGE_UNTESTED(554); // Not hit
+    return false;
+  } else {
+    CODE_COVERAGE(555); // Hit
+  }
+  while (len--) {
+    CODE_COVERAGE(398); // Hit
+    if (!isdigit(*p++)) {
+      CODE_COVERAGE(399); // Hit
+      return false;
+    } else {
+      CODE_COVERAGE_UNTESTED(400); // Not hit
+    }
+  }
+  return true;
+}
+
+// Convert a string to an integer
+TeError strToInt32(mvm_VM* vm, mvm_Value value, int32_t* out_result) {
+  CODE_COVERAGE(404); // Not hit
+
+  TeTypeCode type = deepTypeOf(vm, value);
+  VM_ASSERT(vm, type == TC_REF_STRING || type == TC_REF_INTERNED_STRING);
+
+  bool isFloat = false;
+
+  // Note: this function is implemented to use long pointers to access ROM
+  // memory. This is because the string may be in ROM and we don't want to copy
+  // the string to RAM. Copying to RAM involves allocating the available memory,
+  // which requires that the VM register cache be in a flushed state, which they
+  // aren't necessarily at this point in the code.
+
+  LongPtr start = DynamicPtr_decode_long(vm, value);
+  LongPtr s = start;
+  uint16_t size = vm_getAllocationSize_long(s);
+  uint16_t len = size - 1; // Excluding null terminator
+
+  // Skip leading whitespace
+  while (isspace(LongPtr_read1(s))) {
+    s = LongPtr_add(s, 1);
+  }
+
+  int sign = (LongPtr_read1(s) == '-') ? -1 : 1;
+  if (LongPtr_read1(s) == '+' || LongPtr_read1(s) == '-') {
+    s = LongPtr_add(s, 1);
+  }
+
+  // Find end of digits
+  int32_t n = 0;
+  while (isdigit(LongPtr_read1(s))) {
+    int32_t n2 = n * 10 + (LongPtr_read1(s) - '0');
+    s = LongPtr_add(s, 1);
+    // Overflow Int32
+    if (n2 < n) isFloat = true;
+    n = n2;
+  }
+
+  // Decimal point
+  if ((LongPtr_read1(s) == ',') || (LongPtr_read1(s) == '.')) {
+    CODE_COVERAGE(739); // Not hit
+    isFloat = true;
+    s = LongPtr_add(s, 1);
+  }
+
+  // Digits after decimal point
+  while (isdigit(LongPtr_read1(s))) s = LongPtr_add(s, 1);
+
+  // Skip trailing whitespace
+  while (isspace(LongPtr_read1(s))) s = LongPtr_add(s, 1);
+
+  // Check if we reached the end of the string. If we haven't reached the end of
+  // the string then there is a non-digit character in the string.
+  if (LongPtr_sub(s, start) != len) {
+    CODE_COVERAGE(740); // Not hit
+    return MVM_E_NAN;
+  }
+
+  // This function cannot handle floating point numbers
+  if (isFloat) {
+    CODE_COVERAGE_UNTESTED(741); // Not hit
+    return MVM_E_FLOAT64;
+  }
+
+  CODE_COVERAGE(656); // Hit
+
+  *out_result = sign * n;
+
+  return MVM_E_SUCCESS;
+}
+
+TeError toInt32Internal(mvm_VM* vm, mvm_Value value, int32_t* out_result) {
+  CODE_COVERAGE(56); // Hit
+  // TODO: when the type codes are more stable, we should convert these to a table.
+  *out_result = 0;
+  TeTypeCode type = deepTypeOf(vm, value);
+  MVM_SWITCH(type, TC_END - 1) {
+    MVM_CASE(TC_VAL_INT14):
+    MVM_CASE(TC_REF_INT32): {
+      CODE_COVERAGE(401); // Hit
+      *out_result = vm_readInt32(vm, type, value);
+      return MVM_E_SUCCESS;
+    }
+    MVM_CASE(TC_REF_FLOAT64): {
+      CODE_COVERAGE(402); // Hit
+      return MVM_E_FLOAT64;
+    }
+    MVM_CASE(TC_REF_STRING):
+    MVM_CASE(TC_REF_INTERNED_STRING): {
+      CODE_COVERAGE(403); // Not hit
+      return strToInt32(vm, value, out_result);
+    }
+    MVM_CASE(TC_VAL_STR_LENGTH): {
+      CODE_COVERAGE(270); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_VAL_STR_PROTO): {
+      CODE_COVERAGE(271); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_PROPERTY_LIST): {
+      CODE_COVERAGE(405); // Hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_SHAPED_OBJECT): {
+      CODE_COVERAGE_UNTESTED(785); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_ARRAY): {
+      CODE_COVERAGE_UNTESTED(406); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_FUNCTION): {
+      CODE_COVERAGE(408); // Hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_HOST_FUNC): {
+      CODE_COVERAGE_UNTESTED(409); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_CLOSURE): {
+      CODE_COVERAGE_UNTESTED(410); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_UINT8_ARRAY): {
+      CODE_COVERAGE_UNTESTED(411); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_VIRTUAL): {
+      CODE_COVERAGE_UNTESTED(632); // Not hit
+      VM_RESERVED(vm);
+      return MVM_E_FATAL_ERROR_MUST_KILL_VM;
+    }
+    MVM_CASE(TC_REF_CLASS): {
+      CODE_COVERAGE(633); // Hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_REF_SYMBOL): {
+      CODE_COVERAGE_UNTESTED(412); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_VAL_UNDEFINED): {
+      CODE_COVERAGE(413); // Hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_VAL_NULL): {
+      CODE_COVERAGE(414); // Hit
+      break;
+    }
+    MVM_CASE(TC_VAL_TRUE): {
+      CODE_COVERAGE_UNTESTED(415); // Not hit
+      *out_result = 1; break;
+    }
+    MVM_CASE(TC_VAL_FALSE): {
+      CODE_COVERAGE_UNTESTED(416); // Not hit
+      break;
+    }
+    MVM_CASE(TC_VAL_NAN): {
+      CODE_COVERAGE(417); // Hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_VAL_NEG_ZERO): {
+      CODE_COVERAGE(418); // Hit
+      return MVM_E_NEG_ZERO;
+    }
+    MVM_CASE(TC_VAL_DELETED): {
+      CODE_COVERAGE_UNTESTED(419); // Not hit
+      return MVM_E_NAN;
+    }
+    MVM_CASE(TC_VAL_NO_OP_FUNC): {
+      CODE_COVERAGE(742); // Not hit
+      return MVM_E_NAN;
+    }
+    default:
+      VM_ASSERT_UNREACHABLE(vm);
+  }
+  return MVM_E_SUCCESS;
+}
+
+/**
+ * Evaluates a VM_NUM_OP comparison (`<`, `>`, `<=` or `>=`) with the same
+ * semantics as the VM_OP_NUM_OP instruction. This is the general path for the
+ * fused compare-and-branch instructions when the operands are not both int14.
+ */
+static bool vm_compareNumbers(VM* vm, Value left, Value right, vm_TeNumberOp op) {
+  CODE_COVERAGE(824); // Not hit
+  int32_t leftI = 0;
+  int32_t rightI = 0;
+  TeError leftErr = toInt32Internal(vm, left, &leftI);
+  TeError rightErr = toInt32Internal(vm, right, &rightI);
+
+  #if MVM_SUPPORT_FLOAT
+  if ((leftErr != MVM_E_SUCCESS) || (rightErr != MVM_E_SUCCESS)) {
+    CODE_COVERAGE(825); // Not hit
+    MVM_FLOAT64 leftF = mvm_toFloat64(vm, left);
+    MVM_FLOAT64 rightF = mvm_toFloat64(vm, right);
+    MVM_SWITCH (op, VM_NUM_OP_GREATER_EQUAL) {
+      MVM_CASE(VM_NUM_OP_LESS_THAN): return leftF < rightF;
+      MVM_CASE(VM_NUM_OP_GREATER_THAN): return leftF > rightF;
+      MVM_CASE(VM_NUM_OP_LESS_EQUAL): return leftF <= rightF;
+      MVM_CASE(VM_NUM_OP_GREATER_EQUAL): return leftF >= rightF;
+      default: break;
+    }
+    VM_ASSERT_UNREACHABLE(vm);
+    return false;
+  }
+  #else // !MVM_SUPPORT_FLOAT
+  (void)leftErr;
+  (void)rightErr;
+  #endif // MVM_SUPPORT_FLOAT
+
+  MVM_SWITCH (op, VM_NUM_OP_GREATER_EQUAL) {
+    MVM_CASE(VM_NUM_OP_LESS_THAN): return leftI < rightI;
+    MVM_CASE(VM_NUM_OP_GREATER_THAN): return leftI > rightI;
+    MVM_CASE(VM_NUM_OP_LESS_EQUAL): return leftI <= rightI;
+    MVM_CASE(VM_NUM_OP_GREATER_EQUAL): return leftI >= rightI;
+    default: break;
+  }
+  VM_ASSERT_UNREACHABLE(vm);
+  return false;
+}
+
+int32_t mvm_toInt32(mvm_VM* vm, mvm_Value value) {
+  CODE_COVERAGE(57); // Hit
+  int32_t result;
+  TeError err = toInt32Internal(vm, value, &result);
+  if (err == MVM_E_SUCCESS) {
+    CODE_COVERAGE(420); // Hit
+    return result;
+  } else if (err == MVM_E_NAN) {
+    CODE_COVERAGE(421); // Hit
+    return 0;
+  } else if (err == MVM_E_NEG_ZERO) {
+    CODE_COVERAGE_UNTESTED(422); // Not hit
+    return 0;
+  } else {
+    CODE_COVERAGE_UNTESTED(423); // Not hit
+  }
+
+  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_FLOAT64);
+  #if MVM_SUPPORT_FLOAT
+    return (int32_t)mvm_toFloat64(vm, value);
+  #else // !MVM_SUPPORT_FLOAT
+    // If things were compiled correctly, there shouldn't be any floats in the
+    // system at all
+    return 0;
+  #endif
+}
+
+#if MVM_SUPPORT_FLOAT
+MVM_FLOAT64 mvm_toFloat64(mvm_VM* vm, mvm_Value value) {
+  CODE_COVERAGE(58); // Hit
+  int32_t result;
+  TeError err = toInt32Internal(vm, value, &result);
+  if (err == MVM_E_SUCCESS) {
+    CODE_COVERAGE(424); // Hit
+    return result;
+  } else if (err == MVM_E_NAN) {
+    CODE_COVERAGE(425); // Hit
+    return MVM_FLOAT64_NAN;
+  } else if (err == MVM_E_NEG_ZERO) {
+    CODE_COVERAGE(426); // Hit
+    return MVM_FLOAT_NEG_ZERO;
+  } else {
+    CODE_COVERAGE(427); // Hit
+  }
+
+  VM_ASSERT(vm, deepTypeOf(vm, value) == TC_REF_FLOAT64);
+  LongPtr lpFloat = DynamicPtr_decode_long(vm, value);
+  MVM_FLOAT64 f;
+  memcpy_long(&f, lpFloat, sizeof f);
+  return f;
+}
+#endif // MVM_SUPPORT_FLOAT
+
+// See implementation of mvm_equal for the meaning of each
+typedef enum TeEqualityAlgorithm {
+  EA_NONE,
+  EA_COMPARE_PTR_VALUE_AND_TYPE,
+  EA_COMPARE_NON_PTR_TYPE,
+  EA_COMPARE_REFERENCE,
+  EA_NOT_EQUAL,
+  EA_COMPARE_STRING,
+} TeEqualityAlgorithm;
+
+static const TeEqualityAlgorithm equalityAlgorithmByTypeCode[TC_END] = {
+  EA_NONE,                       // TC_REF_TOMBSTONE          = 0x0
+  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_INT32              = 0x1
+  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_FLOAT64            = 0x2
+  EA_COMPARE_STRING,             // TC_REF_STRING             = 0x3
+  EA_COMPARE_STRING,             // TC_REF_INTERNED_STRING    = 0x4
+  EA_COMPARE_REFERENCE,          // TC_REF_FUNCTION           = 0x5
+  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_HOST_FUNC          = 0x6
+  EA_COMPARE_PTR_VALUE_AND_TYPE, // TC_REF_BIG_INT            = 0x7
+  EA_COMPARE_REFERENCE,          // TC_REF_SYMBOL             = 0x8
+  EA_NONE,                       // TC_REF_CLASS              = 0x9
+  EA_NONE,                       // TC_REF_VIRTUAL            = 0xA
+  EA_COMPARE_REFERENCE,          // TC_REF_SHAPED_OBJECT      = 0xB
+  EA_COMPARE_REFERENCE,          // TC_REF_PROPERTY_LIST      = 0xC
+  EA_COMPARE_REFERENCE,          // TC_REF_ARRAY              = 0xD
+  EA_COMPARE_REFERENCE,          // TC_REF_FIXED_LENGTH_ARRAY = 0xE
+  EA_COMPARE_REFERENCE,          // TC_REF_CLOSURE            = 0xF
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_INT14              = 0x10
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_UNDEFINED          = 0x11
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NULL               = 0x12
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_TRUE               = 0x13
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_FALSE              = 0x14
+  EA_NOT_EQUAL,                  // TC_VAL_NAN                = 0x15
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NEG_ZERO           = 0x16
+  EA_NONE,                       // TC_VAL_DELETED            = 0x17
+  EA_COMPARE_STRING,             // TC_VAL_STR_LENGTH         = 0x18
+  EA_COMPARE_STRING,             // TC_VAL_STR_PROTO          = 0x19
+  EA_COMPARE_NON_PTR_TYPE,       // TC_VAL_NO_OP_FUNC         = 0x1A
+};
+
+bool mvm_equal(mvm_VM* vm, mvm_Value a, mvm_Value b) {
+  CODE_COVERAGE(462); // Hit
+  VM_ASSERT_NOT_USING_CACHED_REGISTERS(vm);
+
+  TeTypeCode aType = deepTypeOf(vm, a);
+  TeTypeCode bType = deepTypeOf(vm, b);
+  TeEqualityAlgorithm algorithmA = equalityAlgorithmByTypeCode[aType];
+  TeEqualityAlgorithm algorithmB = equalityAlgorithmByTypeCode[bType];
+
+  TABLE_COVERAGE(algorithmA, 6, 556); // Hit 4/6
+  TABLE_COVERAGE(algorithmB, 6, 557); // Hit 4/6
+  TABLE_COVERAGE(aType, TC_END, 558); // Hit 7/27
+  TABLE_COVERAGE(bType, TC_END, 559); // Hit 9/27
+
+  // If the values aren't even in the same class of comparison, they're not
+  // equal. In particular, strings will not be equal to non-strings.
+  if (algorithmA != algorithmB) {
+    CODE_COVERAGE(560); // Hit
+    return false;
+  } else {
+    CODE_COVERAGE(561); // Hit
+  }
+
+  if (algorithmA == EA_NOT_EQUAL) {
+    CODE_COVERAGE(562); // Hit
+    return false; // E.g. comparing NaN
+  } else {
+    CODE_COVERAGE(563); // Hit
+  }
+
+  if (a == b) {
+    CODE_COVERAGE(564); // Hit
+    return true;
+  } else {
+    CODE_COVERAGE(565); // Hit
+  }
+
+  switch (algorithmA) {
+    case EA_COMPARE_REFERENCE: {
+      // Reference equality comparison assumes that two values with different
+      // locations in memory must be different values, since their identity is
+      // their address. Since we've already checked `a == b`, this must be false.
+      return false;
+    }
+    case EA_COMPARE_NON_PTR_TYPE: {
+      // Non-pointer types are those like Int14 and the well-known values
+      // (except NaN). These can just be compared with `a == b`, which we've
+      // already done.
+      return false;
+    }
+
+    case EA_COMPARE_STRING: {
+      // Strings are a pain to compare because there are edge cases like the
+      // fact that the string "length" _may_ be represented by
+      // VM_VALUE_STR_LENGTH rather than a pointer to a string (or it may be a
+      // TC_REF_STRING). To keep the code concise, I'm fetching a pointer to the
+      // string data itself and then comparing that. This is the only equality
+      // algorithm that doesn't check the type. It makes use of the check for
+      // `algorithmA != algorithmB` from earlier and the fact that only strings
+      // compare with this algorithm, which means we won't get to this point
+      // unless both `a` and `b` are strings.
+      if (a == b) {
+        CODE_COVERAGE_UNTESTED(566); // Not hit
+        return true;
+      } else {
+        CODE_COVERAGE(567); // Hit
+      }
+      size_t sizeA;
+      size_t sizeB;
+      LongPtr lpStrA = vm_toStringUtf8_long(vm, a, &sizeA);
+      LongPtr lpStrB = vm_toStringUtf8_long(vm, b, &sizeB);
+      bool result = (sizeA == sizeB) && (memcmp_long(lpStrA, lpStrB, (uint16_t)sizeA) == 0);
+      TABLE_COVERAGE(result ? 1 : 0, 2, 568); // Hit 2/2
+      return result;
+    }
+
+    /*
+    Compares two values that are both pointer values that point to non-reference
+    types (e.g. int32). These will be equal if the value pointed to has the same
+    type, the same size, and the raw data pointed to is the same.
+    */
+    case EA_COMPARE_PTR_VALUE_AND_TYPE: {
+      CODE_COVERAGE_UNTESTED(475); // Not hit
+
+      if (a == b) {
+        CODE_COVERAGE_UNTESTED(569); // Not hit
+        return true;
+      } else {
+        CODE_COVERAGE_UNTESTED(570); // Not hit
+      }
+      if (aType != bType) {
+        CODE_COVERAGE_UNTESTED(571); // Not hit
+        return false;
+      } else {
+        CODE_COVERAGE_UNTESTED(572); // Not hit
+        }
+
+      LongPtr lpA = DynamicPtr_decode_long(vm, a);
+      LongPtr lpB = DynamicPtr_decode_long(vm, b);
+      uint16_t aHeaderWord = readAllocationHeaderWord_long(lpA);
+      uint16_t bHeaderWord = readAllocationHeaderWord_long(lpB);
+      // If the header words are different, the sizes or types are different
+      if (aHeaderWord != bHeaderWord) {
+        CODE_COVERAGE_UNTESTED(476); // Not hit
+        return false;
+      } else {
+        CODE_COVERAGE_UNTESTED(477); // Not hit
+      }
+      uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(aHeaderWord);
+      if (memcmp_long(lpA, lpB, size) == 0) {
+        CODE_COVERAGE_UNTESTED(481); // Not hit
+        return true;
+      } else {
+        CODE_COVERAGE_UNTESTED(482); // Not hit
+        return false;
+      }
+    }
+
+    default: {
+      VM_ASSERT_UNREACHABLE(vm);
+      return false;
+    }
+  }
+}
+
+bool mvm_isNaN(mvm_Value value) {
+  CODE_COVERAGE_UNTESTED(573); // Not hit
+  return value == VM_VALUE_NAN;
+}
+
+#if MVM_INCLUDE_SNAPSHOT_CAPABILITY
+
+// Called during snapshotting to convert native pointers to their position-independent form
+static void serializePtr(VM* vm, Value* pv) {
+  CODE_COVERAGE(576); // Hit
+  Value v = *pv;
+  if (!Value_isShortPtr(v)) {
+    CODE_COVERAGE(577); // Hit
+    return;
+  } else {
+    CODE_COVERAGE(578); // Hit
+  }
+  void* p = ShortPtr_decode(vm, v);
+
+  // Pointers are encoded as an offset in the heap
+  uint16_t offsetInHeap = pointerOffsetInHeap(vm, vm->pLastBucket, p);
+
+  // The lowest bit must be zero so that this is tagged as a "ShortPtr".
+  VM_ASSERT(vm, (offsetInHeap & 1) == 0);
+
+  *pv = offsetInHeap;
+}
+
+// The opposite of `loadPointers`
+static void serializePointers(VM* vm, mvm_TsBytecodeHeader* bc) {
+  CODE_COVERAGE(579); // Hit
+  // CAREFUL! This function mutates `bc`, not `vm`.
+
+  uint16_t n;
+  uint16_t* p;
+
+  uint16_t heapOffset = bc->sectionOffsets[BCS_HEAP];
+  uint16_t heapSize = bc->bytecodeSize - heapOffset;
+
+  uint16_t* pGlobals = (uint16_t*)((uint8_t*)bc + bc->sectionOffsets[BCS_GLOBALS]);
+  uint16_t* heapMemory = (uint16_t*)((uint8_t*)bc + heapOffset);
+
+  // Roots in global variables
+  uint16_t globalsSize = bc->sectionOffsets[BCS_GLOBALS + 1] - bc->sectionOffsets[BCS_GLOBALS];
+  p = pGlobals;
+  n = globalsSize / 2;
+  TABLE_COVERAGE(n ? 1 : 0, 2, 580); // Hit 1/2
+  while (n--) {
+    serializePtr(vm, p++);
+  }
+
+  // Pointers in heap memory
+  p = heapMemory;
+  uint16_t* heapEnd = (uint16_t*)((uint8_t*)heapMemory + heapSize);
+  while (p < heapEnd) {
+    CODE_COVERAGE(581); // Hit
+    uint16_t header = *p++;
+    uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(header);
+    int words = size / 2; // Note: round **down** to nearest word
+    uint16_t* next = p + (size + 1) / 2; // Note: round **up** to nearest word
+    TABLE_COVERAGE(next == p + words ? 1 : 0, 2, 694); // Hit 2/2
+    TeTypeCode tc = vm_getTypeCodeFromHeaderWord(header);
+
+    if (tc < TC_REF_DIVIDER_CONTAINER_TYPES) { // Non-container types
+      CODE_COVERAGE(582); // Hit
+      p = next;
+      continue;
+    } else {
+      // Else, container types
+      CODE_COVERAGE(583); // Hit
+    }
+
+    while (words--) {
+      if (Value_isShortPtr(*p))
+        serializePtr(vm, p);
+      p++;
+    }
+    p = next;
+  }
+}
+
+void* mvm_createSnapshot(mvm_VM* vm, size_t* out_size) {
+  CODE_COVERAGE(503); // Hit
+  if (out_size)
+    *out_size = 0;
+
+  uint16_t heapOffset = getSectionOffset(vm->lpBytecode, BCS_HEAP);
+  uint16_t heapSize = getHeapSize(vm);
+
+  // This assumes that the heap is the last section in the bytecode. Since the
+  // heap is the only part of the bytecode image that changes size, we can just
+  // calculate the new bytecode size as follows
+  VM_ASSERT(vm, BCS_HEAP == BCS_SECTION_COUNT - 1);
+  uint32_t bytecodeSize = (uint32_t)heapOffset + heapSize;
+
+  if (bytecodeSize > 0xFFFF) {
+    CODE_COVERAGE_ERROR_PATH(584); // Not hit
+    MVM_FATAL_ERROR(vm, MVM_E_SNAPSHOT_TOO_LARGE);
+  } else {
+    CODE_COVERAGE(585); // Hit
+  }
+
+  mvm_TsBytecodeHeader* pNewBytecode = vm_malloc(vm, bytecodeSize);
+  if (!pNewBytecode) return NULL;
+
+  // The globals and heap are the last parts of the image because they're the
+  // only mutable sections
+  VM_ASSERT(vm, BCS_GLOBALS == BCS_SECTION_COUNT - 2);
+  uint16_t sizeOfConstantPart = getSectionOffset(vm->lpBytecode, BCS_GLOBALS);
+
+  // The first part of the snapshot doesn't change between executions (except
+  // some header fields, which we'll update later).
+  memcpy_long(pNewBytecode, vm->lpBytecode, sizeOfConstantPart);
+
+  // Snapshot the globals memory
+  uint16_t sizeOfGlobals = getSectionSize(vm, BCS_GLOBALS);
+  memcpy((uint8_t*)pNewBytecode + pNewBytecode->sectionOffsets[BCS_GLOBALS], vm->globals, sizeOfGlobals);
+
+  // Snapshot heap memory
+
+  TsBucket* pBucket = vm->pLastBucket;
+  // Start at the end of the heap and work backwards, because buckets are linked
+  // in reverse order. (Edit: actually, they're also linked forwards now, but I
+  // might retract that at some point so I'll leave this with the backwards
+  // iteration).
+  uint8_t* pHeapStart = (uint8_t*)pNewBytecode + pNewBytecode->sectionOffsets[BCS_HEAP];
+  uint8_t* pTarget = pHeapStart + heapSize;
+  uint16_t cursor = heapSize;
+  TABLE_COVERAGE(pBucket ? 1 : 0, 2, 586); // Hit 2/2
+  while (pBucket) {
+    CODE_COVERAGE(504); // Hit
+    uint16_t offsetStart = pBucket->offsetStart;
+    uint16_t bucketSize = cursor - offsetStart;
+    uint8_t* pBucketData = getBucketDataBegin(pBucket);
+
+    pTarget -= bucketSize;
+    memcpy(pTarget, pBucketData, bucketSize);
+
+    cursor = offsetStart;
+    pBucket = pBucket->prev;
+  }
+
+  // Update header fields
+  pNewBytecode->bytecodeSize = bytecodeSize;
+
+  // Convert pointers-to-RAM into their corresponding serialized form
+  serializePointers(vm, pNewBytecode);
+
+  uint16_t crcStartOffset = OFFSETOF(mvm_TsBytecodeHeader, crc) + sizeof pNewBytecode->crc;
+  uint16_t crcSize = bytecodeSize - crcStartOffset;
+  void* pCrcStart = (uint8_t*)pNewBytecode + crcStartOffset;
+  pNewBytecode->crc = MVM_CALC_CRC16_CCITT(pCrcStart, crcSize);
+
+  if (out_size) {
+    CODE_COVERAGE(587); // Hit
+    *out_size = bytecodeSize;
+  }
+  return (void*)pNewBytecode;
+}
+#endif // MVM_INCLUDE_SNAPSHOT_CAPABILITY
+
+#if MVM_INCLUDE_DEBUG_CAPABILITY
+
+void mvm_dbg_setBreakpoint(VM* vm, int bytecodeAddress) {
+  CODE_COVERAGE_UNTESTED(588); // Not hit
+
+  // These checks on the bytecode address are assertions rather than user faults
+  // because the address is probably not manually computed by a user, it's
+  // derived from some kind of debug symbol file. In a production environment,
+  // setting a breakpoint on an address that's never executed (e.g. because it's
+  // not executable) is not a VM failure.
+  VM_ASSERT(vm, (bytecodeAddress == - 1) || (bytecodeAddress >= getSectionOffset(vm->lpBytecode, BCS_ROM)));
+  VM_ASSERT(vm, (bytecodeAddress == -1) || (bytecodeAddress < getSectionOffset(vm->lpBytecode, vm_sectionAfter(vm, BCS_ROM))));
+
+  vm_TsBreakpoints* pBreakpoints = vm->pBreakpoints;
+  if (!pBreakpoints) {
+    CODE_COVERAGE_UNTESTED(832); // Not hit
+    LongPtr lpRomEnd;
+    getBytecodeSection(vm, BCS_ROM, &lpRomEnd);
+    uint16_t addressLimit = (uint16_t)LongPtr_sub(lpRomEnd, vm->lpBytecode);
+    size_t size = sizeof (vm_TsBreakpoints) + addressLimit / 8;
+    pBreakpoints = vm_malloc(vm, size);
+    if (!pBreakpoints) {
+      MVM_FATAL_ERROR(vm, MVM_E_MALLOC_FAIL);
+      return;
+    }
+    memset(pBreakpoints, 0, size);
+    pBreakpoints->addressLimit = addressLimit;
+    vm->pBreakpoints = pBreakpoints;
+  }
+
+  if (bytecodeAddress == -1) {
+    CODE_COVERAGE_UNTESTED(833); // Not hit
+    pBreakpoints->breakOnEveryInstruction = true;
+  } else if ((uint16_t)bytecodeAddress < pBreakpoints->addressLimit) {
+    CODE_COVERAGE_UNTESTED(834); // Not hit
+    uint8_t* pBits = &pBreakpoints->bits[bytecodeAddress >> 3];
+    uint8_t mask = (uint8_t)(1 << (bytecodeAddress & 7));
+    // Setting the same breakpoint twice has no effect
+    if (!(*pBits & mask)) {
+      *pBits |= mask;
+      pBreakpoints->count++;
+    }
+  }
+}
+
+void mvm_dbg_removeBreakpoint(VM* vm, uint16_t bytecodeAddress) {
+  CODE_COVERAGE_UNTESTED(589); // Not hit
+
+  vm_TsBreakpoints* pBreakpoints = vm->pBreakpoints;
+  if (!pBreakpoints) {
+    CODE_COVERAGE_UNTESTED(835); // Not hit
+    return;
+  }
+
+  // Note: an address of -1 arrives here as 0xFFFF, which can't be the address
+  // of an instruction
+  if (bytecodeAddress == 0xFFFF) {
+    CODE_COVERAGE_UNTESTED(590); // Not hit
+    pBreakpoints->breakOnEveryInstruction = false;
+  } else if (bytecodeAddress < pBreakpoints->addressLimit) {
+    CODE_COVERAGE_UNTESTED(591); // Not hit
+    uint8_t* pBits = &pBreakpoints->bits[bytecodeAddress >> 3];
+    uint8_t mask = (uint8_t)(1 << (bytecodeAddress & 7));
+    if (*pBits & mask) {
+      *pBits &= ~mask;
+      pBreakpoints->count--;
+    }
+  }
+
+  // Free the bitmap when the last breakpoint is removed, so that the run loop
+  // is back to a single NULL check per instruction
+  if (!pBreakpoints->count && !pBreakpoints->breakOnEveryInstruction) {
+    CODE_COVERAGE_UNTESTED(836); // Not hit
+    vm_free(vm, pBreakpoints);
+    vm->pBreakpoints = NULL;
+  }
+}
+
+void mvm_dbg_setBreakpointCallback(mvm_VM* vm, mvm_TfBreakpointCallback cb) {
+  CODE_COVERAGE_UNTESTED(592); // Not hit
+  // It doesn't strictly need to be null, but is probably a mistake if it's not.
+  VM_ASSERT(vm, vm->breakpointCallback == NULL);
+  vm->breakpointCallback = cb;
+}
+
+#endif // MVM_INCLUDE_DEBUG_CAPABILITY
+
+#if MVM_VERIFY_BYTECODE
+
+static inline bool vm_verifierBitGet(uint8_t* pBits, uint16_t index) {
+  return (pBits[index >> 3] & (uint8_t)(1 << (index & 7))) != 0;
+}
+
+static inline void vm_verifierBitSet(uint8_t* pBits, uint16_t index) {
+  pBits[index >> 3] |= (uint8_t)(1 << (index & 7));
+}
+
+static inline void vm_verifierBitClear(uint8_t* pBits, uint16_t index) {
+  pBits[index >> 3] &= (uint8_t)~(1 << (index & 7));
+}
+
+static inline uint16_t vm_verifierRead2(vm_TsVerifier* v, uint16_t address) {
+  return LongPtr_read2_aligned(LongPtr_add(v->lpBytecode, address));
+}
+
+/**
+ * Checks a handle: a global slot that a BytecodeMappedPtr refers to so that ROM
+ * can point to RAM.
+ */
+static TeError vm_verifyHandle(vm_TsVerifier* v, uint16_t address, bool requireShortPtr) {
+  uint16_t index;
+
+  if ((address < v->globalsStart) || (address >= v->globalsEnd)) {
+    CODE_COVERAGE_ERROR_PATH(842); // Not hit
+    return MVM_E_INVALID_BYTECODE;
+  }
+  // See BytecodeMappedPtr_decode_long
+  if (requireShortPtr && !Value_isShortPtr(vm_verifierRead2(v, address))) {
+    CODE_COVERAGE_ERROR_PATH(843); // Not hit
+    return MVM_E_INVALID_BYTECODE;
+  }
+  index = (address - v->globalsStart) >> 1;
+  if (index < v->firstHandle) {
+    v->firstHandle = index;
+  }
+  return MVM_E_SUCCESS;
+}
+
+/**
+ * Checks a value in the image. ROM allocations that the value refers to are
+ * queued to be verified later (see vm_verifyBytecode). ShortPtr values are only
+ * allowed in the sections that are copied to RAM, where they are the offset of
+ * an allocation in the heap section.
+ */
+static TeError vm_verifyValue(vm_TsVerifier* v, Value value, bool allowShortPtr) {
+  uint16_t address;
+  uint16_t headerWord;
+
+  if (Value_isVirtualInt14(value)) {
+    return MVM_E_SUCCESS;
+  }
+
+  if (Value_isShortPtr(value)) {
+    if (!allowShortPtr || (value >= v->heapEnd - v->heapStart)) goto SUB_INVALID;
+    if (!vm_verifierBitGet(v->pHeapAllocations, (v->heapStart + value) >> 1)) goto SUB_INVALID;
+    return MVM_E_SUCCESS;
+  }
+
+  if (value < VM_VALUE_WELLKNOWN_END) {
+    return MVM_E_SUCCESS;
+  }
+
+  address = value & 0xFFFC;
+  if (address >= v->globalsStart) {
+    return vm_verifyHandle(v, address, true);
+  }
+  if ((address < v->romStart + 2) || (address >= v->romEnd)) goto SUB_INVALID;
+
+  headerWord = vm_verifierRead2(v, address - 2);
+  if ((vm_getTypeCodeFromHeaderWord(headerWord) == TC_REF_FUNCTION) &&
+    (headerWord & VM_FUNCTION_HEADER_CONTINUATION_FLAG))
+  {
+    // An async resume point. The resume point itself is checked after its
+    // containing function has been verified.
+    uint16_t backDistance = (headerWord & VM_FUNCTION_HEADER_BACK_POINTER_MASK) * 4;
+    if ((backDistance == 0) || (backDistance > address - v->romStart - 2)) goto SUB_INVALID;
+    vm_verifierBitSet(v->pResumePoints, address >> 1);
+    address -= backDistance;
+    headerWord = vm_verifierRead2(v, address - 2);
+    if (vm_getTypeCodeFromHeaderWord(headerWord) != TC_REF_FUNCTION) goto SUB_INVALID;
+    if (headerWord & VM_FUNCTION_HEADER_CONTINUATION_FLAG) goto SUB_INVALID;
+  }
+
+  // The async catch block runs in the frame of an async function, so it can't
+  // be called as a function in its own right
+  if (address == v->asyncCatchBlock) goto SUB_INVALID;
+
+  vm_verifierBitSet(v->pQueued, address >> 1);
+  return MVM_E_SUCCESS;
+
+SUB_INVALID:
+  CODE_COVERAGE_ERROR_PATH(844); // Not hit
+  return MVM_E_INVALID_BYTECODE;
+}
+
+/**
+ * Checks the content of a ROM or heap allocation other than a function, given
+ * that the allocation is already known to lie within its section.
+ */
+static TeError vm_verifyAllocation(vm_TsVerifier* v, uint16_t address, uint16_t headerWord, bool allowShortPtr) {
+  TeTypeCode tc = vm_getTypeCodeFromHeaderWord(headerWord);
+  uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+  uint16_t end;
+  TeError err;
+
+  switch (tc) {
+    case TC_REF_TOMBSTONE:
+    case TC_REF_FUNCTION:
+    case TC_REF_VIRTUAL:
+    case TC_REF_SYMBOL:
+      goto SUB_INVALID;
+
+    // These are read without looking at the size
+    case TC_REF_INT32:
+      if (size != 4) goto SUB_INVALID;
+      return MVM_E_SUCCESS;
+    case TC_REF_FLOAT64:
+      if (size != 8) goto SUB_INVALID;
+      return MVM_E_SUCCESS;
+
+    case TC_REF_HOST_FUNC:
+      if ((size != 2) || (vm_verifierRead2(v, address) >= v->importCount)) goto SUB_INVALID;
+      return MVM_E_SUCCESS;
+
+    default:
+      if (tc < TC_REF_DIVIDER_CONTAINER_TYPES) {
+        return MVM_E_SUCCESS;
+      }
+      end = address + ((size + 1) & 0xFFFE);
+      while (address < end) {
+        err = vm_verifyValue(v, vm_verifierRead2(v, address), allowShortPtr);
+        if (err) return err;
+        address += 2;
+      }
+      return MVM_E_SUCCESS;
+  }
+
+SUB_INVALID:
+  CODE_COVERAGE_ERROR_PATH(845); // Not hit
+  return MVM_E_INVALID_BYTECODE;
+}
+
+/**
+ * Decodes the instruction at `address` in the function being verified and
+ * checks everything about it that doesn't depend on the stack state: the
+ * opcode, that the instruction and its targets lie within ROM, and the
+ * literal operands (global indexes, import indexes and values).
+ */
+// The jump target of case `i` of the TABLE_SWITCH or LOOKUP_SWITCH at
+// `address`. The default case is the instruction's `target`.
+static int32_t vm_verifySwitchCaseTarget(vm_TsVerifier* v, uint16_t address, vm_TsVerifierInstruction* instr, uint16_t i) {
+  LongPtr lp = LongPtr_add(v->lpBytecode, address);
+  bool isTable = LongPtr_read1(LongPtr_add(lp, 1)) == VM_OP4_TABLE_SWITCH;
+  uint16_t offsetOfOffset = isTable ? 7 + i * 2 : 7 + i * 4;
+  return (int32_t)address + instr->size + (int16_t)LongPtr_read2_unaligned(LongPtr_add(lp, offsetOfOffset));
+}
+
+static TeError vm_verifyDecode(vm_TsVerifier* v, uint16_t address, vm_TsVerifierInstruction* out) {
+  LongPtr lp = LongPtr_add(v->lpBytecode, address);
+  uint8_t opcode = LongPtr_read1(lp);
+  uint8_t param = opcode & 0xF;
+  uint16_t literal = 0;
+  int32_t target = 0;
+  bool hasTarget = false;
+  TeError err;
+
+  out->size = 1;
+  out->pop = 0;
+  out->push = 0;
+  out->check = VM_VC_NONE;
+  out->operand = param;
+  out->fallsThrough = true;
+
+  // Sets the instruction size and reads the byte or word at `offset`, after
+  // checking that the whole instruction is within ROM
+  #define VERIFY_SIZE(n) do { \
+    if ((uint32_t)address + (n) > v->romEnd) goto SUB_INVALID; \
+    out->size = (n); \
+  } while (false)
+  #define VERIFY_TARGET(t) do { target = (t); hasTarget = true; } while (false)
+  #define VERIFY_READ_1(offset) LongPtr_read1(LongPtr_add(lp, (offset)))
+  #define VERIFY_READ_2(offset) LongPtr_read2_unaligned(LongPtr_add(lp, (offset)))
+
+  switch (opcode >> 4) {
+    case VM_OP_LOAD_SMALL_LITERAL:
+      if (param >= smallLiteralsSize) goto SUB_INVALID;
+      out->push = 1;
+      break;
+
+    case VM_OP_LOAD_VAR_1:
+      out->check = VM_VC_VAR;
+      out->push = 1;
+      break;
+
+    case VM_OP_LOAD_SCOPED_1:
+    case VM_OP_LOAD_ARG_1:
+    case VM_OP_FIXED_ARRAY_NEW_1:
+      out->push = 1;
+      break;
+
+    case VM_OP_CALL_5:
+      VERIFY_SIZE(3);
+      literal = VERIFY_READ_2(1);
+      // The target must be a bytecode function (SUB_CALL_BYTECODE_FUNC)
+      if ((literal & 3) || (literal < v->romStart + 2) || (literal >= v->romEnd)) goto SUB_INVALID;
+      if (vm_getTypeCodeFromHeaderWord(vm_verifierRead2(v, literal - 2)) != TC_REF_FUNCTION) goto SUB_INVALID;
+      err = vm_verifyValue(v, literal | 1, false);
+      if (err) return err;
+      out->pop = param;
+      out->push = 1;
+      break;
+
+    case VM_OP_STORE_VAR_1:
+      out->check = VM_VC_VAR;
+      out->pop = 1;
+      break;
+
+    case VM_OP_STORE_SCOPED_1:
+      out->pop = 1;
+      break;
+
+    case VM_OP_NUM_OP:
+      if (param >= VM_NUM_OP_END) goto SUB_INVALID;
+      out->pop = (param < VM_NUM_OP_DIVIDER) ? 2 : 1;
+      out->push = 1;
+      break;
+
+    case VM_OP_BIT_OP:
+      if (param >= VM_BIT_OP_END) goto SUB_INVALID;
+      out->pop = (param < VM_BIT_OP_DIVIDER_2) ? 2 : 1;
+      out->push = 1;
+      break;
+
+    case VM_OP_EXTENDED_1:
+      switch (param) {
+        case VM_OP1_RETURN:
+          out->check = VM_VC_RETURN;
+          out->pop = 1;
+          out->fallsThrough = false;
+          break;
+        case VM_OP1_THROW:
+          out->pop = 1;
+          out->fallsThrough = false;
+          break;
+        case VM_OP1_NEW:
+          VERIFY_SIZE(2);
+          literal = VERIFY_READ_1(1);
+          if (literal & ~AF_ARG_COUNT_MASK) goto SUB_INVALID;
+          out->pop = (uint8_t)(literal + 1);
+          out->push = 1;
+          break;
+        case VM_OP1_SCOPE_NEW:
+          VERIFY_SIZE(2);
+          break;
+        case VM_OP1_CLOSURE_NEW:
+        case VM_OP1_TYPE_CODE_OF:
+        case VM_OP1_TYPEOF:
+        case VM_OP1_LOGICAL_NOT:
+          out->pop = 1;
+          out->push = 1;
+          break;
+        case VM_OP1_POP:
+          out->pop = 1;
+          break;
+        case VM_OP1_OBJECT_NEW:
+          out->push = 1;
+          break;
+        case VM_OP1_OBJECT_GET_1:
+        case VM_OP1_ADD:
+        case VM_OP1_EQUAL:
+        case VM_OP1_NOT_EQUAL:
+          out->pop = 2;
+          out->push = 1;
+          break;
+        case VM_OP1_OBJECT_SET_1:
+          out->pop = 3;
+          break;
+        default:
+          goto SUB_INVALID;
+      }
+      break;
+
+    case VM_OP_EXTENDED_2:
+      VERIFY_SIZE(2);
+      literal = VERIFY_READ_1(1);
+      out->operand = literal;
+      switch (param) {
+        case VM_OP2_BRANCH_1:
+          out->pop = 1;
+          VERIFY_TARGET((int32_t)address + 2 + (int8_t)literal);
+          break;
+        case VM_OP2_STORE_ARG:
+        case VM_OP2_STORE_SCOPED_2:
+          out->pop = 1;
+          break;
+        case VM_OP2_STORE_VAR_2:
+          out->check = VM_VC_VAR;
+          out->pop = 1;
+          break;
+        case VM_OP2_BRANCH_LESS_THAN_1:
+        case VM_OP2_BRANCH_LESS_EQUAL_1:
+          out->pop = 2;
+          VERIFY_TARGET((int32_t)address + 2 + (int8_t)literal);
+          break;
+        case VM_OP2_JUMP_1:
+          VERIFY_TARGET((int32_t)address + 2 + (int8_t)literal);
+          out->fallsThrough = false;
+          break;
+        case VM_OP2_CALL_HOST:
+          VERIFY_SIZE(3);
+          // The argument count includes `this`
+          if ((literal & AF_ARG_COUNT_MASK) == 0) goto SUB_INVALID;
+          if (VERIFY_READ_1(2) >= v->importCount) goto SUB_INVALID;
+          out->pop = literal & AF_ARG_COUNT_MASK;
+          out->push = (literal & AF_VOID_CALLED) ? 0 : 1;
+          break;
+        case VM_OP2_CALL_3:
+          out->pop = (uint8_t)((literal & AF_ARG_COUNT_MASK) + 1);
+          out->push = (literal & AF_VOID_CALLED) ? 0 : 1;
+          break;
+        case VM_OP2_LOAD_SCOPED_2:
+        case VM_OP2_ARRAY_NEW:
+        case VM_OP2_FIXED_ARRAY_NEW_2:
+          out->push = 1;
+          break;
+        case VM_OP2_LOAD_VAR_2:
+          out->check = VM_VC_VAR;
+          out->push = 1;
+          break;
+        case VM_OP2_EXTENDED_4:
+          switch (literal) {
+            case VM_OP4_START_TRY:
+              VERIFY_SIZE(4);
+              literal = VERIFY_READ_2(2);
+              // Catch blocks are 4-byte aligned and the target is pushed to the
+              // stack as a BytecodeMappedPtr (see SUB_THROW)
+              if ((literal & 3) != 1) goto SUB_INVALID;
+              VERIFY_TARGET(literal - 1);
+              out->check = VM_VC_START_TRY;
+              out->push = 2;
+              break;
+            case VM_OP4_END_TRY:
+              out->check = VM_VC_END_TRY;
+              break;
+            case VM_OP4_OBJECT_KEYS:
+            case VM_OP4_UINT8_ARRAY_NEW:
+            case VM_OP4_TYPE_CODE_OF:
+              out->pop = 1;
+              out->push = 1;
+              break;
+            case VM_OP4_CLASS_CREATE:
+              out->pop = 2;
+              out->push = 1;
+              break;
+            case VM_OP4_LOAD_REG_CLOSURE:
+            case VM_OP4_SCOPE_SAVE:
+              out->push = 1;
+              break;
+            case VM_OP4_SCOPE_PUSH:
+            case VM_OP4_GAS:
+              VERIFY_SIZE(3);
+              break;
+            case VM_OP4_SCOPE_POP:
+            case VM_OP4_ENQUEUE_JOB:
+              break;
+            case VM_OP4_LOAD_SCOPED_OUTER:
+              VERIFY_SIZE(4);
+              out->push = 1;
+              break;
+            case VM_OP4_STORE_SCOPED_OUTER:
+              VERIFY_SIZE(4);
+              out->pop = 1;
+              break;
+            case VM_OP4_TABLE_SWITCH:
+              VERIFY_SIZE(7);
+              literal = VERIFY_READ_1(4);
+              VERIFY_SIZE(7 + literal * 2);
+              out->operand = literal;
+              VERIFY_TARGET((int32_t)address + out->size + (int16_t)VERIFY_READ_2(5));
+              out->check = VM_VC_SWITCH;
+              out->fallsThrough = false;
+              break;
+            case VM_OP4_LOOKUP_SWITCH: {
+              VERIFY_SIZE(5);
+              literal = VERIFY_READ_1(2);
+              VERIFY_SIZE(5 + literal * 4);
+              // Case values must be int14 in ascending order for the binary
+              // search
+              for (uint16_t i = 0; i < literal; i++) {
+                int16_t caseValue = (int16_t)VERIFY_READ_2(5 + i * 4);
+                if ((caseValue < VM_MIN_INT14) || (caseValue > VM_MAX_INT14)) goto SUB_INVALID;
+                if (i && (caseValue <= (int16_t)VERIFY_READ_2(1 + i * 4))) goto SUB_INVALID;
+              }
+              out->operand = literal;
+              VERIFY_TARGET((int32_t)address + out->size + (int16_t)VERIFY_READ_2(3));
+              out->check = VM_VC_SWITCH;
+              out->fallsThrough = false;
+              break;
+            }
+            case VM_OP4_ARRAY_ITER_START:
+              out->pop = 1;
+              out->push = 2;
+              out->check = VM_VC_ITER_START;
+              break;
+            case VM_OP4_ARRAY_ITER_NEXT:
+              VERIFY_SIZE(4);
+              VERIFY_TARGET((int32_t)address + 4 + (int16_t)VERIFY_READ_2(2));
+              out->push = 1;
+              out->check = VM_VC_ITER_NEXT;
+              break;
+            case VM_OP4_VAR_NUM_OP:
+            case VM_OP4_VAR_LIT_NUM_OP: {
+              uint8_t op;
+              uint8_t left;
+              VERIFY_SIZE(5);
+              // Only the binary operations, which SUB_VAR_NUM_OP hands to the
+              // stack-machine implementation if they aren't int14
+              op = VERIFY_READ_1(2);
+              if ((op >> 4) == VM_OP_NUM_OP) {
+                if ((op & 0xF) >= VM_NUM_OP_DIVIDER) goto SUB_INVALID;
+              } else if ((op >> 4) == VM_OP_BIT_OP) {
+                if ((op & 0xF) >= VM_BIT_OP_DIVIDER_2) goto SUB_INVALID;
+              } else {
+                goto SUB_INVALID;
+              }
+              left = VERIFY_READ_1(3);
+              out->operand = (left << 8) | ((literal == VM_OP4_VAR_NUM_OP) ? VERIFY_READ_1(4) : left);
+              out->check = VM_VC_FRAME_VARS;
+              out->push = 1;
+              break;
+            }
+            case VM_OP4_ASYNC_START:
+              VERIFY_SIZE(3);
+              // Slots 0 and 1 of the closure are the continuation and callback
+              if ((VERIFY_READ_1(2) & 0x7F) < 2) goto SUB_INVALID;
+              out->check = VM_VC_ASYNC_START;
+              out->push = 3;
+              break;
+            case VM_OP4_ASYNC_RETURN:
+              out->check = VM_VC_ASYNC;
+              out->pop = 1;
+              out->fallsThrough = false;
+              break;
+            case VM_OP4_ASYNC_COMPLETE:
+              out->check = VM_VC_ASYNC_COMPLETE;
+              out->fallsThrough = false;
+              break;
+            case VM_OP4_TAIL_CALL:
+              VERIFY_SIZE(3);
+              literal = VERIFY_READ_1(2);
+              if (literal & ~AF_ARG_COUNT_MASK) goto SUB_INVALID;
+              out->check = VM_VC_RETURN;
+              out->pop = (uint8_t)(literal + 1);
+              out->fallsThrough = false;
+              break;
+            default:
+              goto SUB_INVALID;
+          }
+          break;
+        default:
+          // The short-call table (CALL_6) is not emitted by the compiler and
+          // LOAD_ARG_2 is not implemented
+          goto SUB_INVALID;
+      }
+      break;
+
+    case VM_OP_EXTENDED_3:
+      if (param >= VM_OP3_DIVIDER_1) {
+        VERIFY_SIZE(3);
+        literal = VERIFY_READ_2(1);
+        out->operand = literal;
+      }
+      switch (param) {
+        case VM_OP3_POP_N:
+          VERIFY_SIZE(2);
+          out->pop = VERIFY_READ_1(1);
+          break;
+        case VM_OP3_SCOPE_DISCARD:
+        case VM_OP3_SCOPE_CLONE:
+          break;
+        case VM_OP3_AWAIT: {
+          // See SUB_AWAIT for the layout of the resume point
+          uint16_t resumePoint = (address + 1 + 2 + 3) & 0xFFFC;
+          uint16_t headerWord;
+          if (resumePoint + 3 > v->romEnd) goto SUB_INVALID;
+          headerWord = vm_verifierRead2(v, resumePoint - 2);
+          if (vm_getTypeCodeFromHeaderWord(headerWord) != TC_REF_FUNCTION) goto SUB_INVALID;
+          if (!(headerWord & VM_FUNCTION_HEADER_CONTINUATION_FLAG)) goto SUB_INVALID;
+          if ((headerWord & VM_FUNCTION_HEADER_BACK_POINTER_MASK) * 4 != resumePoint - v->entry) goto SUB_INVALID;
+          VERIFY_TARGET(resumePoint);
+          out->check = VM_VC_AWAIT;
+          out->pop = 1;
+          out->fallsThrough = false;
+          break;
+        }
+        case VM_OP3_AWAIT_CALL:
+          VERIFY_SIZE(2);
+          literal = VERIFY_READ_1(1);
+          if (literal & ~AF_ARG_COUNT_MASK) goto SUB_INVALID;
+          out->check = VM_VC_ASYNC;
+          out->pop = (uint8_t)(literal + 1);
+          out->push = 1;
+          break;
+        case VM_OP3_ASYNC_RESUME:
+          VERIFY_SIZE(3);
+          out->check = VM_VC_ASYNC_RESUME;
+          out->operand = VERIFY_READ_2(1);
+          out->push = 1;
+          break;
+        case VM_OP3_LOAD_GLOBAL_CALLEE:
+          VERIFY_SIZE(3);
+          literal = VERIFY_READ_2(1);
+          out->operand = literal;
+          if (literal >= (v->globalsEnd - v->globalsStart) >> 1) goto SUB_INVALID;
+          out->push = 2;
+          break;
+        case VM_OP3_JUMP_2:
+          VERIFY_TARGET((int32_t)address + 3 + (int16_t)literal);
+          out->fallsThrough = false;
+          break;
+        case VM_OP3_LOAD_LITERAL:
+          err = vm_verifyValue(v, literal, false);
+          if (err) return err;
+          out->push = 1;
+          break;
+        case VM_OP3_LOAD_GLOBAL_3:
+          if (literal >= (v->globalsEnd - v->globalsStart) >> 1) goto SUB_INVALID;
+          out->push = 1;
+          break;
+        case VM_OP3_LOAD_SCOPED_3:
+          out->push = 1;
+          break;
+        case VM_OP3_OBJECT_GET_2:
+          err = vm_verifyValue(v, literal, false);
+          if (err) return err;
+          out->pop = 1;
+          out->push = 1;
+          break;
+        case VM_OP3_BRANCH_2:
+          VERIFY_TARGET((int32_t)address + 3 + (int16_t)literal);
+          out->pop = 1;
+          break;
+        case VM_OP3_STORE_GLOBAL_3:
+          if (literal >= (v->globalsEnd - v->globalsStart) >> 1) goto SUB_INVALID;
+          if (literal >= v->globalStoreEnd) {
+            v->globalStoreEnd = literal + 1;
+          }
+          out->pop = 1;
+          break;
+        case VM_OP3_STORE_SCOPED_3:
+          out->pop = 1;
+          break;
+        case VM_OP3_OBJECT_SET_2:
+          err = vm_verifyValue(v, literal, false);
+          if (err) return err;
+          out->pop = 2;
+          break;
+        default:
+          goto SUB_INVALID;
       }
-    }
+      break;
 
-    default: {
-      VM_ASSERT_UNREACHABLE(vm);
-      return false;
-    }
+    default:
+      // The short-call table (CALL_1) is not emitted by the compiler, and
+      // ARRAY_GET_1 and ARRAY_SET_1 have no bounds checks
+      goto SUB_INVALID;
   }
-}
 
-bool mvm_isNaN(mvm_Value value) {
-  CODE_COVERAGE_UNTESTED(573); // Not hit
-  return value == VM_VALUE_NAN;
-}
+  #undef VERIFY_SIZE
+  #undef VERIFY_TARGET
+  #undef VERIFY_READ_1
+  #undef VERIFY_READ_2
 
-#if MVM_INCLUDE_SNAPSHOT_CAPABILITY
+  if (out->fallsThrough && (address + out->size >= v->romEnd)) goto SUB_INVALID;
 
-// Called during snapshotting to convert native pointers to their position-independent form
-static void serializePtr(VM* vm, Value* pv) {
-  CODE_COVERAGE(576); // Hit
-  Value v = *pv;
-  if (!Value_isShortPtr(v)) {
-    CODE_COVERAGE(577); // Hit
-    return;
-  } else {
-    CODE_COVERAGE(578); // Hit
+  out->hasTarget = hasTarget;
+  if (out->hasTarget) {
+    if ((target < v->romStart) || (target >= v->romEnd)) goto SUB_INVALID;
+    out->target = (uint16_t)target;
   }
-  void* p = ShortPtr_decode(vm, v);
 
-  // Pointers are encoded as an offset in the heap
-  uint16_t offsetInHeap = pointerOffsetInHeap(vm, vm->pLastBucket, p);
+  if (out->check == VM_VC_SWITCH) {
+    for (uint16_t i = 0; i < out->operand; i++) {
+      target = vm_verifySwitchCaseTarget(v, address, out, i);
+      if ((target < v->romStart) || (target >= v->romEnd)) goto SUB_INVALID;
+    }
+  }
 
-  // The lowest bit must be zero so that this is tagged as a "ShortPtr".
-  VM_ASSERT(vm, (offsetInHeap & 1) == 0);
+  return MVM_E_SUCCESS;
 
-  *pv = offsetInHeap;
+SUB_INVALID:
+  CODE_COVERAGE_ERROR_PATH(846); // Not hit
+  return MVM_E_INVALID_BYTECODE;
 }
 
-// The opposite of `loadPointers`
-static void serializePointers(VM* vm, mvm_TsBytecodeHeader* bc) {
-  CODE_COVERAGE(579); // Hit
-  // CAREFUL! This function mutates `bc`, not `vm`.
-
-  uint16_t n;
-  uint16_t* p;
-
-  uint16_t heapOffset = bc->sectionOffsets[BCS_HEAP];
-  uint16_t heapSize = bc->bytecodeSize - heapOffset;
-
-  uint16_t* pGlobals = (uint16_t*)((uint8_t*)bc + bc->sectionOffsets[BCS_GLOBALS]);
-  uint16_t* heapMemory = (uint16_t*)((uint8_t*)bc + heapOffset);
+/**
+ * Records the stack state at the start of an instruction, or checks it against
+ * the state already recorded from another path. Resume points (ASYNC_RESUME)
+ * can only be reached from an AWAIT.
+ */
+static TeError vm_verifyJoin(vm_TsVerifier* v, uint16_t from, uint16_t to, uint8_t depth, uint8_t tryIndex, uint8_t iterIndex, bool isAwait) {
+  uint8_t opcode = LongPtr_read1(LongPtr_add(v->lpBytecode, to));
+  bool isResumePoint = opcode == ((VM_OP_EXTENDED_3 << 4) | VM_OP3_ASYNC_RESUME);
 
-  // Roots in global variables
-  uint16_t globalsSize = bc->sectionOffsets[BCS_GLOBALS + 1] - bc->sectionOffsets[BCS_GLOBALS];
-  p = pGlobals;
-  n = globalsSize / 2;
-  TABLE_COVERAGE(n ? 1 : 0, 2, 580); // Hit 1/2
-  while (n--) {
-    serializePtr(vm, p++);
+  if (isResumePoint != isAwait) {
+    CODE_COVERAGE_ERROR_PATH(847); // Not hit
+    return MVM_E_INVALID_BYTECODE;
   }
 
-  // Pointers in heap memory
-  p = heapMemory;
-  uint16_t* heapEnd = (uint16_t*)((uint8_t*)heapMemory + heapSize);
-  while (p < heapEnd) {
-    CODE_COVERAGE(581); // Hit
-    uint16_t header = *p++;
-    uint16_t size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(header);
-    int words = size / 2; // Note: round **down** to nearest word
-    uint16_t* next = p + (size + 1) / 2; // Note: round **up** to nearest word
-    TABLE_COVERAGE(next == p + words ? 1 : 0, 2, 694); // Hit 2/2
-    TeTypeCode tc = vm_getTypeCodeFromHeaderWord(header);
-
-    if (tc < TC_REF_DIVIDER_CONTAINER_TYPES) { // Non-container types
-      CODE_COVERAGE(582); // Hit
-      p = next;
-      continue;
-    } else {
-      // Else, container types
-      CODE_COVERAGE(583); // Hit
+  if (vm_verifierBitGet(v->pReached, to)) {
+    if ((v->pDepth[to - v->lo] != depth) || (v->pTry[to - v->lo] != tryIndex) || (v->pIter[to - v->lo] != iterIndex)) {
+      CODE_COVERAGE_ERROR_PATH(848); // Not hit
+      return MVM_E_INVALID_BYTECODE;
     }
-
-    while (words--) {
-      if (Value_isShortPtr(*p))
-        serializePtr(vm, p);
-      p++;
+  } else {
+    vm_verifierBitSet(v->pReached, to);
+    v->pDepth[to - v->lo] = depth;
+    v->pTry[to - v->lo] = tryIndex;
+    v->pIter[to - v->lo] = iterIndex;
+    // Instructions after `from` are still to come in the current sweep
+    if (to <= from) {
+      v->again = true;
     }
-    p = next;
   }
+
+  return MVM_E_SUCCESS;
 }
 
-void* mvm_createSnapshot(mvm_VM* vm, size_t* out_size) {
-  CODE_COVERAGE(503); // Hit
-  if (out_size)
-    *out_size = 0;
+/**
+ * Verifies the code reachable from `entry`, which is entered with `entryDepth`
+ * items on the stack of a frame that has room for `maxDepth` items.
+ *
+ * The first pass finds the reachable instructions, so that the second pass
+ * can allocate the per-instruction state for just that address range. The
+ * second pass is a data-flow sweep that assigns each instruction a stack depth,
+ * the innermost enclosing try block and the innermost live iteration cursor,
+ * and checks that every path into an instruction agrees on all three.
+ */
+static TeError vm_verifyFunction(vm_TsVerifier* v, uint16_t entry, uint8_t entryDepth, uint8_t maxDepth) {
+  vm_TsVerifierInstruction instr;
+  vm_TsVerifierTry* tries = NULL;
+  vm_TsVerifierIter* iters = NULL;
+  uint8_t* pState = NULL;
+  uint16_t lo = entry;
+  uint16_t hi = entry;
+  uint16_t address;
+  uint16_t tryCount;
+  uint16_t triesUsed;
+  uint16_t iterCount;
+  uint16_t itersUsed;
+  uint16_t span;
+  size_t stateSize;
+  TeError err = MVM_E_SUCCESS;
 
-  uint16_t heapOffset = getSectionOffset(vm->lpBytecode, BCS_HEAP);
-  uint16_t heapSize = getHeapSize(vm);
+  CODE_COVERAGE_UNTESTED(849); // Not hit
 
-  // This assumes that the heap is the last section in the bytecode. Since the
-  // heap is the only part of the bytecode image that changes size, we can just
-  // calculate the new bytecode size as follows
-  VM_ASSERT(vm, BCS_HEAP == BCS_SECTION_COUNT - 1);
-  uint32_t bytecodeSize = (uint32_t)heapOffset + heapSize;
+  v->entry = entry;
+  vm_verifierBitSet(v->pReached, entry);
 
-  if (bytecodeSize > 0xFFFF) {
-    CODE_COVERAGE_ERROR_PATH(584); // Not hit
-    MVM_FATAL_ERROR(vm, MVM_E_SNAPSHOT_TOO_LARGE);
-  } else {
-    CODE_COVERAGE(585); // Hit
-  }
+  // Pass 1: reachability
+  do {
+    v->again = false;
+    tryCount = 0;
+    iterCount = 0;
+    for (address = lo; address <= hi; address++) {
+      if (!vm_verifierBitGet(v->pReached, address)) continue;
+      err = vm_verifyDecode(v, address, &instr);
+      if (err) goto SUB_EXIT;
+      if (instr.check == VM_VC_START_TRY) {
+        tryCount++;
+      } else if (instr.check == VM_VC_ITER_START) {
+        iterCount++;
+      }
+      // Each instruction has at most 2 successors, plus the cases of a switch
+      uint16_t successorCount = (instr.check == VM_VC_SWITCH) ? 2 + instr.operand : 2;
+      for (uint16_t i = 0; i < successorCount; i++) {
+        uint16_t next;
+        if (i == 0) {
+          if (!instr.fallsThrough) continue;
+          next = address + instr.size;
+        } else if (i == 1) {
+          if (!instr.hasTarget) continue;
+          next = instr.target;
+        } else {
+          next = (uint16_t)vm_verifySwitchCaseTarget(v, address, &instr, i - 2);
+        }
+        if (vm_verifierBitGet(v->pReached, next)) continue;
+        vm_verifierBitSet(v->pReached, next);
+        if (next <= address) {
+          v->again = true;
+        }
+        if (next < lo) lo = next;
+        if (next > hi) hi = next;
+      }
+    }
+  } while (v->again);
 
-  mvm_TsBytecodeHeader* pNewBytecode = vm_malloc(vm, bytecodeSize);
-  if (!pNewBytecode) return NULL;
+  // Try block indexes are stored in a byte, and 0 and 1 are reserved. Cursor
+  // indexes are also stored in a byte, and 0 is reserved.
+  if ((tryCount > 0xFD) || (iterCount > 0xFE)) {
+    CODE_COVERAGE_ERROR_PATH(850); // Not hit
+    err = MVM_E_INVALID_BYTECODE;
+    goto SUB_EXIT;
+  }
 
-  // The globals and heap are the last parts of the image because they're the
-  // only mutable sections
-  VM_ASSERT(vm, BCS_GLOBALS == BCS_SECTION_COUNT - 2);
-  uint16_t sizeOfConstantPart = getSectionOffset(vm->lpBytecode, BCS_GLOBALS);
+  span = hi - lo + 1;
+  // The per-instruction bytes are followed by the tables, which need to be
+  // 2-byte aligned
+  stateSize = ((size_t)span * 3 + 1) & ~(size_t)1;
+  pState = MVM_CONTEXTUAL_MALLOC(stateSize + (tryCount + 2) * sizeof (vm_TsVerifierTry) + (iterCount + 1) * sizeof (vm_TsVerifierIter), v->context);
+  if (!pState) {
+    CODE_COVERAGE_ERROR_PATH(851); // Not hit
+    err = MVM_E_MALLOC_FAIL;
+    goto SUB_EXIT;
+  }
+  v->lo = lo;
+  v->pDepth = pState;
+  v->pTry = pState + span;
+  v->pIter = pState + span * 2;
+  tries = (vm_TsVerifierTry*)(pState + stateSize);
+  iters = (vm_TsVerifierIter*)(tries + tryCount + 2);
+  tries[0].startTryAddress = 0;
+  tries[0].stackDepthBefore = 0;
+  tries[0].parent = 0;
+  tries[0].isAsync = false;
+  // The root catch block of an async function is pushed by ASYNC_START in
+  // slots 1-2, after the synchronous result in slot 0
+  tries[1].startTryAddress = 0;
+  tries[1].stackDepthBefore = 1;
+  tries[1].parent = 0;
+  tries[1].isAsync = true;
+  triesUsed = 2;
+  iters[0].iterStartAddress = 0;
+  iters[0].stackDepthAfter = 0;
+  iters[0].parent = 0;
+  itersUsed = 1;
+
+  // Pass 2: stack state. pReached now marks the instructions whose state is
+  // known.
+  for (address = lo; address <= hi; address++) {
+    vm_verifierBitClear(v->pReached, address);
+  }
+  v->again = false;
+  err = vm_verifyJoin(v, entry, entry, entryDepth, 0, 0, false);
+  if (err) goto SUB_EXIT;
+  if (entryDepth > maxDepth) goto SUB_INVALID;
 
-  // The first part of the snapshot doesn't change between executions (except
-  // some header fields, which we'll update later).
-  memcpy_long(pNewBytecode, vm->lpBytecode, sizeOfConstantPart);
+  do {
+    v->again = false;
+    for (address = lo; address <= hi; address++) {
+      uint8_t depth;
+      uint8_t tryIndex;
+      uint8_t floor;
+      uint8_t nextDepth;
+      uint8_t nextTry;
+      uint8_t iterIndex;
+      uint8_t nextIter;
+
+      if (!vm_verifierBitGet(v->pReached, address)) continue;
+      depth = v->pDepth[address - lo];
+      tryIndex = v->pTry[address - lo];
+      iterIndex = v->pIter[address - lo];
+      err = vm_verifyDecode(v, address, &instr);
+      if (err) goto SUB_EXIT;
+      vm_verifierBitSet(v->pCode, address);
+
+      // Nothing may pop the catch target of the enclosing try block
+      floor = tryIndex ? tries[tryIndex].stackDepthBefore + 2 : 0;
+      if ((instr.pop > depth) || (depth - instr.pop < floor)) goto SUB_INVALID;
+      if (depth - instr.pop + instr.push > maxDepth) goto SUB_INVALID;
+      nextDepth = depth - instr.pop + instr.push;
+      nextTry = tryIndex;
+
+      // Popping either slot of an iteration cursor ends it
+      nextIter = iterIndex;
+      while (nextIter && (depth - instr.pop < iters[nextIter].stackDepthAfter)) {
+        nextIter = iters[nextIter].parent;
+      }
 
-  // Snapshot the globals memory
-  uint16_t sizeOfGlobals = getSectionSize(vm, BCS_GLOBALS);
-  memcpy((uint8_t*)pNewBytecode + pNewBytecode->sectionOffsets[BCS_GLOBALS], vm->globals, sizeOfGlobals);
+      switch (instr.check) {
+        case VM_VC_VAR: {
+          // Variable indexes are relative to the top of the stack after the
+          // pop, and may not refer to the slots of a catch target or an
+          // iteration cursor
+          uint16_t slot;
+          uint8_t t;
+          if (instr.operand >= depth - instr.pop) goto SUB_INVALID;
+          slot = depth - instr.pop - 1 - instr.operand;
+          for (t = tryIndex; t; t = tries[t].parent) {
+            if ((slot == tries[t].stackDepthBefore) || (slot == tries[t].stackDepthBefore + 1)) goto SUB_INVALID;
+          }
+          for (t = iterIndex; t; t = iters[t].parent) {
+            if ((slot == iters[t].stackDepthAfter - 2) || (slot == iters[t].stackDepthAfter - 1)) goto SUB_INVALID;
+          }
+          break;
+        }
+        case VM_VC_FRAME_VARS: {
+          // Both slot indexes are relative to the frame base, and follow the
+          // same rules as VM_VC_VAR
+          uint8_t slots[2] = { (uint8_t)(instr.operand >> 8), (uint8_t)instr.operand };
+          uint8_t i;
+          uint8_t t;
+          for (i = 0; i < 2; i++) {
+            if (slots[i] >= depth) goto SUB_INVALID;
+            for (t = tryIndex; t; t = tries[t].parent) {
+              if ((slots[i] == tries[t].stackDepthBefore) || (slots[i] == tries[t].stackDepthBefore + 1)) goto SUB_INVALID;
+            }
+            for (t = iterIndex; t; t = iters[t].parent) {
+              if ((slots[i] == iters[t].stackDepthAfter - 2) || (slots[i] == iters[t].stackDepthAfter - 1)) goto SUB_INVALID;
+            }
+          }
+          break;
+        }
+        case VM_VC_RETURN:
+          // Try blocks must be ended before returning
+          if (tryIndex) goto SUB_INVALID;
+          break;
+        case VM_VC_ASYNC:
+          if (!tries[tryIndex].isAsync) goto SUB_INVALID;
+          break;
+        case VM_VC_AWAIT:
+          if (!tries[tryIndex].isAsync) goto SUB_INVALID;
+          err = vm_verifyJoin(v, address, instr.target, nextDepth, tryIndex, nextIter, true);
+          if (err) goto SUB_EXIT;
+          break;
+        case VM_VC_ASYNC_RESUME: {
+          // The resume point is reached with the stack as it was at the AWAIT.
+          // ASYNC_RESUME restores it from the closure, after the synchronous
+          // result and the root catch target.
+          uint8_t slotCount = instr.operand & 0xFF;
+          uint8_t catchOffset = instr.operand >> 8;
+          if (!tries[tryIndex].isAsync) goto SUB_INVALID;
+          if (depth != slotCount + 3) goto SUB_INVALID;
+          if ((catchOffset == 0) || (catchOffset > depth)) goto SUB_INVALID;
+          if (depth - catchOffset != tries[tryIndex].stackDepthBefore) goto SUB_INVALID;
+          break;
+        }
+        case VM_VC_ASYNC_START:
+          if (depth || tryIndex) goto SUB_INVALID;
+          nextTry = 1;
+          break;
+        case VM_VC_ASYNC_COMPLETE:
+          // See SUB_ASYNC_COMPLETE
+          if ((depth != 3) || tryIndex) goto SUB_INVALID;
+          break;
+        case VM_VC_START_TRY: {
+          uint16_t t;
+          for (t = 2; t < triesUsed; t++) {
+            if (tries[t].startTryAddress == address) break;
+          }
+          if (t == triesUsed) {
+            tries[t].startTryAddress = address;
+            tries[t].stackDepthBefore = depth;
+            tries[t].parent = tryIndex;
+            tries[t].isAsync = tries[tryIndex].isAsync;
+            triesUsed++;
+          }
+          nextTry = (uint8_t)t;
+          // An exception unwinds to the catch target and pushes the error
+          if (depth + 1 > maxDepth) goto SUB_INVALID;
+          err = vm_verifyJoin(v, address, instr.target, depth + 1, tryIndex, iterIndex, false);
+          if (err) goto SUB_EXIT;
+          break;
+        }
+        case VM_VC_SWITCH:
+          // The discriminant is read from the top of the stack
+          if (depth == 0) goto SUB_INVALID;
+          break;
+        case VM_VC_END_TRY:
+          // END_TRY unwinds the stack to the catch target
+          if (tryIndex < 2) goto SUB_INVALID;
+          if (depth < tries[tryIndex].stackDepthBefore + 2) goto SUB_INVALID;
+          nextDepth = tries[tryIndex].stackDepthBefore;
+          nextTry = tries[tryIndex].parent;
+          while (nextIter && (nextDepth < iters[nextIter].stackDepthAfter)) {
+            nextIter = iters[nextIter].parent;
+          }
+          break;
+        case VM_VC_ITER_START: {
+          uint16_t t;
+          for (t = 1; t < itersUsed; t++) {
+            if (iters[t].iterStartAddress == address) break;
+          }
+          if (t == itersUsed) {
+            iters[t].iterStartAddress = address;
+            iters[t].stackDepthAfter = nextDepth;
+            iters[t].parent = nextIter;
+            itersUsed++;
+          }
+          nextIter = (uint8_t)t;
+          break;
+        }
+        case VM_VC_ITER_NEXT:
+          // ARRAY_ITER_NEXT reads and writes the top 2 slots, so nothing may
+          // be pushed between the cursor and the instruction (e.g. the
+          // variables of the loop body)
+          if (!iterIndex || (depth != iters[iterIndex].stackDepthAfter)) goto SUB_INVALID;
+          break;
+        default:
+          break;
+      }
 
-  // Snapshot heap memory
+      if (instr.fallsThrough) {
+        err = vm_verifyJoin(v, address, address + instr.size, nextDepth, nextTry, nextIter, false);
+        if (err) goto SUB_EXIT;
+      }
+      if (instr.hasTarget && (instr.check != VM_VC_AWAIT) && (instr.check != VM_VC_START_TRY)) {
+        err = vm_verifyJoin(v, address, instr.target, nextDepth, nextTry, nextIter, false);
+        if (err) goto SUB_EXIT;
+      }
+      if (instr.check == VM_VC_SWITCH) {
+        for (uint16_t i = 0; i < instr.operand; i++) {
+          err = vm_verifyJoin(v, address, (uint16_t)vm_verifySwitchCaseTarget(v, address, &instr, i), nextDepth, nextTry, nextIter, false);
+          if (err) goto SUB_EXIT;
+        }
+      }
+    }
+  } while (v->again);
 
-  TsBucket* pBucket = vm->pLastBucket;
-  // Start at the end of the heap and work backwards, because buckets are linked
-  // in reverse order. (Edit: actually, they're also linked forwards now, but I
-  // might retract that at some point so I'll leave this with the backwards
-  // iteration).
-  uint8_t* pHeapStart = (uint8_t*)pNewBytecode + pNewBytecode->sectionOffsets[BCS_HEAP];
-  uint8_t* pTarget = pHeapStart + heapSize;
-  uint16_t cursor = heapSize;
-  TABLE_COVERAGE(pBucket ? 1 : 0, 2, 586); // Hit 2/2
-  while (pBucket) {
-    CODE_COVERAGE(504); // Hit
-    uint16_t offsetStart = pBucket->offsetStart;
-    uint16_t bucketSize = cursor - offsetStart;
-    uint8_t* pBucketData = getBucketDataBegin(pBucket);
+  goto SUB_EXIT;
 
-    pTarget -= bucketSize;
-    memcpy(pTarget, pBucketData, bucketSize);
+SUB_INVALID:
+  CODE_COVERAGE_ERROR_PATH(852); // Not hit
+  err = MVM_E_INVALID_BYTECODE;
 
-    cursor = offsetStart;
-    pBucket = pBucket->prev;
+SUB_EXIT:
+  // Leave the scratch set empty for the next function
+  for (address = lo; address <= hi; address++) {
+    vm_verifierBitClear(v->pReached, address);
   }
+  if (pState) {
+    MVM_CONTEXTUAL_FREE(pState, v->context);
+  }
+  return err;
+}
 
-  // Update header fields
-  pNewBytecode->bytecodeSize = bytecodeSize;
-
-  // Convert pointers-to-RAM into their corresponding serialized form
-  serializePointers(vm, pNewBytecode);
+/**
+ * Checks the whole bytecode image before the VM is created, so that the run
+ * loop can execute it without the per-instruction checks of
+ * MVM_DONT_TRUST_BYTECODE. See MVM_VERIFY_BYTECODE in microvium_port_example.h.
+ *
+ * Values in each section are checked first, which queues the ROM allocations
+ * they refer to. Queued allocations are then verified (functions by
+ * vm_verifyFunction) until no new ones are found, so only reachable functions
+ * are verified.
+ */
+static TeError vm_verifyBytecode(MVM_LONG_PTR_TYPE lpBytecode, mvm_TsBytecodeHeader* pHeader, void* context) {
+  vm_TsVerifier verifier;
+  vm_TsVerifier* v = &verifier;
+  uint16_t bytecodeSize = pHeader->bytecodeSize;
+  uint16_t* sectionOffsets = pHeader->sectionOffsets;
+  uint16_t offset;
+  uint16_t address;
+  uint16_t headerWord;
+  uint16_t size;
+  size_t wordBitmapSize;
+  size_t byteBitmapSize;
+  uint8_t* pScratch;
+  Value value;
+  bool changed;
+  int i;
+  TeError err = MVM_E_SUCCESS;
 
-  uint16_t crcStartOffset = OFFSETOF(mvm_TsBytecodeHeader, crc) + sizeof pNewBytecode->crc;
-  uint16_t crcSize = bytecodeSize - crcStartOffset;
-  void* pCrcStart = (uint8_t*)pNewBytecode + crcStartOffset;
-  pNewBytecode->crc = MVM_CALC_CRC16_CCITT(pCrcStart, crcSize);
+  CODE_COVERAGE_UNTESTED(853); // Not hit
 
-  if (out_size) {
-    CODE_COVERAGE(587); // Hit
-    *out_size = bytecodeSize;
+  // Sections must be in order, word-aligned and within the image
+  offset = pHeader->headerSize;
+  for (i = 0; i < BCS_SECTION_COUNT; i++) {
+    if ((sectionOffsets[i] < offset) || (sectionOffsets[i] > bytecodeSize) || (sectionOffsets[i] & 1)) {
+      CODE_COVERAGE_ERROR_PATH(854); // Not hit
+      return MVM_E_INVALID_BYTECODE;
+    }
+    offset = sectionOffsets[i];
+  }
+  if (sectionOffsets[BCS_STRING_TABLE] - sectionOffsets[BCS_BUILTINS] != BIN_BUILTIN_COUNT * 2) {
+    CODE_COVERAGE_ERROR_PATH(855); // Not hit
+    return MVM_E_INVALID_BYTECODE;
   }
-  return (void*)pNewBytecode;
-}
-#endif // MVM_INCLUDE_SNAPSHOT_CAPABILITY
 
-#if MVM_INCLUDE_DEBUG_CAPABILITY
+  v->lpBytecode = lpBytecode;
+  v->context = context;
+  v->romStart = sectionOffsets[BCS_ROM];
+  v->romEnd = sectionOffsets[BCS_GLOBALS];
+  v->globalsStart = sectionOffsets[BCS_GLOBALS];
+  v->globalsEnd = sectionOffsets[BCS_HEAP];
+  v->heapStart = sectionOffsets[BCS_HEAP];
+  v->heapEnd = bytecodeSize;
+  v->importCount = (sectionOffsets[BCS_EXPORT_TABLE] - sectionOffsets[BCS_IMPORT_TABLE]) / sizeof (vm_TsImportTableEntry);
+  v->asyncCatchBlock = 0;
+  v->firstHandle = 0xFFFF;
+  v->globalStoreEnd = 0;
+
+  wordBitmapSize = (bytecodeSize >> 4) + 1;
+  byteBitmapSize = (v->romEnd >> 3) + 1;
+  pScratch = MVM_CONTEXTUAL_MALLOC(wordBitmapSize * 4 + byteBitmapSize * 2, context);
+  if (!pScratch) {
+    CODE_COVERAGE_ERROR_PATH(856); // Not hit
+    return MVM_E_MALLOC_FAIL;
+  }
+  memset(pScratch, 0, wordBitmapSize * 4 + byteBitmapSize * 2);
+  v->pQueued = pScratch;
+  v->pChecked = v->pQueued + wordBitmapSize;
+  v->pResumePoints = v->pChecked + wordBitmapSize;
+  v->pHeapAllocations = v->pResumePoints + wordBitmapSize;
+  v->pCode = v->pHeapAllocations + wordBitmapSize;
+  v->pReached = v->pCode + byteBitmapSize;
+
+  // Find the heap allocations, so that ShortPtr values can be checked
+  address = v->heapStart;
+  while (address < v->heapEnd) {
+    if (v->heapEnd - address < 2) goto SUB_INVALID;
+    headerWord = vm_verifierRead2(v, address);
+    size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+    address += 2;
+    if (((size + 1) & 0xFFFE) > v->heapEnd - address) goto SUB_INVALID;
+    vm_verifierBitSet(v->pHeapAllocations, address >> 1);
+    address += (size + 1) & 0xFFFE;
+  }
+
+  // The async catch block is verified as part of the async function frame that
+  // it runs in: it's entered with the synchronous result and the error on the
+  // stack, and the frame has room for at least 3 slots (see ASYNC_START).
+  value = vm_verifierRead2(v, sectionOffsets[BCS_BUILTINS] + BIN_ASYNC_CATCH_BLOCK * 2);
+  if (value != VM_VALUE_UNDEFINED) {
+    address = value & 0xFFFC;
+    if (!Value_isBytecodeMappedPtrOrWellKnown(value) || (value < VM_VALUE_WELLKNOWN_END)) goto SUB_INVALID;
+    if ((address < v->romStart + 2) || (address >= v->romEnd)) goto SUB_INVALID;
+    headerWord = vm_verifierRead2(v, address - 2);
+    if (vm_getTypeCodeFromHeaderWord(headerWord) != TC_REF_FUNCTION) goto SUB_INVALID;
+    if (headerWord & VM_FUNCTION_HEADER_CONTINUATION_FLAG) goto SUB_INVALID;
+    v->asyncCatchBlock = address;
+    vm_verifierBitSet(v->pChecked, address >> 1);
+    err = vm_verifyFunction(v, address, 2, 3);
+    if (err) goto SUB_EXIT;
+  }
+
+  for (i = 0; i < BIN_BUILTIN_COUNT; i++) {
+    value = vm_verifierRead2(v, sectionOffsets[BCS_BUILTINS] + i * 2);
+    if (i == BIN_ASYNC_CATCH_BLOCK) continue;
+    // The RAM string table handle starts out empty
+    if ((i == BIN_INTERNED_STRINGS) && Value_isBytecodeMappedPtrOrWellKnown(value) && (value >= v->globalsStart)) {
+      err = vm_verifyHandle(v, value & 0xFFFC, false);
+    } else {
+      err = vm_verifyValue(v, value, false);
+    }
+    if (err) goto SUB_EXIT;
+  }
 
-void mvm_dbg_setBreakpoint(VM* vm, int bytecodeAddress) {
-  CODE_COVERAGE_UNTESTED(588); // Not hit
+  // Export table entries are vm_TsExportTableEntry
+  if ((sectionOffsets[BCS_SHORT_CALL_TABLE] - sectionOffsets[BCS_EXPORT_TABLE]) & 3) goto SUB_INVALID;
+  for (address = sectionOffsets[BCS_EXPORT_TABLE]; address < sectionOffsets[BCS_SHORT_CALL_TABLE]; address += 4) {
+    err = vm_verifyValue(v, vm_verifierRead2(v, address + 2), false);
+    if (err) goto SUB_EXIT;
+  }
 
-  // These checks on the bytecode address are assertions rather than user faults
-  // because the address is probably not manually computed by a user, it's
-  // derived from some kind of debug symbol file. In a production environment,
-  // setting a breakpoint on an address that's never executed (e.g. because it's
-  // not executable) is not a VM failure.
-  VM_ASSERT(vm, (bytecodeAddress == - 1) || (bytecodeAddress >= getSectionOffset(vm->lpBytecode, BCS_ROM)));
-  VM_ASSERT(vm, (bytecodeAddress == -1) || (bytecodeAddress < getSectionOffset(vm->lpBytecode, vm_sectionAfter(vm, BCS_ROM))));
+  // The ROM string table is searched by content, so it must only hold strings.
+  // Strings that are all digits can't be property keys, so the compiler
+  // encodes them as TC_REF_STRING rather than TC_REF_INTERNED_STRING, but they
+  // are still in the table.
+  for (address = sectionOffsets[BCS_STRING_TABLE]; address < sectionOffsets[BCS_ROM]; address += 2) {
+    TeTypeCode typeCode;
+    value = vm_verifierRead2(v, address);
+    if (!Value_isBytecodeMappedPtrOrWellKnown(value) || (value < VM_VALUE_WELLKNOWN_END)) goto SUB_INVALID;
+    if (((value & 0xFFFC) < v->romStart + 2) || ((value & 0xFFFC) >= v->romEnd)) goto SUB_INVALID;
+    headerWord = vm_verifierRead2(v, (value & 0xFFFC) - 2);
+    typeCode = vm_getTypeCodeFromHeaderWord(headerWord);
+    if ((typeCode != TC_REF_INTERNED_STRING) && (typeCode != TC_REF_STRING)) goto SUB_INVALID;
+    err = vm_verifyValue(v, value, false);
+    if (err) goto SUB_EXIT;
+  }
 
-  mvm_dbg_removeBreakpoint(vm, bytecodeAddress);
-  TsBreakpoint* breakpoint = vm_malloc(vm, sizeof (TsBreakpoint));
-  if (!breakpoint) {
-    MVM_FATAL_ERROR(vm, MVM_E_MALLOC_FAIL);
-    return;
+  for (address = v->globalsStart; address < v->globalsEnd; address += 2) {
+    err = vm_verifyValue(v, vm_verifierRead2(v, address), true);
+    if (err) goto SUB_EXIT;
   }
-  breakpoint->bytecodeAddress = bytecodeAddress;
-  // Add to linked-list
-  breakpoint->next = vm->pBreakpoints;
-  vm->pBreakpoints = breakpoint;
-}
 
-void mvm_dbg_removeBreakpoint(VM* vm, uint16_t bytecodeAddress) {
-  CODE_COVERAGE_UNTESTED(589); // Not hit
+  address = v->heapStart;
+  while (address < v->heapEnd) {
+    headerWord = vm_verifierRead2(v, address);
+    address += 2;
+    err = vm_verifyAllocation(v, address, headerWord, true);
+    if (err) goto SUB_EXIT;
+    address += (vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord) + 1) & 0xFFFE;
+  }
 
-  TsBreakpoint** ppBreakpoint = &vm->pBreakpoints;
-  TsBreakpoint* pBreakpoint = *ppBreakpoint;
-  while (pBreakpoint) {
-    if (pBreakpoint->bytecodeAddress == bytecodeAddress) {
-      CODE_COVERAGE_UNTESTED(590); // Not hit
-      // Remove from linked list
-      *ppBreakpoint = pBreakpoint->next;
-      vm_free(vm, pBreakpoint);
-      pBreakpoint = *ppBreakpoint;
-    } else {
-      CODE_COVERAGE_UNTESTED(591); // Not hit
-      ppBreakpoint = &pBreakpoint->next;
-      pBreakpoint = *ppBreakpoint;
+  // Verify the queued ROM allocations, which may queue further allocations.
+  // Allocations in ROM are 4-byte aligned.
+  do {
+    changed = false;
+    for (address = (v->romStart + 5) & 0xFFFC; address < v->romEnd; address += 4) {
+      if (!vm_verifierBitGet(v->pQueued, address >> 1)) continue;
+      if (vm_verifierBitGet(v->pChecked, address >> 1)) continue;
+      vm_verifierBitSet(v->pChecked, address >> 1);
+      changed = true;
+      headerWord = vm_verifierRead2(v, address - 2);
+      if (vm_getTypeCodeFromHeaderWord(headerWord) == TC_REF_FUNCTION) {
+        err = vm_verifyFunction(v, address, 0, headerWord & VM_FUNCTION_HEADER_STACK_HEIGHT_MASK);
+      } else {
+        size = vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
+        if (size > v->romEnd - address) goto SUB_INVALID;
+        err = vm_verifyAllocation(v, address, headerWord, false);
+      }
+      if (err) goto SUB_EXIT;
     }
+  } while (changed);
+
+  // Resume points referenced by values must be the targets of a verified AWAIT
+  for (address = (v->romStart + 5) & 0xFFFC; address < v->romEnd; address += 4) {
+    if (vm_verifierBitGet(v->pResumePoints, address >> 1) && !vm_verifierBitGet(v->pCode, address)) goto SUB_INVALID;
   }
-}
 
-void mvm_dbg_setBreakpointCallback(mvm_VM* vm, mvm_TfBreakpointCallback cb) {
-  CODE_COVERAGE_UNTESTED(592); // Not hit
-  // It doesn't strictly need to be null, but is probably a mistake if it's not.
-  VM_ASSERT(vm, vm->breakpointCallback == NULL);
-  vm->breakpointCallback = cb;
+  if (v->globalStoreEnd > v->firstHandle) goto SUB_INVALID;
+
+  goto SUB_EXIT;
+
+SUB_INVALID:
+  CODE_COVERAGE_ERROR_PATH(857); // Not hit
+  err = MVM_E_INVALID_BYTECODE;
+
+SUB_EXIT:
+  MVM_CONTEXTUAL_FREE(pScratch, context);
+  return err;
 }
 
-#endif // MVM_INCLUDE_DEBUG_CAPABILITY
+#endif // MVM_VERIFY_BYTECODE
 
 /**
  * Test out the LONG_PTR macros provided in the port file. lpBytecode should
@@ -7470,6 +12223,9 @@ mvm_TeError mvm_uint8ArrayToBytes(mvm_VM* vm, mvm_Value uint8ArrayValue, uint8_t
   size_t size = (size_t)vm_getAllocationSizeExcludingHeaderFromHeaderWord(headerWord);
   *out_size = size;
   *out_data = MVM_POINTER_SET_BOUNDS(p, size);
+  // The host may write to the bytes. It can only do so until its next call
+  // into the VM, which includes mvm_runGCStep.
+  VM_WRITE_BARRIER(vm, p);
 
   return MVM_E_SUCCESS;
 }
@@ -7613,7 +12369,7 @@ mvm_Value mvm_asyncStart(mvm_VM* vm, mvm_Value* out_result) {
   // Anchor on stack
   vm_push(vm, callbackOrPromise);
 
-  uint16_t* pClosure = mvm_allocate(vm, 4, TC_REF_CLOSURE);
+  Value* pClosure = mvm_allocate(vm, 2 * sizeof (Value), TC_REF_CLOSURE);
   pClosure[0] = asyncHostCallback;
   pClosure[1] = vm_pop(vm); // callbackOrPromise
   mvm_Value closureValue = ShortPtr_encode(vm, pClosure);
@@ -7720,6 +12476,8 @@ static void vm_enqueueJob(VM* vm, Value jobClosure) {
   newNode[2] = firstNodeRef; // next
   lastNode[2] = newNodeRef;  // last.next
   firstNode[0] = newNodeRef; // first.prev
+  VM_WRITE_BARRIER(vm, lastNode);
+  VM_WRITE_BARRIER(vm, firstNode);
 }
 
 /**
@@ -7778,6 +12536,8 @@ static Value vm_dequeueJob(VM* vm) {
     Value* second = ShortPtr_decode(vm, first[2]);
     last[2] /* next */ = first[2] /* next */;
     second[0] /* prev */ = first[0] /* prev */;
+    VM_WRITE_BARRIER(vm, last);
+    VM_WRITE_BARRIER(vm, second);
     reg->jobQueue = first[2];
     return result;
   }
@@ -7939,11 +12699,11 @@ mvm_TsCallStackFrame* mvm_readCallStack(VM* vm, int* out_frameCount) {
     return NULL;
   }
   vm_TsRegisters* reg = &stack->reg;
-  uint16_t* beginningOfStack = getBottomOfStack(stack);
+  Value* beginningOfStack = getBottomOfStack(stack);
 
   // Count number of required frames
   int frameCount = 1;
-  uint16_t* pFrameBase = reg->pFrameBase;
+  Value* pFrameBase = reg->pFrameBase;
   while (pFrameBase > beginningOfStack) {
     frameCount++;
     pFrameBase -= 4;
@@ -8000,7 +12760,7 @@ mvm_TsCallStackFrame* mvm_readCallStack(VM* vm, int* out_frameCount) {
     argCount = (argCountAndFlags & AF_ARG_COUNT_MASK);
     closure = *(--pStackPointer);
     pStackPointer--;
-    pFrameBase = (uint16_t*)((uint8_t*)pStackPointer - *pStackPointer);
+    pFrameBase = (Value*)((uint8_t*)pStackPointer - *pStackPointer);
     pArgs = pFrameBase - VM_FRAME_BOUNDARY_SAVE_SIZE_WORDS - argCount;
 
   }
@@ -8158,6 +12918,7 @@ MVM_HIDDEN void mvm_subscribeToPromise(VM* vm, Value vPromise, Value vCallback)
       CODE_COVERAGE(715); // Hit
       // No subscribers yet (hot path)
       pPromise[VM_OIS_PROMISE_OUT] = vCallback;
+      VM_WRITE_BARRIER(vm, pPromise);
     } else {
       CODE_COVERAGE(716); // Hit
 
@@ -8181,6 +12942,7 @@ MVM_HIDDEN void mvm_subscribeToPromise(VM* vm, Value vPromise, Value vCallback)
         vNewArray = vm_pop(vm);
         pPromise = ShortPtr_decode(vm, *pvPromise); // May have moved
         pPromise[VM_OIS_PROMISE_OUT] = vNewArray;
+        VM_WRITE_BARRIER(vm, pPromise);
         *pvSubscribers = vNewArray;
       } else { // Already an array -- nothing to do
         CODE_COVERAGE(718); // Hit
@@ -15,7 +15,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define MVM_ENGINE_MAJOR_VERSION 8  /* aka MVM_BYTECODE_VERSION */
+#define MVM_ENGINE_MAJOR_VERSION 10  /* aka MVM_BYTECODE_VERSION */
 #define MVM_ENGINE_MINOR_VERSION 0  /* aka MVM_ENGINE_VERSION */
 
 typedef uint16_t mvm_Value;
@@ -82,6 +82,9 @@ typedef enum mvm_TeError {
   /* 56 */ MVM_E_HEAP_CORRUPT, // Microvium's internal heap is not in a consistent state
   /* 57 */ MVM_E_CLASS_PROTOTYPE_MUST_BE_NULL_OR_OBJECT, // The prototype property of a class must be null or a plain object
   /* 58 */ MVM_E_UNINITIALIZED_GLOBAL, // A global variable was not set before it was used.
+  /* 59 */ MVM_E_BYTECODE_REQUIRES_SHAPED_OBJECTS, // The bytecode was compiled with shaped objects enabled, so the engine must be compiled with MVM_SHAPED_OBJECTS
+  /* 60 */ MVM_E_BYTECODE_REQUIRES_GAS_METERING, // The engine is compiled with MVM_GAS_PER_BLOCK, so the bytecode must be compiled with gas metering enabled
+  /* 61 */ MVM_E_NATIVE_FUNCTIONS_MISMATCH, // The table passed to `mvm_aot_setFunctions` was generated from a different snapshot
 } mvm_TeError;
 
 typedef enum mvm_TeType {
@@ -119,6 +122,30 @@ typedef enum mvm_TeType {
 #define MVM_INCLUDE_DEBUG_CAPABILITY 1
 #endif
 
+#ifndef MVM_INLINE_CACHE
+#define MVM_INLINE_CACHE 0
+#endif
+
+#ifndef MVM_CALL_CACHE
+#define MVM_CALL_CACHE 0
+#endif
+
+#ifndef MVM_UNBOXED_INT32
+#define MVM_UNBOXED_INT32 0
+#endif
+
+#ifndef MVM_UNBOXED_FLOAT64
+#define MVM_UNBOXED_FLOAT64 0
+#endif
+
+#ifndef MVM_JIT
+#define MVM_JIT 0
+#endif
+
+#ifndef MVM_AOT
+#define MVM_AOT 0
+#endif
+
 typedef struct mvm_VM mvm_VM;
 
 typedef mvm_TeError (*mvm_TfHostFunction)(mvm_VM* vm, mvm_HostFunctionID hostFunctionID, mvm_Value* result, mvm_Value* args, uint8_t argCount);
@@ -170,6 +197,123 @@ typedef struct mvm_TsMemoryStats {
 
 } mvm_TsMemoryStats;
 
+#if MVM_INLINE_CACHE
+typedef struct mvm_TsInlineCacheStats {
+  // Number of property accesses that were served from the inline cache
+  uint32_t hits;
+
+  // Number of property accesses at cached instructions that needed a full
+  // property lookup
+  uint32_t misses;
+
+  // Number of cache entries discarded, either by a GC collection (which
+  // discards all of them) or by a property being added to an object (which
+  // discards the entries for the same key)
+  uint32_t invalidations;
+
+  // Number of entries in the cache (MVM_INLINE_CACHE_SIZE)
+  uint16_t entryCount;
+
+  // Number of entries currently holding a cached property location
+  uint16_t entriesUsed;
+} mvm_TsInlineCacheStats;
+#endif // MVM_INLINE_CACHE
+
+#if MVM_CALL_CACHE
+typedef struct mvm_TsCallCacheStats {
+  // Number of dynamic calls that went straight to the cached bytecode function
+  uint32_t hits;
+
+  // Number of dynamic calls that needed the full call path, whether or not the
+  // result could then be cached
+  uint32_t misses;
+
+  // Number of cache entries discarded by a GC collection
+  uint32_t invalidations;
+
+  // Number of entries in the cache (MVM_CALL_CACHE_SIZE)
+  uint16_t entryCount;
+
+  // Number of entries currently holding a cached call target
+  uint16_t entriesUsed;
+} mvm_TsCallCacheStats;
+#endif // MVM_CALL_CACHE
+
+#if MVM_UNBOXED_INT32
+typedef struct mvm_TsUnboxedInt32Stats {
+  // Number of int32 results of arithmetic that were passed to the next
+  // arithmetic instruction without being allocated
+  uint32_t unboxedResults;
+
+  // Number of int32 results of arithmetic that were allocated, either because
+  // they were used by something other than arithmetic, or because the
+  // operation that used them needed the general implementation
+  uint32_t allocatedResults;
+} mvm_TsUnboxedInt32Stats;
+#endif // MVM_UNBOXED_INT32
+
+#if MVM_UNBOXED_FLOAT64
+typedef struct mvm_TsUnboxedFloat64Stats {
+  // Number of non-integer results of arithmetic that were passed to the next
+  // arithmetic instruction without being allocated
+  uint32_t unboxedResults;
+
+  // Number of non-integer results of arithmetic that were allocated, either
+  // because they were used by something other than a NUM_OP, or because the
+  // other operand of the NUM_OP that used them wasn't a number
+  uint32_t allocatedResults;
+} mvm_TsUnboxedFloat64Stats;
+#endif // MVM_UNBOXED_FLOAT64
+
+#if MVM_JIT
+typedef struct mvm_TsJitStats {
+  // Number of calls to a bytecode function that ran native code
+  uint32_t nativeCalls;
+
+  // Number of times native code handed the rest of a call back to the
+  // interpreter before reaching a `return`, because it reached an instruction
+  // or a case (e.g. an int14 overflow) that the JIT doesn't compile
+  uint32_t bailouts;
+
+  // Number of functions compiled to native code
+  uint16_t compiledFunctions;
+
+  // Number of functions that became hot but couldn't be compiled, for example
+  // because the code buffer was full
+  uint16_t failedFunctions;
+
+  // Bytes of the code buffer used (out of MVM_JIT_CODE_SIZE)
+  uint32_t codeBytesUsed;
+} mvm_TsJitStats;
+#endif // MVM_JIT
+
+#if MVM_AOT
+/**
+ * A bytecode function compiled ahead of time to C (see `generateNativeC` in
+ * the Microvium library). It runs in the frame that the interpreter has set up
+ * for the call, with `pFrame` pointing at the first variable slot, and returns
+ * MVM_AOT_EXIT with the bytecode address and stack depth at which the
+ * interpreter continues.
+ */
+typedef uint32_t (*mvm_TfAotFunction)(mvm_VM* vm, mvm_Value* pFrame, mvm_Value* pArgs, uint8_t argCount);
+
+#define MVM_AOT_EXIT(address, depth) ((uint32_t)(address) | ((uint32_t)(depth) << 16))
+
+typedef struct mvm_TsAotFunction {
+  // Bytecode address of the function's first instruction
+  uint16_t address;
+  mvm_TfAotFunction fn;
+} mvm_TsAotFunction;
+
+typedef struct mvm_TsAotFunctionTable {
+  // CRC of the snapshot that the functions were generated from
+  uint16_t snapshotCrc;
+  uint16_t count;
+  // Sorted by address
+  const mvm_TsAotFunction* functions;
+} mvm_TsAotFunctionTable;
+#endif // MVM_AOT
+
 /**
  * A handle holds a value that must not be garbage collected.
  *
@@ -393,6 +537,34 @@ MVM_EXPORT mvm_TeError mvm_resolveExports(mvm_VM* vm, const mvm_VMExportID* ids,
  */
 MVM_EXPORT void mvm_runGC(mvm_VM* vm, bool squeeze);
 
+#if MVM_INCREMENTAL_GC
+/**
+ * Do a bounded amount of garbage collection work, for hosts that can't afford
+ * the pause of a full mvm_runGC.
+ *
+ * The first call starts a collection cycle, and each call continues it until
+ * it completes. The VM can be used as normal between calls, including calls to
+ * mvm_runGCStep from within a host function. A full collection (an explicit
+ * mvm_runGC, or one triggered by running out of heap) finishes the cycle in
+ * progress rather than starting again, and uses it in place of a full copy.
+ * An incremental cycle doesn't compact the heap (it doesn't merge the property
+ * cells added to objects, or truncate arrays to their length), so it's worth
+ * calling `mvm_runGC(vm, true)` occasionally, such as before a snapshot, which
+ * also compacts after finishing a cycle.
+ *
+ * @param workUnits The amount of work to do before returning, roughly in
+ * 16-bit words of heap copied. Each step also makes one pass over the roots
+ * (the globals, handles and the stack), which isn't counted.
+ * @returns `true` if the step completed the cycle.
+ *
+ * Note: while a cycle is in progress, the VM holds an additional
+ * MVM_MAX_HEAP_SIZE bytes of tables from the host, on top of the tospace heap.
+ * Allocations that are reachable when they're copied survive to the next cycle
+ * even if they become unreachable before the cycle completes.
+ */
+MVM_EXPORT bool mvm_runGCStep(mvm_VM* vm, uint16_t workUnits);
+#endif // MVM_INCREMENTAL_GC
+
 /**
  * Compares two values for equality. The same semantics as JavaScript `===`
  */
@@ -492,11 +664,17 @@ MVM_EXPORT void* mvm_createSnapshot(mvm_VM* vm, size_t* out_size);
  *
  * Setting a breakpoint a second time on the same address of an existing active
  * breakpoint will have no effect.
+ *
+ * The breakpoints are kept in a bitmap with one bit per byte of bytecode up to
+ * the end of the ROM section, which is allocated when the first breakpoint is
+ * set. While any breakpoint is set, the VM tests one bit before each
+ * instruction. When there are no breakpoints, the bitmap is freed again.
  */
 MVM_EXPORT void mvm_dbg_setBreakpoint(mvm_VM* vm, int bytecodeAddress);
 
 /**
- * Remove a breakpoint added by mvm_dbg_setBreakpoint
+ * Remove a breakpoint added by mvm_dbg_setBreakpoint. Use (-1) to remove the
+ * breakpoint on every instruction.
  */
 MVM_EXPORT void mvm_dbg_removeBreakpoint(mvm_VM* vm, uint16_t bytecodeAddress);
 
@@ -519,6 +697,96 @@ MVM_EXPORT void mvm_dbg_removeBreakpoint(mvm_VM* vm, uint16_t bytecodeAddress);
 MVM_EXPORT void mvm_dbg_setBreakpointCallback(mvm_VM* vm, mvm_TfBreakpointCallback cb);
 #endif // MVM_INCLUDE_DEBUG_CAPABILITY
 
+#if MVM_INLINE_CACHE
+/**
+ * mvm_getInlineCacheStats
+ *
+ * Reads the hit and miss counters of the property inline cache (see
+ * MVM_INLINE_CACHE in the port file). The counters accumulate over the
+ * lifetime of the VM.
+ */
+MVM_EXPORT void mvm_getInlineCacheStats(mvm_VM* vm, mvm_TsInlineCacheStats* out_stats);
+#endif // MVM_INLINE_CACHE
+
+#if MVM_CALL_CACHE
+/**
+ * mvm_getCallCacheStats
+ *
+ * Reads the hit and miss counters of the call-site cache (see MVM_CALL_CACHE
+ * in the port file). The counters accumulate over the lifetime of the VM.
+ */
+MVM_EXPORT void mvm_getCallCacheStats(mvm_VM* vm, mvm_TsCallCacheStats* out_stats);
+#endif // MVM_CALL_CACHE
+
+#if MVM_UNBOXED_INT32
+/**
+ * mvm_getUnboxedInt32Stats
+ *
+ * Reads the counters of int32 arithmetic results that were and weren't
+ * allocated on the heap (see MVM_UNBOXED_INT32 in the port file). The counters
+ * accumulate over the lifetime of the VM.
+ */
+MVM_EXPORT void mvm_getUnboxedInt32Stats(mvm_VM* vm, mvm_TsUnboxedInt32Stats* out_stats);
+#endif // MVM_UNBOXED_INT32
+
+#if MVM_UNBOXED_FLOAT64
+/**
+ * mvm_getUnboxedFloat64Stats
+ *
+ * Reads the counters of non-integer arithmetic results that were and weren't
+ * allocated on the heap (see MVM_UNBOXED_FLOAT64 in the port file). The
+ * counters accumulate over the lifetime of the VM.
+ */
+MVM_EXPORT void mvm_getUnboxedFloat64Stats(mvm_VM* vm, mvm_TsUnboxedFloat64Stats* out_stats);
+#endif // MVM_UNBOXED_FLOAT64
+
+#if MVM_JIT
+/**
+ * mvm_getJitStats
+ *
+ * Reads the counters of the baseline JIT (see MVM_JIT in the port file). The
+ * counters accumulate over the lifetime of the VM.
+ */
+MVM_EXPORT void mvm_getJitStats(mvm_VM* vm, mvm_TsJitStats* out_stats);
+#endif // MVM_JIT
+
+#if MVM_AOT
+/**
+ * mvm_aot_setFunctions
+ *
+ * Gives the VM the native implementations of its bytecode functions, as
+ * generated by `generateNativeC` from the same snapshot that the VM was
+ * restored from. Functions that the snapshot marks as native are then run by
+ * calling the C function instead of interpreting them, except while the gas
+ * counter is counting instructions or breakpoints are set. The table must
+ * outlive the VM.
+ *
+ * Returns MVM_E_NATIVE_FUNCTIONS_MISMATCH if the table was generated from a
+ * different snapshot.
+ */
+MVM_EXPORT mvm_TeError mvm_aot_setFunctions(mvm_VM* vm, const mvm_TsAotFunctionTable* table);
+
+/*
+ * The runtime functions that the generated C calls. Each of these takes the
+ * top of the native frame, `pStackPointer`, and publishes it to the VM before
+ * doing anything that can allocate, so that a garbage collection sees and
+ * updates every value on the frame. They return an error without changing the
+ * frame if the operation would throw, in which case the generated code exits
+ * to the interpreter at the same instruction.
+ */
+
+// Like VM_OP1_OBJECT_GET_1: replaces the object and key at the top of the stack with the property value
+MVM_EXPORT mvm_TeError mvm_aot_getProperty(mvm_VM* vm, mvm_Value* pStackPointer);
+// Like VM_OP3_OBJECT_GET_2: replaces the object at the top of the stack with the property value
+MVM_EXPORT mvm_TeError mvm_aot_getPropertyKey(mvm_VM* vm, mvm_Value* pStackPointer, mvm_Value key);
+// Like VM_OP1_OBJECT_SET_1: sets the property from the object, key and value at the top of the stack, without popping them
+MVM_EXPORT mvm_TeError mvm_aot_setProperty(mvm_VM* vm, mvm_Value* pStackPointer);
+// Like VM_OP3_OBJECT_SET_2: sets the property from the object and value at the top of the stack, without popping them
+MVM_EXPORT mvm_TeError mvm_aot_setPropertyKey(mvm_VM* vm, mvm_Value* pStackPointer, mvm_Value key);
+// Like VM_OP1_OBJECT_NEW: writes a new empty object to `*pStackPointer`
+MVM_EXPORT mvm_TeError mvm_aot_newObject(mvm_VM* vm, mvm_Value* pStackPointer);
+#endif // MVM_AOT
+
 #ifdef MVM_GAS_COUNTER
 /**
  * mvm_stopAfterNInstructions
@@ -529,6 +797,19 @@ MVM_EXPORT void mvm_dbg_setBreakpointCallback(mvm_VM* vm, mvm_TfBreakpointCallba
  *
  * If `n` is zero, the VM will stop before executing any further instructions.
  *
+ * A superinstruction, which the compiler emits in place of a common sequence
+ * of instructions, is counted as the number of instructions it replaces.
+ *
+ * If the engine is compiled with MVM_GAS_PER_BLOCK, the count is charged once
+ * on entry to each basic block (a straight run of instructions between jumps)
+ * rather than once per instruction, where a block is also split after each
+ * call, so that instructions skipped by a caught exception are not charged.
+ * The VM then stops at the start of the first block that costs more than the
+ * remaining count, so it may stop with up to one block's worth of instructions
+ * still unspent. Only a block cut short by an error that ends the call (such as
+ * MVM_E_TYPE_ERROR from a host function) is charged for the instructions it
+ * didn't run.
+ *
  * When the VM reaches the stopped state, further calls to the VM will fail with
  * the same error until `mvm_stopAfterNInstructions` is called again to reset
  * the countdown.
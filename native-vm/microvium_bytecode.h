@@ -163,6 +163,10 @@ typedef struct mvm_TsBytecodeHeader { // Size = 12B + sectionOffsets
 
 typedef enum mvm_TeFeatureFlags {
   FF_FLOAT_SUPPORT = 0,
+  // (1 is used by the compiler to record that the script was compiled with
+  // overflow checks)
+  FF_SHAPED_OBJECTS = 2, // The heap contains TsShapedObject allocations
+  FF_GAS_METERING = 3, // Each basic block starts with VM_OP4_GAS
 } mvm_TeFeatureFlags;
 
 typedef struct vm_TsExportTableEntry {
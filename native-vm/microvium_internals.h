@@ -146,6 +146,28 @@
   #endif
 #endif
 
+#ifndef MVM_RESERVED_HEAP
+#define MVM_RESERVED_HEAP 0
+#endif
+
+#if MVM_RESERVED_HEAP && (MVM_NATIVE_POINTER_IS_16_BIT || MVM_USE_SINGLE_RAM_PAGE)
+#error "MVM_RESERVED_HEAP can't be combined with MVM_NATIVE_POINTER_IS_16_BIT or MVM_USE_SINGLE_RAM_PAGE"
+#endif
+
+#if MVM_RESERVED_HEAP && !(defined(__unix__) || defined(__APPLE__))
+#error "MVM_RESERVED_HEAP is only supported on hosts with mmap"
+#endif
+
+#ifndef MVM_INCREMENTAL_GC
+#define MVM_INCREMENTAL_GC 0
+#endif
+
+// The incremental collector indexes its forwarding table by ShortPtr, so it
+// needs ShortPtrs to be heap offsets
+#if MVM_INCREMENTAL_GC && (MVM_NATIVE_POINTER_IS_16_BIT || MVM_USE_SINGLE_RAM_PAGE)
+#error "MVM_INCREMENTAL_GC can't be combined with MVM_NATIVE_POINTER_IS_16_BIT or MVM_USE_SINGLE_RAM_PAGE"
+#endif
+
 #ifndef MVM_MALLOC
 #define MVM_MALLOC(size) malloc(size)
 #endif
@@ -540,6 +562,14 @@ typedef MVM_LONG_PTR_TYPE LongPtr;
 #define MVM_DONT_TRUST_BYTECODE 0
 #endif
 
+#ifndef MVM_VERIFY_BYTECODE
+#define MVM_VERIFY_BYTECODE 0
+#endif
+
+#if MVM_VERIFY_BYTECODE && !MVM_DONT_TRUST_BYTECODE
+#error "MVM_VERIFY_BYTECODE requires MVM_DONT_TRUST_BYTECODE"
+#endif
+
 #ifndef MVM_SWITCH
 #define MVM_SWITCH(tag, upper) switch (tag)
 #endif
@@ -548,6 +578,86 @@ typedef MVM_LONG_PTR_TYPE LongPtr;
 #define MVM_CASE(value) case value
 #endif
 
+#ifndef MVM_COMPUTED_GOTO_DISPATCH
+#define MVM_COMPUTED_GOTO_DISPATCH 0
+#endif
+
+#ifndef MVM_INLINE_CACHE_SIZE
+#define MVM_INLINE_CACHE_SIZE 32
+#endif
+
+#if MVM_INLINE_CACHE && ((MVM_INLINE_CACHE_SIZE & (MVM_INLINE_CACHE_SIZE - 1)) != 0)
+#error "MVM_INLINE_CACHE_SIZE must be a power of 2"
+#endif
+
+#ifndef MVM_CALL_CACHE_SIZE
+#define MVM_CALL_CACHE_SIZE 16
+#endif
+
+#if MVM_CALL_CACHE && ((MVM_CALL_CACHE_SIZE & (MVM_CALL_CACHE_SIZE - 1)) != 0)
+#error "MVM_CALL_CACHE_SIZE must be a power of 2"
+#endif
+
+#ifndef MVM_SCOPE_CACHE_SIZE
+#define MVM_SCOPE_CACHE_SIZE 0
+#endif
+
+#if MVM_SCOPE_CACHE_SIZE > 15
+#error "MVM_SCOPE_CACHE_SIZE must be no more than 15"
+#endif
+
+#ifndef MVM_INT14_FAST_PATHS
+#define MVM_INT14_FAST_PATHS 0
+#endif
+
+#ifndef MVM_SHAPED_OBJECTS
+#define MVM_SHAPED_OBJECTS 0
+#endif
+
+#ifndef MVM_GAS_PER_BLOCK
+#define MVM_GAS_PER_BLOCK 0
+#endif
+
+#if MVM_UNBOXED_FLOAT64 && !MVM_SUPPORT_FLOAT
+#error "MVM_UNBOXED_FLOAT64 requires MVM_SUPPORT_FLOAT"
+#endif
+
+#if MVM_JIT && !(defined(__x86_64__) && defined(__linux__))
+#error "MVM_JIT is only supported on x86-64 Linux hosts"
+#endif
+
+#ifndef MVM_JIT_THRESHOLD
+#define MVM_JIT_THRESHOLD 100
+#endif
+
+#if MVM_JIT && ((MVM_JIT_THRESHOLD < 1) || (MVM_JIT_THRESHOLD > 0xFFFF))
+#error "MVM_JIT_THRESHOLD must be in the range 1 to 65535"
+#endif
+
+#ifndef MVM_JIT_CODE_SIZE
+#define MVM_JIT_CODE_SIZE 0x10000
+#endif
+
+#ifndef MVM_JIT_FUNCTION_COUNT
+#define MVM_JIT_FUNCTION_COUNT 64
+#endif
+
+#if MVM_JIT && ((MVM_JIT_FUNCTION_COUNT & (MVM_JIT_FUNCTION_COUNT - 1)) != 0)
+#error "MVM_JIT_FUNCTION_COUNT must be a power of 2"
+#endif
+
+#ifndef MVM_PROPERTY_INDEX
+#define MVM_PROPERTY_INDEX 0
+#endif
+
+#ifndef MVM_PROPERTY_INDEX_THRESHOLD
+#define MVM_PROPERTY_INDEX_THRESHOLD 16
+#endif
+
+#if MVM_PROPERTY_INDEX && (MVM_PROPERTY_INDEX_THRESHOLD < 1)
+#error "MVM_PROPERTY_INDEX_THRESHOLD must be at least 1"
+#endif
+
 #ifndef MVM_DEBUG_UTILS
 #define MVM_DEBUG_UTILS 0
 #endif
@@ -561,10 +671,21 @@ typedef MVM_LONG_PTR_TYPE LongPtr;
 #define VM_FUNCTION_HEADER_BACK_POINTER_MASK 0x07FF
 /** (Normal funcs only) Mask of required stack height in words */
 #define VM_FUNCTION_HEADER_STACK_HEIGHT_MASK 0x00FF
+/** (Normal funcs only) Flag bit to indicate that the function was compiled
+ * ahead of time to C, and so may have an entry in the table given to
+ * `mvm_aot_setFunctions` */
+#define VM_FUNCTION_HEADER_NATIVE_FLAG 0x0100
 
 // Minimum number of items to have in an array when expanding it
 #define VM_ARRAY_INITIAL_CAPACITY 4
 
+// Maximum number of float64 results that can be waiting to be consumed without
+// having been allocated (see MVM_UNBOXED_FLOAT64)
+#define VM_UNBOXED_FLOAT64_MAX 4
+
+// Number of instructions vm_arithmeticResultIsConsumed looks ahead
+#define VM_UNBOXED_LOOKAHEAD 8
+
 /**
  * Type code indicating the type of data.
  *
@@ -647,7 +768,7 @@ typedef enum TeTypeCode {
 
   TC_REF_CLASS              = 0x9, // TsClass
   TC_REF_VIRTUAL            = 0xA, // Reserved: TsVirtual
-  TC_REF_RESERVED_1         = 0xB, // Reserved
+  TC_REF_SHAPED_OBJECT      = 0xB, // TsShapedObject - Object whose keys are in a shared shape (see MVM_SHAPED_OBJECTS)
   TC_REF_PROPERTY_LIST      = 0xC, // TsPropertyList - Object represented as linked list of properties
   TC_REF_ARRAY              = 0xD, // TsArray
   TC_REF_FIXED_LENGTH_ARRAY = 0xE, // TsFixedLengthArray
@@ -713,6 +834,31 @@ typedef enum vm_TePromiseStatus {
 
 #define VM_PROTO_SLOT_MAGIC_KEY_VALUE VIRTUAL_INT14_ENCODE(-0x2000)
 
+/**
+ * Property hash index (see MVM_PROPERTY_INDEX)
+ *
+ * An indexed property list has the following at the end of its allocation,
+ * after the key-value pairs:
+ *
+ *   - `bucketCount` bucket words (a power of 2, at least 2)
+ *   - VM_PROPERTY_INDEX_MARKER
+ *   - `bucketCount` as an int14
+ *
+ * Each bucket is either VM_PROPERTY_INDEX_EMPTY or VM_PROPERTY_INDEX_ENTRY(i)
+ * where `i` is the index of a key-value pair in the same allocation. Collisions
+ * are resolved by linear probing. All of these words are negative int14 values
+ * in key positions, so code that walks the pairs linearly (or treats negative
+ * keys as internal slots) never mistakes them for properties.
+ *
+ * Only keys whose value doesn't change when the GC moves things are in the
+ * index: int14 keys and strings in ROM. Strings interned in RAM are ShortPtrs,
+ * so lookups for those keys fall back to a linear scan.
+ */
+#define VM_PROPERTY_INDEX_MARKER VIRTUAL_INT14_ENCODE(-0x1FFF)
+#define VM_PROPERTY_INDEX_EMPTY VIRTUAL_INT14_ENCODE(-1)
+#define VM_PROPERTY_INDEX_ENTRY(pairIndex) VIRTUAL_INT14_ENCODE(-2 - (int)(pairIndex))
+#define VM_PROPERTY_INDEX_ENTRY_DECODE(entry) ((uint16_t)(-2 - (((int16_t)(entry)) >> 2)))
+
 // Some well-known values
 typedef enum vm_TeWellKnownValues {
   // Note: well-known values share the bytecode address space, so we can't have
@@ -813,6 +959,37 @@ typedef struct TsPropertyCell /* extends TsPropertyList */ {
   Value value;
 } TsPropertyCell;
 
+/**
+ * An alternative representation of a JavaScript object (TC_REF_SHAPED_OBJECT)
+ * where the keys are not stored in the object itself but in a separate "shape",
+ * which is a TsFixedLengthArray of keys that can be shared by any number of
+ * objects with the same keys in the same order. The object itself holds only
+ * the values, in the same order as the keys of the shape.
+ *
+ * Shapes are created by the compiler when encoding the snapshot and are placed
+ * in ROM, so each object with N properties costs 6 + 2N bytes of RAM rather
+ * than the 4 + 4N bytes of a TsPropertyList, and a key found in the shape is
+ * found at the same index in every object with that shape.
+ *
+ * The first two fields have the same layout as TsPropertyList, so that code
+ * following the `dpNext` and `dpProto` pointers can treat both in the same way.
+ * Properties added after the object was created are appended as TsPropertyCell
+ * groups in the `dpNext` chain, exactly as for a TsPropertyList, and the GC
+ * compacts them into a single group. The shape itself never changes.
+ *
+ * Only supported if MVM_SHAPED_OBJECTS is enabled. Otherwise, the engine
+ * refuses to load bytecode that contains shaped objects (FF_SHAPED_OBJECTS).
+ */
+typedef struct TsShapedObject /* extends TsPropertyList */ {
+  DynamicPtr dpNext; // TsPropertyList* or VM_VALUE_NULL, containing properties added after creation
+  DynamicPtr dpProto;
+  DynamicPtr dpShape; // TsFixedLengthArray of keys (TC_VAL_INT14 or TC_REF_INTERNED_STRING)
+  /*
+  Followed by one value for each key in the shape:
+    Value values[];
+   */
+} TsShapedObject;
+
 /**
  * A TsClosure (TC_REF_CLOSURE) is a function-like (callable) container that is
  * overloaded to represent both closures and/or their variable environments.
@@ -905,10 +1082,187 @@ typedef struct TsBucket {
   /* ...data */
 } TsBucket;
 
-typedef struct TsBreakpoint {
-  struct TsBreakpoint* next;
-  int bytecodeAddress;
-} TsBreakpoint;
+#if MVM_INCREMENTAL_GC
+typedef struct gc_TsIncrementalGC gc_TsIncrementalGC;
+#endif
+
+#if MVM_INCLUDE_DEBUG_CAPABILITY
+// The breakpoints set by mvm_dbg_setBreakpoint. Allocated when the first
+// breakpoint is set and freed when the last one is removed, so that `mvm_call`
+// only needs to check for NULL when there are no breakpoints.
+typedef struct vm_TsBreakpoints {
+  // Number of bits set in `bits`
+  uint16_t count;
+  // All the code is in the ROM section, so `bits` only needs to extend as far
+  // as the end of ROM. Addresses at or beyond this never have a breakpoint.
+  uint16_t addressLimit;
+  // True if there is a breakpoint at address -1 (every instruction)
+  bool breakOnEveryInstruction;
+  // One bit per byte of bytecode, indexed by bytecode address. A bit is set if
+  // there's a breakpoint on the instruction starting at that address.
+  uint8_t bits[1];
+} vm_TsBreakpoints;
+#endif // MVM_INCLUDE_DEBUG_CAPABILITY
+
+#if MVM_VERIFY_BYTECODE
+// Kinds of instruction that the bytecode verifier checks against the stack
+// state at the instruction, beyond the general pop/push accounting. See
+// vm_verifyFunction.
+typedef enum vm_TeVerifierCheck {
+  VM_VC_NONE,
+  VM_VC_VAR,            // LOAD_VAR or STORE_VAR (operand is the variable index)
+  VM_VC_RETURN,         // RETURN or TAIL_CALL (not allowed inside a try block)
+  VM_VC_ASYNC,          // Only allowed in an async function body
+  VM_VC_AWAIT,          // Target is the resume point
+  VM_VC_ASYNC_RESUME,   // Operand is the slot count and catch offset
+  VM_VC_ASYNC_START,
+  VM_VC_ASYNC_COMPLETE,
+  VM_VC_START_TRY,      // Target is the catch block
+  VM_VC_END_TRY,
+  VM_VC_SWITCH,         // Target is the default case, operand is the case count
+  VM_VC_FRAME_VARS,     // VAR_NUM_OP or VAR_LIT_NUM_OP (operand is the two frame slot indexes)
+  VM_VC_ITER_START,     // ARRAY_ITER_START (starts an iteration cursor)
+  VM_VC_ITER_NEXT,      // ARRAY_ITER_NEXT (the cursor must be at the top of the stack)
+} vm_TeVerifierCheck;
+
+// A single instruction as decoded by the bytecode verifier
+typedef struct vm_TsVerifierInstruction {
+  uint16_t operand;
+  uint16_t target; // Branch, jump, catch or resume target if `hasTarget`
+  uint16_t size;
+  uint8_t pop;
+  uint8_t push;
+  uint8_t check; // vm_TeVerifierCheck
+  bool hasTarget;
+  bool fallsThrough;
+} vm_TsVerifierInstruction;
+
+// A try block in the function being verified. Index 0 in the table means "not
+// in a try block" and index 1 is the root catch block of an async function.
+typedef struct vm_TsVerifierTry {
+  // Address of the START_TRY instruction (0 for the async root)
+  uint16_t startTryAddress;
+  // Stack depth at which the catch target is stored
+  uint8_t stackDepthBefore;
+  // Index of the enclosing try block
+  uint8_t parent;
+  // True if this is (or is nested in) the async root catch block
+  bool isAsync;
+} vm_TsVerifierTry;
+
+// An array iteration cursor (the array and index pushed by ARRAY_ITER_START)
+// in the function being verified. Index 0 in the table means "no cursor".
+typedef struct vm_TsVerifierIter {
+  // Address of the ARRAY_ITER_START instruction
+  uint16_t iterStartAddress;
+  // Stack depth with the cursor at the top (the index is at depth - 1)
+  uint8_t stackDepthAfter;
+  // Index of the enclosing cursor
+  uint8_t parent;
+} vm_TsVerifierIter;
+
+// State of the load-time bytecode verifier. See MVM_VERIFY_BYTECODE in
+// microvium_port_example.h
+typedef struct vm_TsVerifier {
+  LongPtr lpBytecode;
+  void* context;
+  uint16_t romStart;
+  uint16_t romEnd;
+  uint16_t globalsStart;
+  uint16_t globalsEnd;
+  uint16_t heapStart;
+  uint16_t heapEnd;
+  uint16_t importCount;
+  // Address of the BIN_ASYNC_CATCH_BLOCK function, or 0 if there is none
+  uint16_t asyncCatchBlock;
+  // Lowest global slot index used as a handle, and one past the highest global
+  // slot index written by STORE_GLOBAL. Handles must not be overwritten.
+  uint16_t firstHandle;
+  uint16_t globalStoreEnd;
+
+  // Bitmaps with 1 bit per word of the image (indexed by address / 2)
+  uint8_t* pQueued; // ROM allocations referenced by a verified value
+  uint8_t* pChecked; // ROM allocations already verified
+  uint8_t* pResumePoints; // Async resume points referenced by a verified value
+  uint8_t* pHeapAllocations; // Start of each allocation in the heap section
+
+  // Bitmaps with 1 bit per byte of the image up to the end of ROM
+  uint8_t* pCode; // Start of each verified instruction
+  uint8_t* pReached; // Scratch set for the function being verified
+
+  // The function being verified
+  uint16_t entry;
+  uint16_t lo; // Lowest reachable instruction address
+  uint8_t* pDepth; // Stack depth at each instruction, indexed from `lo`
+  uint8_t* pTry; // Try block index at each instruction, indexed from `lo`
+  uint8_t* pIter; // Innermost iteration cursor at each instruction, indexed from `lo`
+  bool again; // A backward edge reached a new instruction during the sweep
+} vm_TsVerifier;
+#endif // MVM_VERIFY_BYTECODE
+
+#if MVM_INLINE_CACHE
+// The location of a property as last seen by a property access instruction.
+// See MVM_INLINE_CACHE in microvium_port_example.h
+typedef struct vm_TsInlineCacheEntry {
+  // Bytecode address of the end of the instruction that filled the entry, or 0
+  // if the entry is unused
+  uint16_t site;
+  // The object that the property was accessed on
+  Value receiver;
+  // The property key
+  Value key;
+  // The value slot of the property, which may be in the receiver or in one of
+  // its prototypes (for reads)
+  LongPtr lpSlot;
+  #if MVM_SHAPED_OBJECTS
+  // If the property was found in the shape of a shaped object, the shape and
+  // the offset of the value slot from the start of the object, so that the
+  // entry also serves other objects with the same shape. Otherwise
+  // VM_VALUE_UNDEFINED.
+  Value shape;
+  uint16_t shapeSlotOffset;
+  #endif
+} vm_TsInlineCacheEntry;
+#endif // MVM_INLINE_CACHE
+
+#if MVM_CALL_CACHE
+// The target of a dynamic call as last seen by a call instruction. See
+// MVM_CALL_CACHE in microvium_port_example.h
+typedef struct vm_TsCallCacheEntry {
+  // Bytecode address of the end of the call instruction that filled the
+  // entry, or 0 if the entry is unused
+  uint16_t site;
+  // The function or closure that was called
+  Value callee;
+  // The function that the callee resolved to. This is the same as `callee`
+  // for a plain function. For a closure, the closure's target is checked
+  // against this on each hit, since an embedded closure's target is written
+  // after the closure is created.
+  Value function;
+  // Offset of the function's code in the bytecode
+  uint16_t functionOffset;
+  // Words of stack needed by the function's frame, including the saved
+  // registers
+  uint16_t frameSizeWords;
+} vm_TsCallCacheEntry;
+#endif // MVM_CALL_CACHE
+
+#if MVM_JIT
+// A bytecode function tracked by the JIT. See MVM_JIT in
+// microvium_port_example.h
+typedef struct vm_TsJitFunction {
+  // Bytecode address of the function's first instruction, or 0 if the entry is
+  // unused
+  uint16_t address;
+  // Number of calls so far, up to MVM_JIT_THRESHOLD
+  uint16_t callCount;
+  // Offset of the native entry point in the code buffer, 0 if the function
+  // hasn't been compiled yet, or VM_JIT_FAILED
+  uint32_t entry;
+} vm_TsJitFunction;
+
+#define VM_JIT_FAILED 0xFFFFFFFF
+#endif // MVM_JIT
 
 /*
   Minimum size:
@@ -924,7 +1278,7 @@ typedef struct TsBreakpoint {
 
 */
 struct mvm_VM {
-  uint16_t* globals;
+  Value* globals;
   LongPtr lpBytecode;
   vm_TsStack* stack;
 
@@ -935,10 +1289,24 @@ struct mvm_VM {
   // Handles - values to treat as GC roots
   mvm_Handle* gc_handles;
 
+  #if MVM_RESERVED_HEAP
+  // 2 ranges of address space reserved for the heap, mapped on first use. The
+  // heap is in range `reservedHeapRange` and the GC copies it to the other.
+  uint8_t* pReservedHeap;
+  // The number of bytes at the start of each range that are committed
+  size_t reservedHeapCommitted[2];
+  uint8_t reservedHeapRange;
+  #endif // MVM_RESERVED_HEAP
+
+  #if MVM_INCREMENTAL_GC
+  // The collection in progress (see mvm_runGCStep), or NULL
+  gc_TsIncrementalGC* pIncrementalGC;
+  #endif // MVM_INCREMENTAL_GC
+
   void* context;
 
   #if MVM_INCLUDE_DEBUG_CAPABILITY
-  TsBreakpoint* pBreakpoints;
+  vm_TsBreakpoints* pBreakpoints;
   mvm_TfBreakpointCallback breakpointCallback;
   #endif // MVM_INCLUDE_DEBUG_CAPABILITY
 
@@ -946,6 +1314,45 @@ struct mvm_VM {
   int32_t stopAfterNInstructions; // Set to -1 to disable
   #endif // MVM_GAS_COUNTER
 
+  #if MVM_INLINE_CACHE
+  vm_TsInlineCacheEntry inlineCache[MVM_INLINE_CACHE_SIZE];
+  mvm_TsInlineCacheStats inlineCacheStats;
+  #endif // MVM_INLINE_CACHE
+
+  #if MVM_CALL_CACHE
+  vm_TsCallCacheEntry callCache[MVM_CALL_CACHE_SIZE];
+  mvm_TsCallCacheStats callCacheStats;
+  #endif // MVM_CALL_CACHE
+
+  #if MVM_UNBOXED_INT32
+  mvm_TsUnboxedInt32Stats unboxedInt32Stats;
+  #endif // MVM_UNBOXED_INT32
+
+  #if MVM_UNBOXED_FLOAT64
+  mvm_TsUnboxedFloat64Stats unboxedFloat64Stats;
+  #endif // MVM_UNBOXED_FLOAT64
+
+  #if MVM_JIT
+  vm_TsJitFunction jitFunctions[MVM_JIT_FUNCTION_COUNT];
+  // MVM_JIT_CODE_SIZE bytes of memory mapped on the first compilation. It's
+  // executable (and not writable) except while a function is being compiled.
+  uint8_t* pJitCode;
+  mvm_TsJitStats jitStats;
+  #endif // MVM_JIT
+
+  #if MVM_AOT
+  const mvm_TsAotFunctionTable* pAotFunctions;
+  #endif // MVM_AOT
+
+  #if MVM_SCOPE_CACHE_SIZE
+  // Outer scopes of `scopeCacheKey` (the closure register when the cache was
+  // filled). `scopeCache[i]` is the scope `i + 1` steps up the scope chain.
+  // See vm_findOuterScope.
+  Value scopeCacheKey;
+  uint8_t scopeCacheCount;
+  Value scopeCache[MVM_SCOPE_CACHE_SIZE];
+  #endif // MVM_SCOPE_CACHE_SIZE
+
   uint16_t heapSizeUsedAfterLastGC;
   uint16_t stackHighWaterMark;
   uint16_t heapHighWaterMark;
@@ -1000,15 +1407,15 @@ typedef enum vm_TeActivationFlags {
  * This struct is malloc'd from the host when the host calls into the VM
  */
 typedef struct vm_TsRegisters { // 28 B on 32-bit machine
-  uint16_t* pFrameBase;
-  uint16_t* pStackPointer;
+  Value* pFrameBase;
+  Value* pStackPointer;
   LongPtr lpProgramCounter;
   // Note: I previously used to infer the location of the arguments based on the
   // number of values PUSHed by a CALL instruction to preserve the activation
   // state (i.e. 3 words). But now that distance is dynamic, so we need and
   // explicit register.
   Value* pArgs;
-  uint16_t* pCatchTarget; // NULL if no catch block, otherwise points to catch block
+  Value* pCatchTarget; // NULL if no catch block, otherwise points to catch block
   uint16_t argCountAndFlags; // Lower 8 bits are argument count, upper 8 bits are vm_TeActivationFlags
   Value closure; // Closure scope or VM_VALUE_UNDEFINED
 
@@ -1096,6 +1503,34 @@ typedef struct gc_TsGCCollectionState {
   uint16_t* lastBucketEndCapacity;
 } gc_TsGCCollectionState;
 
+#if MVM_INCREMENTAL_GC
+// A collection started by mvm_runGCStep. The mutator keeps using fromspace
+// while the collector replicates the reachable allocations into tospace, and the
+// roots are only switched over to tospace when the replica is complete (see
+// gc_incrementalFlip).
+struct gc_TsIncrementalGC {
+  // Tospace
+  gc_TsGCCollectionState gc;
+  // The next replica to scan. Replicas before this have been copied from
+  // fromspace and their pointers forwarded to tospace. Replicas after it still
+  // hold the ShortPtr of their fromspace original in the first word.
+  TsBucket* scanBucket;
+  uint16_t* pScan;
+  // Count of allocations replicated in this collection
+  uint16_t replicatedCount;
+  // Number of entries in `pDirty`
+  uint16_t dirtyCount;
+  // Indexed by fromspace ShortPtr / 4 (allocations are at least 4 bytes
+  // apart). Each entry is the tospace ShortPtr of the replica, or 0 if the
+  // allocation hasn't been replicated. Bit 0 is set while the allocation is in
+  // `pDirty`.
+  uint16_t* pForwarding;
+  // Fromspace ShortPtrs of the replicated allocations that the mutator has
+  // written to since they were last copied
+  ShortPtr* pDirty;
+};
+#endif // MVM_INCREMENTAL_GC
+
 typedef struct mvm_TsCallStackFrame {
   uint16_t programCounter;
   Value* frameBase;
@@ -1130,7 +1565,7 @@ typedef struct mvm_TsHeapAllocationInfo {
 
 static inline mvm_HostFunctionID vm_getHostFunctionId(VM*vm, uint16_t hostFunctionIndex);
 static TeError vm_createStackAndRegisters(VM* vm);
-static TeError vm_requireStackSpace(VM* vm, uint16_t* pStackPointer, uint16_t sizeRequiredInWords);
+static TeError vm_requireStackSpace(VM* vm, Value* pStackPointer, uint16_t sizeRequiredInWords);
 static Value vm_convertToString(VM* vm, Value value);
 static Value vm_concat(VM* vm, Value* left, Value* right);
 static TeTypeCode deepTypeOf(VM* vm, Value value);
@@ -1164,8 +1599,8 @@ static int memcmp_long(LongPtr p1, LongPtr p2, size_t size);
 static LongPtr getBytecodeSection(VM* vm, mvm_TeBytecodeSection id, LongPtr* out_end);
 static inline void* LongPtr_truncate(VM* vm, LongPtr lp);
 static inline LongPtr LongPtr_new(void* p);
-static inline uint16_t* getBottomOfStack(vm_TsStack* stack);
-static inline uint16_t* getTopOfStackSpace(vm_TsStack* stack);
+static inline Value* getBottomOfStack(vm_TsStack* stack);
+static inline Value* getTopOfStackSpace(vm_TsStack* stack);
 static inline void* getBucketDataBegin(TsBucket* bucket);
 static uint16_t getBucketOffsetEnd(TsBucket* bucket);
 static uint16_t getSectionSize(VM* vm, mvm_TeBytecodeSection section);
@@ -1174,8 +1609,11 @@ static Value vm_newStringFromCStrNT(VM* vm, const char* s);
 static TeError vm_validatePortFileMacros(MVM_LONG_PTR_TYPE lpBytecode, mvm_TsBytecodeHeader* pHeader, void* context);
 static LongPtr vm_toStringUtf8_long(VM* vm, Value value, size_t* out_sizeBytes);
 static LongPtr vm_findScopedVariable(VM* vm, uint16_t index);
+static LongPtr vm_findOuterScopedVariable(VM* vm, uint8_t depthAndIndex);
 static inline Value vm_readScopedFromThisClosure(VM* vm, uint16_t varIndex);
 static inline void vm_writeScopedToThisClosure(VM* vm, uint16_t varIndex, Value value);
+static inline bool vm_getSwitchKey(VM* vm, Value discriminant, int16_t* out_key);
+static inline Value vm_readArrayElement(VM* vm, Value array, uint16_t index);
 static Value vm_cloneContainer(VM* vm, Value* pArr);
 static Value vm_safePop(VM* vm, Value* pStackPointerAfterDecr);
 static LongPtr vm_getStringData(VM* vm, Value value);
@@ -1192,12 +1630,53 @@ static void* ShortPtr_decode(VM* vm, ShortPtr shortPtr);
 static TeError vm_newError(VM* vm, TeError err);
 static void* vm_malloc(VM* vm, size_t size);
 static void vm_free(VM* vm, void* ptr);
-static inline uint16_t* getTopOfStackSpace(vm_TsStack* stack);
+static bool vm_compareNumbers(VM* vm, Value left, Value right, vm_TeNumberOp op);
+#if MVM_INLINE_CACHE
+static TeError vm_getPropertyCached(VM* vm, uint16_t site, Value* pObjectValue, Value* pPropertyName, Value* out_propertyValue);
+static TeError vm_setPropertyCached(VM* vm, uint16_t site, Value* pObject, Value* pPropertyName, Value* pPropertyValue);
+static void vm_invalidateInlineCache(VM* vm);
+static void vm_invalidateInlineCacheForKey(VM* vm, Value key);
+#endif
+#if MVM_CALL_CACHE
+static void vm_fillCallCache(VM* vm, vm_TsCallCacheEntry* entry, uint16_t site, Value callee);
+static void vm_invalidateCallCache(VM* vm);
+#endif
+#if MVM_UNBOXED_INT32 || MVM_UNBOXED_FLOAT64
+static bool vm_arithmeticResultIsConsumed(VM* vm, LongPtr lpNextInstruction, Value* pResultSlot, bool isInt32);
+#endif
+#if MVM_UNBOXED_INT32
+static bool vm_int32Op(uint8_t instr, int32_t left, int32_t right, int32_t* out_result);
+#endif
+#if MVM_JIT
+static void vm_jitEnter(VM* vm);
+static void vm_jitFree(VM* vm);
+#endif
+#if MVM_AOT
+static bool vm_aotEnter(VM* vm);
+#endif
+#if MVM_VERIFY_BYTECODE
+static TeError vm_verifyBytecode(MVM_LONG_PTR_TYPE lpBytecode, mvm_TsBytecodeHeader* pHeader, void* context);
+#endif
+#if MVM_SHAPED_OBJECTS
+static LongPtr vm_shapedObjectFindSlot(VM* vm, LongPtr lpObject, Value propertyName);
+#endif
+#if MVM_PROPERTY_INDEX
+static uint16_t vm_propertyIndexSize(VM* vm, LongPtr lpPropertyList, uint16_t size);
+static bool vm_propertyIndexFindSlot(VM* vm, LongPtr lpPropertyList, uint16_t* inout_size, Value propertyName, LongPtr* out_lpSlot);
+static void gc_buildPropertyIndex(VM* vm, uint16_t* pPairs, uint16_t pairCount, uint16_t bucketCount);
+#endif
+#if MVM_INCREMENTAL_GC
+static void gc_incrementalWriteBarrier(VM* vm, void* pAllocation);
+static void gc_incrementalScopedWriteBarrier(VM* vm, Value* pVar);
+static void gc_incrementalAbandon(VM* vm);
+static void gc_incrementalFinish(VM* vm);
+#endif
+static inline Value* getTopOfStackSpace(vm_TsStack* stack);
 static Value* vm_getHandleTargetOrNull(VM* vm, Value value);
 static Value vm_resolveIndirections(VM* vm, Value value);
 static mvm_TeError vm_uint8ArrayNew(VM* vm, Value* slot);
 static Value getBuiltin(VM* vm, mvm_TeBuiltins builtinID);
-static uint16_t* vm_scopePushOrNew(VM* vm, int slotCount, bool captureParent);
+static Value* vm_scopePushOrNew(VM* vm, int slotCount, bool captureParent);
 static inline Value vm_encodeBytecodeOffsetAsPointer(VM* vm, uint16_t offset);
 static void vm_enqueueJob(VM* vm, Value jobClosure);
 static Value vm_dequeueJob(VM* vm);
@@ -1288,7 +1767,7 @@ static const uint8_t typeByTC[TC_END] = {
   VM_T_SYMBOL,      /* TC_REF_SYMBOL             */
   VM_T_CLASS,       /* TC_REF_CLASS              */
   VM_T_END,         /* TC_REF_VIRTUAL            */
-  VM_T_END,         /* TC_REF_RESERVED_1         */
+  VM_T_OBJECT,      /* TC_REF_SHAPED_OBJECT      */
   VM_T_OBJECT,      /* TC_REF_PROPERTY_LIST      */
   VM_T_ARRAY,       /* TC_REF_ARRAY              */
   VM_T_ARRAY,       /* TC_REF_FIXED_LENGTH_ARRAY */
@@ -1324,6 +1803,23 @@ static int32_t mvm_float64ToInt32(MVM_FLOAT64 value);
   } while (0)
 #endif
 
+// Every write to an existing heap allocation must be followed by a write
+// barrier on the allocation, so that a collection in progress (see
+// mvm_runGCStep) copies it again. Allocations created since the last possible
+// collection step don't need one.
+#if MVM_INCREMENTAL_GC
+  #define VM_WRITE_BARRIER(vm, pAllocation) do { \
+    if ((vm)->pIncrementalGC) gc_incrementalWriteBarrier(vm, pAllocation); \
+  } while (0)
+  // For a write to a closure variable, where only the slot is known
+  #define VM_SCOPED_WRITE_BARRIER(vm, pVar) do { \
+    if ((vm)->pIncrementalGC) gc_incrementalScopedWriteBarrier(vm, pVar); \
+  } while (0)
+#else
+  #define VM_WRITE_BARRIER(vm, pAllocation) do { } while (0)
+  #define VM_SCOPED_WRITE_BARRIER(vm, pVar) do { } while (0)
+#endif
+
 // MVM_LOCAL declares a local variable whose value would become invalidated if
 // the GC performs a cycle. All access to the local should use MVM_GET_LOCAL AND
 // MVM_SET_LOCAL. This only needs to be used for pointer values or values that
@@ -112,6 +112,20 @@ fixes and improvement from the original github or npm repository.
  */
 #define MVM_DONT_TRUST_BYTECODE 1
 
+/**
+ * Set to `1` to verify the whole bytecode image once in `mvm_restore` (jump
+ * targets, operand ranges, stack heights against each function's declared
+ * maximum, and references between sections) and then run the interpreter
+ * without the per-instruction checks of `MVM_DONT_TRUST_BYTECODE`. Invalid
+ * images are rejected with `MVM_E_INVALID_BYTECODE` before any VM memory is
+ * allocated. The verifier needs scratch RAM during restore, up to half the
+ * bytecode size plus 3 bytes per byte of the largest function, which is
+ * allocated with `MVM_CONTEXTUAL_MALLOC` and freed again before returning.
+ *
+ * Requires `MVM_DONT_TRUST_BYTECODE`.
+ */
+#define MVM_VERIFY_BYTECODE 0
+
 /**
  * Not recommended!
  *
@@ -216,6 +230,229 @@ fixes and improvement from the original github or npm repository.
 #define MVM_SWITCH(tag, upper) switch (tag)
 #define MVM_CASE(value) case value
 
+/**
+ * Set to 1 to dispatch bytecode instructions through a table of label
+ * addresses (computed goto) rather than the nested switch statements in the
+ * run loop. Each instruction is then dispatched with a single indirect jump
+ * indexed by its first byte, instead of a switch on the primary opcode
+ * followed by a second switch on the extended opcode.
+ *
+ * This is typically faster on pipelined processors, at the cost of some
+ * additional ROM for the 256-entry dispatch table and the per-opcode dispatch
+ * stubs. It requires a compiler that supports the "labels as values"
+ * extension (GCC and Clang). When enabled, MVM_SWITCH and MVM_CASE are still
+ * used for the remaining switch statements.
+ */
+#define MVM_COMPUTED_GOTO_DISPATCH 0
+
+/**
+ * Set to 1 to cache the location of properties accessed by instructions with
+ * a constant key (`o.x` and `o.x = v`).
+ *
+ * The cache is a small table in the VM struct, indexed by the bytecode
+ * address of the accessing instruction. Each entry records the object and key
+ * last seen at that instruction and the address of the property's value slot,
+ * so that the next access to the same object at the same instruction is a
+ * compare and a load rather than a search of the object's property list and
+ * prototype chain. Adding a property to an object discards the entries for
+ * that key (the new property may shadow one found on a prototype), and a
+ * garbage collection discards all entries since it moves objects.
+ *
+ * Objects are cached by identity, so the cache helps most where the same
+ * object is accessed repeatedly at the same instruction, such as in a loop.
+ * With MVM_SHAPED_OBJECTS, an entry for a property that was found in the shape
+ * of a shaped object also hits for any other object with the same shape, such
+ * as the elements of an array of records created by the same code. Plain
+ * property lists have no shape, so for those a site that sees a different
+ * object each time always misses.
+ *
+ * Hit and miss counters are available through `mvm_getInlineCacheStats`.
+ */
+#define MVM_INLINE_CACHE 0
+
+/**
+ * The number of entries in the property inline cache (MVM_INLINE_CACHE). Must
+ * be a power of 2. Each entry is 6 bytes plus a long pointer, and instructions
+ * whose bytecode addresses collide modulo this size share an entry.
+ */
+#define MVM_INLINE_CACHE_SIZE 32
+
+/**
+ * Set to 1 to cache the target of each dynamic call instruction (`CALL_3`),
+ * which is how calls through a variable, a property or a closure are compiled.
+ *
+ * A dynamic call normally checks the type of the callee, follows a closure to
+ * its target function, and reads the target's function header to find its
+ * frame size. The cache is a small table in the VM struct, indexed by the
+ * bytecode address of the call instruction, that records the callee last seen
+ * at that instruction along with its target and frame size. When the same
+ * function or closure is called again from the same instruction, the call goes
+ * straight to setting up the new frame. A garbage collection discards all
+ * entries, since closures are heap objects that move.
+ *
+ * Hit and miss counters are available through `mvm_getCallCacheStats`.
+ */
+#define MVM_CALL_CACHE 0
+
+/**
+ * The number of entries in the call-site cache (MVM_CALL_CACHE). Must be a
+ * power of 2. Each entry is 10 bytes, and call instructions whose bytecode
+ * addresses collide modulo this size share an entry.
+ */
+#define MVM_CALL_CACHE_SIZE 16
+
+/**
+ * The number of outer scopes to remember for the instructions that access
+ * closure variables by scope depth (VM_OP4_LOAD_SCOPED_OUTER and
+ * VM_OP4_STORE_SCOPED_OUTER). The VM remembers the scope chain of the most
+ * recently used closure up to this depth, so that repeated accesses to an
+ * outer variable from the same closure don't walk the chain each time. The
+ * cache costs 2 bytes of RAM per entry in every VM, and is discarded by a
+ * garbage collection. 0 disables the cache. Must be no more than 15.
+ */
+#define MVM_SCOPE_CACHE_SIZE 0
+
+/**
+ * Set to 1 to include fast paths in the arithmetic, comparison and bitwise
+ * instructions for when the operands are int14 values, which is the case for
+ * most integer arithmetic in practice (e.g. loop counters). These skip the
+ * general conversion to int32 or float64 and the overflow checks. They cost a
+ * few hundred bytes of ROM, so they are opt-in.
+ */
+#define MVM_INT14_FAST_PATHS 0
+
+/**
+ * Set to 1 to avoid allocating the int32 results of arithmetic that are only
+ * used as an operand of the arithmetic that follows, such as `a * b` in
+ * `(a * b) & 0xFFFF` or `t - t0` in `(t - t0) >> 4`.
+ *
+ * A number outside the int14 range is normally allocated on the GC heap, so
+ * each intermediate result in that range costs an allocation, and code that
+ * works with timestamps, sensor readings or checksums can end up allocating on
+ * almost every operation. With this option, an arithmetic instruction whose
+ * int32 result is consumed by the next arithmetic instruction (possibly after
+ * pushing a literal, an argument or a variable) passes the result to it in a
+ * local variable of the interpreter instead. The result's stack slot holds a
+ * placeholder in the meantime, which the GC skips. If the consuming
+ * instruction can't do the operation on int32 values (e.g. a division, or an
+ * overflow into float64), the result is allocated at that point as before.
+ * Results that go anywhere else, such as to a variable, are also allocated.
+ *
+ * This works with the gas counter (MVM_GAS_COUNTER), which counts the same
+ * instructions either way, but isn't done while breakpoints are set.
+ * Counters are available through `mvm_getUnboxedInt32Stats`.
+ */
+#define MVM_UNBOXED_INT32 0
+
+/**
+ * Set to 1 to avoid allocating the non-integer results of arithmetic that are
+ * only used as an operand of the NUM_OP that follows, such as `a * 0.3` and
+ * `b * 0.7` in `a * 0.3 + b * 0.7`. Requires MVM_SUPPORT_FLOAT.
+ *
+ * This works like MVM_UNBOXED_INT32, except that the result can also wait
+ * while other NUM_OPs run on values pushed after it, as with `a * 0.3` above.
+ * Up to 4 results at a time are kept in local variables of the interpreter,
+ * and their stack slots hold placeholders in the meantime. Since a non-integer
+ * operand always sends a NUM_OP down the float64 path, the consuming
+ * instruction does the operation directly on the unboxed value when the other
+ * operand is a number. Each such result saves an 8-byte heap allocation, and
+ * some of the collections that come with them. Results that are integers after
+ * all are passed on as int32 values if MVM_UNBOXED_INT32 is also enabled.
+ *
+ * This works with the gas counter (MVM_GAS_COUNTER), which counts the same
+ * instructions either way, but isn't done while breakpoints are set.
+ * Counters are available through `mvm_getUnboxedFloat64Stats`.
+ */
+#define MVM_UNBOXED_FLOAT64 0
+
+/**
+ * Set to 1 to support objects whose keys are stored in a shared "shape" in ROM
+ * rather than in each object (see TsShapedObject in microvium_internals.h).
+ *
+ * The compiler only produces these when the snapshot is created with the
+ * `shapedObjects` option. Objects with the same keys in the same order then
+ * share a single list of keys in ROM, and each object in RAM holds just the
+ * prototype, the shape pointer and the property values. Bytecode that contains
+ * shaped objects can't be loaded unless this is enabled
+ * (MVM_E_BYTECODE_REQUIRES_SHAPED_OBJECTS).
+ */
+#define MVM_SHAPED_OBJECTS 0
+
+/**
+ * Set to 1 to give large objects a hash index over their property keys, so
+ * that property lookup on them doesn't need to scan every property.
+ *
+ * The GC builds the index when it compacts an object that has at least
+ * MVM_PROPERTY_INDEX_THRESHOLD properties, and stores it at the end of the
+ * object's own allocation. Properties added after the last collection are
+ * scanned linearly as usual until the next collection folds them in. The index
+ * costs roughly 4 extra bytes per property on those objects.
+ */
+#define MVM_PROPERTY_INDEX 0
+
+/**
+ * The minimum number of properties an object must have for the GC to give it a
+ * hash index (see MVM_PROPERTY_INDEX).
+ */
+#define MVM_PROPERTY_INDEX_THRESHOLD 16
+
+/**
+ * Set to 1 to compile hot bytecode functions to x86-64 machine code. This is
+ * for running Microvium on a desktop or server host (e.g. for simulation or
+ * testing of the embedded script), and is only supported on x86-64 Linux. It
+ * needs `mmap` and `mprotect`, and memory that can be made executable.
+ *
+ * A bytecode function is compiled when it has been called MVM_JIT_THRESHOLD
+ * times. The JIT is a template compiler over a subset of the instruction set:
+ * loading and storing variables, arguments and literals, int14 arithmetic,
+ * comparisons and bitwise operations, branches and property reads. The native
+ * code uses the interpreter's own frame layout, so at any instruction or case
+ * it doesn't handle (e.g. a call, or an addition that overflows int14), it
+ * returns to the interpreter, which continues the same call from that
+ * instruction. Every live value is kept in its slot on the VM stack rather than
+ * in a machine register, so the garbage collector sees them when the native
+ * code calls the VM to read a property.
+ *
+ * The JIT is skipped while the gas counter is active or breakpoints are set.
+ * Counters are available through `mvm_getJitStats`.
+ */
+#define MVM_JIT 0
+
+/**
+ * The number of calls after which a bytecode function is compiled to native
+ * code (see MVM_JIT).
+ */
+#define MVM_JIT_THRESHOLD 100
+
+/**
+ * The size in bytes of the executable memory for compiled functions (see
+ * MVM_JIT). Functions that become hot after this is full stay interpreted.
+ */
+#define MVM_JIT_CODE_SIZE 0x10000
+
+/**
+ * The number of bytecode functions whose call counts are tracked by the JIT
+ * (see MVM_JIT). Must be a power of 2.
+ */
+#define MVM_JIT_FUNCTION_COUNT 64
+
+/**
+ * Set to 1 to run bytecode functions that have been compiled ahead of time to
+ * C. Unlike MVM_JIT, this works on any target with a C compiler, and costs
+ * flash rather than RAM: the snapshot is compiled with the `nativeFunctions`
+ * snapshotting option, which marks the chosen functions in the bytecode, and
+ * `generateNativeC` translates them to a C file that is built with the host.
+ * The host then passes the table from the generated file to
+ * `mvm_aot_setFunctions` after restoring the snapshot.
+ *
+ * The translation covers the same subset of instructions as the JIT, plus
+ * property writes and object literals, and the generated code returns to the
+ * interpreter at anything else. Functions marked in the snapshot run in the
+ * interpreter when there's no table, so the same snapshot runs on an engine
+ * built without this option.
+ */
+#define MVM_AOT 0
+
 /**
  * Macro that evaluates to true if the CRC of the given data matches the
  * expected value. Note that this is evaluated against the bytecode, so lpData
@@ -262,6 +499,41 @@ fixes and improvement from the original github or npm repository.
 #define MVM_RAM_PAGE_ADDR 0x12340000
 #endif
 
+/**
+ * Set to 1 to keep the heap in address space reserved with `mmap`, for hosts
+ * with virtual memory (e.g. Linux or macOS) where neither
+ * MVM_NATIVE_POINTER_IS_16_BIT nor MVM_USE_SINGLE_RAM_PAGE applies.
+ *
+ * By default, the heap is a list of buckets malloc'd from the host, and
+ * translating a ShortPtr to a native pointer (or back) searches the list. With
+ * this option, each VM reserves 2 ranges of address space of MVM_MAX_HEAP_SIZE
+ * each (one for the heap and one for the GC to copy it to), and commits pages
+ * as the heap grows. The heap is then contiguous, so the translation is an
+ * addition or subtraction. The pages of the old heap are released to the OS
+ * after each collection.
+ *
+ * Hosts without virtual memory should leave this at 0.
+ */
+#define MVM_RESERVED_HEAP 0
+
+/**
+ * Set to 1 to enable `mvm_runGCStep`, which does garbage collection in bounded
+ * steps, for hosts that need to bound the pause (e.g. a control loop that can
+ * spare a fixed slice of each tick).
+ *
+ * A collection cycle copies the reachable allocations in steps while the VM
+ * keeps running, and every write to an existing heap allocation goes through a
+ * write barrier so that the copy stays in step. The barrier is a single test
+ * when no cycle is in progress. During a cycle, the VM allocates an extra
+ * MVM_MAX_HEAP_SIZE bytes of bookkeeping from the host, on top of the copy of
+ * the heap.
+ *
+ * A collection triggered by running out of heap is still a full one, as is
+ * `mvm_runGC`. Not supported with MVM_NATIVE_POINTER_IS_16_BIT or
+ * MVM_USE_SINGLE_RAM_PAGE.
+ */
+#define MVM_INCREMENTAL_GC 0
+
 /**
  * Implementation of malloc and free to use.
  *
@@ -281,3 +553,15 @@ fixes and improvement from the original github or npm repository.
  * `mvm_getInstructionCountRemaining`.
  */
 #define MVM_GAS_COUNTER
+
+/**
+ * Set to 1 to charge the gas counter (MVM_GAS_COUNTER) once per basic block
+ * instead of checking it before every instruction. This takes the countdown off
+ * the hot path of the interpreter loop, but requires bytecode compiled with the
+ * `gasMetering` snapshot option, which starts each block with a VM_OP4_GAS
+ * instruction that holds the number of instructions in the block (blocks are
+ * also split after each call, so that a caught exception isn't charged for the
+ * rest of the block). Bytecode without it fails to restore
+ * (MVM_E_BYTECODE_REQUIRES_GAS_METERING).
+ */
+#define MVM_GAS_PER_BLOCK 0
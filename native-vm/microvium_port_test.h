@@ -33,3 +33,72 @@
 
 #undef MVM_SAFE_MODE
 #define MVM_SAFE_MODE 1
+
+// Verify every image that the tests restore (including every end-to-end test
+// artifact), so that the verifier is checked against everything the compiler
+// can produce. Invalid bytecode is fatal because of MVM_ALL_ERRORS_FATAL.
+#undef MVM_VERIFY_BYTECODE
+#define MVM_VERIFY_BYTECODE 1
+
+// The int14 fast paths must give the same results as the general paths, so the
+// tests run with them on to check that they do.
+#undef MVM_INT14_FAST_PATHS
+#define MVM_INT14_FAST_PATHS 1
+
+// The tests are also run against a second build of the engine with the opt-in
+// run-loop and memory options turned on (the `opt-in-features` addon in
+// binding.gyp), so that each option is checked against the whole end-to-end
+// suite rather than only the tests written for it.
+#if MVM_TEST_OPT_IN_FEATURES
+
+#if defined(__GNUC__) || defined(__clang__)
+#undef MVM_COMPUTED_GOTO_DISPATCH
+#define MVM_COMPUTED_GOTO_DISPATCH 1
+#endif
+
+#undef MVM_INLINE_CACHE
+#define MVM_INLINE_CACHE 1
+
+#undef MVM_CALL_CACHE
+#define MVM_CALL_CACHE 1
+
+#undef MVM_SCOPE_CACHE_SIZE
+#define MVM_SCOPE_CACHE_SIZE 4
+
+#undef MVM_SHAPED_OBJECTS
+#define MVM_SHAPED_OBJECTS 1
+
+// Low enough that the objects in the tests get an index when they're compacted
+#undef MVM_PROPERTY_INDEX
+#define MVM_PROPERTY_INDEX 1
+#undef MVM_PROPERTY_INDEX_THRESHOLD
+#define MVM_PROPERTY_INDEX_THRESHOLD 2
+
+#undef MVM_UNBOXED_INT32
+#define MVM_UNBOXED_INT32 1
+
+#undef MVM_UNBOXED_FLOAT64
+#define MVM_UNBOXED_FLOAT64 1
+
+// The functions in the snapshot are marked as native, but there's no table of
+// generated C for them, so they run in the interpreter
+#undef MVM_AOT
+#define MVM_AOT 1
+
+// Each test calls its functions only a few times
+#if defined(__x86_64__) && defined(__linux__)
+#undef MVM_JIT
+#define MVM_JIT 1
+#undef MVM_JIT_THRESHOLD
+#define MVM_JIT_THRESHOLD 2
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#undef MVM_RESERVED_HEAP
+#define MVM_RESERVED_HEAP 1
+#endif
+
+#undef MVM_INCREMENTAL_GC
+#define MVM_INCREMENTAL_GC 1
+
+#endif // MVM_TEST_OPT_IN_FEATURES
@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+pushd perf-test
+./build.sh
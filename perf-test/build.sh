@@ -0,0 +1,139 @@
+#!/usr/bin/env bash
+#
+# Builds the engine in each of the benchmark configurations and measures the
+# instruction throughput of each on the end-to-end test scripts.
+#
+# The end-to-end tests need to have been run first (`npm test`), since this uses
+# the `1.post-load.mvm-bc` snapshots that they leave in the artifacts directory.
+#
+# Set TESTS to a space-separated list of test names to run only those tests.
+
+set -e
+
+ARTIFACTS=${ARTIFACTS:-../test/end-to-end/artifacts}
+MIN_SECONDS=${MIN_SECONDS:-0.2}
+SAMPLES=${SAMPLES:-5}
+
+# Each configuration is "name:compiler-flags". The flags are PERF_* macros
+# which are mapped to port options in microvium_port.h
+CONFIGS=(
+  "switch:-DPERF_COMPUTED_GOTO_DISPATCH=0"
+  "computed-goto:-DPERF_COMPUTED_GOTO_DISPATCH=1"
+  "inline-cache:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_INLINE_CACHE=1"
+  "call-cache:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_CALL_CACHE=1"
+  "no-int14-fast-paths:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_INT14_FAST_PATHS=0"
+  "reserved-heap:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_RESERVED_HEAP=1"
+  "incremental-gc:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_INCREMENTAL_GC=1"
+  "unboxed-int32:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_UNBOXED_INT32=1"
+  "unboxed-float64:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_UNBOXED_FLOAT64=1"
+  # Built once per test, with the C generated for the test's snapshot
+  "aot:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_AOT=1"
+)
+
+# The JIT only supports x86-64 Linux
+if [ "$(uname -s)" = Linux ] && [ "$(uname -m)" = x86_64 ]; then
+  CONFIGS+=("jit:-DPERF_COMPUTED_GOTO_DISPATCH=1 -DPERF_JIT=1")
+fi
+
+mkdir -p output
+
+# Instructions are counted once per test in a separate build with the gas
+# counter, since the gas counter would distort the timed builds
+gcc -O2 -I. -I../native-vm -DPERF_COUNT_INSTRUCTIONS=1 \
+  perf-test.c \
+  ../native-vm/microvium.c \
+  -o "output/perf-test-count" \
+  -lm
+
+for config in "${CONFIGS[@]}"; do
+  name="${config%%:*}"
+  flags="${config#*:}"
+  if [[ "$flags" == *PERF_AOT* ]]; then
+    # The engine is compiled once, and linked with each test's functions below
+    gcc -O2 -I. -I../native-vm $flags -c ../native-vm/microvium.c -o "output/microvium-$name.o"
+    continue
+  fi
+  gcc -O2 -I. -I../native-vm $flags \
+    perf-test.c \
+    ../native-vm/microvium.c \
+    -o "output/perf-test-$name" \
+    -lm
+done
+
+tests=()
+counts="output/instructions.txt"
+: > "$counts"
+for dir in "$ARTIFACTS"/*/; do
+  testName=$(basename "$dir")
+  if [ -n "$TESTS" ] && [[ " $TESTS " != *" $testName "* ]]; then continue; fi
+  snapshot="$dir/1.post-load.mvm-bc"
+  meta="$dir/0.meta.yaml"
+  [ -f "$snapshot" ] || continue
+  grep -q "^skipNative: true" "$meta" && continue
+  exportID=$(awk '/^runExportedFunction:/ { print $2 }' "$meta")
+  [ -n "$exportID" ] || continue
+  # The host fails the run if a test throws, unless it's meant to
+  options=""
+  grep -q "^expectException:" "$meta" && options="--expect-exception"
+  tests+=("$testName:$exportID:$options")
+  # Assigned first, so that `set -e` stops the script if the host fails
+  count=$(./output/perf-test-count $options "$snapshot" "$exportID")
+  echo "$testName $count" >> "$counts"
+done
+
+# Each result line is the test name, the mean time per call, and the standard
+# deviation of the time per call across SAMPLES samples. The configurations
+# are run one after the other on each test, rather than one after the other
+# on all the tests, so that drift in the speed of the machine (e.g. from
+# frequency scaling) affects them all about equally.
+for config in "${CONFIGS[@]}"; do
+  : > "output/results-${config%%:*}.txt"
+done
+for test in "${tests[@]}"; do
+  IFS=: read -r testName exportID options <<< "$test"
+  snapshot="$ARTIFACTS/$testName/1.post-load.mvm-bc"
+  for config in "${CONFIGS[@]}"; do
+    name="${config%%:*}"
+    flags="${config#*:}"
+    host="./output/perf-test-$name"
+    testSnapshot="$snapshot"
+    if [[ "$flags" == *PERF_AOT* ]]; then
+      # Every function in this snapshot is marked as native, and
+      # 1.post-load.native.c is the C generated for it
+      host="./output/perf-test-$name-$testName"
+      testSnapshot="$ARTIFACTS/$testName/1.post-load.native.mvm-bc"
+      gcc -O2 -I. -I../native-vm $flags \
+        perf-test.c \
+        "$ARTIFACTS/$testName/1.post-load.native.c" \
+        "output/microvium-$name.o" \
+        -o "$host" \
+        -lm
+    fi
+    result=$("$host" $options "$testSnapshot" "$exportID" "$MIN_SECONDS" "$SAMPLES")
+    echo "$testName $result" >> "output/results-$name.txt"
+  done
+done
+
+# Throughput is the counted instructions over the mean time, and the +/- is
+# the standard deviation as a percentage of the mean
+printf "\n%-32s" "Test (M instructions/s)"
+for config in "${CONFIGS[@]}"; do printf "%20s" "${config%%:*}"; done
+printf "\n"
+for test in "${tests[@]}"; do
+  testName="${test%%:*}"
+  printf "%-32s" "$testName"
+  for config in "${CONFIGS[@]}"; do
+    awk -v t="$testName" 'FNR == NR { if ($1 == t) n = $2; next }
+      $1 == t { printf "%20s", sprintf("%.1f +/-%.0f%%", n / $2 / 1e6, 100 * $3 / $2) }' \
+      "$counts" "output/results-${config%%:*}.txt"
+  done
+  printf "\n"
+done
+printf "%-32s" "(all tests)"
+for config in "${CONFIGS[@]}"; do
+  awk 'FNR == NR { n[$1] = $2; next }
+    { i += n[$1]; s += $2; v += $3 * $3 }
+    END { printf "%20s", sprintf("%.1f +/-%.0f%%", i / s / 1e6, 100 * sqrt(v) / s) }' \
+    "$counts" "output/results-${config%%:*}.txt"
+done
+printf "\n"
@@ -0,0 +1,102 @@
+/**
+ * @file microvium_port.h
+ *
+ * Port file for the performance tests. This is the example port file, but with
+ * the debug and safety checks turned off, since these are not representative of
+ * a typical production build.
+ *
+ * Each benchmark configuration in `build.sh` defines one or more `PERF_*`
+ * macros on the command line, which override the corresponding port options
+ * here.
+ */
+
+#include "../native-vm/microvium_port_example.h"
+
+#undef MVM_SAFE_MODE
+#define MVM_SAFE_MODE 0
+
+#undef MVM_DONT_TRUST_BYTECODE
+#define MVM_DONT_TRUST_BYTECODE 0
+
+#undef MVM_VERY_EXPENSIVE_MEMORY_CHECKS
+#define MVM_VERY_EXPENSIVE_MEMORY_CHECKS 0
+
+#undef MVM_INCLUDE_DEBUG_CAPABILITY
+#define MVM_INCLUDE_DEBUG_CAPABILITY 0
+
+#undef MVM_INCLUDE_SNAPSHOT_CAPABILITY
+#define MVM_INCLUDE_SNAPSHOT_CAPABILITY 0
+
+// Same as the native end-to-end tests
+#undef MVM_MAX_HEAP_SIZE
+#define MVM_MAX_HEAP_SIZE 2048
+
+// The gas counter adds a decrement and a check to every instruction, and while
+// a count is set it also turns off the JIT, the AOT functions and store
+// folding, since those skip individual instructions. So it's only
+// enabled in the build that counts the instructions of each test, and the
+// timed builds run without it. See perf-test.c.
+#ifndef PERF_COUNT_INSTRUCTIONS
+#undef MVM_GAS_COUNTER
+#endif
+
+#ifdef PERF_COMPUTED_GOTO_DISPATCH
+#undef MVM_COMPUTED_GOTO_DISPATCH
+#define MVM_COMPUTED_GOTO_DISPATCH PERF_COMPUTED_GOTO_DISPATCH
+#endif
+
+#ifdef PERF_INLINE_CACHE
+#undef MVM_INLINE_CACHE
+#define MVM_INLINE_CACHE PERF_INLINE_CACHE
+#endif
+
+#ifdef PERF_CALL_CACHE
+#undef MVM_CALL_CACHE
+#define MVM_CALL_CACHE PERF_CALL_CACHE
+#endif
+
+// The int14 fast paths are on in every configuration except
+// `no-int14-fast-paths`, which measures what they save
+#undef MVM_INT14_FAST_PATHS
+#ifdef PERF_INT14_FAST_PATHS
+#define MVM_INT14_FAST_PATHS PERF_INT14_FAST_PATHS
+#else
+#define MVM_INT14_FAST_PATHS 1
+#endif
+
+#ifdef PERF_RESERVED_HEAP
+#undef MVM_RESERVED_HEAP
+#define MVM_RESERVED_HEAP PERF_RESERVED_HEAP
+#endif
+
+#ifdef PERF_INCREMENTAL_GC
+#undef MVM_INCREMENTAL_GC
+#define MVM_INCREMENTAL_GC PERF_INCREMENTAL_GC
+#endif
+
+#ifdef PERF_UNBOXED_INT32
+#undef MVM_UNBOXED_INT32
+#define MVM_UNBOXED_INT32 PERF_UNBOXED_INT32
+#endif
+
+#ifdef PERF_UNBOXED_FLOAT64
+#undef MVM_UNBOXED_FLOAT64
+#define MVM_UNBOXED_FLOAT64 PERF_UNBOXED_FLOAT64
+#endif
+
+// Each call is on a freshly restored VM, so the JIT compiles a function after
+// fewer calls than the default, otherwise most calls in a test would finish
+// before it did
+#ifdef PERF_JIT
+#undef MVM_JIT
+#define MVM_JIT PERF_JIT
+#undef MVM_JIT_THRESHOLD
+#define MVM_JIT_THRESHOLD 5
+#endif
+
+// The host registers the functions generated for the snapshot under test
+// (see perf-test.c)
+#ifdef PERF_AOT
+#undef MVM_AOT
+#define MVM_AOT PERF_AOT
+#endif
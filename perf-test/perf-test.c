@@ -0,0 +1,224 @@
+/*
+ * Host for the performance tests.
+ *
+ * Usage: perf-test [--expect-exception] <snapshot.mvm-bc> <exportID> [minSeconds [samples]]
+ *
+ * When built with PERF_COUNT_INSTRUCTIONS, this restores the given snapshot,
+ * calls the given export once, and outputs the number of instructions that the
+ * call executed, as counted by the gas counter (MVM_GAS_COUNTER).
+ *
+ * Otherwise, the gas counter is disabled (see microvium_port.h) and this
+ * measures the time per call. Each sample repeatedly restores the snapshot and
+ * calls the export until at least `minSeconds` of VM execution time has
+ * accumulated, and only the time spent in `mvm_call` is measured. The output
+ * is a single line with the mean and sample standard deviation of the time per
+ * call across the samples, in seconds.
+ *
+ * The snapshots are typically the post-load snapshots of the end-to-end tests,
+ * so this implements the same host functions as the end-to-end test harness,
+ * except that `print` discards its output.
+ *
+ * When built with PERF_AOT, the host is linked with the C that
+ * `generateNativeC` produced for the snapshot, and registers its functions
+ * after each restore. The snapshot must then be the one the C was generated
+ * from (`1.post-load.native.mvm-bc` in the end-to-end artifacts).
+ *
+ * The exit code is non-zero if a call fails or an assertion in the script
+ * fails, so that a configuration that breaks a test doesn't go unnoticed in the
+ * timings. Tests that are expected to end with an uncaught exception are run
+ * with `--expect-exception`, and then it's a call that doesn't throw that fails.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "microvium.h"
+
+// Same IDs as in test/end-to-end/end-to-end.test.ts
+#define HOST_FUNCTION_PRINT_ID 1
+#define HOST_FUNCTION_ASSERT_ID 2
+#define HOST_FUNCTION_ASSERT_EQUAL_ID 3
+#define HOST_FUNCTION_GET_HEAP_USED_ID 4
+#define HOST_FUNCTION_RUN_GC_ID 5
+#define HOST_FUNCTION_ASYNC_TEST_COMPLETE 6
+
+#ifdef PERF_AOT
+extern const mvm_TsAotFunctionTable mvm_aotFunctions;
+#endif
+
+static int assertionFailures = 0;
+static bool expectException = false;
+
+static mvm_TeError resolveImport(mvm_HostFunctionID id, void* context, mvm_TfHostFunction* out);
+
+static double now() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+static mvm_VM* restoreAndResolve(uint8_t* snapshot, long snapshotSize, mvm_VMExportID exportID, mvm_Value* func) {
+  mvm_TeError err;
+  mvm_VM* vm;
+
+  err = mvm_restore(&vm, snapshot, snapshotSize, NULL, resolveImport);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "Restore failed with error %d\n", err);
+    exit(1);
+  }
+#ifdef PERF_AOT
+  err = mvm_aot_setFunctions(vm, &mvm_aotFunctions);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "mvm_aot_setFunctions failed with error %d\n", err);
+    exit(1);
+  }
+#endif
+  err = mvm_resolveExports(vm, &exportID, func, 1);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "Export %d not found\n", exportID);
+    exit(1);
+  }
+  return vm;
+}
+
+static void checkCallResult(mvm_TeError err) {
+  if (expectException ? err != MVM_E_UNCAUGHT_EXCEPTION : err != MVM_E_SUCCESS) {
+    fprintf(stderr, expectException
+      ? "Expected an uncaught exception, but the call returned %d\n"
+      : "Call failed with error %d\n", err);
+    exit(1);
+  }
+}
+
+int main(int argc, char** argv) {
+  mvm_VM* vm;
+  uint8_t* snapshot;
+  long snapshotSize;
+  FILE* snapshotFile;
+  mvm_VMExportID exportID;
+  mvm_Value func;
+
+  if (argc > 1 && strcmp(argv[1], "--expect-exception") == 0) {
+    expectException = true;
+    argv++;
+    argc--;
+  }
+  if (argc < 3) {
+    fprintf(stderr, "Usage: perf-test [--expect-exception] <snapshot.mvm-bc> <exportID> [minSeconds [samples]]\n");
+    return 1;
+  }
+  exportID = (mvm_VMExportID)atoi(argv[2]);
+
+  snapshotFile = fopen(argv[1], "rb");
+  if (!snapshotFile) {
+    fprintf(stderr, "Could not open %s\n", argv[1]);
+    return 1;
+  }
+  fseek(snapshotFile, 0L, SEEK_END);
+  snapshotSize = ftell(snapshotFile);
+  rewind(snapshotFile);
+  snapshot = (uint8_t*)malloc(snapshotSize);
+  if (fread(snapshot, 1, snapshotSize, snapshotFile) != (size_t)snapshotSize) {
+    fprintf(stderr, "Could not read %s\n", argv[1]);
+    return 1;
+  }
+  fclose(snapshotFile);
+
+#ifdef PERF_COUNT_INSTRUCTIONS
+  vm = restoreAndResolve(snapshot, snapshotSize, exportID, &func);
+  mvm_stopAfterNInstructions(vm, INT32_MAX);
+  checkCallResult(mvm_call(vm, func, NULL, NULL, 0));
+  printf("%ld\n", (long)(INT32_MAX - mvm_getInstructionCountRemaining(vm)));
+  mvm_free(vm);
+#else
+  double minSeconds = argc > 3 ? atof(argv[3]) : 0.2;
+  int samples = argc > 4 ? atoi(argv[4]) : 5;
+  double sum = 0;
+  double sumOfSquares = 0;
+
+  // One untimed call first, so that the first sample isn't penalized for
+  // cold caches
+  vm = restoreAndResolve(snapshot, snapshotSize, exportID, &func);
+  checkCallResult(mvm_call(vm, func, NULL, NULL, 0));
+  mvm_free(vm);
+
+  for (int sample = 0; sample < samples; sample++) {
+    double seconds = 0;
+    long calls = 0;
+    do {
+      // A fresh VM for each call, since the test functions are not
+      // necessarily idempotent
+      vm = restoreAndResolve(snapshot, snapshotSize, exportID, &func);
+      double start = now();
+      mvm_TeError err = mvm_call(vm, func, NULL, NULL, 0);
+      seconds += now() - start;
+      checkCallResult(err);
+      calls++;
+      mvm_free(vm);
+    } while (seconds < minSeconds);
+    double secondsPerCall = seconds / calls;
+    sum += secondsPerCall;
+    sumOfSquares += secondsPerCall * secondsPerCall;
+  }
+
+  double mean = sum / samples;
+  double variance = samples > 1 ? (sumOfSquares - sum * mean) / (samples - 1) : 0;
+  printf("%.9g %.9g\n", mean, variance > 0 ? sqrt(variance) : 0);
+#endif
+
+  free(snapshot);
+
+  if (assertionFailures) {
+    fprintf(stderr, "%d assertion failures\n", assertionFailures);
+    return 1;
+  }
+
+  return 0;
+}
+
+static mvm_TeError print(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmAssert(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  if (argCount < 1 || !mvm_toBool(vm, args[0])) assertionFailures++;
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmAssertEqual(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  if (argCount < 2 || !mvm_equal(vm, args[0], args[1])) assertionFailures++;
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmGetHeapUsed(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  mvm_TsMemoryStats stats;
+  mvm_getMemoryStats(vm, &stats);
+  *result = mvm_newInt32(vm, (int32_t)stats.virtualHeapUsed);
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmRunGC(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  mvm_runGC(vm, argCount >= 1 && mvm_toBool(vm, args[0]));
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError asyncTestComplete(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError resolveImport(mvm_HostFunctionID funcID, void* context, mvm_TfHostFunction* out) {
+  switch (funcID) {
+    case HOST_FUNCTION_PRINT_ID: *out = print; break;
+    case HOST_FUNCTION_ASSERT_ID: *out = vmAssert; break;
+    case HOST_FUNCTION_ASSERT_EQUAL_ID: *out = vmAssertEqual; break;
+    case HOST_FUNCTION_GET_HEAP_USED_ID: *out = vmGetHeapUsed; break;
+    case HOST_FUNCTION_RUN_GC_ID: *out = vmRunGC; break;
+    case HOST_FUNCTION_ASYNC_TEST_COMPLETE: *out = asyncTestComplete; break;
+    default: return MVM_E_UNRESOLVED_IMPORT;
+  }
+  return MVM_E_SUCCESS;
+}
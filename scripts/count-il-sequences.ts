@@ -0,0 +1,130 @@
+// Counts the sequences of IL operations that the end-to-end test scripts
+// execute one after another in the same block, in the TypeScript VM. These are
+// the counts that the superinstructions were chosen from (see the
+// Superinstructions section of the instruction set documentation).
+//
+// Usage: ts-node scripts/count-il-sequences.ts [max-length] [rows]
+
+import glob from 'glob';
+import fs from 'fs';
+import YAML from 'yaml';
+import * as IL from '../lib/il';
+import * as VM from '../lib/virtual-machine-types';
+import { VirtualMachineFriendly } from '../lib/virtual-machine-friendly';
+import { addDefaultGlobals } from '../lib';
+
+const maxLength = parseInt(process.argv[2] ?? '4');
+const rows = parseInt(process.argv[3] ?? '20');
+
+const counts = new Map<string, number>();
+let totalOperations = 0;
+
+for (const filename of glob.sync('./test/end-to-end/tests/**/*.test.mvm.js')) {
+  const src = fs.readFileSync(filename, 'utf8');
+  const yamlHeaderMatch = src.match(/\/\*---(.*?)---\*\//s);
+  const meta = yamlHeaderMatch ? YAML.parse(yamlHeaderMatch[1].trim()) : {};
+  if (meta.skip || meta.nativeOnly) continue;
+  countSequences(src, filename, meta.runExportedFunction);
+}
+
+const sorted = [...counts].sort(([, a], [, b]) => b - a);
+console.log(`${totalOperations} operations executed\n`);
+for (const [sequence, count] of sorted.slice(0, rows)) {
+  console.log(`${String(count).padStart(8)}  ${sequence}`);
+}
+
+function countSequences(src: string, filename: string, runExportedFunction: IL.ExportID | undefined) {
+  // The operations executed most recently in the same block, with one entry
+  // per frame. A `Call` is followed by the operation after it once the callee
+  // returns, as if the callee's operations weren't there.
+  const windows: IL.Operation[][] = [[]];
+  let functions: Map<IL.FunctionID, VM.Function> | undefined;
+  // The position of each operation in its block, filled in as blocks are reached
+  const positions = new Map<IL.Operation, { block: IL.Block, index: number }>();
+
+  const trace = (op: IL.Operation) => {
+    totalOperations++;
+    let position = positions.get(op);
+    if (!position) {
+      // The functions of a module are added as it's compiled, so the list is
+      // read again whenever an operation turns up that isn't in it yet
+      for (const func of functions?.values() ?? []) {
+        for (const block of Object.values(func.blocks)) {
+          block.operations.forEach((op, index) => positions.set(op, { block, index }));
+        }
+      }
+      position = positions.get(op);
+    }
+    if (!position) return;
+    const follows = (window: IL.Operation[]) => {
+      const prev = positions.get(window[window.length - 1]);
+      return prev && prev.block === position!.block && prev.index + 1 === position!.index;
+    };
+    // Returning to a caller, possibly past several frames if an exception was
+    // thrown
+    const caller = windows.findLastIndex(follows);
+    if (caller !== -1) {
+      windows.length = caller + 1;
+      windows[caller] = [...windows[caller].slice(1 - maxLength), op];
+    } else {
+      const top = windows[windows.length - 1];
+      const last = top[top.length - 1];
+      // Entering a callee, or jumping to another block in the same frame
+      if (last && (last.opcode === 'Call' || last.opcode === 'New')) {
+        windows.push([op]);
+      } else {
+        windows[windows.length - 1] = [op];
+      }
+    }
+    const window = windows[windows.length - 1];
+    for (let length = 2; length <= window.length; length++) {
+      const sequence = window.slice(-length).map(describeOperation).join(', ');
+      counts.set(sequence, (counts.get(sequence) ?? 0) + 1);
+    }
+  };
+
+  const noOp = () => {};
+  const vm = VirtualMachineFriendly.create({ 1: noOp, 2: noOp, 3: noOp, 4: () => 0, 5: noOp, 6: noOp }, { trace });
+  // Not part of the public API: the IL functions that the VM executes
+  functions = (vm as any).vm.functions;
+  addDefaultGlobals(vm);
+  const vmGlobal = vm.globalThis;
+  vmGlobal.print = vm.vmImport(1);
+  vmGlobal.assert = vm.vmImport(2);
+  vmGlobal.assertEqual = vm.vmImport(3);
+  vmGlobal.getHeapUsed = vm.vmImport(4);
+  vmGlobal.runGC = vm.vmImport(5);
+  vmGlobal.asyncTestComplete = vm.vmImport(6);
+  vmGlobal.vmExport = vm.vmExport;
+  vmGlobal.overflowChecks = true;
+  vmGlobal.console = vm.newObject();
+  vmGlobal.console.log = vmGlobal.print;
+
+  vm.evaluateModule({ sourceText: src, debugFilename: filename });
+  if (runExportedFunction !== undefined) {
+    try {
+      vm.resolveExport(runExportedFunction)();
+    } catch {
+      // Tests that expect an exception still count up to the throw
+    }
+  }
+}
+
+function describeOperation(op: IL.Operation): string {
+  const operand = op.operands[0];
+  if (op.opcode === 'Literal' && operand?.type === 'LiteralOperand') {
+    const literal = operand.literal;
+    if (literal.type === 'NumberValue') {
+      return Number.isInteger(literal.value) && literal.value >= -0x2000 && literal.value <= 0x1FFF
+        ? 'Literal(int14)'
+        : 'Literal(number)';
+    }
+    if (literal.type === 'StringValue') return 'Literal(string)';
+    if (literal.type === 'UndefinedValue') return 'Literal(undefined)';
+    return 'Literal';
+  }
+  if (op.opcode === 'BinOp' && operand?.type === 'OpOperand') {
+    return `BinOp(${operand.subOperation})`;
+  }
+  return op.opcode;
+}
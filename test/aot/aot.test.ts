@@ -0,0 +1,126 @@
+import { assert } from "chai";
+import fs from 'fs-extra';
+import path from 'path';
+import shelljs from 'shelljs';
+import YAML from 'yaml';
+import colors from 'colors';
+import * as microvium from '../../lib';
+import { writeTextFile } from "../../lib/utils";
+
+/*
+ * These tests compile some of the end-to-end test scripts with every function
+ * marked as native, generate the C for them with `generateNativeC`, build each
+ * into a host with an engine that has MVM_AOT enabled (see host.c), and run
+ * the test's exported function there. The scripts are chosen for code that the
+ * generator translates, so that the assertions run in the generated C rather
+ * than in the interpreter.
+ */
+
+const testDir = './test/aot';
+const artifactDir = path.join(testDir, 'artifacts');
+const buildDir = path.join(testDir, 'build');
+const endToEndTestDir = './test/end-to-end/tests';
+
+const debugShellOutput = false;
+
+const tests = [
+  'perf-sum-loop',
+  'perf-property-access',
+  'perf-calls',
+  'int14-arithmetic',
+  'number-operations',
+  'bitwise-operations',
+  'object-operations',
+  'tail-calls',
+];
+
+// Same IDs as in test/end-to-end/end-to-end.test.ts
+const HOST_FUNCTION_PRINT_ID = 1;
+const HOST_FUNCTION_ASSERT_ID = 2;
+const HOST_FUNCTION_ASSERT_EQUAL_ID = 3;
+const HOST_FUNCTION_GET_HEAP_USED_ID = 4;
+const HOST_FUNCTION_RUN_GC_ID = 5;
+
+suite('aot', function () {
+  const metas = new Map<string, any>();
+
+  suiteSetup(function () {
+    // Building the engine and a host per test takes a while
+    this.timeout(120_000);
+
+    for (const testName of tests) {
+      const src = fs.readFileSync(path.join(endToEndTestDir, `${testName}.test.mvm.js`), 'utf8');
+      const yamlHeaderMatch = src.match(/\/\*---(.*?)---\*\//s);
+      metas.set(testName, yamlHeaderMatch ? YAML.parse(yamlHeaderMatch[1].trim()) : {});
+
+      // The host functions are implemented in host.c, so the ones here are
+      // just placeholders for the imports
+      const noOp = () => {};
+      const vm = microvium.create({
+        [HOST_FUNCTION_PRINT_ID]: noOp,
+        [HOST_FUNCTION_ASSERT_ID]: noOp,
+        [HOST_FUNCTION_ASSERT_EQUAL_ID]: noOp,
+        [HOST_FUNCTION_GET_HEAP_USED_ID]: () => 0,
+        [HOST_FUNCTION_RUN_GC_ID]: noOp,
+      });
+      const vmGlobal = vm.globalThis;
+      vmGlobal.print = vm.vmImport(HOST_FUNCTION_PRINT_ID);
+      vmGlobal.assert = vm.vmImport(HOST_FUNCTION_ASSERT_ID);
+      vmGlobal.assertEqual = vm.vmImport(HOST_FUNCTION_ASSERT_EQUAL_ID);
+      vmGlobal.getHeapUsed = vm.vmImport(HOST_FUNCTION_GET_HEAP_USED_ID);
+      vmGlobal.runGC = vm.vmImport(HOST_FUNCTION_RUN_GC_ID);
+      vmGlobal.vmExport = vm.vmExport;
+      // The port file in this directory keeps the default overflow checks
+      vmGlobal.overflowChecks = true;
+      vmGlobal.console = vm.newObject();
+      vmGlobal.console.log = vmGlobal.print;
+      vm.evaluateModule({ sourceText: src, debugFilename: `${testName}.test.mvm.js` });
+
+      const snapshot = vm.createSnapshot({ nativeFunctions: 'all' });
+      const testArtifactDir = path.join(artifactDir, testName);
+      fs.mkdirpSync(testArtifactDir);
+      fs.writeFileSync(path.join(testArtifactDir, 'snapshot.mvm-bc'), snapshot.data, null);
+      writeTextFile(path.join(testArtifactDir, 'native.c'), microvium.generateNativeC(snapshot));
+    }
+
+    fs.mkdirpSync(buildDir);
+    exec(`cmake -S ${testDir} -B ${buildDir} -DAOT_TESTS="${tests.join(';')}"`);
+    exec(`cmake --build ${buildDir} --config Debug`);
+  });
+
+  for (const testName of tests) {
+    test(testName, () => {
+      const meta = metas.get(testName);
+      const snapshotFilename = path.join(artifactDir, testName, 'snapshot.mvm-bc');
+      const options = meta.expectException ? '--expect-exception ' : '';
+      const result = exec(`"${hostFilename(testName)}" ${options}"${snapshotFilename}" ${meta.runExportedFunction}`, false);
+      assert.equal(result.stderr, '');
+      assert.equal(result.code, 0);
+
+      const printout = result.stdout.trim().split(/\r?\n/);
+      const assertionCount = parseInt(printout.pop()!);
+      if (meta.expectedPrintout !== undefined) {
+        assert.deepEqual(printout.join('\n'), meta.expectedPrintout.trim());
+      }
+      if (meta.assertionCount !== undefined) {
+        assert.equal(assertionCount, meta.assertionCount, 'Expected assertion count');
+      }
+    });
+  }
+});
+
+function hostFilename(testName: string) {
+  // Multi-configuration generators (e.g. Visual Studio) put the output in a
+  // subdirectory per configuration
+  const multiConfig = path.resolve(buildDir, 'Debug', `${testName}.exe`);
+  return fs.existsSync(multiConfig) ? multiConfig : path.resolve(buildDir, testName);
+}
+
+function exec(cmd: string, requireSuccess: boolean = true) {
+  debugShellOutput && console.log(colors.cyan(cmd));
+  const result = shelljs.exec(cmd, { silent: !debugShellOutput });
+  if (requireSuccess && result.code !== 0) {
+    throw new Error(`${result.stderr}\nShell command failed with code ${result.code}`);
+  }
+  return result;
+}
@@ -0,0 +1,104 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 4 bytecode function(s) of the
+ * snapshot with CRC 0xD1AE. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0038(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[2] = f[3];
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x0045, 3);
+  f[3] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x07D3;
+  // VM_OP2_BRANCH_LESS_THAN_1, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x0049, 5);
+  if ((int16_t)f[3] < (int16_t)f[4]) goto L_0079;
+  // VM_OP1_POP, depth 3
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x004C, 2);
+L_0079: // VM_OP3_LOAD_GLOBAL_CALLEE, depth 3
+  return MVM_AOT_EXIT(0x0079, 3);
+}
+
+// add
+static uint32_t aot_add_00B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00B2, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00B2, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00B3, 1);
+}
+
+// makeAdder
+static uint32_t aot_makeAdder_00B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x00B8, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_00C8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SCOPED_1, depth 1
+  return MVM_AOT_EXIT(0x00C9, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0038, aot_run_0038 },
+  { 0x00B0, aot_add_00B0 },
+  { 0x00B8, aot_makeAdder_00B8 },
+  { 0x00C8, aot_anonymous_00C8 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xD1AE,
+  4,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,171 @@
+/*
+ * Host for the ahead-of-time compilation tests (see aot.test.ts).
+ *
+ * Usage: <test> [--expect-exception] <snapshot.mvm-bc> <exportID>
+ *
+ * This is linked with the C that `generateNativeC` produced for the snapshot,
+ * and registers its functions after restoring the snapshot, so the snapshot
+ * must be the one the C was generated from. It then calls the given export
+ * once.
+ *
+ * It implements the same host functions as the end-to-end test harness. The
+ * output of `print` goes to stdout, followed by a final line with the number
+ * of assertions that passed. The exit code is non-zero if the call fails or an
+ * assertion fails. Tests that are expected to end with an uncaught exception
+ * are run with `--expect-exception`, and then it's a call that doesn't throw
+ * that fails.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "microvium.h"
+
+// Same IDs as in test/end-to-end/end-to-end.test.ts
+#define HOST_FUNCTION_PRINT_ID 1
+#define HOST_FUNCTION_ASSERT_ID 2
+#define HOST_FUNCTION_ASSERT_EQUAL_ID 3
+#define HOST_FUNCTION_GET_HEAP_USED_ID 4
+#define HOST_FUNCTION_RUN_GC_ID 5
+#define HOST_FUNCTION_ASYNC_TEST_COMPLETE 6
+
+extern const mvm_TsAotFunctionTable mvm_aotFunctions;
+
+static int assertionsPassed = 0;
+static int assertionFailures = 0;
+
+static mvm_TeError resolveImport(mvm_HostFunctionID id, void* context, mvm_TfHostFunction* out);
+
+int main(int argc, char** argv) {
+  mvm_TeError err;
+  mvm_VM* vm;
+  uint8_t* snapshot;
+  long snapshotSize;
+  FILE* snapshotFile;
+  mvm_VMExportID exportID;
+  mvm_Value func;
+  bool expectException = false;
+
+  if (argc > 1 && strcmp(argv[1], "--expect-exception") == 0) {
+    expectException = true;
+    argv++;
+    argc--;
+  }
+  if (argc < 3) {
+    fprintf(stderr, "Usage: <test> [--expect-exception] <snapshot.mvm-bc> <exportID>\n");
+    return 1;
+  }
+  exportID = (mvm_VMExportID)atoi(argv[2]);
+
+  snapshotFile = fopen(argv[1], "rb");
+  if (!snapshotFile) {
+    fprintf(stderr, "Could not open %s\n", argv[1]);
+    return 1;
+  }
+  fseek(snapshotFile, 0L, SEEK_END);
+  snapshotSize = ftell(snapshotFile);
+  rewind(snapshotFile);
+  snapshot = (uint8_t*)malloc(snapshotSize);
+  if (fread(snapshot, 1, snapshotSize, snapshotFile) != (size_t)snapshotSize) {
+    fprintf(stderr, "Could not read %s\n", argv[1]);
+    return 1;
+  }
+  fclose(snapshotFile);
+
+  err = mvm_restore(&vm, snapshot, snapshotSize, NULL, resolveImport);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "Restore failed with error %d\n", err);
+    return 1;
+  }
+  err = mvm_aot_setFunctions(vm, &mvm_aotFunctions);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "mvm_aot_setFunctions failed with error %d\n", err);
+    return 1;
+  }
+  err = mvm_resolveExports(vm, &exportID, &func, 1);
+  if (err != MVM_E_SUCCESS) {
+    fprintf(stderr, "Export %d not found\n", exportID);
+    return 1;
+  }
+
+  err = mvm_call(vm, func, NULL, NULL, 0);
+  if (expectException ? err != MVM_E_UNCAUGHT_EXCEPTION : err != MVM_E_SUCCESS) {
+    fprintf(stderr, expectException
+      ? "Expected an uncaught exception, but the call returned %d\n"
+      : "Call failed with error %d\n", err);
+    return 1;
+  }
+
+  mvm_runGC(vm, true);
+  mvm_free(vm);
+  free(snapshot);
+
+  printf("%d assertions\n", assertionsPassed);
+
+  if (assertionFailures) {
+    fprintf(stderr, "%d assertion failures\n", assertionFailures);
+    return 1;
+  }
+
+  return 0;
+}
+
+static mvm_TeError print(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  if (argCount >= 1) {
+    size_t size;
+    const char* text = mvm_toStringUtf8(vm, args[0], &size);
+    printf("%.*s\n", (int)size, text);
+  }
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmAssert(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  if (argCount >= 1 && mvm_toBool(vm, args[0])) {
+    assertionsPassed++;
+  } else {
+    fprintf(stderr, "Failed assertion\n");
+    assertionFailures++;
+  }
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmAssertEqual(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  if (argCount >= 2 && mvm_equal(vm, args[0], args[1])) {
+    assertionsPassed++;
+  } else {
+    fprintf(stderr, "Failed assertEqual\n");
+    assertionFailures++;
+  }
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmGetHeapUsed(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  mvm_TsMemoryStats stats;
+  mvm_getMemoryStats(vm, &stats);
+  *result = mvm_newInt32(vm, (int32_t)stats.virtualHeapUsed);
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError vmRunGC(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  mvm_runGC(vm, argCount >= 1 && mvm_toBool(vm, args[0]));
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError asyncTestComplete(mvm_VM* vm, mvm_HostFunctionID funcID, mvm_Value* result, mvm_Value* args, uint8_t argCount) {
+  return MVM_E_SUCCESS;
+}
+
+static mvm_TeError resolveImport(mvm_HostFunctionID funcID, void* context, mvm_TfHostFunction* out) {
+  switch (funcID) {
+    case HOST_FUNCTION_PRINT_ID: *out = print; break;
+    case HOST_FUNCTION_ASSERT_ID: *out = vmAssert; break;
+    case HOST_FUNCTION_ASSERT_EQUAL_ID: *out = vmAssertEqual; break;
+    case HOST_FUNCTION_GET_HEAP_USED_ID: *out = vmGetHeapUsed; break;
+    case HOST_FUNCTION_RUN_GC_ID: *out = vmRunGC; break;
+    case HOST_FUNCTION_ASYNC_TEST_COMPLETE: *out = asyncTestComplete; break;
+    default: return MVM_E_UNRESOLVED_IMPORT;
+  }
+  return MVM_E_SUCCESS;
+}
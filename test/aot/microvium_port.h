@@ -0,0 +1,5 @@
+// The example port file, with the generated C enabled
+#include "microvium_port_example.h"
+
+#undef MVM_AOT
+#define MVM_AOT 1
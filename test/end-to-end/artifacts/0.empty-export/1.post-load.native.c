@@ -0,0 +1,44 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 1 bytecode function(s) of the
+ * snapshot with CRC 0x958F. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0030(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0031, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0030, aot_run_0030 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x958F,
+  1,
+  mvm_aotFunctions_entries,
+};
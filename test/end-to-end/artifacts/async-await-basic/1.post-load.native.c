@@ -0,0 +1,541 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 58 bytecode function(s) of the
+ * snapshot with CRC 0xE5C2. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// asyncContinue
+static uint32_t aot_asyncContinue_0130(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0130, 0);
+}
+
+// asyncCatchBlock
+static uint32_t aot_asyncCatchBlock_013C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x000D;
+  // VM_OP4_ASYNC_COMPLETE, depth 1
+  return MVM_AOT_EXIT(0x013D, 1);
+}
+
+// asyncHostCallback
+static uint32_t aot_asyncHostCallback_0144(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_ASYNC_COMPLETE, depth 3
+  return MVM_AOT_EXIT(0x0147, 3);
+}
+
+// Array_push
+static uint32_t aot_Array_push_014C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x014F, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0152, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0153, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0156, 1);
+}
+
+// run
+static uint32_t aot_run_015C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x015C, 0);
+}
+
+// runAsync
+static uint32_t aot_runAsync_0168(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0168, 0);
+}
+
+// test_minimal
+static uint32_t aot_test_minimal_0238(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0255;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x023B, 1);
+}
+
+// myAsyncFunc
+static uint32_t aot_myAsyncFunc_0254(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0254, 0);
+}
+
+// test_awaitReturnValue
+static uint32_t aot_test_awaitReturnValue_0264(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0264, 0);
+}
+
+// asyncFunction
+static uint32_t aot_asyncFunction_028C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x028C, 0);
+}
+
+// test_asyncVariablesFromNested
+static uint32_t aot_test_asyncVariablesFromNested_0298(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0298, 0);
+}
+
+// nested2
+static uint32_t aot_nested2_0320(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0320, 0);
+}
+
+// nestedFunc
+static uint32_t aot_nestedFunc_0338(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0338, 0);
+}
+
+// test_asyncInExpression
+static uint32_t aot_test_asyncInExpression_038C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x038C, 0);
+}
+
+// nestedFunc1
+static uint32_t aot_nestedFunc1_0434(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0434, 0);
+}
+
+// nestedFunc2
+static uint32_t aot_nestedFunc2_043C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x043C, 0);
+}
+
+// nestedFunc3
+static uint32_t aot_nestedFunc3_0448(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0448, 0);
+}
+
+// test_asyncFunctionArguments
+static uint32_t aot_test_asyncFunctionArguments_0460(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0460, 0);
+}
+
+// nestedFunc4
+static uint32_t aot_nestedFunc4_0484(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0484, 0);
+}
+
+// nestedFunc5
+static uint32_t aot_nestedFunc5_04D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x04D0, 0);
+}
+
+// test_asyncThisArgument
+static uint32_t aot_test_asyncThisArgument_04D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x04D8, 0);
+}
+
+// nestedFunc6
+static uint32_t aot_nestedFunc6_0518(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0518, 0);
+}
+
+// nestedFunc7
+static uint32_t aot_nestedFunc7_0570(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0570, 0);
+}
+
+// test_asyncArrowFunctions
+static uint32_t aot_test_asyncArrowFunctions_0578(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0578, 0);
+}
+
+// nestedFunc8
+static uint32_t aot_nestedFunc8_05AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x05AC, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_05B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x05B4, 0);
+}
+
+// test_implicitReturn
+static uint32_t aot_test_implicitReturn_05D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x05D8, 0);
+}
+
+// implicitReturn1
+static uint32_t aot_implicitReturn1_064C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x064C, 0);
+}
+
+// explicitReturn1
+static uint32_t aot_explicitReturn1_0654(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0654, 0);
+}
+
+// implicitReturn2
+static uint32_t aot_implicitReturn2_065C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x065C, 0);
+}
+
+// explicitReturn2
+static uint32_t aot_explicitReturn2_0678(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0678, 0);
+}
+
+// nestedFunc9
+static uint32_t aot_nestedFunc9_0694(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0694, 0);
+}
+
+// test_asyncClosure
+static uint32_t aot_test_asyncClosure_069C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x069C, 0);
+}
+
+// method
+static uint32_t aot_method_06E4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x06E4, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_06F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x06F4, 0);
+}
+
+// nestedFunc10
+static uint32_t aot_nestedFunc10_0728(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0728, 0);
+}
+
+// test_syncClosureInAsync
+static uint32_t aot_test_syncClosureInAsync_0730(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0730, 0);
+}
+
+// method1
+static uint32_t aot_method1_07A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x07A8, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_07B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x001B;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP1_ADD, depth 3
+  if (!AOT_BOTH_INT14(f[1], f[2])) return MVM_AOT_EXIT(0x07C1, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[1]) + AOT_INT14_VALUE(f[2]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x07C1, 3);
+    f[1] = AOT_INT14(r);
+  }
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x07C2, 2);
+}
+
+// nestedFunc11
+static uint32_t aot_nestedFunc11_07D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x07D4, 0);
+}
+
+// test_exceptionsBasic
+static uint32_t aot_test_exceptionsBasic_07DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x07DC, 0);
+}
+
+// nestedFunc12
+static uint32_t aot_nestedFunc12_0810(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0810, 0);
+}
+
+// test_exceptionsNested
+static uint32_t aot_test_exceptionsNested_0818(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0818, 0);
+}
+
+// nestedFunc13
+static uint32_t aot_nestedFunc13_088C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x088C, 0);
+}
+
+// nestedFunc14
+static uint32_t aot_nestedFunc14_08B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x08B0, 0);
+}
+
+// test_multipleJobs
+static uint32_t aot_test_multipleJobs_08B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x08B8, 0);
+}
+
+// task1
+static uint32_t aot_task1_08F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x08F8, 0);
+}
+
+// task2
+static uint32_t aot_task2_0920(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0920, 0);
+}
+
+// nestedFunc15
+static uint32_t aot_nestedFunc15_0948(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0948, 0);
+}
+
+// test_nestedClosure
+static uint32_t aot_test_nestedClosure_0950(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0950, 0);
+}
+
+// func1
+static uint32_t aot_func1_0978(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0978, 0);
+}
+
+// func2
+static uint32_t aot_func2_09B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x09B0, 0);
+}
+
+// func3
+static uint32_t aot_func3_09E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x09E8, 0);
+}
+
+// nestedFunc16
+static uint32_t aot_nestedFunc16_0A1C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0A1C, 0);
+}
+
+// test_awaitInsideCatch
+static uint32_t aot_test_awaitInsideCatch_0A24(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0A24, 0);
+}
+
+// nestedFunc17
+static uint32_t aot_nestedFunc17_0A98(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0A98, 0);
+}
+
+// nestedFunc18
+static uint32_t aot_nestedFunc18_0AA0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0AA0, 0);
+}
+
+// nestedFunc19
+static uint32_t aot_nestedFunc19_0AAC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0AAC, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0130, aot_asyncContinue_0130 },
+  { 0x013C, aot_asyncCatchBlock_013C },
+  { 0x0144, aot_asyncHostCallback_0144 },
+  { 0x014C, aot_Array_push_014C },
+  { 0x015C, aot_run_015C },
+  { 0x0168, aot_runAsync_0168 },
+  { 0x0238, aot_test_minimal_0238 },
+  { 0x0254, aot_myAsyncFunc_0254 },
+  { 0x0264, aot_test_awaitReturnValue_0264 },
+  { 0x028C, aot_asyncFunction_028C },
+  { 0x0298, aot_test_asyncVariablesFromNested_0298 },
+  { 0x0320, aot_nested2_0320 },
+  { 0x0338, aot_nestedFunc_0338 },
+  { 0x038C, aot_test_asyncInExpression_038C },
+  { 0x0434, aot_nestedFunc1_0434 },
+  { 0x043C, aot_nestedFunc2_043C },
+  { 0x0448, aot_nestedFunc3_0448 },
+  { 0x0460, aot_test_asyncFunctionArguments_0460 },
+  { 0x0484, aot_nestedFunc4_0484 },
+  { 0x04D0, aot_nestedFunc5_04D0 },
+  { 0x04D8, aot_test_asyncThisArgument_04D8 },
+  { 0x0518, aot_nestedFunc6_0518 },
+  { 0x0570, aot_nestedFunc7_0570 },
+  { 0x0578, aot_test_asyncArrowFunctions_0578 },
+  { 0x05AC, aot_nestedFunc8_05AC },
+  { 0x05B4, aot_anonymous_05B4 },
+  { 0x05D8, aot_test_implicitReturn_05D8 },
+  { 0x064C, aot_implicitReturn1_064C },
+  { 0x0654, aot_explicitReturn1_0654 },
+  { 0x065C, aot_implicitReturn2_065C },
+  { 0x0678, aot_explicitReturn2_0678 },
+  { 0x0694, aot_nestedFunc9_0694 },
+  { 0x069C, aot_test_asyncClosure_069C },
+  { 0x06E4, aot_method_06E4 },
+  { 0x06F4, aot_anonymous1_06F4 },
+  { 0x0728, aot_nestedFunc10_0728 },
+  { 0x0730, aot_test_syncClosureInAsync_0730 },
+  { 0x07A8, aot_method1_07A8 },
+  { 0x07B8, aot_anonymous2_07B8 },
+  { 0x07D4, aot_nestedFunc11_07D4 },
+  { 0x07DC, aot_test_exceptionsBasic_07DC },
+  { 0x0810, aot_nestedFunc12_0810 },
+  { 0x0818, aot_test_exceptionsNested_0818 },
+  { 0x088C, aot_nestedFunc13_088C },
+  { 0x08B0, aot_nestedFunc14_08B0 },
+  { 0x08B8, aot_test_multipleJobs_08B8 },
+  { 0x08F8, aot_task1_08F8 },
+  { 0x0920, aot_task2_0920 },
+  { 0x0948, aot_nestedFunc15_0948 },
+  { 0x0950, aot_test_nestedClosure_0950 },
+  { 0x0978, aot_func1_0978 },
+  { 0x09B0, aot_func2_09B0 },
+  { 0x09E8, aot_func3_09E8 },
+  { 0x0A1C, aot_nestedFunc16_0A1C },
+  { 0x0A24, aot_test_awaitInsideCatch_0A24 },
+  { 0x0A98, aot_nestedFunc17_0A98 },
+  { 0x0AA0, aot_nestedFunc18_0AA0 },
+  { 0x0AAC, aot_nestedFunc19_0AAC },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xE5C2,
+  58,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,511 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 47 bytecode function(s) of the
+ * snapshot with CRC 0x4137. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// asyncContinue
+static uint32_t aot_asyncContinue_057C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x057C, 0);
+}
+
+// asyncCatchBlock
+static uint32_t aot_asyncCatchBlock_0588(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x000D;
+  // VM_OP4_ASYNC_COMPLETE, depth 1
+  return MVM_AOT_EXIT(0x0589, 1);
+}
+
+// asyncHostCallback
+static uint32_t aot_asyncHostCallback_0590(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_ASYNC_COMPLETE, depth 3
+  return MVM_AOT_EXIT(0x0593, 3);
+}
+
+// promiseResolve
+static uint32_t aot_promiseResolve_0598(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0009;
+  // VM_OP4_ASYNC_COMPLETE, depth 3
+  return MVM_AOT_EXIT(0x059B, 3);
+}
+
+// promiseReject
+static uint32_t aot_promiseReject_05A0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x000D;
+  // VM_OP4_ASYNC_COMPLETE, depth 3
+  return MVM_AOT_EXIT(0x05A3, 3);
+}
+
+// promiseConstructor
+static uint32_t aot_promiseConstructor_05A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP1_SCOPE_NEW, depth 2
+  return MVM_AOT_EXIT(0x05AA, 2);
+}
+
+// Reflect.ownKeys
+static uint32_t aot_Reflect_ownKeys_05C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_OBJECT_KEYS, depth 1
+  return MVM_AOT_EXIT(0x05C5, 1);
+}
+
+// Array_push
+static uint32_t aot_Array_push_05CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x05CF, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x05D2, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x05D3, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x05D6, 1);
+}
+
+// Error
+static uint32_t aot_Error_05DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0099;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x05E1, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x05E2, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x05E5, 1);
+}
+
+// run
+static uint32_t aot_run_05E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x05E8, 0);
+}
+
+// runAsync
+static uint32_t aot_runAsync_05F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x05F4, 0);
+}
+
+// test_asyncReturnsPromise
+static uint32_t aot_test_asyncReturnsPromise_06A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x06AB, 1);
+}
+
+// myAsyncFunc
+static uint32_t aot_myAsyncFunc_06C8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x06C8, 0);
+}
+
+// test_promiseKeys
+static uint32_t aot_test_promiseKeys_06D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x06D4, 0);
+}
+
+// test_promiseAwait
+static uint32_t aot_test_promiseAwait_0730(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0730, 0);
+}
+
+// test_promiseAwaitReject
+static uint32_t aot_test_promiseAwaitReject_0758(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0758, 0);
+}
+
+// myAsyncFuncReject
+static uint32_t aot_myAsyncFuncReject_0798(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0798, 0);
+}
+
+// test_awaitMustBeAsynchronous
+static uint32_t aot_test_awaitMustBeAsynchronous_07A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x07A8, 0);
+}
+
+// inner
+static uint32_t aot_inner_07DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x07DC, 0);
+}
+
+// test_promiseConstructor
+static uint32_t aot_test_promiseConstructor_0814(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0814, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_0840(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00AB;
+  // VM_OP2_CALL_3, depth 3
+  return MVM_AOT_EXIT(0x0845, 3);
+}
+
+// test_unresolvedPromise1Subscriber
+static uint32_t aot_test_unresolvedPromise1Subscriber_084C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x084C, 0);
+}
+
+// subscriber1
+static uint32_t aot_subscriber1_0898(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0898, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_08D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x08D1, 1);
+  f[1] = f[0];
+  // VM_OP4_STORE_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x08D2, 2);
+}
+
+// test_unresolvedPromise2Subscribers
+static uint32_t aot_test_unresolvedPromise2Subscribers_08DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x08DC, 0);
+}
+
+// subscriber2
+static uint32_t aot_subscriber2_093C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x093C, 0);
+}
+
+// subscriber3
+static uint32_t aot_subscriber3_0974(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0974, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_09AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x09AD, 1);
+  f[1] = f[0];
+  // VM_OP4_STORE_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x09AE, 2);
+}
+
+// test_unresolvedPromise3Subscribers
+static uint32_t aot_test_unresolvedPromise3Subscribers_09B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x09B8, 0);
+}
+
+// subscriber4
+static uint32_t aot_subscriber4_0A34(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0A34, 0);
+}
+
+// subscriber5
+static uint32_t aot_subscriber5_0A70(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0A70, 0);
+}
+
+// subscriber6
+static uint32_t aot_subscriber6_0AAC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0AAC, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_0AE8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0AE9, 1);
+  f[1] = f[0];
+  // VM_OP4_STORE_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x0AEA, 2);
+}
+
+// test_awaitBeforeAndAfterResolved
+static uint32_t aot_test_awaitBeforeAndAfterResolved_0AF4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0AF4, 0);
+}
+
+// subscriber7
+static uint32_t aot_subscriber7_0B74(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0B74, 0);
+}
+
+// subscriber8
+static uint32_t aot_subscriber8_0BAC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0BAC, 0);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_0BE4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0BE5, 1);
+  f[1] = f[0];
+  // VM_OP4_STORE_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x0BE6, 2);
+}
+
+// test_awaitUnrejected
+static uint32_t aot_test_awaitUnrejected_0BF0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0BF0, 0);
+}
+
+// subscriber9
+static uint32_t aot_subscriber9_0C40(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0C40, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_0C90(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0C91, 1);
+  f[1] = f[0];
+  // VM_OP4_STORE_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x0C92, 2);
+}
+
+// test_immediatelyRejectedPromise
+static uint32_t aot_test_immediatelyRejectedPromise_0C9C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0C9C, 0);
+}
+
+// subscriber10
+static uint32_t aot_subscriber10_0CE0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0CE0, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_0D30(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0D32, 2);
+}
+
+// test_augmentingPromisePrototype
+static uint32_t aot_test_augmentingPromisePrototype_0D40(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0D40, 0);
+}
+
+// myAsync
+static uint32_t aot_myAsync_0DF8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_ASYNC_START, depth 0
+  return MVM_AOT_EXIT(0x0DF8, 0);
+}
+
+// anonymous7
+static uint32_t aot_anonymous7_0E00(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x0559) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0E01, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0E04, 1);
+}
+
+// anonymous8
+static uint32_t aot_anonymous8_0E08(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0E0A, 2);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x057C, aot_asyncContinue_057C },
+  { 0x0588, aot_asyncCatchBlock_0588 },
+  { 0x0590, aot_asyncHostCallback_0590 },
+  { 0x0598, aot_promiseResolve_0598 },
+  { 0x05A0, aot_promiseReject_05A0 },
+  { 0x05A8, aot_promiseConstructor_05A8 },
+  { 0x05C4, aot_Reflect_ownKeys_05C4 },
+  { 0x05CC, aot_Array_push_05CC },
+  { 0x05DC, aot_Error_05DC },
+  { 0x05E8, aot_run_05E8 },
+  { 0x05F4, aot_runAsync_05F4 },
+  { 0x06A8, aot_test_asyncReturnsPromise_06A8 },
+  { 0x06C8, aot_myAsyncFunc_06C8 },
+  { 0x06D4, aot_test_promiseKeys_06D4 },
+  { 0x0730, aot_test_promiseAwait_0730 },
+  { 0x0758, aot_test_promiseAwaitReject_0758 },
+  { 0x0798, aot_myAsyncFuncReject_0798 },
+  { 0x07A8, aot_test_awaitMustBeAsynchronous_07A8 },
+  { 0x07DC, aot_inner_07DC },
+  { 0x0814, aot_test_promiseConstructor_0814 },
+  { 0x0840, aot_anonymous_0840 },
+  { 0x084C, aot_test_unresolvedPromise1Subscriber_084C },
+  { 0x0898, aot_subscriber1_0898 },
+  { 0x08D0, aot_anonymous1_08D0 },
+  { 0x08DC, aot_test_unresolvedPromise2Subscribers_08DC },
+  { 0x093C, aot_subscriber2_093C },
+  { 0x0974, aot_subscriber3_0974 },
+  { 0x09AC, aot_anonymous2_09AC },
+  { 0x09B8, aot_test_unresolvedPromise3Subscribers_09B8 },
+  { 0x0A34, aot_subscriber4_0A34 },
+  { 0x0A70, aot_subscriber5_0A70 },
+  { 0x0AAC, aot_subscriber6_0AAC },
+  { 0x0AE8, aot_anonymous3_0AE8 },
+  { 0x0AF4, aot_test_awaitBeforeAndAfterResolved_0AF4 },
+  { 0x0B74, aot_subscriber7_0B74 },
+  { 0x0BAC, aot_subscriber8_0BAC },
+  { 0x0BE4, aot_anonymous4_0BE4 },
+  { 0x0BF0, aot_test_awaitUnrejected_0BF0 },
+  { 0x0C40, aot_subscriber9_0C40 },
+  { 0x0C90, aot_anonymous5_0C90 },
+  { 0x0C9C, aot_test_immediatelyRejectedPromise_0C9C },
+  { 0x0CE0, aot_subscriber10_0CE0 },
+  { 0x0D30, aot_anonymous6_0D30 },
+  { 0x0D40, aot_test_augmentingPromisePrototype_0D40 },
+  { 0x0DF8, aot_myAsync_0DF8 },
+  { 0x0E00, aot_anonymous7_0E00 },
+  { 0x0E08, aot_anonymous8_0E08 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x4137,
+  47,
+  mvm_aotFunctions_entries,
+};
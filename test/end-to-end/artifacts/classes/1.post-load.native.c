@@ -0,0 +1,953 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 61 bytecode function(s) of the
+ * snapshot with CRC 0xCDAC. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Reflect.ownKeys
+static uint32_t aot_Reflect_ownKeys_0150(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_OBJECT_KEYS, depth 1
+  return MVM_AOT_EXIT(0x0151, 1);
+}
+
+// Microvium.newUint8Array
+static uint32_t aot_Microvium_newUint8Array_0158(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_UINT8_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x0159, 1);
+}
+
+// typeCodeOf
+static uint32_t aot_typeCodeOf_0160(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_TYPE_CODE_OF, depth 1
+  return MVM_AOT_EXIT(0x0161, 1);
+}
+
+// Number_isNaN
+static uint32_t aot_Number_isNaN_0168(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP1_NOT_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x016A, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] != (int16_t)f[1]);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x016B, 1);
+}
+
+// run
+static uint32_t aot_run_0170(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0170, 0);
+}
+
+// GlobalClass
+static uint32_t aot_GlobalClass_01D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0017;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x01DA, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x01DA, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01DF, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01E0, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x01E3, 1);
+}
+
+// GlobalClass_myMethod
+static uint32_t aot_GlobalClass_myMethod_01E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01E9, 1);
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x01ED, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x01ED, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01F2, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01F3, 4);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x01F4, 1);
+}
+
+// GlobalClass_myStaticMethod
+static uint32_t aot_GlobalClass_myStaticMethod_01F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01F9, 1);
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01FC, 1);
+  f[1] = f[0];
+  // VM_OP2_BRANCH_1, depth 2
+  if ((f[1] == AOT_TRUE) || ((f[1] != AOT_FALSE) && (f[1] != AOT_INT14(0)) && (AOT_IS_INT14(f[1]) || mvm_toBool(vm, f[1])))) goto L_0201;
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0007;
+L_0201: // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x0202, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0202, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0207, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0208, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x020B, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x020E, 1);
+}
+
+// test_globalClass
+static uint32_t aot_test_globalClass_0214(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0217, 1);
+}
+
+// test_globalInstance
+static uint32_t aot_test_globalInstance_0284(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00ED;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x028B, 1);
+}
+
+// test_localClass
+static uint32_t aot_test_localClass_02E0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0375;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x02E9, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x02EA, 4);
+}
+
+// LocalClass
+static uint32_t aot_LocalClass_0374(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x001F;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x0378, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0378, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x037D, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x037E, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0381, 1);
+}
+
+// LocalClass_myMethod
+static uint32_t aot_LocalClass_myMethod_0384(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0385, 1);
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x0389, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0389, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x038E, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x038F, 4);
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x0391, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0391, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0392, 1);
+}
+
+// LocalClass_myStaticMethod
+static uint32_t aot_LocalClass_myStaticMethod_0398(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0399, 1);
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x039C, 1);
+  f[1] = f[0];
+  // VM_OP2_BRANCH_1, depth 2
+  if ((f[1] == AOT_TRUE) || ((f[1] != AOT_FALSE) && (f[1] != AOT_INT14(0)) && (AOT_IS_INT14(f[1]) || mvm_toBool(vm, f[1])))) goto L_03A1;
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0007;
+L_03A1: // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x03A2, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x03A2, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x03A7, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x03A8, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x03AB, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x03AE, 1);
+}
+
+// test_inheritedProperties
+static uint32_t aot_test_inheritedProperties_03B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0439;
+  // VM_OP1_OBJECT_NEW, depth 4
+  if (mvm_aot_newObject(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x03C0, 4);
+  // VM_OP4_CLASS_CREATE, depth 5
+  return MVM_AOT_EXIT(0x03C1, 5);
+}
+
+// LocalClass1
+static uint32_t aot_LocalClass1_0438(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0439, 1);
+}
+
+// test_proto
+static uint32_t aot_test_proto_043C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0489;
+  // VM_OP1_OBJECT_NEW, depth 4
+  if (mvm_aot_newObject(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0448, 4);
+  // VM_OP4_CLASS_CREATE, depth 5
+  return MVM_AOT_EXIT(0x0449, 5);
+}
+
+// LocalClass2
+static uint32_t aot_LocalClass2_0488(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0489, 1);
+}
+
+// LocalClass3
+static uint32_t aot_LocalClass3_048C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x048D, 1);
+}
+
+// test_returnFromConstructor
+static uint32_t aot_test_returnFromConstructor_0490(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x04CD;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0499, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x049A, 4);
+}
+
+// LocalClass4
+static uint32_t aot_LocalClass4_04CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_OBJECT_NEW, depth 0
+  if (mvm_aot_newObject(vm, &f[0]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x04CC, 0);
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x04CD, 1);
+  f[1] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x002B;
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x04D4, 4);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x04D5, 1);
+}
+
+// test_operators
+static uint32_t aot_test_operators_04D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0569;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x04E1, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x04E2, 4);
+}
+
+// LocalClass5
+static uint32_t aot_LocalClass5_0568(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0569, 1);
+}
+
+// test_classAsMember
+static uint32_t aot_test_classAsMember_056C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x05BD;
+  // VM_OP1_OBJECT_NEW, depth 4
+  if (mvm_aot_newObject(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0578, 4);
+  // VM_OP4_CLASS_CREATE, depth 5
+  return MVM_AOT_EXIT(0x0579, 5);
+}
+
+// LocalClass6
+static uint32_t aot_LocalClass6_05BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0017;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x05C1, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x05C2, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x05C5, 1);
+}
+
+// LocalClass_foo
+static uint32_t aot_LocalClass_foo_05C8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x002B;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x05CB, 1);
+}
+
+// test_closingOverClass
+static uint32_t aot_test_closingOverClass_05D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0609;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x05D9, 3);
+  f[3] = f[0];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 4
+  f[4] = 0x0001;
+  // VM_OP2_CALL_3, depth 5
+  return MVM_AOT_EXIT(0x05DB, 5);
+}
+
+// inner
+static uint32_t aot_inner_0608(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0608, 0);
+}
+
+// LocalClass7
+static uint32_t aot_LocalClass7_0628(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0017;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00E9;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x062D, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x062E, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0631, 1);
+}
+
+// LocalClass_foo1
+static uint32_t aot_LocalClass_foo1_0634(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0053;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0637, 1);
+}
+
+// anonymous
+static uint32_t aot_anonymous_063C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x063C, 0);
+}
+
+// test_closureInConstructor
+static uint32_t aot_test_closureInConstructor_0640(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0640, 0);
+}
+
+// LocalClass8
+static uint32_t aot_LocalClass8_0694(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0694, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_06AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x06AC, 0);
+}
+
+// test_classProperty
+static uint32_t aot_test_classProperty_06BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0759;
+  // VM_OP1_OBJECT_NEW, depth 5
+  if (mvm_aot_newObject(vm, &f[5]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x06CB, 5);
+  // VM_OP4_CLASS_CREATE, depth 6
+  return MVM_AOT_EXIT(0x06CC, 6);
+}
+
+// LocalClass9
+static uint32_t aot_LocalClass9_0758(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00E9;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0017;
+  // VM_OP1_OBJECT_SET_1, depth 3
+  if (mvm_aot_setProperty(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x075D, 3);
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0129;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0001;
+  // VM_OP1_OBJECT_SET_1, depth 3
+  if (mvm_aot_setProperty(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0763, 3);
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0765, 1);
+}
+
+// test_classStaticProperty
+static uint32_t aot_test_classStaticProperty_0768(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x07D1;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0771, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x0772, 4);
+}
+
+// LocalClass10
+static uint32_t aot_LocalClass10_07D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x07D1, 1);
+}
+
+// test_closureMethod
+static uint32_t aot_test_closureMethod_07D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x07D4, 0);
+}
+
+// LocalClass11
+static uint32_t aot_LocalClass11_0828(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0829, 1);
+}
+
+// LocalClass_method
+static uint32_t aot_LocalClass_method_082C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x082C, 0);
+}
+
+// test_thisInInitializer
+static uint32_t aot_test_thisInInitializer_0838(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x086D;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0841, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x0842, 4);
+}
+
+// LocalClass12
+static uint32_t aot_LocalClass12_086C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00E9;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0017;
+  // VM_OP1_OBJECT_SET_1, depth 3
+  if (mvm_aot_setProperty(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0871, 3);
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0129;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x00E9) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0877, 3);
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0007;
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x087B, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x087B, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP1_OBJECT_SET_1, depth 3
+  if (mvm_aot_setProperty(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x087C, 3);
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x087E, 1);
+}
+
+// test_initializerClosingOverThis
+static uint32_t aot_test_initializerClosingOverThis_0884(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x08D1;
+  // VM_OP1_OBJECT_NEW, depth 4
+  if (mvm_aot_newObject(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0890, 4);
+  // VM_OP4_CLASS_CREATE, depth 5
+  return MVM_AOT_EXIT(0x0891, 5);
+}
+
+// LocalClass13
+static uint32_t aot_LocalClass13_08D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x08D0, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_08EC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x08EC, 0);
+}
+
+// test_initializerClosingOverOuter
+static uint32_t aot_test_initializerClosingOverOuter_08FC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x08FC, 0);
+}
+
+// LocalClass14
+static uint32_t aot_LocalClass14_0944(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0944, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_0958(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0958, 0);
+}
+
+// test_staticInitializerUsingThis
+static uint32_t aot_test_staticInitializerUsingThis_0968(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x09A5;
+  // VM_OP1_OBJECT_NEW, depth 2
+  if (mvm_aot_newObject(vm, &f[2]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x096E, 2);
+  // VM_OP4_CLASS_CREATE, depth 3
+  return MVM_AOT_EXIT(0x096F, 3);
+}
+
+// LocalClass15
+static uint32_t aot_LocalClass15_09A4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x09A5, 1);
+}
+
+// test_staticInitializerClosingUsingThis
+static uint32_t aot_test_staticInitializerClosingUsingThis_09A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x09A8, 0);
+}
+
+// LocalClass16
+static uint32_t aot_LocalClass16_09E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x09E9, 1);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_09EC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x09EC, 0);
+}
+
+// test_closureOverThisInConstructor
+static uint32_t aot_test_closureOverThisInConstructor_09F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0A35;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0A01, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x0A02, 4);
+}
+
+// LocalClass17
+static uint32_t aot_LocalClass17_0A34(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0A34, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_0A50(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0A50, 0);
+}
+
+// test_closureOverThisInMethod
+static uint32_t aot_test_closureOverThisInMethod_0A5C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0AA1;
+  // VM_OP1_OBJECT_NEW, depth 3
+  if (mvm_aot_newObject(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0A65, 3);
+  // VM_OP4_CLASS_CREATE, depth 4
+  return MVM_AOT_EXIT(0x0A66, 4);
+}
+
+// LocalClass18
+static uint32_t aot_LocalClass18_0AA0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00E9;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0017;
+  // VM_OP1_OBJECT_SET_1, depth 3
+  if (mvm_aot_setProperty(vm, &f[3]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0AA5, 3);
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0AA7, 1);
+}
+
+// LocalClass_method1
+static uint32_t aot_LocalClass_method1_0AAC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0AAC, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_0ABC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0ABC, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0150, aot_Reflect_ownKeys_0150 },
+  { 0x0158, aot_Microvium_newUint8Array_0158 },
+  { 0x0160, aot_typeCodeOf_0160 },
+  { 0x0168, aot_Number_isNaN_0168 },
+  { 0x0170, aot_run_0170 },
+  { 0x01D8, aot_GlobalClass_01D8 },
+  { 0x01E8, aot_GlobalClass_myMethod_01E8 },
+  { 0x01F8, aot_GlobalClass_myStaticMethod_01F8 },
+  { 0x0214, aot_test_globalClass_0214 },
+  { 0x0284, aot_test_globalInstance_0284 },
+  { 0x02E0, aot_test_localClass_02E0 },
+  { 0x0374, aot_LocalClass_0374 },
+  { 0x0384, aot_LocalClass_myMethod_0384 },
+  { 0x0398, aot_LocalClass_myStaticMethod_0398 },
+  { 0x03B4, aot_test_inheritedProperties_03B4 },
+  { 0x0438, aot_LocalClass1_0438 },
+  { 0x043C, aot_test_proto_043C },
+  { 0x0488, aot_LocalClass2_0488 },
+  { 0x048C, aot_LocalClass3_048C },
+  { 0x0490, aot_test_returnFromConstructor_0490 },
+  { 0x04CC, aot_LocalClass4_04CC },
+  { 0x04D8, aot_test_operators_04D8 },
+  { 0x0568, aot_LocalClass5_0568 },
+  { 0x056C, aot_test_classAsMember_056C },
+  { 0x05BC, aot_LocalClass6_05BC },
+  { 0x05C8, aot_LocalClass_foo_05C8 },
+  { 0x05D0, aot_test_closingOverClass_05D0 },
+  { 0x0608, aot_inner_0608 },
+  { 0x0628, aot_LocalClass7_0628 },
+  { 0x0634, aot_LocalClass_foo1_0634 },
+  { 0x063C, aot_anonymous_063C },
+  { 0x0640, aot_test_closureInConstructor_0640 },
+  { 0x0694, aot_LocalClass8_0694 },
+  { 0x06AC, aot_anonymous1_06AC },
+  { 0x06BC, aot_test_classProperty_06BC },
+  { 0x0758, aot_LocalClass9_0758 },
+  { 0x0768, aot_test_classStaticProperty_0768 },
+  { 0x07D0, aot_LocalClass10_07D0 },
+  { 0x07D4, aot_test_closureMethod_07D4 },
+  { 0x0828, aot_LocalClass11_0828 },
+  { 0x082C, aot_LocalClass_method_082C },
+  { 0x0838, aot_test_thisInInitializer_0838 },
+  { 0x086C, aot_LocalClass12_086C },
+  { 0x0884, aot_test_initializerClosingOverThis_0884 },
+  { 0x08D0, aot_LocalClass13_08D0 },
+  { 0x08EC, aot_anonymous2_08EC },
+  { 0x08FC, aot_test_initializerClosingOverOuter_08FC },
+  { 0x0944, aot_LocalClass14_0944 },
+  { 0x0958, aot_anonymous3_0958 },
+  { 0x0968, aot_test_staticInitializerUsingThis_0968 },
+  { 0x09A4, aot_LocalClass15_09A4 },
+  { 0x09A8, aot_test_staticInitializerClosingUsingThis_09A8 },
+  { 0x09E8, aot_LocalClass16_09E8 },
+  { 0x09EC, aot_anonymous4_09EC },
+  { 0x09F8, aot_test_closureOverThisInConstructor_09F8 },
+  { 0x0A34, aot_LocalClass17_0A34 },
+  { 0x0A50, aot_anonymous5_0A50 },
+  { 0x0A5C, aot_test_closureOverThisInMethod_0A5C },
+  { 0x0AA0, aot_LocalClass18_0AA0 },
+  { 0x0AAC, aot_LocalClass_method1_0AAC },
+  { 0x0ABC, aot_anonymous6_0ABC },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xCDAC,
+  61,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,211 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 19 bytecode function(s) of the
+ * snapshot with CRC 0xEF48. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Array_push
+static uint32_t aot_Array_push_0040(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0043, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0046, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0047, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x004A, 1);
+}
+
+// run
+static uint32_t aot_run_0050(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0050, 0);
+}
+
+// testNestedRead
+static uint32_t aot_testNestedRead_0068(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0068, 0);
+}
+
+// level1
+static uint32_t aot_level1_0088(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0088, 0);
+}
+
+// level2
+static uint32_t aot_level2_00A4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x00A4, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_00BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x00BC, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_00C0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x00C0, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_00DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x00DC, 0);
+}
+
+// testNestedWrite
+static uint32_t aot_testNestedWrite_00E0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x00E0, 0);
+}
+
+// makeIncrementer
+static uint32_t aot_makeIncrementer_0124(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0124, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_0144(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0145, 1);
+  f[1] = f[0];
+  // VM_OP_STORE_SCOPED_1, depth 2
+  return MVM_AOT_EXIT(0x0146, 2);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_014C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x014C, 0);
+}
+
+// testAlternatingClosures
+static uint32_t aot_testAlternatingClosures_0160(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0166, 2);
+}
+
+// makeCounter
+static uint32_t aot_makeCounter_01AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x01AC, 0);
+}
+
+// inner
+static uint32_t aot_inner_01C0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x01C0, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_01D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x01D8, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_01DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x01DC, 0);
+}
+
+// testLoopScopes
+static uint32_t aot_testLoopScopes_01EC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x01EC, 0);
+}
+
+// anonymous7
+static uint32_t aot_anonymous7_0258(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0258, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0040, aot_Array_push_0040 },
+  { 0x0050, aot_run_0050 },
+  { 0x0068, aot_testNestedRead_0068 },
+  { 0x0088, aot_level1_0088 },
+  { 0x00A4, aot_level2_00A4 },
+  { 0x00BC, aot_anonymous1_00BC },
+  { 0x00C0, aot_anonymous2_00C0 },
+  { 0x00DC, aot_anonymous_00DC },
+  { 0x00E0, aot_testNestedWrite_00E0 },
+  { 0x0124, aot_makeIncrementer_0124 },
+  { 0x0144, aot_anonymous3_0144 },
+  { 0x014C, aot_anonymous4_014C },
+  { 0x0160, aot_testAlternatingClosures_0160 },
+  { 0x01AC, aot_makeCounter_01AC },
+  { 0x01C0, aot_inner_01C0 },
+  { 0x01D8, aot_anonymous5_01D8 },
+  { 0x01DC, aot_anonymous6_01DC },
+  { 0x01EC, aot_testLoopScopes_01EC },
+  { 0x0258, aot_anonymous7_0258 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xEF48,
+  19,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,194 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 18 bytecode function(s) of the
+ * snapshot with CRC 0x5CA7. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Array_push
+static uint32_t aot_Array_push_0040(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0043, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0046, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0047, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x004A, 1);
+}
+
+// run
+static uint32_t aot_run_0050(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0050, 0);
+}
+
+// test_basicClosureEmbedding
+static uint32_t aot_test_basicClosureEmbedding_0068(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0068, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_00AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x00AC, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_00B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x00B4, 0);
+}
+
+// test_declarationClosureEmbedding
+static uint32_t aot_test_declarationClosureEmbedding_00C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x00C4, 0);
+}
+
+// increment
+static uint32_t aot_increment_0100(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0100, 0);
+}
+
+// decrement
+static uint32_t aot_decrement_0108(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0108, 0);
+}
+
+// test_loop
+static uint32_t aot_test_loop_0118(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0118, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_01C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x01C4, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_01D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x01D4, 0);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_01E0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x01E0, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_01E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x01E8, 0);
+}
+
+// test_doubleNesting
+static uint32_t aot_test_doubleNesting_01F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x01F8, 0);
+}
+
+// bar
+static uint32_t aot_bar_0230(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0230, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_0240(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0240, 0);
+}
+
+// baz
+static uint32_t aot_baz_024C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x024C, 0);
+}
+
+// anonymous7
+static uint32_t aot_anonymous7_025C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x025C, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0040, aot_Array_push_0040 },
+  { 0x0050, aot_run_0050 },
+  { 0x0068, aot_test_basicClosureEmbedding_0068 },
+  { 0x00AC, aot_anonymous_00AC },
+  { 0x00B4, aot_anonymous1_00B4 },
+  { 0x00C4, aot_test_declarationClosureEmbedding_00C4 },
+  { 0x0100, aot_increment_0100 },
+  { 0x0108, aot_decrement_0108 },
+  { 0x0118, aot_test_loop_0118 },
+  { 0x01C4, aot_anonymous2_01C4 },
+  { 0x01D4, aot_anonymous3_01D4 },
+  { 0x01E0, aot_anonymous4_01E0 },
+  { 0x01E8, aot_anonymous5_01E8 },
+  { 0x01F8, aot_test_doubleNesting_01F8 },
+  { 0x0230, aot_bar_0230 },
+  { 0x0240, aot_anonymous6_0240 },
+  { 0x024C, aot_baz_024C },
+  { 0x025C, aot_anonymous7_025C },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x5CA7,
+  18,
+  mvm_aotFunctions_entries,
+};
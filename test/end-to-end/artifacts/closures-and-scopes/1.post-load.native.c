@@ -0,0 +1,344 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 30 bytecode function(s) of the
+ * snapshot with CRC 0x13F9. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Number_isNaN
+static uint32_t aot_Number_isNaN_009C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP1_NOT_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x009E, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] != (int16_t)f[1]);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x009F, 1);
+}
+
+// run
+static uint32_t aot_run_00A4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00A4, 0);
+}
+
+// basics
+static uint32_t aot_basics_00C8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 5
+  return MVM_AOT_EXIT(0x00D7, 5);
+}
+
+// makeIncrementorA
+static uint32_t aot_makeIncrementorA_0168(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0168, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_0178(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0178, 0);
+}
+
+// makeIncrementorA2
+static uint32_t aot_makeIncrementorA2_0180(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0180, 0);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_0190(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0190, 0);
+}
+
+// makeIncrementorB
+static uint32_t aot_makeIncrementorB_0198(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0198, 0);
+}
+
+// increment
+static uint32_t aot_increment_01A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x01A8, 0);
+}
+
+// makeIncrementorC
+static uint32_t aot_makeIncrementorC_01B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x01B0, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_01C0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x01C0, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_01CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x01CC, 0);
+}
+
+// nestedLexicalScopes
+static uint32_t aot_nestedLexicalScopes_01DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x01DC, 0);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_0258(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0258, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_0264(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0264, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_0274(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x0274, 0);
+}
+
+// differentVariableTypes
+static uint32_t aot_differentVariableTypes_0284(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0339;
+  // VM_OP_STORE_VAR_1, depth 5
+  f[0] = f[4];
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0294, 4);
+  f[4] = f[0];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 5
+  f[5] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 6
+  f[6] = 0x0007;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 7
+  f[7] = 0x000B;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 8
+  f[8] = 0x000F;
+  // VM_OP2_CALL_3, depth 9
+  return MVM_AOT_EXIT(0x0299, 9);
+}
+
+// anonymous7
+static uint32_t aot_anonymous7_0338(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0338, 0);
+}
+
+// anonymous8
+static uint32_t aot_anonymous8_0360(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0360, 0);
+}
+
+// anonymous9
+static uint32_t aot_anonymous9_0388(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (3 < argCount) ? pArgs[3] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 2
+  return MVM_AOT_EXIT(0x038A, 2);
+}
+
+// closureOperations
+static uint32_t aot_closureOperations_0458(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x04B1;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x04B5;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0466, 2);
+}
+
+// anonymous10
+static uint32_t aot_anonymous10_04B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x04B1, 1);
+}
+
+// anonymous11
+static uint32_t aot_anonymous11_04B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x04B5, 1);
+}
+
+// thisCapturing
+static uint32_t aot_thisCapturing_04B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x04B8, 0);
+}
+
+// printMe1
+static uint32_t aot_printMe1_0534(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x0065) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0535, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0538, 1);
+}
+
+// getObj2
+static uint32_t aot_getObj2_053C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x053C, 0);
+}
+
+// anonymous12
+static uint32_t aot_anonymous12_056C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x056C, 0);
+}
+
+// anonymous13
+static uint32_t aot_anonymous13_0574(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x0065) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0575, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0578, 1);
+}
+
+// anonymous14
+static uint32_t aot_anonymous14_057C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0FA3;
+  // VM_OP3_LOAD_GLOBAL_3, depth 1
+  return MVM_AOT_EXIT(0x057F, 1);
+}
+
+// rootScope
+static uint32_t aot_rootScope_05B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x05B8, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x009C, aot_Number_isNaN_009C },
+  { 0x00A4, aot_run_00A4 },
+  { 0x00C8, aot_basics_00C8 },
+  { 0x0168, aot_makeIncrementorA_0168 },
+  { 0x0178, aot_anonymous_0178 },
+  { 0x0180, aot_makeIncrementorA2_0180 },
+  { 0x0190, aot_anonymous1_0190 },
+  { 0x0198, aot_makeIncrementorB_0198 },
+  { 0x01A8, aot_increment_01A8 },
+  { 0x01B0, aot_makeIncrementorC_01B0 },
+  { 0x01C0, aot_anonymous2_01C0 },
+  { 0x01CC, aot_anonymous3_01CC },
+  { 0x01DC, aot_nestedLexicalScopes_01DC },
+  { 0x0258, aot_anonymous4_0258 },
+  { 0x0264, aot_anonymous5_0264 },
+  { 0x0274, aot_anonymous6_0274 },
+  { 0x0284, aot_differentVariableTypes_0284 },
+  { 0x0338, aot_anonymous7_0338 },
+  { 0x0360, aot_anonymous8_0360 },
+  { 0x0388, aot_anonymous9_0388 },
+  { 0x0458, aot_closureOperations_0458 },
+  { 0x04B0, aot_anonymous10_04B0 },
+  { 0x04B4, aot_anonymous11_04B4 },
+  { 0x04B8, aot_thisCapturing_04B8 },
+  { 0x0534, aot_printMe1_0534 },
+  { 0x053C, aot_getObj2_053C },
+  { 0x056C, aot_anonymous12_056C },
+  { 0x0574, aot_anonymous13_0574 },
+  { 0x057C, aot_anonymous14_057C },
+  { 0x05B8, aot_rootScope_05B8 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x13F9,
+  30,
+  mvm_aotFunctions_entries,
+};
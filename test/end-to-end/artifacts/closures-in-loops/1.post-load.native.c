@@ -0,0 +1,188 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 16 bytecode function(s) of the
+ * snapshot with CRC 0xE8DA. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Array_push
+static uint32_t aot_Array_push_00E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x00EB, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x00EE, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x00EF, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00F2, 1);
+}
+
+// run
+static uint32_t aot_run_00F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00F8, 0);
+}
+
+// test1
+static uint32_t aot_test1_0118(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x011B, 1);
+}
+
+// anonymous
+static uint32_t aot_anonymous_017C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x017C, 0);
+}
+
+// mutationOfLoopVar
+static uint32_t aot_mutationOfLoopVar_0194(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0197, 1);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_0208(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0208, 0);
+}
+
+// popScope
+static uint32_t aot_popScope_0220(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0220, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_029C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x029C, 0);
+}
+
+// anonymous3
+static uint32_t aot_anonymous3_02BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP3_LOAD_GLOBAL_3, depth 1
+  return MVM_AOT_EXIT(0x02BD, 1);
+}
+
+// testBreak
+static uint32_t aot_testBreak_02D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x02D8, 0);
+}
+
+// anonymous4
+static uint32_t aot_anonymous4_0360(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0360, 0);
+}
+
+// anonymous5
+static uint32_t aot_anonymous5_0380(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP3_LOAD_GLOBAL_3, depth 1
+  return MVM_AOT_EXIT(0x0381, 1);
+}
+
+// testNestedBreak
+static uint32_t aot_testNestedBreak_039C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x039C, 0);
+}
+
+// anonymous6
+static uint32_t aot_anonymous6_0464(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0464, 0);
+}
+
+// anonymous7
+static uint32_t aot_anonymous7_0498(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0498, 0);
+}
+
+// anonymous8
+static uint32_t aot_anonymous8_04B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP3_LOAD_GLOBAL_3, depth 1
+  return MVM_AOT_EXIT(0x04B9, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x00E8, aot_Array_push_00E8 },
+  { 0x00F8, aot_run_00F8 },
+  { 0x0118, aot_test1_0118 },
+  { 0x017C, aot_anonymous_017C },
+  { 0x0194, aot_mutationOfLoopVar_0194 },
+  { 0x0208, aot_anonymous1_0208 },
+  { 0x0220, aot_popScope_0220 },
+  { 0x029C, aot_anonymous2_029C },
+  { 0x02BC, aot_anonymous3_02BC },
+  { 0x02D8, aot_testBreak_02D8 },
+  { 0x0360, aot_anonymous4_0360 },
+  { 0x0380, aot_anonymous5_0380 },
+  { 0x039C, aot_testNestedBreak_039C },
+  { 0x0464, aot_anonymous6_0464 },
+  { 0x0498, aot_anonymous7_0498 },
+  { 0x04B8, aot_anonymous8_04B8 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xE8DA,
+  16,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,487 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 25 bytecode function(s) of the
+ * snapshot with CRC 0x3F3D. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_03B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x03B0, 0);
+}
+
+// test_uncaughtException
+static uint32_t aot_test_uncaughtException_040C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x040C, 0);
+}
+
+// test_minimalTryCatch
+static uint32_t aot_test_minimalTryCatch_041C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00BD;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP4_START_TRY, depth 1
+  return MVM_AOT_EXIT(0x0423, 1);
+}
+
+// test_catchWithoutThrow
+static uint32_t aot_test_catchWithoutThrow_0450(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00BD;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP4_START_TRY, depth 1
+  return MVM_AOT_EXIT(0x0457, 1);
+}
+
+// test_throwUnwinding
+static uint32_t aot_test_throwUnwinding_048C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00BD;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP4_START_TRY, depth 1
+  return MVM_AOT_EXIT(0x0493, 1);
+}
+
+// test_normalUnwinding
+static uint32_t aot_test_normalUnwinding_04E0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00BD;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP4_START_TRY, depth 1
+  return MVM_AOT_EXIT(0x04E7, 1);
+}
+
+// test_throwAcrossFrames
+static uint32_t aot_test_throwAcrossFrames_0540(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0540, 0);
+}
+
+// functionThatThrows
+static uint32_t aot_functionThatThrows_0584(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0584, 0);
+}
+
+// test_conditionalThrow
+static uint32_t aot_test_conditionalThrow_0590(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x00BD;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(4))) return MVM_AOT_EXIT(0x059C, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] < (int16_t)AOT_INT14(4));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_05B0;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x05A4, 1);
+L_05B0: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x05B0, 2);
+  f[2] = f[0];
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x05B1, 3);
+  f[3] = f[1];
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x05B2, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x05B2, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x05B3, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP4_START_TRY, depth 2
+  return MVM_AOT_EXIT(0x05B6, 2);
+}
+
+// test_exceptionParameter
+static uint32_t aot_test_exceptionParameter_0628(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0007;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[2] = f[3];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0001;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP4_START_TRY, depth 3
+  return MVM_AOT_EXIT(0x0631, 3);
+}
+
+// test_exceptionParameterWithClosure
+static uint32_t aot_test_exceptionParameterWithClosure_0660(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0660, 0);
+}
+
+// anonymous
+static uint32_t aot_anonymous_06B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x06B8, 0);
+}
+
+// test_rethrow
+static uint32_t aot_test_rethrow_06BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_START_TRY, depth 0
+  return MVM_AOT_EXIT(0x06BC, 0);
+}
+
+// test_breakOutOfTry
+static uint32_t aot_test_breakOutOfTry_06EC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0139;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(100))) return MVM_AOT_EXIT(0x06F8, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] < (int16_t)AOT_INT14(100));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_070C;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0700, 1);
+L_070C: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x070C, 2);
+  f[2] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0141;
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x0710, 4);
+  f[4] = f[1];
+  // VM_OP1_ADD, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x0711, 5);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(f[4]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0711, 5);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x0712, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0712, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x0713, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP4_START_TRY, depth 2
+  return MVM_AOT_EXIT(0x0716, 2);
+}
+
+// test_breakOutOfTryWithClosure
+static uint32_t aot_test_breakOutOfTryWithClosure_0758(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0139;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP1_SCOPE_NEW, depth 1
+  return MVM_AOT_EXIT(0x075F, 1);
+}
+
+// anonymous1
+static uint32_t aot_anonymous1_07D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_LOAD_SCOPED_OUTER, depth 0
+  return MVM_AOT_EXIT(0x07D8, 0);
+}
+
+// test_breakOutOfCatch
+static uint32_t aot_test_breakOutOfCatch_07E0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 4
+  f[4] = 0x0001;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 5
+  f[5] = 0x0001;
+  // VM_OP3_LOAD_LITERAL, depth 6
+  f[6] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 7
+  f[7] = 0x0139;
+  // VM_OP_STORE_VAR_1, depth 8
+  f[6] = f[7];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 7
+  f[7] = 0x0001;
+  // VM_OP_STORE_VAR_1, depth 8
+  f[0] = f[7];
+  // VM_OP3_LOAD_LITERAL, depth 7
+  f[7] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 8
+  f[8] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 9
+  f[7] = f[8];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 8
+  if (!AOT_BOTH_INT14(f[7], AOT_INT14(100))) return MVM_AOT_EXIT(0x07F4, 8);
+  f[8] = AOT_BOOL((int16_t)f[7] < (int16_t)AOT_INT14(100));
+  // VM_OP2_BRANCH_1, depth 9
+  if ((f[8] == AOT_TRUE) || ((f[8] != AOT_FALSE) && (f[8] != AOT_INT14(0)) && (AOT_IS_INT14(f[8]) || mvm_toBool(vm, f[8])))) goto L_0808;
+  // VM_OP1_POP, depth 8
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 7
+  return MVM_AOT_EXIT(0x07FC, 7);
+L_0808: // VM_OP3_LOAD_LITERAL, depth 8
+  f[8] = 0x0019;
+  // VM_OP_LOAD_VAR_1, depth 9
+  if (f[6] == AOT_DELETED) return MVM_AOT_EXIT(0x080B, 9);
+  f[9] = f[6];
+  // VM_OP3_LOAD_LITERAL, depth 10
+  f[10] = 0x0141;
+  // VM_OP_LOAD_VAR_1, depth 11
+  if (f[7] == AOT_DELETED) return MVM_AOT_EXIT(0x080F, 11);
+  f[11] = f[7];
+  // VM_OP1_ADD, depth 12
+  if (!AOT_BOTH_INT14(f[10], f[11])) return MVM_AOT_EXIT(0x0810, 12);
+  {
+    int32_t r = AOT_INT14_VALUE(f[10]) + AOT_INT14_VALUE(f[11]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0810, 12);
+    f[10] = AOT_INT14(r);
+  }
+  // VM_OP1_ADD, depth 11
+  if (!AOT_BOTH_INT14(f[9], f[10])) return MVM_AOT_EXIT(0x0811, 11);
+  {
+    int32_t r = AOT_INT14_VALUE(f[9]) + AOT_INT14_VALUE(f[10]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0811, 11);
+    f[9] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 10
+  if (f[9] == AOT_DELETED) return MVM_AOT_EXIT(0x0812, 10);
+  f[10] = f[9];
+  // VM_OP_STORE_VAR_1, depth 11
+  f[6] = f[10];
+  // VM_OP1_POP, depth 10
+  // VM_OP_LOAD_SMALL_LITERAL, depth 9
+  f[9] = 0x0001;
+  // VM_OP_STORE_VAR_1, depth 10
+  f[8] = f[9];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 9
+  f[9] = 0x0001;
+  // VM_OP_STORE_VAR_1, depth 10
+  f[1] = f[9];
+  // VM_OP4_START_TRY, depth 9
+  return MVM_AOT_EXIT(0x0819, 9);
+}
+
+// test_breakOutOfDoubleCatch
+static uint32_t aot_test_breakOutOfDoubleCatch_0898(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0139;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(100))) return MVM_AOT_EXIT(0x08A4, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] < (int16_t)AOT_INT14(100));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_08B8;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x08AC, 1);
+L_08B8: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x08B8, 2);
+  f[2] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0141;
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x08BC, 4);
+  f[4] = f[1];
+  // VM_OP1_ADD, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x08BD, 5);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(f[4]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x08BD, 5);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x08BE, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x08BE, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x08BF, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP4_START_TRY, depth 2
+  return MVM_AOT_EXIT(0x08C2, 2);
+}
+
+// test_returnFromTry
+static uint32_t aot_test_returnFromTry_0924(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0924, 0);
+}
+
+// test_returnFromTry_inner
+static uint32_t aot_test_returnFromTry_inner_0958(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP4_SCOPE_PUSH, depth 0
+  return MVM_AOT_EXIT(0x0958, 0);
+}
+
+// anonymous2
+static uint32_t aot_anonymous2_09D0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x09D0, 0);
+}
+
+// test_returnInsideNestedTry
+static uint32_t aot_test_returnInsideNestedTry_09D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x09D4, 0);
+}
+
+// inner
+static uint32_t aot_inner_0A1C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0A1C, 0);
+}
+
+// test_returnInsideNestedCatch
+static uint32_t aot_test_returnInsideNestedCatch_0A70(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0A70, 0);
+}
+
+// inner1
+static uint32_t aot_inner1_0AB8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0AB8, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x03B0, aot_run_03B0 },
+  { 0x040C, aot_test_uncaughtException_040C },
+  { 0x041C, aot_test_minimalTryCatch_041C },
+  { 0x0450, aot_test_catchWithoutThrow_0450 },
+  { 0x048C, aot_test_throwUnwinding_048C },
+  { 0x04E0, aot_test_normalUnwinding_04E0 },
+  { 0x0540, aot_test_throwAcrossFrames_0540 },
+  { 0x0584, aot_functionThatThrows_0584 },
+  { 0x0590, aot_test_conditionalThrow_0590 },
+  { 0x0628, aot_test_exceptionParameter_0628 },
+  { 0x0660, aot_test_exceptionParameterWithClosure_0660 },
+  { 0x06B8, aot_anonymous_06B8 },
+  { 0x06BC, aot_test_rethrow_06BC },
+  { 0x06EC, aot_test_breakOutOfTry_06EC },
+  { 0x0758, aot_test_breakOutOfTryWithClosure_0758 },
+  { 0x07D8, aot_anonymous1_07D8 },
+  { 0x07E0, aot_test_breakOutOfCatch_07E0 },
+  { 0x0898, aot_test_breakOutOfDoubleCatch_0898 },
+  { 0x0924, aot_test_returnFromTry_0924 },
+  { 0x0958, aot_test_returnFromTry_inner_0958 },
+  { 0x09D0, aot_anonymous2_09D0 },
+  { 0x09D4, aot_test_returnInsideNestedTry_09D4 },
+  { 0x0A1C, aot_inner_0A1C },
+  { 0x0A70, aot_test_returnInsideNestedCatch_0A70 },
+  { 0x0AB8, aot_inner1_0AB8 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x3F3D,
+  25,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,176 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 11 bytecode function(s) of the
+ * snapshot with CRC 0x6A58. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Array_push
+static uint32_t aot_Array_push_009C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x009F, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x00A2, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x00A3, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00A6, 1);
+}
+
+// run
+static uint32_t aot_run_00AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00AC, 0);
+}
+
+// testSum
+static uint32_t aot_testSum_00D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 3
+  return MVM_AOT_EXIT(0x00E1, 3);
+}
+
+// testEmpty
+static uint32_t aot_testEmpty_014C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP2_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x0151, 1);
+}
+
+// testHoles
+static uint32_t aot_testHoles_0178(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 2
+  return MVM_AOT_EXIT(0x017E, 2);
+}
+
+// testBreak
+static uint32_t aot_testBreak_01B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0051;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP2_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x01B7, 1);
+}
+
+// testClosures
+static uint32_t aot_testClosures_01FC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x01FF, 1);
+}
+
+// anonymous
+static uint32_t aot_anonymous_0268(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x0268, 0);
+}
+
+// testGrowingArray
+static uint32_t aot_testGrowingArray_0270(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 2
+  return MVM_AOT_EXIT(0x0276, 2);
+}
+
+// testNested
+static uint32_t aot_testNested_02B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0051;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP2_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x02BF, 1);
+}
+
+// testIndexedLoop
+static uint32_t aot_testIndexedLoop_0314(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 2
+  return MVM_AOT_EXIT(0x031A, 2);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x009C, aot_Array_push_009C },
+  { 0x00AC, aot_run_00AC },
+  { 0x00D8, aot_testSum_00D8 },
+  { 0x014C, aot_testEmpty_014C },
+  { 0x0178, aot_testHoles_0178 },
+  { 0x01B0, aot_testBreak_01B0 },
+  { 0x01FC, aot_testClosures_01FC },
+  { 0x0268, aot_anonymous_0268 },
+  { 0x0270, aot_testGrowingArray_0270 },
+  { 0x02B8, aot_testNested_02B8 },
+  { 0x0314, aot_testIndexedLoop_0314 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x6A58,
+  11,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,121 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 4 bytecode function(s) of the
+ * snapshot with CRC 0xE876. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0064(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0067, 1);
+}
+
+// foo
+static uint32_t aot_foo_0094(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0094, 0);
+}
+
+// bar
+static uint32_t aot_bar_00A4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0055;
+  // VM_OP_LOAD_ARG_1, depth 3
+  f[3] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x00AA, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00AA, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP2_CALL_3, depth 3
+  return MVM_AOT_EXIT(0x00AB, 3);
+}
+
+// concat
+static uint32_t aot_concat_00B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x005D;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00B8, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00B8, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00BA, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00BA, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x005D;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00BE, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00BE, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (3 < argCount) ? pArgs[3] : AOT_UNDEFINED;
+  // VM_OP1_ADD, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00C0, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00C0, 2);
+    f[0] = AOT_INT14(r);
+  }
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00C1, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0064, aot_run_0064 },
+  { 0x0094, aot_foo_0094 },
+  { 0x00A4, aot_bar_00A4 },
+  { 0x00B4, aot_concat_00B4 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xE876,
+  4,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,116 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 5 bytecode function(s) of the
+ * snapshot with CRC 0x18A3. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Array_push
+static uint32_t aot_Array_push_0058(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 2
+  f[2] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x001D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x005B, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x005E, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x005F, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0062, 1);
+}
+
+// run
+static uint32_t aot_run_0068(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0003;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0069, 1);
+  f[1] = f[0];
+  // VM_OP3_STORE_GLOBAL_3, depth 2
+  return MVM_AOT_EXIT(0x006A, 2);
+}
+
+// function1
+static uint32_t aot_function1_0084(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP2_ARRAY_NEW, depth 2
+  return MVM_AOT_EXIT(0x008A, 2);
+}
+
+// nestedFunction
+static uint32_t aot_nestedFunction_00E8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP1_OBJECT_NEW, depth 2
+  if (mvm_aot_newObject(vm, &f[2]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x00EE, 2);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x00EF, 3);
+  f[3] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0045;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 5
+  f[5] = 0x000F;
+  // VM_OP1_OBJECT_SET_1, depth 6
+  if (mvm_aot_setProperty(vm, &f[6]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x00F4, 6);
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x00F6, 2);
+}
+
+// checkAllocated
+static uint32_t aot_checkAllocated_0150(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0150, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0058, aot_Array_push_0058 },
+  { 0x0068, aot_run_0068 },
+  { 0x0084, aot_function1_0084 },
+  { 0x00E8, aot_nestedFunction_00E8 },
+  { 0x0150, aot_checkAllocated_0150 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x18A3,
+  5,
+  mvm_aotFunctions_entries,
+};
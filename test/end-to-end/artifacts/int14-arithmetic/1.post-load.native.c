@@ -0,0 +1,207 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 6 bytecode function(s) of the
+ * snapshot with CRC 0x21C1. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0078(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0078, 0);
+}
+
+// testAddSubtract
+static uint32_t aot_testAddSubtract_0098(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x7FFF;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x8003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x00A6, 2);
+}
+
+// testMultiply
+static uint32_t aot_testMultiply_0100(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x7FFF;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x8003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x010E, 2);
+}
+
+// testCompare
+static uint32_t aot_testCompare_015C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x7FFF;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x8003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x016A, 2);
+}
+
+// testBitwise
+static uint32_t aot_testBitwise_01A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x7FFF;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x8003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x01B6, 2);
+}
+
+// testCountingLoop
+static uint32_t aot_testCountingLoop_021C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[2] = f[3];
+L_022B: // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x022B, 3);
+  f[3] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x7D03;
+  // VM_OP2_BRANCH_LESS_THAN_1, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x022F, 5);
+  if ((int16_t)f[3] < (int16_t)f[4]) goto L_0248;
+  // VM_OP1_POP, depth 3
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0232, 2);
+L_0248: // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[0], AOT_INT14(1))) return MVM_AOT_EXIT(0x0248, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0248, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x024D, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[0] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP4_VAR_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[1], f[2])) return MVM_AOT_EXIT(0x0250, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[1]) + AOT_INT14_VALUE(f[2]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0250, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x3FFF;
+  // VM_OP_BIT_OP, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x0258, 5);
+  f[3] = f[3] & f[4];
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x0259, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x025C, 3);
+  f[3] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 4
+  if (!AOT_BOTH_INT14(f[3], AOT_INT14(1))) return MVM_AOT_EXIT(0x025D, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x025D, 4);
+    f[4] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 5
+  if (f[4] == AOT_DELETED) return MVM_AOT_EXIT(0x0262, 5);
+  f[5] = f[4];
+  // VM_OP_STORE_VAR_1, depth 6
+  f[2] = f[5];
+  // VM_OP1_POP, depth 5
+  // VM_OP1_POP, depth 4
+  // VM_OP2_JUMP_1, depth 3
+  goto L_022B;
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0078, aot_run_0078 },
+  { 0x0098, aot_testAddSubtract_0098 },
+  { 0x0100, aot_testMultiply_0100 },
+  { 0x015C, aot_testCompare_015C },
+  { 0x01A8, aot_testBitwise_01A8 },
+  { 0x021C, aot_testCountingLoop_021C },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x21C1,
+  6,
+  mvm_aotFunctions_entries,
+};
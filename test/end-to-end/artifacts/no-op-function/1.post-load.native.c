@@ -0,0 +1,79 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 4 bytecode function(s) of the
+ * snapshot with CRC 0xA72F. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Microvium.newUint8Array
+static uint32_t aot_Microvium_newUint8Array_00CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_UINT8_ARRAY_NEW, depth 1
+  return MVM_AOT_EXIT(0x00CD, 1);
+}
+
+// typeCodeOf
+static uint32_t aot_typeCodeOf_00D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_TYPE_CODE_OF, depth 1
+  return MVM_AOT_EXIT(0x00D5, 1);
+}
+
+// Number_isNaN
+static uint32_t aot_Number_isNaN_00DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP1_NOT_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00DE, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] != (int16_t)f[1]);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00DF, 1);
+}
+
+// run
+static uint32_t aot_run_00E4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_3, depth 1
+  return MVM_AOT_EXIT(0x00E7, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x00CC, aot_Microvium_newUint8Array_00CC },
+  { 0x00D4, aot_typeCodeOf_00D4 },
+  { 0x00DC, aot_Number_isNaN_00DC },
+  { 0x00E4, aot_run_00E4 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xA72F,
+  4,
+  mvm_aotFunctions_entries,
+};
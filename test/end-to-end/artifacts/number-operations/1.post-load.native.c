@@ -0,0 +1,175 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 16 bytecode function(s) of the
+ * snapshot with CRC 0xBB6F. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// Number_isNaN
+static uint32_t aot_Number_isNaN_0408(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP1_NOT_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x040A, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] != (int16_t)f[1]);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x040B, 1);
+}
+
+// run
+static uint32_t aot_run_0410(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0410, 0);
+}
+
+// testNegate
+static uint32_t aot_testNegate_045C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x045C, 0);
+}
+
+// testUnaryPlus
+static uint32_t aot_testUnaryPlus_0490(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0490, 0);
+}
+
+// testAddition
+static uint32_t aot_testAddition_04AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x04AC, 0);
+}
+
+// testSubtraction
+static uint32_t aot_testSubtraction_0568(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0568, 0);
+}
+
+// testMultiplication
+static uint32_t aot_testMultiplication_05F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x05F4, 0);
+}
+
+// testDivision
+static uint32_t aot_testDivision_0674(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0674, 0);
+}
+
+// testLessThan
+static uint32_t aot_testLessThan_07CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x07CC, 0);
+}
+
+// testGreaterThan
+static uint32_t aot_testGreaterThan_089C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x089C, 0);
+}
+
+// testRemainder
+static uint32_t aot_testRemainder_096C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x096C, 0);
+}
+
+// testPower
+static uint32_t aot_testPower_0A38(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0A38, 0);
+}
+
+// testIncrDecr
+static uint32_t aot_testIncrDecr_0A74(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0A79, 1);
+}
+
+// testStringToInt
+static uint32_t aot_testStringToInt_0AF4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0AF4, 0);
+}
+
+// testIntToString
+static uint32_t aot_testIntToString_0BF0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0BF0, 0);
+}
+
+// testFloatToString
+static uint32_t aot_testFloatToString_0C3C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0C3C, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0408, aot_Number_isNaN_0408 },
+  { 0x0410, aot_run_0410 },
+  { 0x045C, aot_testNegate_045C },
+  { 0x0490, aot_testUnaryPlus_0490 },
+  { 0x04AC, aot_testAddition_04AC },
+  { 0x0568, aot_testSubtraction_0568 },
+  { 0x05F4, aot_testMultiplication_05F4 },
+  { 0x0674, aot_testDivision_0674 },
+  { 0x07CC, aot_testLessThan_07CC },
+  { 0x089C, aot_testGreaterThan_089C },
+  { 0x096C, aot_testRemainder_096C },
+  { 0x0A38, aot_testPower_0A38 },
+  { 0x0A74, aot_testIncrDecr_0A74 },
+  { 0x0AF4, aot_testStringToInt_0AF4 },
+  { 0x0BF0, aot_testIntToString_0BF0 },
+  { 0x0C3C, aot_testFloatToString_0C3C },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xBB6F,
+  16,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,158 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 1 bytecode function(s) of the
+ * snapshot with CRC 0x4E26. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0044(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP1_OBJECT_NEW, depth 1
+  if (mvm_aot_newObject(vm, &f[1]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0047, 1);
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x0048, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0039;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 4
+  f[4] = 0x0003;
+  // VM_OP1_OBJECT_SET_1, depth 5
+  if (mvm_aot_setProperty(vm, &f[5]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x004D, 5);
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x004E, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x003D;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 4
+  f[4] = 0x0003;
+  // VM_OP1_OBJECT_SET_1, depth 5
+  if (mvm_aot_setProperty(vm, &f[5]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0053, 5);
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+L_005A: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x005A, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0FA3;
+  // VM_OP2_BRANCH_LESS_THAN_1, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x005E, 4);
+  if ((int16_t)f[2] < (int16_t)f[3]) goto L_007C;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0061, 1);
+L_007C: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x007C, 2);
+  f[2] = f[0];
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x0039) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x007D, 3);
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0007;
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x0081, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0081, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0082, 3);
+  f[3] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0039;
+  // VM_OP_LOAD_VAR_1, depth 5
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x0086, 5);
+  f[5] = f[2];
+  // VM_OP1_OBJECT_SET_1, depth 6
+  if (mvm_aot_setProperty(vm, &f[6]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x0087, 6);
+  // VM_OP1_POP, depth 3
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0089, 2);
+  f[2] = f[0];
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x0039) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x008A, 3);
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x008D, 3);
+  f[3] = f[0];
+  // VM_OP3_OBJECT_GET_2, depth 4
+  if (mvm_aot_getPropertyKey(vm, &f[4], 0x003D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x008E, 4);
+  // VM_OP1_ADD, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x0091, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(f[3]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0091, 4);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x3FFF;
+  // VM_OP_BIT_OP, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x0095, 4);
+  f[2] = f[2] & f[3];
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0096, 3);
+  f[3] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x003D;
+  // VM_OP_LOAD_VAR_1, depth 5
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x009A, 5);
+  f[5] = f[2];
+  // VM_OP1_OBJECT_SET_1, depth 6
+  if (mvm_aot_setProperty(vm, &f[6]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x009B, 6);
+  // VM_OP1_POP, depth 3
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x009D, 2);
+  f[2] = f[1];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[2], AOT_INT14(1))) return MVM_AOT_EXIT(0x009E, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x009E, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x00A3, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP1_POP, depth 3
+  // VM_OP2_JUMP_1, depth 2
+  goto L_005A;
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0044, aot_run_0044 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x4E26,
+  1,
+  mvm_aotFunctions_entries,
+};
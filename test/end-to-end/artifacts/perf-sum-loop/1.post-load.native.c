@@ -0,0 +1,131 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 2 bytecode function(s) of the
+ * snapshot with CRC 0x88DE. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0038(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(100))) return MVM_AOT_EXIT(0x0042, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] < (int16_t)AOT_INT14(100));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_0066;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x004A, 1);
+L_0066: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0066, 2);
+  f[2] = f[0];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 3
+  return MVM_AOT_EXIT(0x0067, 3);
+}
+
+// sum
+static uint32_t aot_sum_0088(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+L_0092: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x0092, 2);
+  f[2] = f[1];
+  // VM_OP_LOAD_ARG_1, depth 3
+  f[3] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_NUM_OP, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x0094, 4);
+  f[2] = AOT_BOOL((int16_t)f[2] < (int16_t)f[3]);
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_009A;
+  // VM_OP1_POP, depth 2
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x0098, 1);
+  f[1] = f[0];
+  // VM_OP1_RETURN, depth 2
+  return MVM_AOT_EXIT(0x0099, 2);
+L_009A: // VM_OP4_VAR_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x009A, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(f[1]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x009A, 2);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x009F, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x00A2, 2);
+  f[2] = f[1];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[2], AOT_INT14(1))) return MVM_AOT_EXIT(0x00A3, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00A3, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x00A8, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP1_POP, depth 3
+  // VM_OP2_JUMP_1, depth 2
+  goto L_0092;
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0038, aot_run_0038 },
+  { 0x0088, aot_sum_0088 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x88DE,
+  2,
+  mvm_aotFunctions_entries,
+};
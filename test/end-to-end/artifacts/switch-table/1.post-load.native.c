@@ -0,0 +1,181 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 12 bytecode function(s) of the
+ * snapshot with CRC 0xC17C. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_00D4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00D4, 0);
+}
+
+// dense
+static uint32_t aot_dense_00FC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_TABLE_SWITCH, depth 1
+  return MVM_AOT_EXIT(0x00FD, 1);
+}
+
+// testDense
+static uint32_t aot_testDense_0130(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0130, 0);
+}
+
+// sparse
+static uint32_t aot_sparse_01A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_LOOKUP_SWITCH, depth 1
+  return MVM_AOT_EXIT(0x01A9, 1);
+}
+
+// testSparse
+static uint32_t aot_testSparse_01D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x01D8, 0);
+}
+
+// fallthrough
+static uint32_t aot_fallthrough_0238(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0099;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_TABLE_SWITCH, depth 2
+  return MVM_AOT_EXIT(0x0240, 2);
+}
+
+// testFallthrough
+static uint32_t aot_testFallthrough_0278(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0278, 0);
+}
+
+// defaultInMiddle
+static uint32_t aot_defaultInMiddle_02C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0099;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP4_TABLE_SWITCH, depth 2
+  return MVM_AOT_EXIT(0x02CC, 2);
+}
+
+// testDefaultInMiddle
+static uint32_t aot_testDefaultInMiddle_0300(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0300, 0);
+}
+
+// testNoDefault
+static uint32_t aot_testNoDefault_033C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(10))) return MVM_AOT_EXIT(0x0346, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] < (int16_t)AOT_INT14(10));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_0358;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x034E, 1);
+L_0358: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x0358, 2);
+  f[2] = f[1];
+  // VM_OP4_TABLE_SWITCH, depth 3
+  return MVM_AOT_EXIT(0x0359, 3);
+}
+
+// testNonIntegerDiscriminant
+static uint32_t aot_testNonIntegerDiscriminant_0388(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0388, 0);
+}
+
+// testDuplicateCase
+static uint32_t aot_testDuplicateCase_03CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0099;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x000B;
+  // VM_OP4_TABLE_SWITCH, depth 2
+  return MVM_AOT_EXIT(0x03D4, 2);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x00D4, aot_run_00D4 },
+  { 0x00FC, aot_dense_00FC },
+  { 0x0130, aot_testDense_0130 },
+  { 0x01A8, aot_sparse_01A8 },
+  { 0x01D8, aot_testSparse_01D8 },
+  { 0x0238, aot_fallthrough_0238 },
+  { 0x0278, aot_testFallthrough_0278 },
+  { 0x02C4, aot_defaultInMiddle_02C4 },
+  { 0x0300, aot_testDefaultInMiddle_0300 },
+  { 0x033C, aot_testNoDefault_033C },
+  { 0x0388, aot_testNonIntegerDiscriminant_0388 },
+  { 0x03CC, aot_testDuplicateCase_03CC },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xC17C,
+  12,
+  mvm_aotFunctions_entries,
+};
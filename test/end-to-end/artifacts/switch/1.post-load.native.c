@@ -0,0 +1,203 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 8 bytecode function(s) of the
+ * snapshot with CRC 0xD211. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_0138(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0138, 0);
+}
+
+// convert
+static uint32_t aot_convert_01B4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x01BA, 2);
+  f[2] = f[1];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0017;
+  // VM_OP1_EQUAL, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x01BC, 4);
+  f[2] = AOT_BOOL((int16_t)f[2] == (int16_t)f[3]);
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_01D8;
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x01BF, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x001B;
+  // VM_OP1_EQUAL, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x01C3, 4);
+  f[2] = AOT_BOOL((int16_t)f[2] == (int16_t)f[3]);
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_01E1;
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x01C6, 2);
+  f[2] = f[1];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x000F;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 4
+  f[4] = 0x0013;
+  // VM_OP_NUM_OP, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x01C9, 5);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(f[4]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x01C9, 5);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP1_EQUAL, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x01CA, 4);
+  f[2] = AOT_BOOL((int16_t)f[2] == (int16_t)f[3]);
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_01E9;
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x01CD, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x007D;
+  // VM_OP1_EQUAL, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x01D1, 4);
+  f[2] = AOT_BOOL((int16_t)f[2] == (int16_t)f[3]);
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_01ED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x00A1;
+  // VM_OP1_RETURN, depth 3
+  return MVM_AOT_EXIT(0x01D7, 3);
+L_01D8: // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0059;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x01DB, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+L_01DE: // VM_OP1_POP, depth 2
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01DF, 1);
+  f[1] = f[0];
+  // VM_OP1_RETURN, depth 2
+  return MVM_AOT_EXIT(0x01E0, 2);
+L_01E1: // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0065;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x01E4, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP2_JUMP_1, depth 2
+  goto L_01DE;
+L_01E9: // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0071;
+  // VM_OP1_RETURN, depth 3
+  return MVM_AOT_EXIT(0x01EC, 3);
+L_01ED: // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0081;
+  // VM_OP1_RETURN, depth 3
+  return MVM_AOT_EXIT(0x01F0, 3);
+}
+
+// weirdSwitch
+static uint32_t aot_weirdSwitch_01F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 1
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01F5, 1);
+  f[1] = f[0];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x01F6, 2);
+}
+
+// evaluateCase
+static uint32_t aot_evaluateCase_0244(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0244, 0);
+}
+
+// switchWithNoDefault
+static uint32_t aot_switchWithNoDefault_0250(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0017;
+  // VM_OP4_TABLE_SWITCH, depth 1
+  return MVM_AOT_EXIT(0x0251, 1);
+}
+
+// switchFallThroughBottom
+static uint32_t aot_switchFallThroughBottom_026C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0007;
+  // VM_OP4_TABLE_SWITCH, depth 1
+  return MVM_AOT_EXIT(0x026D, 1);
+}
+
+// emptySwitch
+static uint32_t aot_emptySwitch_02A0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0007;
+  // VM_OP1_POP, depth 1
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x02A2, 0);
+}
+
+// switchWithOnlyDefault
+static uint32_t aot_switchWithOnlyDefault_02B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0007;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x02B1, 1);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x0138, aot_run_0138 },
+  { 0x01B4, aot_convert_01B4 },
+  { 0x01F4, aot_weirdSwitch_01F4 },
+  { 0x0244, aot_evaluateCase_0244 },
+  { 0x0250, aot_switchWithNoDefault_0250 },
+  { 0x026C, aot_switchFallThroughBottom_026C },
+  { 0x02A0, aot_emptySwitch_02A0 },
+  { 0x02B0, aot_switchWithOnlyDefault_02B0 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0xD211,
+  8,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,256 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 17 bytecode function(s) of the
+ * snapshot with CRC 0x3E8B. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_009C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x009C, 0);
+}
+
+// sum
+static uint32_t aot_sum_00C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00C6, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] <= (int16_t)f[1]);
+  // VM_OP2_BRANCH_1, depth 1
+  if ((f[0] == AOT_TRUE) || ((f[0] != AOT_FALSE) && (f[0] != AOT_INT14(0)) && (AOT_IS_INT14(f[0]) || mvm_toBool(vm, f[0])))) goto L_00D5;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00C9, 0);
+L_00D5: // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (2 < argCount) ? pArgs[2] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00D6, 1);
+}
+
+// isEven
+static uint32_t aot_isEven_00DC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP1_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00DE, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] == (int16_t)f[1]);
+  // VM_OP2_BRANCH_1, depth 1
+  if ((f[0] == AOT_TRUE) || ((f[0] != AOT_FALSE) && (f[0] != AOT_INT14(0)) && (AOT_IS_INT14(f[0]) || mvm_toBool(vm, f[0])))) goto L_00ED;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00E1, 0);
+L_00ED: // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0009;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x00EE, 1);
+}
+
+// isOdd
+static uint32_t aot_isOdd_00F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP1_EQUAL, depth 2
+  if (!AOT_BOTH_INT14(f[0], f[1])) return MVM_AOT_EXIT(0x00F6, 2);
+  f[0] = AOT_BOOL((int16_t)f[0] == (int16_t)f[1]);
+  // VM_OP2_BRANCH_1, depth 1
+  if ((f[0] == AOT_TRUE) || ((f[0] != AOT_FALSE) && (f[0] != AOT_INT14(0)) && (AOT_IS_INT14(f[0]) || mvm_toBool(vm, f[0])))) goto L_0102;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x00F9, 0);
+L_0102: // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x000D;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x0103, 1);
+}
+
+// testTailRecursion
+static uint32_t aot_testTailRecursion_0108(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0108, 0);
+}
+
+// testMutualRecursion
+static uint32_t aot_testMutualRecursion_0120(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0120, 0);
+}
+
+// testResultUsedByCaller
+static uint32_t aot_testResultUsedByCaller_0140(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0007;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0144, 2);
+}
+
+// testVoidCall
+static uint32_t aot_testVoidCall_0160(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x006D;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0167, 1);
+}
+
+// testClosureTarget
+static uint32_t aot_testClosureTarget_0180(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP1_SCOPE_NEW, depth 0
+  return MVM_AOT_EXIT(0x0180, 0);
+}
+
+// callIt
+static uint32_t aot_callIt_01A8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0001;
+  // VM_OP4_TAIL_CALL, depth 2
+  return MVM_AOT_EXIT(0x01AA, 2);
+}
+
+// anonymous
+static uint32_t aot_anonymous_01B0(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SCOPED_1, depth 0
+  return MVM_AOT_EXIT(0x01B0, 0);
+}
+
+// Box
+static uint32_t aot_Box_01B8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (1 < argCount) ? pArgs[1] : AOT_UNDEFINED;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0079;
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01BD, 3);
+  f[3] = f[0];
+  // VM_OP1_OBJECT_SET_1, depth 4
+  if (mvm_aot_setProperty(vm, &f[4]) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01BE, 4);
+  // VM_OP1_POP, depth 1
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x01C1, 1);
+}
+
+// Box_get
+static uint32_t aot_Box_get_01C4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_ARG_1, depth 0
+  f[0] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP3_OBJECT_GET_2, depth 1
+  if (mvm_aot_getPropertyKey(vm, &f[1], 0x0079) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01C5, 1);
+  // VM_OP1_RETURN, depth 1
+  return MVM_AOT_EXIT(0x01C8, 1);
+}
+
+// Box_callGet
+static uint32_t aot_Box_callGet_01CC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 0
+  f[0] = 0x0001;
+  // VM_OP_LOAD_ARG_1, depth 1
+  f[1] = (0 < argCount) ? pArgs[0] : AOT_UNDEFINED;
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x01CE, 2);
+  f[2] = f[1];
+  // VM_OP3_OBJECT_GET_2, depth 3
+  if (mvm_aot_getPropertyKey(vm, &f[3], 0x004D) != MVM_E_SUCCESS) return MVM_AOT_EXIT(0x01CF, 3);
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP4_TAIL_CALL, depth 2
+  return MVM_AOT_EXIT(0x01D3, 2);
+}
+
+// testMethodTarget
+static uint32_t aot_testMethodTarget_01D8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x01DB, 1);
+}
+
+// testHostTarget
+static uint32_t aot_testHostTarget_01F8(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0211;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x01FB, 1);
+}
+
+// check
+static uint32_t aot_check_0210(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x0210, 0);
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x009C, aot_run_009C },
+  { 0x00C4, aot_sum_00C4 },
+  { 0x00DC, aot_isEven_00DC },
+  { 0x00F4, aot_isOdd_00F4 },
+  { 0x0108, aot_testTailRecursion_0108 },
+  { 0x0120, aot_testMutualRecursion_0120 },
+  { 0x0140, aot_testResultUsedByCaller_0140 },
+  { 0x0160, aot_testVoidCall_0160 },
+  { 0x0180, aot_testClosureTarget_0180 },
+  { 0x01A8, aot_callIt_01A8 },
+  { 0x01B0, aot_anonymous_01B0 },
+  { 0x01B8, aot_Box_01B8 },
+  { 0x01C4, aot_Box_get_01C4 },
+  { 0x01CC, aot_Box_callGet_01CC },
+  { 0x01D8, aot_testMethodTarget_01D8 },
+  { 0x01F8, aot_testHostTarget_01F8 },
+  { 0x0210, aot_check_0210 },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x3E8B,
+  17,
+  mvm_aotFunctions_entries,
+};
@@ -0,0 +1,322 @@
+/*
+ * Generated by Microvium `generateNativeC`. Do not edit.
+ *
+ * Native implementations of 6 bytecode function(s) of the
+ * snapshot with CRC 0x390B. Pass `&mvm_aotFunctions` to
+ * `mvm_aot_setFunctions` after restoring that snapshot.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "microvium.h"
+
+#if !MVM_AOT
+#error "Native functions require MVM_AOT in the port file"
+#endif
+
+#define AOT_UNDEFINED 0x0001
+#define AOT_TRUE 0x0009
+#define AOT_FALSE 0x000D
+#define AOT_DELETED 0x0019
+#define AOT_IS_INT14(v) (((v) & 3) == 3)
+#define AOT_BOTH_INT14(a, b) (((a) & (b) & 3) == 3)
+#define AOT_INT14_VALUE(v) ((int32_t)(int16_t)(v) >> 2)
+#define AOT_INT14(i) ((mvm_Value)(((unsigned int)(i) << 2) | 3))
+#define AOT_IN_INT14_RANGE(i) (((i) >= -0x2000) && ((i) <= 0x1FFF))
+#define AOT_BOOL(b) ((b) ? AOT_TRUE : AOT_FALSE)
+
+// run
+static uint32_t aot_run_009C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 0
+  return MVM_AOT_EXIT(0x009C, 0);
+}
+
+// testLoopPastInt14
+static uint32_t aot_testLoopPastInt14_00BC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x7FD3;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+L_00C8: // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x00C8, 2);
+  f[2] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0051;
+  // VM_OP2_BRANCH_LESS_THAN_1, depth 4
+  if (!AOT_BOTH_INT14(f[2], f[3])) return MVM_AOT_EXIT(0x00CC, 4);
+  if ((int16_t)f[2] < (int16_t)f[3]) goto L_00DB;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x00CF, 1);
+L_00DB: // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[0], AOT_INT14(1))) return MVM_AOT_EXIT(0x00DB, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00DB, 2);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x00E0, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x00E3, 2);
+  f[2] = f[1];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[2], AOT_INT14(1))) return MVM_AOT_EXIT(0x00E4, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x00E4, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x00E9, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP1_POP, depth 3
+  // VM_OP2_JUMP_1, depth 2
+  goto L_00C8;
+}
+
+// testLoopPastInt32
+static uint32_t aot_testLoopPastInt32_00F4(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 3
+  f[3] = 0x0059;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[2] = f[3];
+L_0105: // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x0105, 3);
+  f[3] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x0061;
+  // VM_OP2_BRANCH_LESS_THAN_1, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x0109, 5);
+  if ((int16_t)f[3] < (int16_t)f[4]) goto L_0122;
+  // VM_OP1_POP, depth 3
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x010C, 2);
+L_0122: // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[0], AOT_INT14(1))) return MVM_AOT_EXIT(0x0122, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0122, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x0127, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[0] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x012A, 3);
+  f[3] = f[2];
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x012B, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x012E, 3);
+  f[3] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 4
+  if (!AOT_BOTH_INT14(f[3], AOT_INT14(1))) return MVM_AOT_EXIT(0x012F, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x012F, 4);
+    f[4] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 5
+  if (f[4] == AOT_DELETED) return MVM_AOT_EXIT(0x0134, 5);
+  f[5] = f[4];
+  // VM_OP_STORE_VAR_1, depth 6
+  f[2] = f[5];
+  // VM_OP1_POP, depth 5
+  // VM_OP1_POP, depth 4
+  // VM_OP2_JUMP_1, depth 3
+  goto L_0105;
+}
+
+// testLessEqualLoop
+static uint32_t aot_testLessEqualLoop_013C(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 1
+  f[1] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 2
+  f[0] = f[1];
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0xFFEF;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+L_0148: // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[1], AOT_INT14(5))) return MVM_AOT_EXIT(0x0148, 2);
+  f[2] = AOT_BOOL((int16_t)f[1] <= (int16_t)AOT_INT14(5));
+  // VM_OP2_BRANCH_1, depth 3
+  if ((f[2] == AOT_TRUE) || ((f[2] != AOT_FALSE) && (f[2] != AOT_INT14(0)) && (AOT_IS_INT14(f[2]) || mvm_toBool(vm, f[2])))) goto L_015C;
+  // VM_OP1_POP, depth 2
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 1
+  return MVM_AOT_EXIT(0x0150, 1);
+L_015C: // VM_OP4_VAR_LIT_NUM_OP, depth 2
+  if (!AOT_BOTH_INT14(f[0], AOT_INT14(1))) return MVM_AOT_EXIT(0x015C, 2);
+  {
+    int32_t r = AOT_INT14_VALUE(f[0]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x015C, 2);
+    f[2] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x0161, 3);
+  f[3] = f[2];
+  // VM_OP_STORE_VAR_1, depth 4
+  f[0] = f[3];
+  // VM_OP1_POP, depth 3
+  // VM_OP_LOAD_VAR_1, depth 2
+  if (f[1] == AOT_DELETED) return MVM_AOT_EXIT(0x0164, 2);
+  f[2] = f[1];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[2], AOT_INT14(1))) return MVM_AOT_EXIT(0x0165, 3);
+  {
+    int32_t r = AOT_INT14_VALUE(f[2]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x0165, 3);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x016A, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[1] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP1_POP, depth 3
+  // VM_OP2_JUMP_1, depth 2
+  goto L_0148;
+}
+
+// testNumberAdd
+static uint32_t aot_testNumberAdd_0174(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0079;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x000F;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[1] = f[2];
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x0180, 2);
+}
+
+// testStringAddNotSpecialized
+static uint32_t aot_testStringAddNotSpecialized_01AC(mvm_VM* vm, mvm_Value* f, mvm_Value* pArgs, uint8_t argCount) {
+  (void)vm; (void)pArgs; (void)argCount;
+  // VM_OP3_LOAD_LITERAL, depth 0
+  f[0] = 0x0019;
+  // VM_OP3_LOAD_LITERAL, depth 1
+  f[1] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 2
+  f[2] = 0x0007;
+  // VM_OP_STORE_VAR_1, depth 3
+  f[0] = f[2];
+  // VM_OP3_LOAD_LITERAL, depth 2
+  f[2] = 0x0019;
+  // VM_OP_LOAD_SMALL_LITERAL, depth 3
+  f[3] = 0x0003;
+  // VM_OP_STORE_VAR_1, depth 4
+  f[2] = f[3];
+L_01B9: // VM_OP4_VAR_LIT_NUM_OP, depth 3
+  if (!AOT_BOTH_INT14(f[2], AOT_INT14(2))) return MVM_AOT_EXIT(0x01B9, 3);
+  f[3] = AOT_BOOL((int16_t)f[2] < (int16_t)AOT_INT14(2));
+  // VM_OP2_BRANCH_1, depth 4
+  if ((f[3] == AOT_TRUE) || ((f[3] != AOT_FALSE) && (f[3] != AOT_INT14(0)) && (AOT_IS_INT14(f[3]) || mvm_toBool(vm, f[3])))) goto L_01E5;
+  // VM_OP1_POP, depth 3
+  // VM_OP3_LOAD_GLOBAL_CALLEE, depth 2
+  return MVM_AOT_EXIT(0x01C1, 2);
+L_01E5: // VM_OP_LOAD_VAR_1, depth 3
+  if (f[0] == AOT_DELETED) return MVM_AOT_EXIT(0x01E5, 3);
+  f[3] = f[0];
+  // VM_OP3_LOAD_LITERAL, depth 4
+  f[4] = 0x003D;
+  // VM_OP1_ADD, depth 5
+  if (!AOT_BOTH_INT14(f[3], f[4])) return MVM_AOT_EXIT(0x01E9, 5);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(f[4]);
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x01E9, 5);
+    f[3] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 4
+  if (f[3] == AOT_DELETED) return MVM_AOT_EXIT(0x01EA, 4);
+  f[4] = f[3];
+  // VM_OP_STORE_VAR_1, depth 5
+  f[0] = f[4];
+  // VM_OP1_POP, depth 4
+  // VM_OP_LOAD_VAR_1, depth 3
+  if (f[2] == AOT_DELETED) return MVM_AOT_EXIT(0x01ED, 3);
+  f[3] = f[2];
+  // VM_OP4_VAR_LIT_NUM_OP, depth 4
+  if (!AOT_BOTH_INT14(f[3], AOT_INT14(1))) return MVM_AOT_EXIT(0x01EE, 4);
+  {
+    int32_t r = AOT_INT14_VALUE(f[3]) + AOT_INT14_VALUE(AOT_INT14(1));
+    if (!AOT_IN_INT14_RANGE(r)) return MVM_AOT_EXIT(0x01EE, 4);
+    f[4] = AOT_INT14(r);
+  }
+  // VM_OP_LOAD_VAR_1, depth 5
+  if (f[4] == AOT_DELETED) return MVM_AOT_EXIT(0x01F3, 5);
+  f[5] = f[4];
+  // VM_OP_STORE_VAR_1, depth 6
+  f[2] = f[5];
+  // VM_OP1_POP, depth 5
+  // VM_OP1_POP, depth 4
+  // VM_OP2_JUMP_1, depth 3
+  goto L_01B9;
+}
+
+static const mvm_TsAotFunction mvm_aotFunctions_entries[] = {
+  { 0x009C, aot_run_009C },
+  { 0x00BC, aot_testLoopPastInt14_00BC },
+  { 0x00F4, aot_testLoopPastInt32_00F4 },
+  { 0x013C, aot_testLessEqualLoop_013C },
+  { 0x0174, aot_testNumberAdd_0174 },
+  { 0x01AC, aot_testStringAddNotSpecialized_01AC },
+};
+
+const mvm_TsAotFunctionTable mvm_aotFunctions = {
+  0x390B,
+  6,
+  mvm_aotFunctions_entries,
+};
@@ -9,7 +9,8 @@ import YAML from 'yaml';
 import { Microvium, HostImportTable, addDefaultGlobals } from '../../lib';
 import { assertSameCode } from '../common';
 import { assert } from 'chai';
-import { NativeVM } from '../../lib/native-vm';
+import { NativeVM, loadNativeVMWithOptInFeatures } from '../../lib/native-vm';
+import { NativeVMFriendly } from '../../lib/native-vm-friendly';
 import { unexpected, writeTextFile } from '../../lib/utils';
 import { encodeSnapshot } from '../../lib/encode-snapshot';
 import { decodeSnapshot } from '../../lib/decode-snapshot';
@@ -22,6 +23,7 @@ import { anyGrepSelector } from '../code-coverage.test';
 import nodeVM from 'vm';
 import { mvm_TeType } from '../../lib/runtime-types';
 import { stringifySourceMap } from '../../lib/source-map';
+import { generateNativeC } from '../../lib/generate-native-c';
 
 const testDir = './test/end-to-end/tests';
 const rootArtifactDir = './test/end-to-end/artifacts';
@@ -315,6 +317,11 @@ async function runTest(anySkips: boolean, testArtifactDir: string, yamlText: str
   writeTextFile(path.resolve(testArtifactDir, '1.post-load.mvm-bc.source-map'), stringifySourceMap(postLoadSnapshot.sourceMap ?? unexpected()));
   const decoded = decodeSnapshot(postLoadSnapshot);
   writeTextFile(path.resolve(testArtifactDir, '1.post-load.mvm-bc.disassembly'), decoded.disassembly);
+  // The C that the ahead-of-time compiler generates for the post-load
+  // snapshot with every function marked as native
+  const { snapshot: nativeSnapshot } = encodeSnapshot(postLoadSnapshotInfo, false, false, () => true);
+  fs.writeFileSync(path.resolve(testArtifactDir, '1.post-load.native.mvm-bc'), nativeSnapshot.data, null);
+  writeTextFile(path.resolve(testArtifactDir, '1.post-load.native.c'), generateNativeC(nativeSnapshot));
   if (!meta.dontCompareDisassembly) {
     // This checks that a round-trip serialization and deserialization of
     // the post-load snapshot gives us the same thing.
@@ -429,6 +436,72 @@ async function runTest(anySkips: boolean, testArtifactDir: string, yamlText: str
       writeTextFile(path.resolve(testArtifactDir, '5.native-post-gc.mvm-bc.disassembly'), decodeSnapshot(postGCSnapshot).disassembly);
     }
   }
+
+  // ------------- Run function in native VM with opt-in features -------------
+  // The same snapshot, with shaped objects and every function marked as
+  // native, in the engine built with the opt-in port options (see
+  // MVM_TEST_OPT_IN_FEATURES in microvium_port_test.h). The function runs
+  // while an incremental collection cycle is in progress, which the harness
+  // then finishes in steps.
+  if (!meta.skipNative) {
+    printLog = [];
+    testCompletionPromise = new Promise((...a) => [resolveTest, rejectTest] = a);
+
+    function vmGetHeapUsed() {
+      const memoryStats = optInVM.getMemoryStats();
+      return memoryStats.virtualHeapUsed;
+    }
+
+    function vmRunGC(squeeze?: boolean) {
+      optInVM.garbageCollect(squeeze);
+    }
+
+    importMap[HOST_FUNCTION_GET_HEAP_USED_ID] = vmGetHeapUsed;
+    importMap[HOST_FUNCTION_RUN_GC_ID] = vmRunGC;
+    importMap[HOST_FUNCTION_ASYNC_TEST_COMPLETE] = asyncTestComplete;
+
+    const shapedSnapshotInfo = {
+      ...postLoadSnapshotInfo,
+      flags: new Set([...postLoadSnapshotInfo.flags, IL.ExecutionFlag.ShapedObjects])
+    };
+    const { snapshot: shapedSnapshot } = encodeSnapshot(shapedSnapshotInfo, false, false, () => true);
+    const optInVM = new NativeVMFriendly(shapedSnapshot, importMap, loadNativeVMWithOptInFeatures());
+
+    if (meta.runExportedFunction !== undefined) {
+      const run = optInVM.resolveExport(meta.runExportedFunction);
+      assertionCount = 0;
+      optInVM.garbageCollectStep(16);
+
+      if (meta.expectException) {
+        let threw = undefined;
+        try {
+          run();
+          if (meta.isAsync) await testCompletionPromise;
+        } catch (e) {
+          threw = e;
+        }
+        if (!threw) {
+          assert(false, 'Expected exception to be thrown but none thrown');
+        }
+        assert.deepEqual(threw.message, meta.expectException);
+      } else {
+        run();
+        if (meta.isAsync) await testCompletionPromise;
+      }
+
+      if (meta.expectedPrintout !== undefined) {
+        assertSameCode(printLog.join('\n'), meta.expectedPrintout);
+      }
+      if (meta.assertionCount !== undefined) {
+        assert.equal(assertionCount, meta.assertionCount, 'Expected assertion count');
+      }
+
+      while (!optInVM.garbageCollectStep(64));
+      optInVM.garbageCollect(true);
+      // The heap must still be valid after the collections
+      decodeSnapshot(optInVM.createSnapshot());
+    }
+  }
 }
 
 function* enumerateCases(testFiles: string[]) {
@@ -0,0 +1,85 @@
+/*---
+description: >
+  Tests access to closure variables in outer scopes, which the bytecode emitter
+  compiles to instructions that address the variable by scope depth and slot
+  index rather than by walking the scope chain.
+runExportedFunction: 0
+assertionCount: 8
+---*/
+vmExport(0, run);
+
+function run() {
+  testNestedRead();
+  testNestedWrite();
+  testAlternatingClosures();
+  testLoopScopes();
+}
+
+function testNestedRead() {
+  let a = 1;
+  function level1() {
+    let b = 2;
+    const unused1 = () => b;
+    function level2() {
+      let c = 3;
+      const unused2 = () => c;
+      return () => a * 100 + b * 10 + c;
+    }
+    return level2();
+  }
+  assertEqual(level1()(), 123);
+}
+
+function testNestedWrite() {
+  let count = 0;
+  function makeIncrementer() {
+    let step = 1;
+    const setStep = s => { step = s; };
+    return [() => { count += step; }, setStep];
+  }
+  const pair = makeIncrementer();
+  const inc = pair[0];
+  const setStep = pair[1];
+  inc();
+  inc();
+  setStep(10);
+  inc();
+  assertEqual(count, 12);
+}
+
+// Two closures with different scope chains, called alternately, so that the
+// engine's memory of the last scope chain is replaced on each call
+function testAlternatingClosures() {
+  const f = makeCounter(100);
+  const g = makeCounter(200);
+  f(); g(); f(); g(); g();
+  assertEqual(f(), 103);
+  assertEqual(g(), 204);
+}
+
+function makeCounter(start) {
+  let n = start;
+  function inner() {
+    let unused = 0;
+    const unusedClosure = () => unused;
+    return () => ++n;
+  }
+  return inner();
+}
+
+// Each iteration has its own scope for `i`, and the closures reference both
+// the loop scope and the function scope above it
+function testLoopScopes() {
+  let total = 0;
+  const fns = [];
+  for (let i = 0; i < 3; i++) {
+    fns.push(() => {
+      total += i;
+      return total;
+    });
+  }
+  assertEqual(fns[2](), 2);
+  assertEqual(fns[1](), 3);
+  assertEqual(fns[0](), 3);
+  assertEqual(total, 3);
+}
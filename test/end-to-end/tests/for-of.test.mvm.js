@@ -0,0 +1,106 @@
+/*---
+description: >
+  Tests `for..of` loops over arrays, and indexed loops over arrays, which both
+  use fast paths in the engine that read the element directly.
+runExportedFunction: 0
+assertionCount: 12
+---*/
+vmExport(0, run);
+
+function run() {
+  testSum();
+  testEmpty();
+  testHoles();
+  testBreak();
+  testClosures();
+  testGrowingArray();
+  testNested();
+  testIndexedLoop();
+}
+
+function testSum() {
+  const arr = [1, 2, 3, 4];
+  let sum = 0;
+  for (const x of arr) {
+    sum += x;
+  }
+  assertEqual(sum, 10);
+
+  // Without a block body
+  let s = '';
+  for (let x of ['a', 'b', 'c']) s += x;
+  assertEqual(s, 'abc');
+}
+
+function testEmpty() {
+  let count = 0;
+  for (const x of []) {
+    count++;
+  }
+  assertEqual(count, 0);
+}
+
+function testHoles() {
+  const arr = [];
+  arr[2] = 'c';
+  let s = '';
+  for (const x of arr) {
+    s += x;
+  }
+  assertEqual(s, 'undefinedundefinedc');
+}
+
+function testBreak() {
+  let s = '';
+  for (const x of [1, 2, 3, 4]) {
+    let y = x * 10;
+    if (x === 3) break;
+    s += y;
+  }
+  assertEqual(s, '1020');
+}
+
+// Each iteration has its own instance of the loop variable
+function testClosures() {
+  const fns = [];
+  for (const x of [1, 2, 3]) {
+    let doubled = x * 2;
+    fns.push(() => x + doubled);
+  }
+  assertEqual(fns[0](), 3);
+  assertEqual(fns[1](), 6);
+  assertEqual(fns[2](), 9);
+}
+
+// Elements added during the loop are visited
+function testGrowingArray() {
+  const arr = [1];
+  let count = 0;
+  for (const x of arr) {
+    if (x < 5) arr.push(x + 1);
+    count++;
+  }
+  assertEqual(count, 5);
+}
+
+function testNested() {
+  let s = '';
+  for (const row of [[1, 2], [3], []]) {
+    for (const x of row) {
+      s += x;
+    }
+    s += ';';
+  }
+  assertEqual(s, '12;3;;');
+}
+
+function testIndexedLoop() {
+  const arr = [5, 6, 7];
+  let sum = 0;
+  for (let i = 0; i < arr.length; i++) {
+    sum += arr[i];
+  }
+  assertEqual(sum, 18);
+  // Reading past the end still gives undefined
+  assertEqual(arr[3], undefined);
+}
@@ -0,0 +1,74 @@
+/*---
+description: >
+  Tests arithmetic, comparison and bitwise operations on small integers,
+  particularly where the result crosses the boundary of the int14 range
+  (-8192 to 8191). The counting loop at the end doubles as a micro-benchmark of
+  integer arithmetic for perf-test.
+runExportedFunction: 0
+assertionCount: 27
+---*/
+vmExport(0, run);
+
+function run() {
+  testAddSubtract();
+  testMultiply();
+  testCompare();
+  testBitwise();
+  testCountingLoop();
+}
+
+function testAddSubtract() {
+  const max = 8191;
+  const min = -8192;
+  assertEqual(max + 1, 8192);
+  assertEqual(min - 1, -8193);
+  assertEqual(min + max, -1);
+  assertEqual(max - min, 16383);
+  assertEqual(max + max, 16382);
+  assertEqual(min + min, -16384);
+  assertEqual(1 - max, -8190);
+}
+
+function testMultiply() {
+  const max = 8191;
+  const min = -8192;
+  assertEqual(max * max, 67092481);
+  assertEqual(min * min, 67108864);
+  assertEqual(min * -1, 8192);
+  assertEqual(90 * 91, 8190);
+  assertEqual(-90 * 91, -8190);
+}
+
+function testCompare() {
+  const max = 8191;
+  const min = -8192;
+  assertEqual(min < max, true);
+  assertEqual(max < min, false);
+  assertEqual(max <= max, true);
+  assertEqual(min >= max, false);
+  assertEqual(-1 > min, true);
+}
+
+function testBitwise() {
+  const max = 8191;
+  const min = -8192;
+  assertEqual(min | max, -1);
+  assertEqual(min & max, 0);
+  assertEqual(min ^ -1, max);
+  assertEqual(~min, max);
+  assertEqual(min >> 3, -1024);
+  assertEqual(min >> 33, -4096);
+  assertEqual(max << 1, 16382);
+  assertEqual(min >>> 1, 0x7FFFF000);
+}
+
+function testCountingLoop() {
+  let count = 0;
+  let sum = 0;
+  for (let i = 0; i < 8000; i++) {
+    count = count + 1;
+    sum = (sum + i) & 0xFFF;
+  }
+  assertEqual(count, 8000);
+  assertEqual(sum, 2144);
+}
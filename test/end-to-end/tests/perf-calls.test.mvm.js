@@ -0,0 +1,31 @@
+/*---
+description: >
+  Calls a function and a closure from a loop. This is a micro-benchmark of
+  calls for perf-test (see the `call-cache` configuration there).
+runExportedFunction: 0
+assertionCount: 2
+---*/
+vmExport(0, run);
+
+function run() {
+  let total = 0;
+  for (let i = 0; i < 500; i++) {
+    total = add(total, i) & 0xFFF;
+  }
+  assertEqual(total, 1870);
+
+  const addThree = makeAdder(3);
+  total = 0;
+  for (let i = 0; i < 500; i++) {
+    total = addThree(total) & 0xFFF;
+  }
+  assertEqual(total, 1500);
+}
+
+function add(a, b) {
+  return a + b;
+}
+
+function makeAdder(n) {
+  return x => x + n;
+}
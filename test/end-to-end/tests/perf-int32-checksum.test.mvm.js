@@ -0,0 +1,18 @@
+/*---
+description: >
+  A checksum loop whose intermediate results are outside the int14 range, so
+  the engine allocates them as int32 values unless it can keep them unboxed.
+  This is a micro-benchmark for perf-test (see the `unboxed-int32`
+  configuration there).
+runExportedFunction: 0
+assertionCount: 1
+---*/
+vmExport(0, run);
+
+function run() {
+  let acc = 0;
+  for (let i = 0; i < 1000; i++) {
+    acc = ((acc * 1000) + i) & 0x1FFF;
+  }
+  assertEqual(acc, 6551);
+}
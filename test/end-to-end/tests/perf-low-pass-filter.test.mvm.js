@@ -0,0 +1,19 @@
+/*---
+description: >
+  A one-pole low-pass filter over a ramp. Each step computes non-integer
+  results, so the engine allocates them as float64 values unless it can keep
+  them unboxed. This is a micro-benchmark for perf-test (see the
+  `unboxed-float64` and `reserved-heap` configurations there).
+runExportedFunction: 0
+assertionCount: 1
+---*/
+vmExport(0, run);
+
+function run() {
+  let y = 0;
+  for (let i = 0; i < 1000; i++) {
+    y = (y * 0.7) + (i * 0.3);
+  }
+  // The filter lags the ramp by 0.7 / 0.3 = 2.33
+  assert(y > 996.66 && y < 996.67);
+}
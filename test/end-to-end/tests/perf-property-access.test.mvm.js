@@ -0,0 +1,19 @@
+/*---
+description: >
+  Reads and writes two properties of the same object in a loop. This is a
+  micro-benchmark of property access for perf-test (see the `inline-cache`
+  configuration there).
+runExportedFunction: 0
+assertionCount: 2
+---*/
+vmExport(0, run);
+
+function run() {
+  const point = { x: 0, y: 0 };
+  for (let i = 0; i < 1000; i++) {
+    point.x = point.x + 1;
+    point.y = (point.x + point.y) & 0xFFF;
+  }
+  assertEqual(point.x, 1000);
+  assertEqual(point.y, 788);
+}
@@ -0,0 +1,26 @@
+/*---
+description: >
+  Calls a function with a counting loop 100 times. This is a micro-benchmark
+  for perf-test of code that the JIT and the ahead-of-time compiler can
+  translate (see the `jit` and `aot` configurations there).
+runExportedFunction: 0
+assertionCount: 2
+---*/
+vmExport(0, run);
+
+function run() {
+  let total = 0;
+  for (let i = 0; i < 100; i++) {
+    total = (total + sum(120)) & 0xFFF;
+  }
+  assertEqual(sum(120), 7140);
+  assertEqual(total, 1296);
+}
+
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s = s + i;
+  }
+  return s;
+}
@@ -0,0 +1,72 @@
+/*---
+description: >
+  Tests objects created before the snapshot, which the opt-in native run
+  encodes as shaped objects. Native only because it runs the GC.
+runExportedFunction: 0
+nativeOnly: true
+assertionCount: 24
+---*/
+
+// Three objects with the same keys in the same order, so they share a shape
+const a = { x: 1, y: 2 };
+const b = { x: 3, y: 4 };
+const c = { x: 5, y: 6 };
+// The same keys in a different order have a different shape
+const d = { y: 7, x: 8 };
+// An object that gains a key after the snapshot
+const e = { name: 'e', count: 0 };
+
+vmExport(0, run);
+
+function run() {
+  // Reads
+  assertEqual(sumX([a, b, c, d]), 17);
+  assertEqual(d.y, 7);
+  assertEqual(e.name, 'e');
+  assertEqual(a.z, undefined);
+
+  // Writes
+  a.x = 10;
+  d.x = 20;
+  e.count++;
+  assertEqual(a.x, 10);
+  assertEqual(d.x, 20);
+  assertEqual(e.count, 1);
+  assertEqual(sumX([a, b, c, d]), 38);
+
+  // Adding keys
+  e.extra = 'added';
+  b.z = 9;
+  assertEqual(e.extra, 'added');
+  assertEqual(e.name, 'e');
+  assertEqual(e.count, 1);
+  assertEqual(b.z, 9);
+  assertEqual(b.x, 3);
+  // The objects that still have the shape are not affected
+  assertEqual(c.z, undefined);
+  assertEqual(sumX([a, b, c, d]), 38);
+
+  // Keys are listed in the order they were added
+  const keys = Reflect.ownKeys(e);
+  assertEqual(keys.length, 3);
+  assertEqual(keys[0], 'name');
+  assertEqual(keys[1], 'count');
+  assertEqual(keys[2], 'extra');
+  assertEqual(Reflect.ownKeys(d)[0], 'y');
+
+  // The objects survive the heap being compacted
+  runGC();
+  assertEqual(sumX([a, b, c, d]), 38);
+  assertEqual(b.z, 9);
+  assertEqual(e.extra, 'added');
+  assertEqual(Reflect.ownKeys(c).length, 2);
+}
+
+// The same property access site sees each of the objects in turn
+function sumX(objects) {
+  let sum = 0;
+  for (const obj of objects) {
+    sum += obj.x;
+  }
+  return sum;
+}
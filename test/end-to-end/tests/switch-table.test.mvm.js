@@ -0,0 +1,128 @@
+/*---
+description: >
+  Tests switch statements whose case labels are all small integer literals,
+  which the bytecode emitter compiles to a jump table when the cases are dense
+  and to a sorted lookup table when they are sparse.
+runExportedFunction: 0
+assertionCount: 29
+---*/
+vmExport(0, run);
+
+function run() {
+  testDense();
+  testSparse();
+  testFallthrough();
+  testDefaultInMiddle();
+  testNoDefault();
+  testNonIntegerDiscriminant();
+  testDuplicateCase();
+}
+
+function dense(x) {
+  switch (x) {
+    case 0: return 'zero';
+    case 1: return 'one';
+    case 2: return 'two';
+    case 4: return 'four';
+    case -1: return 'minus one';
+    default: return 'other';
+  }
+}
+
+function testDense() {
+  assertEqual(dense(0), 'zero');
+  assertEqual(dense(1), 'one');
+  assertEqual(dense(2), 'two');
+  assertEqual(dense(3), 'other');
+  assertEqual(dense(4), 'four');
+  assertEqual(dense(5), 'other');
+  assertEqual(dense(-1), 'minus one');
+  assertEqual(dense(-2), 'other');
+}
+
+function sparse(x) {
+  switch (x) {
+    case 8000: return 'a';
+    case -100: return 'b';
+    case 3: return 'c';
+    case 500: return 'd';
+    default: return 'other';
+  }
+}
+
+function testSparse() {
+  assertEqual(sparse(8000), 'a');
+  assertEqual(sparse(-100), 'b');
+  assertEqual(sparse(3), 'c');
+  assertEqual(sparse(500), 'd');
+  assertEqual(sparse(4), 'other');
+  assertEqual(sparse(-8000), 'other');
+}
+
+function fallthrough(x) {
+  let s = '';
+  switch (x) {
+    case 1: s += 'a';
+    case 2: s += 'b';
+    case 3: s += 'c'; break;
+    case 4: s += 'd';
+  }
+  return s;
+}
+
+function testFallthrough() {
+  assertEqual(fallthrough(1), 'abc');
+  assertEqual(fallthrough(2), 'bc');
+  assertEqual(fallthrough(3), 'c');
+  assertEqual(fallthrough(4), 'd');
+  assertEqual(fallthrough(5), '');
+}
+
+function defaultInMiddle(x) {
+  let s = '';
+  switch (x) {
+    case 1: s += 'a';
+    default: s += 'x';
+    case 2: s += 'b'; break;
+    case 3: s += 'c';
+  }
+  return s;
+}
+
+function testDefaultInMiddle() {
+  assertEqual(defaultInMiddle(1), 'axb');
+  assertEqual(defaultInMiddle(2), 'b');
+  assertEqual(defaultInMiddle(3), 'c');
+  assertEqual(defaultInMiddle(4), 'xb');
+}
+
+function testNoDefault() {
+  let count = 0;
+  for (let i = 0; i < 10; i++) {
+    switch (i) {
+      case 2:
+      case 5:
+      case 7: count++;
+    }
+  }
+  assertEqual(count, 3);
+}
+
+// Only numbers that are strictly equal to a case label match
+function testNonIntegerDiscriminant() {
+  assertEqual(dense('1'), 'other');
+  assertEqual(dense(1.5), 'other');
+  assertEqual(dense(undefined), 'other');
+  assertEqual(dense(-0), 'zero');
+}
+
+function testDuplicateCase() {
+  let s = '';
+  switch (2) {
+    case 1: s += 'a'; break;
+    case 2: s += 'b'; break;
+    case 2: s += 'c'; break;
+    case 3: s += 'd'; break;
+  }
+  assertEqual(s, 'b');
+}
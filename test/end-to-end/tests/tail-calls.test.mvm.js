@@ -0,0 +1,84 @@
+/*---
+description: >
+  Tests `return f(...)` in tail position, which the bytecode emitter compiles
+  to a tail call that replaces the current frame. The recursion depths used
+  here would overflow the default 256-byte stack if each call pushed a frame.
+runExportedFunction: 0
+assertionCount: 9
+---*/
+vmExport(0, run);
+
+function run() {
+  testTailRecursion();
+  testMutualRecursion();
+  testResultUsedByCaller();
+  testVoidCall();
+  testClosureTarget();
+  testMethodTarget();
+  testHostTarget();
+}
+
+function sum(n, acc) {
+  if (n <= 0) return acc;
+  return sum(n - 1, acc + n);
+}
+
+// `isEven` and `isOdd` take different numbers of arguments, so each tail call
+// changes the size of the frame being replaced
+function isEven(n) {
+  if (n === 0) return true;
+  return isOdd(n - 1, 'unused');
+}
+
+function isOdd(n, unused) {
+  if (n === 0) return false;
+  return isEven(n - 1);
+}
+
+function testTailRecursion() {
+  assertEqual(sum(1000, 0), 500500);
+}
+
+function testMutualRecursion() {
+  assertEqual(isEven(1000), true);
+  assertEqual(isEven(999), false);
+}
+
+function testResultUsedByCaller() {
+  const x = 1 + sum(10, 0) + 1;
+  assertEqual(x, 57);
+}
+
+function testVoidCall() {
+  const before = 'before';
+  sum(1000, 0);
+  assertEqual(before, 'before');
+}
+
+function testClosureTarget() {
+  let count = 0;
+  const increment = () => ++count;
+  function callIt(f) {
+    return f();
+  }
+  callIt(increment);
+  assertEqual(callIt(increment), 2);
+}
+
+class Box {
+  constructor(value) { this.value = value; }
+  get() { return this.value; }
+  callGet() { return this.get(); }
+}
+
+function testMethodTarget() {
+  const box = new Box(5);
+  assertEqual(box.callGet(), 5);
+}
+
+function testHostTarget() {
+  function check(x) {
+    return assertEqual(x, 'host');
+  }
+  assertEqual(check('host'), undefined);
+}
@@ -0,0 +1,64 @@
+/*---
+description: >
+  Tests operations that the bytecode emitter specializes based on inferred
+  number types: `+` on numbers, and `<`/`<=` loop conditions on integers. The
+  loops include counters that leave the int14 and int32 ranges, which the fused
+  compare-and-branch instructions don't handle on their fast path.
+runExportedFunction: 0
+assertionCount: 9
+---*/
+vmExport(0, run);
+
+function run() {
+  testLoopPastInt14();
+  testLoopPastInt32();
+  testLessEqualLoop();
+  testNumberAdd();
+  testStringAddNotSpecialized();
+}
+
+function testLoopPastInt14() {
+  let count = 0;
+  for (let i = 8180; i < 8200; i++) {
+    count = count + 1;
+  }
+  assertEqual(count, 20);
+}
+
+function testLoopPastInt32() {
+  let count = 0;
+  let last = 0;
+  for (let i = 2147483640; i < 2147483650; i++) {
+    count = count + 1;
+    last = i;
+  }
+  assertEqual(count, 10);
+  assertEqual(last, 2147483649);
+}
+
+function testLessEqualLoop() {
+  let count = 0;
+  for (let i = -5; i <= 5; i++) {
+    count = count + 1;
+  }
+  assertEqual(count, 11);
+}
+
+function testNumberAdd() {
+  let x = 0.5;
+  let y = 3;
+  assertEqual(x + y, 3.5);
+  assertEqual(y + y, 6);
+  assertEqual(y + 8190, 8193);
+}
+
+function testStringAddNotSpecialized() {
+  let s = 1;
+  for (let i = 0; i < 2; i++) {
+    s = s + 'x';
+  }
+  assertEqual(s, '1xx');
+  let n = 1;
+  n = n + 2;
+  assertEqual(n + '', '3');
+}
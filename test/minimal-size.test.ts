@@ -201,7 +201,7 @@ suite('minimal-size', function () {
       vmExport(0, () => checkSize());
     `});
     const snapshot = vm.createSnapshot();
-    assert.equal(snapshot.data.length, 70);
+    assert.equal(snapshot.data.length, 66);
 
     const vm2 = Microvium.restore(snapshot, { 0: checkSize });
 
@@ -221,7 +221,7 @@ suite('minimal-size', function () {
     assert.equal(stats.virtualHeapUsed, virtualHeapSize);
     assert.equal(stats.virtualHeapHighWaterMark, virtualHeapSize);
     assert.equal(stats.stackHighWaterMark, 26);
-    assert.equal(stats.stackHeight, 18);
+    assert.equal(stats.stackHeight, 6);
     assert.equal(stats.stackAllocatedCapacity, defaultStackCapacity);
     assert.equal(stats.registersSize, registersSize64BitMax);
     assert.equal(stats.importTableSize, importTableSize64Bit);